@@ -19,6 +19,7 @@
 
 */
 #include <iostream>
+#include <algorithm>
 
 #include "../common/action.h"
 using common_ns::action_t;
@@ -526,4 +527,17 @@ void cmacro_t::addTerms(vterm_t *a_pvTerms, cond_item_t *a_pCond) {
 	}
 }
 
+// get macro terms of a case of macro, in the order they were added
+void cmacro_t::getTerms(int a_nIdx, vterm_t &a_vTerms) const {
+	
+	assert(a_nIdx >= 0 && a_nIdx < (int)m_vpnBody.size());
+	
+	a_vTerms.clear();
+	// terms are linked reversely
+	for(node_t *p = m_vpnBody[a_nIdx]; p; p = p->plink) {
+		a_vTerms.push_back(p->pterm);
+	}
+	std::reverse(a_vTerms.begin(), a_vTerms.end());
+}
+
 }
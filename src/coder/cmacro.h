@@ -141,11 +141,21 @@ public:
 
 public:
 	
+	inline cmacro_term_type getType(void) const {
+		
+		return m_nType;
+	}
+	
 	inline string getText(void) const {
 		
 		return m_strText;
 	}
 	
+	inline void setText(const string &a_strText) {
+		
+		m_strText = a_strText;
+	}
+	
 	inline vint_t& getParamIndexes(void) {
 		
 		return m_vnParams;
@@ -225,8 +235,21 @@ public:
 	 */ 
 	void addTerms(vterm_t *a_pvTerms, cond_item_t *a_pCond = nullptr);
 	
+	/*
+	 * get macro terms of a case of macro, in the order they were added
+	 * @a_nIdx: index of the case, its condition is m_conds.getCondItem(@a_nIdx)
+	 * @a_vTerms: macro terms
+	 */
+	void getTerms(int a_nIdx, vterm_t &a_vTerms) const;
+	
 public:
 	
+	inline const cond_t& getConds(void) const {
+		
+		return m_conds;
+	}
+	
+	
 	/*
 	 * add macro a term to macro
 	 * @a_pvTerms: macro term
@@ -39,6 +39,23 @@ namespace coder_ns {
 class cond_item_t {
 	
 public:
+	// kind of condition-item, by which it is saved to and loaded from SPEC cache
+	enum kind_t {
+		
+		CIK_EMPTY = 0,
+		CIK_END,
+		CIK_LAST,
+		CIK_MORE,
+		CIK_MOD,
+		CIK_GROUP,
+		CIK_GROUPFIRST,
+		CIK_ELEMREL,
+		CIK_OPTEQ,
+		CIK_COMPOUND
+	};
+	
+public:
+	virtual kind_t getKind(void) const = 0;
 	// check if macro condition is satified
 	// @a_map: data map
 	// @a_strKey: name of a key
@@ -68,6 +85,10 @@ public:
 	: m_bTestEmpty(a_bTestEmpty) {
 	}
 	
+	virtual kind_t getKind(void) const {
+		return CIK_EMPTY;
+	}
+	
 	virtual bool satisfied(const dmmap_t &a_map, const string &a_strKey) const {
 		
 		if(m_bTestEmpty) {
@@ -86,6 +107,10 @@ class cond_end_t: public cond_item_t {
 	
 public:
 	
+	virtual kind_t getKind(void) const {
+		return CIK_END;
+	}
+	
 	virtual bool satisfied(const dmmap_t &a_map, const string &a_strKey) const {
 		
 		return a_map.isEnd(a_strKey);
@@ -100,6 +125,10 @@ class cond_last_t: public cond_item_t {
 	
 public:
 	
+	virtual kind_t getKind(void) const {
+		return CIK_LAST;
+	}
+	
 	virtual bool satisfied(const dmmap_t &a_map, const string &a_strKey) const {
 		
 		return a_map.isLast(a_strKey);
@@ -114,6 +143,10 @@ class cond_more_t: public cond_item_t {
 	
 public:
 	
+	virtual kind_t getKind(void) const {
+		return CIK_MORE;
+	}
+	
 	virtual bool satisfied(const dmmap_t &a_map, const string &a_strKey) const {
 		
 		return a_map.isMore(a_strKey);
@@ -136,6 +169,14 @@ public:
 	: m_nElemsPerLine(a_nElemsPerLine) {
 	}
 	
+	virtual kind_t getKind(void) const {
+		return CIK_MOD;
+	}
+	
+	inline int getDivisor(void) const {
+		return m_nElemsPerLine;
+	}
+	
 	virtual bool satisfied(const dmmap_t &a_map, const string &a_strKey) const {
 		return a_map.isMod(a_strKey, m_nElemsPerLine);
 	}
@@ -148,6 +189,10 @@ class cond_group_t: public cond_item_t {
 	
 public:
 	
+	virtual kind_t getKind(void) const {
+		return CIK_GROUP;
+	}
+	
 	virtual bool satisfied(const dmmap_t &a_map, const string &a_strKey) const {
 		
 		return a_map.isGroupFlag(a_strKey);
@@ -160,6 +205,10 @@ public:
 class cond_groupfirst_t: public cond_item_t {
 	
 public:
+	virtual kind_t getKind(void) const {
+		return CIK_GROUPFIRST;
+	}
+	
 	virtual bool satisfied(const dmmap_t &a_map, const string &a_strKey) const {
 		
 		return a_map.isGroupFirst(a_strKey);
@@ -183,8 +232,6 @@ public:
 		EOP_GE
 	};
 	
-private:
-	
 	// value type
 	enum elemrel_type_t {
 		
@@ -236,6 +283,23 @@ public:
 	
 public:
 	
+	virtual kind_t getKind(void) const {
+		return CIK_ELEMREL;
+	}
+	
+	inline eop_t getOp(void) const {
+		return m_nOp;
+	}
+	inline elemrel_type_t getValType(void) const {
+		return m_nType;
+	}
+	inline int getInt(void) const {
+		return m_nVal;
+	}
+	inline const string& getStr(void) const {
+		return *m_pstrVal;
+	}
+	
 	virtual bool satisfied(const dmmap_t &a_map, const string &a_strKey) const {
 		
 		bool bret = false;
@@ -342,6 +406,7 @@ public:
  */
 class cond_opteq_t: public cond_item_t {
 	
+public:
 	// option value type
 	enum optval_type_t {
 		OVT_BOOL,
@@ -393,6 +458,23 @@ public:
 	
 public:
 	
+	virtual kind_t getKind(void) const {
+		return CIK_OPTEQ;
+	}
+	
+	inline const string& getOptionName(void) const {
+		return m_strOptionName;
+	}
+	inline optval_type_t getValType(void) const {
+		return m_nType;
+	}
+	inline int getInt(void) const {
+		return m_nVal;
+	}
+	inline const string& getStr(void) const {
+		return *m_pstrVal;
+	}
+	
 	virtual bool satisfied(const dmmap_t &a_map, const string &a_strKey) const {
 		
 		bool bret = false;
@@ -483,6 +565,14 @@ public:
 		}
 	}
 	
+	virtual kind_t getKind(void) const {
+		return CIK_COMPOUND;
+	}
+	
+	inline const vcond_item_t& getCondItems(void) const {
+		return m_vciConds;
+	}
+	
 	virtual bool satisfied(const dmmap_t &a_map, const string &a_strKey) const {
 		
 		for(int i = 0; i < (int)m_vciConds.size(); ++i) {
@@ -532,6 +622,11 @@ public:
 		return (int)m_vciConds.size();
 	}
 	
+	inline cond_item_t* getCondItem(int a_nIdx) const {
+		
+		return m_vciConds[a_nIdx];
+	}
+	
 private:
 	
 	vcond_item_t m_vciConds;
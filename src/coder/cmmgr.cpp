@@ -306,6 +306,29 @@ cmacro_term_t* cmacro_mgr_t::newMacroTerm(const string &a_strMacroName, const vi
 	return pterm;
 }
 
+// add macro term: its type is @CTT_TEXT, text of which is value of key @a_strKey
+cmacro_term_t* cmacro_mgr_t::newScalarTerm(const string &a_strKey) {
+	
+	// text is unknown yet, so the term is never shared
+	m_vScalarTerms.push_back(s2i_pair_t(a_strKey, (int)m_vcmTerms.size()));
+	m_vcmTerms.push_back(new cmacro_term_t("", 0, *this));
+	
+	return m_vcmTerms[m_vcmTerms.size() - 1];
+}
+
+// set text of macro terms added by newScalarTerm() with values in data map
+void cmacro_mgr_t::bindScalars(const dmmap_t &a_map) {
+	
+	string strVal;
+	for(int i = 0; i < (int)m_vScalarTerms.size(); ++i) {
+		
+		if( ! a_map.getString(m_vScalarTerms[i].first, strVal)) {
+			strVal.clear();
+		}
+		m_vcmTerms[m_vScalarTerms[i].second]->setText(strVal);
+	}
+}
+
 // add empty macro object, whose name is @a_strName
 cmacro_t* cmacro_mgr_t::newMacro(const string &a_strName) {
 	
@@ -372,4 +395,324 @@ bool cmacro_mgr_t::expandWithStack(const string &a_strMacro, dmmap_t &a_map, con
 	return bret;
 }
 
+// map a condition-item to its reference in SPEC cache
+int cmacro_mgr_t::getCondRef(const cond_item_t *a_pCond, const map<const cond_item_t*, int> &a_cond2Idx) const {
+	
+	if(nullptr == a_pCond) {
+		return -1;
+	}
+	const cond_item_t *ppBuiltIn[] = {&m_condHas, &m_condEmpty, &m_condEnd, &m_condLast,
+									&m_condMore, &m_condGroup, &m_condGroupFirst};
+	for(int i = 0; i < (int)(sizeof(ppBuiltIn) / sizeof(ppBuiltIn[0])); ++i) {
+		if(ppBuiltIn[i] == a_pCond) {
+			return -2 - i;
+		}
+	}
+	
+	map<const cond_item_t*, int>::const_iterator cit = a_cond2Idx.find(a_pCond);
+	assert(cit != a_cond2Idx.end());
+	return cit->second;
+}
+
+// map a reference in SPEC cache back to condition-item
+bool cmacro_mgr_t::getCondByRef(int a_nRef, cond_item_t *&a_pCond) {
+	
+	cond_item_t *ppBuiltIn[] = {&m_condHas, &m_condEmpty, &m_condEnd, &m_condLast,
+								&m_condMore, &m_condGroup, &m_condGroupFirst};
+	int nBuiltIn = (int)(sizeof(ppBuiltIn) / sizeof(ppBuiltIn[0]));
+	
+	if(-1 == a_nRef) {
+		a_pCond = nullptr;
+	}
+	else if(a_nRef < -1 && a_nRef >= -1 - nBuiltIn) {
+		a_pCond = ppBuiltIn[-2 - a_nRef];
+	}
+	else if(a_nRef >= 0 && a_nRef < (int)m_vcondItems.size()) {
+		a_pCond = m_vcondItems[a_nRef];
+	}
+	else {
+		return false;
+	}
+	return true;
+}
+
+// save macro terms, condition-items and macros to SPEC cache
+void cmacro_mgr_t::save(binwriter_t &a_bw) const {
+	
+	// macro terms are referred to by index, built-in ones by negative index
+	map<const cmacro_term_t*, int> term2Ref;
+	for(int i = 0; i < ATOMIC_MACRO_NUM; ++i) {
+		term2Ref[m_pmAtomicMacro[i]] = -1 - i;
+	}
+	
+	a_bw.writeInt((int)m_vcmTerms.size());
+	for(int i = 0; i < (int)m_vcmTerms.size(); ++i) {
+		
+		term2Ref[m_vcmTerms[i]] = i;
+		a_bw.writeInt(m_vcmTerms[i]->getType());
+		a_bw.writeStr(m_vcmTerms[i]->getText());
+		a_bw.writeInts(m_vcmTerms[i]->getParamIndexes());
+	}
+	
+	a_bw.writeInt((int)m_vScalarTerms.size());
+	for(int i = 0; i < (int)m_vScalarTerms.size(); ++i) {
+		
+		a_bw.writeStr(m_vScalarTerms[i].first);
+		a_bw.writeInt(m_vScalarTerms[i].second);
+	}
+	
+	map<const cond_item_t*, int> cond2Idx;
+	for(int i = 0; i < (int)m_vcondItems.size(); ++i) {
+		cond2Idx[m_vcondItems[i]] = i;
+	}
+	
+	a_bw.writeInt((int)m_vcondItems.size());
+	for(int i = 0; i < (int)m_vcondItems.size(); ++i) {
+		
+		const cond_item_t *pcond = m_vcondItems[i];
+		a_bw.writeInt(pcond->getKind());
+		
+		switch(pcond->getKind()) {
+		
+		case cond_item_t::CIK_MOD:
+			
+			a_bw.writeInt(((const cond_mod_t*)pcond)->getDivisor());
+			break;
+			
+		case cond_item_t::CIK_ELEMREL: {
+			
+			const cond_elemrel_t *per = (const cond_elemrel_t*)pcond;
+			a_bw.writeInt(per->getOp());
+			a_bw.writeInt(per->getValType());
+			if(cond_elemrel_t::EVT_PSTR == per->getValType()) {
+				a_bw.writeStr(per->getStr());
+			}
+			else {
+				a_bw.writeInt(per->getInt());
+			}
+		}
+			break;
+			
+		case cond_item_t::CIK_OPTEQ: {
+			
+			const cond_opteq_t *poe = (const cond_opteq_t*)pcond;
+			a_bw.writeStr(poe->getOptionName());
+			a_bw.writeInt(poe->getValType());
+			if(cond_opteq_t::OVT_PSTR == poe->getValType()) {
+				a_bw.writeStr(poe->getStr());
+			}
+			else {
+				a_bw.writeInt(poe->getInt());
+			}
+		}
+			break;
+			
+		case cond_item_t::CIK_COMPOUND: {
+			
+			const vcond_item_t &vItems = ((const cond_compound_t*)pcond)->getCondItems();
+			vint_t vnRefs;
+			for(int j = 0; j < (int)vItems.size(); ++j) {
+				vnRefs.push_back(getCondRef(vItems[j], cond2Idx));
+			}
+			a_bw.writeInts(vnRefs);
+		}
+			break;
+			
+		default:
+			// built-in condition-items are only referred to
+			assert(false);
+			break;
+		}
+	}
+	
+	vterm_t vTerms;
+	vint_t vnRefs;
+	a_bw.writeInt((int)m_str2Macro.size());
+	for(str2mac_cit_t cit = m_str2Macro.begin(); cit != m_str2Macro.end(); ++cit) {
+		
+		const cmacro_t *pmac = (const cmacro_t*)cit->second;
+		const cond_t &conds = pmac->getConds();
+		
+		a_bw.writeStr(cit->first);
+		a_bw.writeInt(conds.size());
+		for(int i = 0; i < conds.size(); ++i) {
+			
+			a_bw.writeInt(getCondRef(conds.getCondItem(i), cond2Idx));
+			
+			pmac->getTerms(i, vTerms);
+			vnRefs.clear();
+			for(int j = 0; j < (int)vTerms.size(); ++j) {
+				vnRefs.push_back(term2Ref[vTerms[j]]);
+			}
+			a_bw.writeInts(vnRefs);
+		}
+	}
+}
+
+// load macro terms, condition-items and macros from SPEC cache
+bool cmacro_mgr_t::load(binreader_t &a_br) {
+	
+	assert(m_vcmTerms.empty() && m_vcondItems.empty());
+	
+	string str;
+	vint_t vn;
+	
+	int nTerms = a_br.readCount(3 * sizeof(int));
+	for(int i = 0; i < nTerms; ++i) {
+		
+		int nType = a_br.readInt();
+		a_br.readStr(str);
+		a_br.readInts(vn);
+		
+		if(CTT_TEXT == nType && 1 == vn.size()) {
+			m_vcmTerms.push_back(new cmacro_term_t(str, vn[0], *this));
+		}
+		else if(CTT_MACRO == nType) {
+			
+			cmacro_term_t *pterm = new cmacro_term_t(str, *this);
+			pterm->getParamIndexes() = vn;
+			m_vcmTerms.push_back(pterm);
+		}
+		else {
+			return false;
+		}
+	}
+	
+	int nScalars = a_br.readCount(2 * sizeof(int));
+	for(int i = 0; i < nScalars; ++i) {
+		
+		a_br.readStr(str);
+		int nIdx = a_br.readInt();
+		if(nIdx < 0 || nIdx >= (int)m_vcmTerms.size()) {
+			return false;
+		}
+		m_vScalarTerms.push_back(s2i_pair_t(str, nIdx));
+	}
+	
+	// items of compound condition-items may come after them,
+	// so they are filled after all condition-items are created
+	vector<pair<cond_compound_t*, vint_t> > vCompounds;
+	
+	int nConds = a_br.readCount(sizeof(int));
+	for(int i = 0; i < nConds; ++i) {
+		
+		switch(a_br.readInt()) {
+		
+		case cond_item_t::CIK_MOD:
+			
+			newModCond(a_br.readInt());
+			break;
+			
+		case cond_item_t::CIK_ELEMREL: {
+			
+			int nOp = a_br.readInt();
+			int nValType = a_br.readInt();
+			if(nOp < cond_elemrel_t::EOP_EQ || nOp > cond_elemrel_t::EOP_GE) {
+				return false;
+			}
+			
+			cond_elemrel_t::eop_t op = (cond_elemrel_t::eop_t)nOp;
+			if(cond_elemrel_t::EVT_PSTR == nValType) {
+				
+				a_br.readStr(str);
+				newERelCond(op, str);
+			}
+			else if(cond_elemrel_t::EVT_BOOL == nValType) {
+				newERelCond(op, TRUE == a_br.readInt());
+			}
+			else if(cond_elemrel_t::EVT_INT == nValType) {
+				newERelCond(op, a_br.readInt());
+			}
+			else {
+				return false;
+			}
+		}
+			break;
+			
+		case cond_item_t::CIK_OPTEQ: {
+			
+			string strName;
+			a_br.readStr(strName);
+			int nValType = a_br.readInt();
+			if(cond_opteq_t::OVT_PSTR == nValType) {
+				
+				a_br.readStr(str);
+				newOptCond(strName, str);
+			}
+			else if(cond_opteq_t::OVT_BOOL == nValType) {
+				newOptCond(strName, TRUE == a_br.readInt());
+			}
+			else if(cond_opteq_t::OVT_INT == nValType) {
+				newOptCond(strName, a_br.readInt());
+			}
+			else {
+				return false;
+			}
+		}
+			break;
+			
+		case cond_item_t::CIK_COMPOUND:
+			
+			vCompounds.push_back(std::make_pair(newCompoundCond(), vint_t()));
+			a_br.readInts(vCompounds.back().second);
+			break;
+			
+		default:
+			return false;
+		}
+	}
+	
+	cond_item_t *pcond;
+	for(int i = 0; i < (int)vCompounds.size(); ++i) {
+		
+		const vint_t &vnRefs = vCompounds[i].second;
+		for(int j = 0; j < (int)vnRefs.size(); ++j) {
+			
+			if( ! getCondByRef(vnRefs[j], pcond)) {
+				return false;
+			}
+			vCompounds[i].first->addCondItem(pcond);
+		}
+	}
+	
+	vterm_t vTerms;
+	int nMacros = a_br.readCount(2 * sizeof(int));
+	for(int i = 0; i < nMacros; ++i) {
+		
+		a_br.readStr(str);
+		// built-in macros are there since construction
+		cmacro_t *pmac = getMacro(str)? nullptr : newMacro(str);
+		
+		int nCases = a_br.readCount(2 * sizeof(int));
+		for(int j = 0; j < nCases; ++j) {
+			
+			int nCondRef = a_br.readInt();
+			a_br.readInts(vn);
+			if( ! pmac) {
+				continue;
+			}
+			
+			if(vn.empty() || ! getCondByRef(nCondRef, pcond)) {
+				return false;
+			}
+			vTerms.clear();
+			for(int k = 0; k < (int)vn.size(); ++k) {
+				
+				if(vn[k] >= 0 && vn[k] < (int)m_vcmTerms.size()) {
+					vTerms.push_back(m_vcmTerms[vn[k]]);
+				}
+				else if(vn[k] < 0 && vn[k] >= -ATOMIC_MACRO_NUM) {
+					vTerms.push_back(m_pmAtomicMacro[-1 - vn[k]]);
+				}
+				else {
+					return false;
+				}
+			}
+			pmac->addTerms(&vTerms, pcond);
+		}
+	}
+	
+	return a_br.isGood();
+}
+
 }
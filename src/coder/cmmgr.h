@@ -45,6 +45,10 @@ using std::iterator;
 #include "./cmacro.h"
 #include "./dmmap.h"
 
+#include "../common/binstream.h"
+using common_ns::binwriter_t;
+using common_ns::binreader_t;
+
 #define MAX_TEXT_COMPARE_SIZE		20
 
 namespace coder_ns {
@@ -72,6 +76,8 @@ private:
 	s2i_map_t m_str2TermIdx;
 	// array of macro terms
 	vterm_t m_vcmTerms;
+	// terms taking value of a key in data map: key --> index to array of macro terms
+	vector<s2i_pair_t> m_vScalarTerms;
 	
 	// map table: macro name --> macro object
 	str2mac_map_t m_str2Macro;
@@ -103,6 +109,11 @@ private:
 	// otherwise return nullptr
 	cmacro_term_t* tryBuildInMacro(const string &a_strMacroName);
 	
+	// map a condition-item to its reference in SPEC cache, and back:
+	// -1 for nullptr, -2 to -8 for built-in ones, and index to @m_vcondItems otherwise
+	int getCondRef(const cond_item_t *a_pCond, const map<const cond_item_t*, int> &a_cond2Idx) const;
+	bool getCondByRef(int a_nRef, cond_item_t *&a_pCond);
+	
 public:
 
 	// test macro expansion conditions
@@ -121,6 +132,11 @@ public:
 	cmacro_term_t* newMacroTerm(const string &a_strMacroName);
 	// add macro term: its type is @CTT_MACRO
 	cmacro_term_t* newMacroTerm(const string &a_strMacroName, const vint_t &a_vnParams);
+	// add macro term: its type is @CTT_TEXT, text of which is value of key @a_strKey,
+	// and is not known until bindScalars() is called
+	cmacro_term_t* newScalarTerm(const string &a_strKey);
+	// set text of macro terms added by newScalarTerm() with values in data map
+	void bindScalars(const dmmap_t &a_map);
 	// add empty macro object, whose name is @a_strName
 	cmacro_t* newMacro(const string &a_strName);
 	
@@ -129,6 +145,12 @@ public:
 	// expand macros using stack
 	bool expandWithStack(const string &a_strMacro, dmmap_t &a_map, const vstr_t &a_vstrKeys, ostream& os);
 	
+	// save macro terms, condition-items and macros to SPEC cache
+	void save(binwriter_t &a_bw) const;
+	// load macro terms, condition-items and macros from SPEC cache,
+	// the manager is supposed to be newly constructed
+	bool load(binreader_t &a_br);
+	
 public:
 	
 	inline cond_empty_t* getHasCond(void) {
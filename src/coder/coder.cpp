@@ -33,8 +33,8 @@ using common_ns::filehelper_t;
 #include "./coder.h"
 #include "./dmmap.h"
 #include "./cmmgr.h"
-#include "../gcode/coderyac.h"
-using namespace coder_nsx;
+#include "./cspec.h"
+#include "../common/profiler.h"
 
 namespace coder_ns {
 
@@ -163,34 +163,224 @@ bool coder_t::openStream(dmmap_t &dmap) {
 	return true;
 }
 
+// get language SPEC compiled, or loaded from SPEC cache if it is enabled
+// @a_strSpec: language SPEC in form of string buffer
+// @a_nSize: size of @a_strSpec, including ending nullptr
+// @return-value: compiled SPEC, which is deleted by caller, or nullptr if it fails
+cspec_t* coder_t::getSpec(const char *a_strSpec, int a_nSize) {
+	
+	_PROFILE_PHASE("spec");
+	
+	cspec_t *pspec = new cspec_t;
+	if( ! m_gSetup.m_pchSpecCache) {
+		
+		if( ! pspec->compile(a_strSpec, a_nSize)) {
+			
+			delete pspec;
+			return nullptr;
+		}
+		return pspec;
+	}
+	
+	unsigned long long nHash = cspec_t::hash(a_strSpec, a_nSize);
+	string strCache = cspec_t::getCacheName(m_gSetup.m_pchSpecCache, nHash);
+	
+	if(pspec->load(strCache, nHash)) {
+		
+		_PROFILE_COUNT("cache hits", 1);
+		return pspec;
+	}
+	
+	// cache file is missing, or stale, start over with a new object
+	delete pspec;
+	pspec = new cspec_t;
+	if( ! pspec->compile(a_strSpec, a_nSize)) {
+		
+		delete pspec;
+		return nullptr;
+	}
+	_PROFILE_COUNT("cache hits", 0);
+	
+	if( ! pspec->save(strCache, nHash)) {
+		
+		string strMsg = "failed to write SPEC cache file `";
+		strMsg += strCache;
+		strMsg += "\'.";
+		_WARNING(strMsg);
+	}
+	return pspec;
+}
+
+// run program section of compiled SPEC to generate code
+bool coder_t::execute(cspec_t &a_spec) {
+	
+	const vs2s_pair_t &vSetupItems = a_spec.getSetupItems();
+	for(int i = 0; i < (int)vSetupItems.size(); ++i) {
+		
+		if( ! addSetupItem(vSetupItems[i].first, vSetupItems[i].second)) {
+			
+			string strMsg = " description: setting item `";
+			strMsg += vSetupItems[i].first;
+			strMsg += "\' already exists, this setting is discarded.";
+			_WARNING(strMsg);
+		}
+	}
+	
+	if( ! openStream(m_dmap)) {
+		return false;
+	}
+	
+	cmacro_mgr_t &cmmgr = a_spec.getMacroMgr();
+	cmmgr.bindScalars(m_dmap);
+	
+	switchToDef();
+	
+	const vinst_t &vInsts = a_spec.getInsts();
+	// condition of <If> being tested, and conditions of <If> or <Else> entered
+	bool bTest = true;
+	vbool_t vbConds;
+	// condition of <If> just ended
+	bool bLast = true;
+	
+	for(int i = 0; i < (int)vInsts.size(); ++i) {
+		
+		const cinst_t &inst = vInsts[i];
+		switch(inst.m_nType) {
+		
+		case CIT_TEXT:
+			
+			if( ! isThrowAway()) {
+				
+				getStream() << inst.m_strText;
+				m_dmap.addSrcLineNo(inst.m_nVal);
+			}
+			break;
+			
+		case CIT_CALL:
+			
+			if( ! isThrowAway()) {
+				cmmgr.expandWithStack(inst.m_strText, m_dmap,
+						inst.m_vstrParams.empty()? cmmgr.getEmptyParam() : inst.m_vstrParams, getStream());
+			}
+			break;
+			
+		case CIT_DECLARE:
+			
+			if( ! isThrowAway()) {
+				switchToDecl();
+			}
+			break;
+			
+		case CIT_DEFINE:
+			
+			if(isCondTrue()) {
+				switchToDef();
+			}
+			break;
+			
+		// items inside a block thrown away are never satisfied
+		case CIT_TEST_BOOL:
+			
+			bTest = ( ! isThrowAway() && cmmgr.testCond(m_dmap, inst.m_strText, TRUE == inst.m_nVal)) && bTest;
+			break;
+			
+		case CIT_TEST_INT:
+			
+			bTest = ( ! isThrowAway() && cmmgr.testCond(m_dmap, inst.m_strText, inst.m_nVal)) && bTest;
+			break;
+			
+		case CIT_TEST_STR:
+			
+			bTest = ( ! isThrowAway() && cmmgr.testCond(m_dmap, inst.m_strText, inst.m_strVal)) && bTest;
+			break;
+			
+		case CIT_TEST_NOT:
+			
+			bTest = ( ! isThrowAway() && ! cmmgr.testCond(m_dmap, inst.m_strText, true)) && bTest;
+			break;
+			
+		case CIT_TEST_HAS:
+			
+			bTest = ( ! isThrowAway() && cmmgr.testHas(m_dmap, inst.m_strText)) && bTest;
+			break;
+			
+		case CIT_TEST_EMPTY:
+			
+			bTest = ( ! isThrowAway() && cmmgr.testEmpty(m_dmap, inst.m_strText)) && bTest;
+			break;
+			
+		case CIT_IF:
+			
+			vbConds.push_back(bTest);
+			addIPCond(bTest);
+			bTest = true;
+			break;
+			
+		case CIT_ENDIF:
+			
+			bLast = vbConds.back();
+			vbConds.pop_back();
+			subIPCond(bLast);
+			break;
+			
+		case CIT_ELSE:
+			
+			vbConds.push_back( ! bLast);
+			addIPCond( ! bLast);
+			break;
+			
+		default:	// case CIT_ENDELSE:
+			
+			subIPCond(vbConds.back());
+			vbConds.pop_back();
+			break;
+		}
+	}
+	
+	flush();
+	
+	return true;
+}
+
 // generate code
 // @a_inFileName: name of language SPEC file
 // @a_outFileName: name of outputted file
 bool coder_t::gencode(const string &a_inFileName, const string &a_outFileName) {
 
-	cmacro_mgr_t cmmgr;
 	m_dmap.buildMap(m_dTbl, m_pTbl, m_gSetup);
 	
 	m_strDefName = a_outFileName;
 	
-	bool bret = false;
-	
-	do {
-	
-        if(0 != coder_nsx::yylexfile(a_inFileName.c_str(), false)) {
+	cspec_t *pspec = nullptr;
+	if(m_gSetup.m_pchSpecCache) {
+		
+		// text of SPEC is needed to look it up in cache
+		string strSpec;
+		if( ! filehelper_t::readFile(a_inFileName, strSpec)) {
+			
 			_ERROR("failed to SPEC file.", ECMD(11));
-			break;
+			return false;
 		}
-	
-        if(0 != coder_nsx::yyparse(*this, m_dmap, cmmgr)) {
+		pspec = getSpec(strSpec.c_str(), (int)strSpec.size() + 1);
+	}
+	else {
+		
+		_PROFILE_PHASE("spec");
+		pspec = new cspec_t;
+		if( ! pspec->compile(a_inFileName)) {
 			
-			break;
+			delete pspec;
+			pspec = nullptr;
 		}
-		
-		bret = true;
-		
-	}while(0);
-
+	}
+	
+	if( ! pspec) {
+		return false;
+	}
+	
+	bool bret = execute(*pspec);
+	delete pspec;
+	
 	return bret;
 }
 
@@ -200,31 +390,18 @@ bool coder_t::gencode(const string &a_inFileName, const string &a_outFileName) {
 // @a_outFileName: name of outputted file
 bool coder_t::gencode(char *a_strSpec, int a_nSize, const string &a_outFileName) {
 	
-	cmacro_mgr_t cmmgr;
-	dmmap_t dmap;
 	m_dmap.buildMap(m_dTbl, m_pTbl, m_gSetup);
 	
 	m_strDefName = a_outFileName;
 	
-	bool bret = false;
+	cspec_t *pspec = getSpec(a_strSpec, a_nSize);
+	if( ! pspec) {
+		return false;
+	}
 	
-	do {
-
-        if(0 != coder_nsx::yylexstr(a_strSpec, a_nSize)) {
-			
-			_ERROR("failed to open buffer", ECMD(11));
-			break;	
-		}
+	bool bret = execute(*pspec);
+	delete pspec;
 	
-        if(0 != coder_nsx::yyparse(*this, m_dmap,cmmgr)) {
-			
-			break;
-		}
-		
-		bret = true;
-		
-	}while(0);
-
 	return bret;
 }
 
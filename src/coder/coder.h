@@ -42,6 +42,9 @@ using parser_ns::ptable_t;
 #include "./dmmap.h"
 
 namespace coder_ns {
+
+class cspec_t;
+
 // code generator class
 class coder_t {
 	
@@ -72,9 +75,19 @@ private:
 	
 private:
 	
-	// temporary variables used only in the process of parsing
+	// temporary variables used only in the process of running program section of SPEC
 	int mt_nFalses;
 	bool mt_bsentoTrash;
+	
+private:
+	
+	// get language SPEC compiled, or loaded from SPEC cache if it is enabled
+	// @a_strSpec: language SPEC in form of string buffer
+	// @a_nSize: size of @a_strSpec, including ending nullptr
+	// @return-value: compiled SPEC, which is deleted by caller, or nullptr if it fails
+	cspec_t* getSpec(const char *a_strSpec, int a_nSize);
+	// run program section of compiled SPEC to generate code
+	bool execute(cspec_t &a_spec);
 
 public:
 	
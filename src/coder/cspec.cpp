@@ -0,0 +1,210 @@
+/*
+    Upgen -- a scanner and parser generator.
+    Copyright (C) 2009-2018 Bruce Wu
+    
+    This file is a part of Upgen program
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+
+#include <cstdio>
+#include <fstream>
+using std::ofstream;
+
+#if defined(_WIN32)
+#include <process.h>
+#define getpid		_getpid
+#else
+#include <unistd.h>
+#endif
+
+#include "../common/reporter.h"
+#include "../common/filehelper.h"
+using common_ns::filehelper_t;
+#include "../common/strhelper.h"
+using common_ns::strhelper_t;
+
+#include "./cspec.h"
+#include "../gcode/coderyac.h"
+
+// `UPGS' in little-endian, a cache file of other byte order does not match it
+#define CSPEC_CACHE_MAGIC		0x53475055
+// to be increased whenever layout of cache file changes
+#define CSPEC_CACHE_VERSION		1
+
+namespace coder_ns {
+
+// compile language SPEC
+// @a_strFile: name of SPEC file
+bool cspec_t::compile(const string &a_strFile) {
+	
+	if(0 != coder_nsx::yylexfile(a_strFile.c_str(), false)) {
+		_ERROR("failed to SPEC file.", ECMD(11));
+		return false;
+	}
+	
+	return 0 == coder_nsx::yyparse(*this, m_cmMgr);
+}
+
+// @a_strSpec: SPEC in form of string buffer
+// @a_nSize: size of @a_strSpec, including ending nullptr
+bool cspec_t::compile(const char *a_strSpec, int a_nSize) {
+	
+	if(0 != coder_nsx::yylexcstr(a_strSpec, a_nSize)) {
+		_ERROR("failed to open buffer", ECMD(11));
+		return false;
+	}
+	
+	return 0 == coder_nsx::yyparse(*this, m_cmMgr);
+}
+
+// hash of text of SPEC: 64-bit FNV-1a
+unsigned long long cspec_t::hash(const char *a_strSpec, int a_nSize) {
+	
+	unsigned long long nHash = 14695981039346656037ULL;
+	for(int i = 0; i < a_nSize; ++i) {
+		
+		nHash ^= (unsigned char)a_strSpec[i];
+		nHash *= 1099511628211ULL;
+	}
+	return nHash;
+}
+
+// name of cache file in directory @a_strDir for SPEC of hash @a_nHash
+string cspec_t::getCacheName(const string &a_strDir, unsigned long long a_nHash) {
+	
+	char pchName[40];
+	snprintf(pchName, sizeof(pchName), "upgen-%016llx.spec", a_nHash);
+	
+	string strName = a_strDir;
+	if( ! strName.empty() && '/' != strName[strName.size() - 1]) {
+		strName += '/';
+	}
+	strName += pchName;
+	
+	return strName;
+}
+
+// save compiled SPEC to cache file @a_strFile
+bool cspec_t::save(const string &a_strFile, unsigned long long a_nHash) const {
+	
+	binwriter_t bw;
+	
+	bw.writeInt((int)m_vSetupItems.size());
+	for(int i = 0; i < (int)m_vSetupItems.size(); ++i) {
+		
+		bw.writeStr(m_vSetupItems[i].first);
+		bw.writeStr(m_vSetupItems[i].second);
+	}
+	
+	m_cmMgr.save(bw);
+	
+	bw.writeInt((int)m_vInsts.size());
+	for(int i = 0; i < (int)m_vInsts.size(); ++i) {
+		
+		const cinst_t &inst = m_vInsts[i];
+		bw.writeInt(inst.m_nType);
+		bw.writeInt(inst.m_nVal);
+		bw.writeStr(inst.m_strText);
+		bw.writeStr(inst.m_strVal);
+		bw.writeStrs(inst.m_vstrParams);
+	}
+	
+	// header: what the cache file is for, and hash of its body to detect broken ones
+	const string &strBody = bw.getBuffer();
+	binwriter_t bwHead;
+	bwHead.writeInt(CSPEC_CACHE_MAGIC);
+	bwHead.writeInt(CSPEC_CACHE_VERSION);
+	bwHead.writeUInt64(a_nHash);
+	bwHead.writeUInt64(hash(strBody.data(), (int)strBody.size()));
+	
+	// write to a file of its own and rename it, so that other processes
+	// sharing the cache never see a cache file partly written
+	string strTemp = a_strFile;
+	strTemp += '.';
+	strTemp += strhelper_t::fromInt((int)getpid());
+	
+	ofstream ofs(strTemp.c_str(), std::ios::out | std::ios::binary);
+	if( ! ofs) {
+		return false;
+	}
+	ofs.write(bwHead.getBuffer().data(), bwHead.getBuffer().size());
+	ofs.write(strBody.data(), strBody.size());
+	ofs.close();
+	
+	if( ! ofs || 0 != std::rename(strTemp.c_str(), a_strFile.c_str())) {
+		
+		std::remove(strTemp.c_str());
+		return false;
+	}
+	return true;
+}
+
+// load compiled SPEC from cache file @a_strFile
+bool cspec_t::load(const string &a_strFile, unsigned long long a_nHash) {
+	
+	string strBuf;
+	if( ! filehelper_t::readFile(a_strFile, strBuf)) {
+		return false;
+	}
+	
+	const int nHeadSize = 2 * sizeof(int) + 2 * sizeof(unsigned long long);
+	if(strBuf.size() < (size_t)nHeadSize) {
+		return false;
+	}
+	
+	binreader_t brHead(strBuf.data(), nHeadSize);
+	if(CSPEC_CACHE_MAGIC != brHead.readInt()
+			|| CSPEC_CACHE_VERSION != brHead.readInt()
+			|| a_nHash != brHead.readUInt64()
+			|| hash(strBuf.data() + nHeadSize, (int)strBuf.size() - nHeadSize) != brHead.readUInt64()) {
+		return false;
+	}
+	
+	binreader_t br(strBuf.data() + nHeadSize, strBuf.size() - nHeadSize);
+	
+	int nItems = br.readCount(2 * sizeof(int));
+	m_vSetupItems.resize(nItems);
+	for(int i = 0; i < nItems; ++i) {
+		
+		br.readStr(m_vSetupItems[i].first);
+		br.readStr(m_vSetupItems[i].second);
+	}
+	
+	if( ! m_cmMgr.load(br)) {
+		return false;
+	}
+	
+	int nInsts = br.readCount(5 * sizeof(int));
+	m_vInsts.reserve(nInsts);
+	for(int i = 0; i < nInsts; ++i) {
+		
+		int nType = br.readInt();
+		if(nType < CIT_TEXT || nType > CIT_ENDELSE) {
+			return false;
+		}
+		
+		m_vInsts.push_back(cinst_t((cinst_type_t)nType, br.readInt()));
+		cinst_t &inst = m_vInsts.back();
+		br.readStr(inst.m_strText);
+		br.readStr(inst.m_strVal);
+		br.readStrs(inst.m_vstrParams);
+	}
+	
+	return br.isGood() && br.isEnd();
+}
+
+}
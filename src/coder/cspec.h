@@ -0,0 +1,226 @@
+/*
+    Upgen -- a scanner and parser generator.
+    Copyright (C) 2009-2018 Bruce Wu
+    
+    This file is a part of Upgen program
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+
+#ifndef CODER_CSPEC_H__
+#define CODER_CSPEC_H__
+
+#include <string>
+using std::string;
+#include <vector>
+using std::vector;
+
+#include "../common/types.h"
+#include "./cmmgr.h"
+
+// compiled language SPEC: what the SPEC parser gets out of a SPEC, namely setting items,
+// macros, and program section as a list of instructions; the program section depends on
+// data map, so it is run by coder_t for each script, while the compiled SPEC only depends
+// on text of SPEC, and can be saved to and loaded from a SPEC cache file
+
+namespace coder_ns {
+
+// type of instruction of program section
+enum cinst_type_t {
+	
+	// output text @m_strText, which is @m_nVal lines long
+	CIT_TEXT = 0,
+	// expand macro @m_strText with parameters @m_vstrParams, or without parameters if it is empty
+	CIT_CALL,
+	// <Declare/>: output code to declaration file
+	CIT_DECLARE,
+	// <Define/>: output code to definition file
+	CIT_DEFINE,
+	
+	// test an item of condition of <If>, all items of the condition are ANDed
+	// option @m_strText is equal to boolean value @m_nVal
+	CIT_TEST_BOOL,
+	// option @m_strText is equal to integer @m_nVal
+	CIT_TEST_INT,
+	// option @m_strText is equal to string @m_strVal
+	CIT_TEST_STR,
+	// option @m_strText is not true
+	CIT_TEST_NOT,
+	// value of key @m_strText is not empty
+	CIT_TEST_HAS,
+	// value of key @m_strText is empty
+	CIT_TEST_EMPTY,
+	
+	// <If ...>: begin of block output only if condition tested so far holds
+	CIT_IF,
+	// </If>
+	CIT_ENDIF,
+	// <Else>: begin of block output only if condition of the <If> just ended fails
+	CIT_ELSE,
+	// </Else>
+	CIT_ENDELSE
+};
+
+// instruction of program section
+struct cinst_t {
+	
+	cinst_type_t m_nType;
+	int m_nVal;
+	string m_strText;
+	string m_strVal;
+	vstr_t m_vstrParams;
+	
+	inline cinst_t(cinst_type_t a_nType, int a_nVal = 0)
+	: m_nType(a_nType)
+	, m_nVal(a_nVal) {
+	}
+};
+
+typedef vector<cinst_t> vinst_t;
+typedef vector<s2s_pair_t> vs2s_pair_t;
+
+// compiled language SPEC
+class cspec_t {
+	
+private:
+	
+	// setting items of SPEC, in order of appearance
+	vs2s_pair_t m_vSetupItems;
+	// macros of SPEC
+	cmacro_mgr_t m_cmMgr;
+	// program section of SPEC
+	vinst_t m_vInsts;
+	
+private:
+	
+	cspec_t(const cspec_t&);
+	cspec_t& operator=(const cspec_t&);
+	
+public:
+	
+	inline cspec_t(void) {
+	}
+	
+public:
+	
+	// compile language SPEC
+	// @a_strFile: name of SPEC file
+	bool compile(const string &a_strFile);
+	// @a_strSpec: SPEC in form of string buffer
+	// @a_nSize: size of @a_strSpec, including ending nullptr
+	bool compile(const char *a_strSpec, int a_nSize);
+	
+	// hash of text of SPEC, which names its cache file
+	static unsigned long long hash(const char *a_strSpec, int a_nSize);
+	// name of cache file in directory @a_strDir for SPEC of hash @a_nHash
+	static string getCacheName(const string &a_strDir, unsigned long long a_nHash);
+	
+	// save compiled SPEC to cache file @a_strFile, it must not be run yet
+	bool save(const string &a_strFile, unsigned long long a_nHash) const;
+	// load compiled SPEC from cache file @a_strFile, which fails if the file is missing,
+	// broken, written by other version of program, or for other SPEC than of hash @a_nHash;
+	// object is supposed to be newly constructed, and be discarded if it fails
+	bool load(const string &a_strFile, unsigned long long a_nHash);
+	
+public:
+	
+	inline const vs2s_pair_t& getSetupItems(void) const {
+		return m_vSetupItems;
+	}
+	inline cmacro_mgr_t& getMacroMgr(void) {
+		return m_cmMgr;
+	}
+	inline const vinst_t& getInsts(void) const {
+		return m_vInsts;
+	}
+	
+public:
+	
+	// used by SPEC parser
+	
+	inline void addSetupItem(const string &a_strKey, const string &a_strVal) {
+		m_vSetupItems.push_back(s2s_pair_t(a_strKey, a_strVal));
+	}
+	
+	inline void addText(const string &a_strText, int a_nLines) {
+		
+		m_vInsts.push_back(cinst_t(CIT_TEXT, a_nLines));
+		m_vInsts.back().m_strText = a_strText;
+	}
+	inline void addCall(const string &a_strMacro, const vstr_t *a_pvstrParams) {
+		
+		m_vInsts.push_back(cinst_t(CIT_CALL));
+		m_vInsts.back().m_strText = a_strMacro;
+		if(a_pvstrParams) {
+			m_vInsts.back().m_vstrParams = *a_pvstrParams;
+		}
+	}
+	inline void addDeclare(void) {
+		m_vInsts.push_back(cinst_t(CIT_DECLARE));
+	}
+	inline void addDefine(void) {
+		m_vInsts.push_back(cinst_t(CIT_DEFINE));
+	}
+	
+	inline void addTestCond(const string &a_strKey, bool a_bVal) {
+		
+		m_vInsts.push_back(cinst_t(CIT_TEST_BOOL, a_bVal));
+		m_vInsts.back().m_strText = a_strKey;
+	}
+	inline void addTestCond(const string &a_strKey, int a_nVal) {
+		
+		m_vInsts.push_back(cinst_t(CIT_TEST_INT, a_nVal));
+		m_vInsts.back().m_strText = a_strKey;
+	}
+	inline void addTestCond(const string &a_strKey, const string &a_strVal) {
+		
+		m_vInsts.push_back(cinst_t(CIT_TEST_STR));
+		m_vInsts.back().m_strText = a_strKey;
+		m_vInsts.back().m_strVal = a_strVal;
+	}
+	inline void addTestNot(const string &a_strKey) {
+		
+		m_vInsts.push_back(cinst_t(CIT_TEST_NOT));
+		m_vInsts.back().m_strText = a_strKey;
+	}
+	inline void addTestHas(const string &a_strKey) {
+		
+		m_vInsts.push_back(cinst_t(CIT_TEST_HAS));
+		m_vInsts.back().m_strText = a_strKey;
+	}
+	inline void addTestEmpty(const string &a_strKey) {
+		
+		m_vInsts.push_back(cinst_t(CIT_TEST_EMPTY));
+		m_vInsts.back().m_strText = a_strKey;
+	}
+	
+	inline void addIf(void) {
+		m_vInsts.push_back(cinst_t(CIT_IF));
+	}
+	inline void addEndIf(void) {
+		m_vInsts.push_back(cinst_t(CIT_ENDIF));
+	}
+	inline void addElse(void) {
+		m_vInsts.push_back(cinst_t(CIT_ELSE));
+	}
+	inline void addEndElse(void) {
+		m_vInsts.push_back(cinst_t(CIT_ENDELSE));
+	}
+};
+
+}
+
+#endif // CODER_CSPEC_H__
@@ -21,6 +21,7 @@
 
 #include "../main/upgmain.h"
 #include <string>
+#include <algorithm>
 using std::string;
 #ifdef UPGEN_TEST_VERSION
 // TODO: fix bug
@@ -111,6 +112,137 @@ void dmmap_t::map2Groups(const vint_t& a_map, vint_t& a_grp) const {
 
 }
 
+// insert an integer table, together with the narrowest element type for it,
+// so that language SPECs may declare the table with a compact type,
+// return size of the element type in bytes
+int dmmap_t::insertTable(const string& a_strKey, const vint_t &a_vnTbl) {
+	
+	int nMin = 0, nMax = 0;
+	for(int i = 0; i < (int)a_vnTbl.size(); ++i) {
+		
+		if(a_vnTbl[i] < nMin) {
+			nMin = a_vnTbl[i];
+		}
+		if(a_vnTbl[i] > nMax) {
+			nMax = a_vnTbl[i];
+		}
+	}
+	
+	const char *pchType = CVAL_ELEMTYPE_INT32;
+	int nBytes = 4;
+	if(nMin >= 0) {
+		
+		if(nMax <= 0xff) {
+			pchType = CVAL_ELEMTYPE_UINT8;
+			nBytes = 1;
+		}
+		else if(nMax <= 0xffff) {
+			pchType = CVAL_ELEMTYPE_UINT16;
+			nBytes = 2;
+		}
+	}
+	else if(nMin >= -0x80 && nMax <= 0x7f) {
+		
+		pchType = CVAL_ELEMTYPE_INT8;
+		nBytes = 1;
+	}
+	else if(nMin >= -0x8000 && nMax <= 0x7fff) {
+		
+		pchType = CVAL_ELEMTYPE_INT16;
+		nBytes = 2;
+	}
+	
+	insert(a_strKey, a_vnTbl);
+	insert(a_strKey + CKEY_ELEMTYPE_SUFFIX, string(pchType));
+	return nBytes;
+}
+
+// insert full transition table of DFA, one load per char to get next state,
+// and report size of the table
+void dmmap_t::insertFullTable(const dtable_t &a_dTbl, const gsetting_t &a_gsetup) {
+	
+	bool bPremul = (LEX_TABLE_PREMUL == a_gsetup.m_nLexTable);
+	vint_t vnFull, vnStarts(a_dTbl.getStarts());
+	int nStride = a_dTbl.getFullTable(vnFull, bPremul);
+	if(bPremul) {
+		
+		for(int i = 0; i < (int)vnStarts.size(); ++i) {
+			vnStarts[i] *= nStride;
+		}
+	}
+	
+	insertTable(CKEY_LEX_STARTS, vnStarts);
+	int nBytes = insertTable(CKEY_LEX_DFA_FULL, vnFull) * (int)vnFull.size();
+	insert(CKEY_LEX_FULL_STRIDE, nStride);
+	insert(CKEY_LEX_FULL_PREMUL, bPremul ? TRUE : FALSE);
+	
+	if(a_gsetup.m_posDetail) {
+		
+		ostream &os = *(ostream*)a_gsetup.m_posDetail;
+		os << "---------------------- Full DFA Table -----------------------------" << std::endl << std::endl;
+		os << "full transition table: " << (int)vnFull.size() / nStride << " states x "
+		   << nStride << " columns, " << nBytes << " bytes" << std::endl << std::endl;
+	}
+	if(nBytes > a_gsetup.m_nFullTableWarn * 1024) {
+		
+		string strMsg = "full transition table of scanner takes ";
+		strMsg += std::to_string((nBytes + 1023) / 1024);
+		strMsg += " KB, which is larger than ";
+		strMsg += std::to_string(a_gsetup.m_nFullTableWarn);
+		strMsg += " KB.";
+		_WARNING(strMsg);
+	}
+}
+
+// flatten states of DFA for direct-coded scanner, see CKEY_LEX_DIRECT_STATES
+void dmmap_t::buildDirectStates(const dtable_t &a_dTbl, vint_t &a_vnStates) const {
+	
+	const vint_t &vnCharMap = a_dTbl.getCharMap();
+	const table_t &vnAccepts = a_dTbl.getAccepts();
+	int nLabels = 0;
+	for(int i = 0; i < (int)vnCharMap.size(); ++i) {
+		
+		if(vnCharMap[i] >= nLabels) {
+			nLabels = vnCharMap[i] + 1;
+		}
+	}
+	
+	vint_t vnTargets(nLabels), vnOrder;
+	a_vnStates.clear();
+	for(int s = FIRST_STATE; s < a_dTbl.getDefaultState(); ++s) {
+		
+		a_vnStates.push_back(s);
+		a_vnStates.push_back(vnAccepts[s]);
+		a_vnStates.push_back(s);
+		
+		vnOrder.clear();
+		for(int d = 0; d < nLabels; ++d) {
+			
+			vnTargets[d] = a_dTbl.getNextState(s, d);
+			if(vnTargets[d] != INVALID_STATE) {
+				vnOrder.push_back(d);
+			}
+		}
+		// groups are in ascending order of target states,
+		// and labels of a group are in ascending order
+		std::stable_sort(vnOrder.begin(), vnOrder.end(), [&](int a, int b) {
+			return vnTargets[a] < vnTargets[b];
+		});
+		for(int i = 0; i < (int)vnOrder.size(); ++i) {
+			
+			a_vnStates.push_back(vnOrder[i]);
+			if(i + 1 == (int)vnOrder.size()
+				|| vnTargets[vnOrder[i + 1]] != vnTargets[vnOrder[i]]) {
+				
+				a_vnStates.push_back(LABELS_DELIMITER);
+				a_vnStates.push_back(vnTargets[vnOrder[i]]);
+				a_vnStates.push_back(vnTargets[vnOrder[i]]);
+			}
+		}
+		a_vnStates.push_back(GROUP_DELIMITER);
+	}
+}
+
 // build data model map, which contains all keys and its values used in generating code
 // there are two types of keys according the way dealing its value,
 // the first is the one whose value is text, and will be copied literally to output stream,
@@ -174,6 +306,8 @@ void dmmap_t::buildMap(const dtable_t &a_dTbl, const ptable_t &a_pTbl, const gse
 	insert(CKEY_ENABLE_LOCATION, a_gsetup.m_bLocCompute ? TRUE : FALSE);
 	insert(CKEY_ENABLE_COLUMN, (a_gsetup.m_bColCompute && a_gsetup.m_bLocCompute) ? TRUE : FALSE);
 	insert(CKEY_ENABLE_LINENO, a_gsetup.m_bEnableLineNo? TRUE : FALSE);
+	insert(CKEY_REENTRANT, a_gsetup.m_bReentrant? TRUE : FALSE);
+	insert(CKEY_PUSH_MODE, a_gsetup.m_bPushMode? TRUE : FALSE);
 	if(! isString(CKEY_NAME_PREFIX)) {
 		if(a_gsetup.m_pchNamePrefix) {
 			
@@ -224,31 +358,37 @@ void dmmap_t::buildMap(const dtable_t &a_dTbl, const ptable_t &a_pTbl, const gse
 		map2Groups(a_dTbl.getRule2Actions(), vi);
 		insert(CKEY_LEX_RULE2ACTIONS, vi);
 		// character map, and meta-character, to minimize number of invalid characters 
-		insert(CKEY_LEX_CHARMAP, a_dTbl.getCharMap());
-		insert(CKEY_LEX_METACHARS, a_dTbl.getMeta());
+		insertTable(CKEY_LEX_CHARMAP, a_dTbl.getCharMap());
 	
 	// keys related to DFAs
-		// start state of DFAs
-		insert(CKEY_LEX_STARTS, a_dTbl.getStarts());
 		// indexes of start-conditions, INITIAL is always 0
 		insert(CKEY_LEX_STARTINDEXES, a_dTbl.getStartIndexes());
 		// start-condition names
 		insert(CKEY_LEX_STARTLABLES, a_dTbl.getStartLabels());
-		// DFA transition table
-		// here, we use next/check/base/default scheme to store DFA
-		// for more information, refer the book
-		//	Compiler: Principles, Techniques, and Tools
-		// at page 144-146, chapter 3
-		insert(CKEY_LEX_DFA_NEXTS, a_dTbl.getNexts());
-		// check table for next table (transition table)
-		insert(CKEY_LEX_DFA_CHECKS, a_dTbl.getChecks());
-		// store offset for each state to lookup it's transitions
-		// in next table and check table
-		insert(CKEY_LEX_DFA_BASES, a_dTbl.getBases());
-		// optional offset for each state when the current offset is invalid
-		insert(CKEY_LEX_DFA_DEFAULTS, a_dTbl.getDefaults());
-		// store rule accepted in each state
-		insert(CKEY_LEX_DFA_ACCEPTS, a_dTbl.getAccepts());
+		if(LEX_TABLE_COMB == a_gsetup.m_nLexTable) {
+			// start state of DFAs
+			insertTable(CKEY_LEX_STARTS, a_dTbl.getStarts());
+			insertTable(CKEY_LEX_METACHARS, a_dTbl.getMeta());
+			// DFA transition table
+			// here, we use next/check/base/default scheme to store DFA
+			// for more information, refer the book
+			//	Compiler: Principles, Techniques, and Tools
+			// at page 144-146, chapter 3
+			insertTable(CKEY_LEX_DFA_NEXTS, a_dTbl.getNexts());
+			// check table for next table (transition table)
+			insertTable(CKEY_LEX_DFA_CHECKS, a_dTbl.getChecks());
+			// store offset for each state to lookup it's transitions
+			// in next table and check table
+			insertTable(CKEY_LEX_DFA_BASES, a_dTbl.getBases());
+			// optional offset for each state when the current offset is invalid
+			insertTable(CKEY_LEX_DFA_DEFAULTS, a_dTbl.getDefaults());
+			// store rule accepted in each state
+			insertTable(CKEY_LEX_DFA_ACCEPTS, a_dTbl.getAccepts());
+		}
+		else {
+			
+			insertFullTable(a_dTbl, a_gsetup);
+		}
 		// indicate which state should go to, if no valid transition available
 		insert(CKEY_LEX_DEFAULT_STATE, a_dTbl.getDefaultState());
 		// trap state, no out-going transitions
@@ -265,7 +405,16 @@ void dmmap_t::buildMap(const dtable_t &a_dTbl, const ptable_t &a_pTbl, const gse
 		// flag: are there any lookahead states
 		if(a_dTbl.hasLookahead()) {
 			
-			insert(CKEY_LEX_DFA_LOOKAHEADS, a_dTbl.getLookaheads());
+			insertTable(CKEY_LEX_DFA_LOOKAHEADS, a_dTbl.getLookaheads());
+		}
+		
+		// states of direct-coded scanner, transitions of each state are resolved
+		// from the tables above and grouped by target state
+		insert(CKEY_LEX_DIRECT, a_gsetup.m_bLexDirect ? TRUE : FALSE);
+		if(a_gsetup.m_bLexDirect) {
+			
+			buildDirectStates(a_dTbl, vi);
+			insert(CKEY_LEX_DIRECT_STATES, vi);
 		}
 		
 		// debug options for scanner 
@@ -273,7 +422,7 @@ void dmmap_t::buildMap(const dtable_t &a_dTbl, const ptable_t &a_pTbl, const gse
 			insert(CKEY_LEX_DLEVEL, a_gsetup.m_nLexDLevel);
 			insert(CKEY_LEX_DMODE, TRUE);
 			// map: rule index --> lineno
-			insert(CKEY_LEX_RULE2LINES, a_dTbl.getRule2LineNos());
+			insertTable(CKEY_LEX_RULE2LINES, a_dTbl.getRule2LineNos());
 		}
 		else {
 			insert(CKEY_LEX_DLEVEL, 0);
@@ -324,31 +473,44 @@ void dmmap_t::buildMap(const dtable_t &a_dTbl, const ptable_t &a_pTbl, const gse
 		// number of symbols
 		insert(CKEY_PARSE_SYMBOLNUM, a_pTbl.getSymNum());
 		// token map: token ID --> index of token
-		insert(CKEY_PARSE_TOKENMAP, a_pTbl.getTokenMap());
+		insertTable(CKEY_PARSE_TOKENMAP, a_pTbl.getTokenMap());
 		// token IDs
-		insert(CKEY_PARSE_TOKENID, a_pTbl.getTIDTable());
+		insertTable(CKEY_PARSE_TOKENID, a_pTbl.getTIDTable());
 		// numbers of symbols in right part of grammar rules
-		insert(CKEY_PARSE_RPNUM, a_pTbl.getRPNumTable());
+		insertTable(CKEY_PARSE_RPNUM, a_pTbl.getRPNumTable());
 		// symbol ID at left part of grammar rules
-		insert(CKEY_PARSE_LPID, a_pTbl.getLPartIndex());
+		insertTable(CKEY_PARSE_LPID, a_pTbl.getLPartIndex());
 		// action table
-		insert(CKEY_PARSE_ACTENTRIES, a_pTbl.getActionTable());
+		insertTable(CKEY_PARSE_ACTENTRIES, a_pTbl.getActionTable());
 		// the base address of the entries for each state stored in action table
-		insert(CKEY_PACTION_BASES, a_pTbl.getActionBase());
+		insertTable(CKEY_PACTION_BASES, a_pTbl.getActionBase());
 		// goto table
-		insert(CKEY_PARSE_GOTOS, a_pTbl.getGotoTable());
+		insertTable(CKEY_PARSE_GOTOS, a_pTbl.getGotoTable());
 		// the base address of the entries for each state stored in goto table
-		insert(CKEY_PGOTO_BASES, a_pTbl.getGotoBase());
+		insertTable(CKEY_PGOTO_BASES, a_pTbl.getGotoBase());
 
-		// tables used to compress action table and goto table
-		insert(CKEY_PARSE_VALID_BMAP, a_pTbl.getValidBMap().getBVect());
-		insert(CKEY_PARSE_BMAP_ROWSIZE, a_pTbl.getValidBMap().getRowSize());
-		insert(CKEY_PARSE_ACT_ROWVAL, a_pTbl.getActRowVal());
-		insert(CKEY_PARSE_ACT_ROWNICE, a_pTbl.getActRowNice());
-		insert(CKEY_PARSE_COLVAL, a_pTbl.getColVal());
-		insert(CKEY_PARSE_COLNICE, a_pTbl.getColNice());
-		insert(CKEY_PARSE_GOTO_ROWVAL, a_pTbl.getGotoRowVal());
-		insert(CKEY_PARSE_GOTO_ROWNICE, a_pTbl.getGotoRowNice());
+		if(_EQ(a_gsetup.m_nParseTable, PARSE_TABLE_MERGE)) {
+			// tables of merged rows: a cell is valid if its check matches,
+			// otherwise the default action of state (or goto of non-terminal) applies
+			insert(CKEY_PARSE_ROW_MERGE, TRUE);
+			insertTable(CKEY_PACTION_CHECKS, a_pTbl.getActionCheck());
+			insertTable(CKEY_PGOTO_CHECKS, a_pTbl.getGotoCheck());
+			insertTable(CKEY_PDEF_RULES, a_pTbl.getDefActions());
+			insertTable(CKEY_PDEF_GOTOS, a_pTbl.getDefGotos());
+			insert(CKEY_PACTION_DEFBASE, a_pTbl.getDefOnlyBase());
+		}
+		else {
+			// tables used to compress action table and goto table
+			insert(CKEY_PARSE_ROW_MERGE, FALSE);
+			insert(CKEY_PARSE_VALID_BMAP, a_pTbl.getValidBMap().getBVect());
+			insert(CKEY_PARSE_BMAP_ROWSIZE, a_pTbl.getValidBMap().getRowSize());
+			insertTable(CKEY_PARSE_ACT_ROWVAL, a_pTbl.getActRowVal());
+			insertTable(CKEY_PARSE_ACT_ROWNICE, a_pTbl.getActRowNice());
+			insertTable(CKEY_PARSE_COLVAL, a_pTbl.getColVal());
+			insertTable(CKEY_PARSE_COLNICE, a_pTbl.getColNice());
+			insertTable(CKEY_PARSE_GOTO_ROWVAL, a_pTbl.getGotoRowVal());
+			insertTable(CKEY_PARSE_GOTO_ROWNICE, a_pTbl.getGotoRowNice());
+		}
 
 		// user-defined parse-actions
 		insert(CKEY_PARSE_ACTIONS, a_pTbl.getActions());
@@ -364,9 +526,9 @@ void dmmap_t::buildMap(const dtable_t &a_dTbl, const ptable_t &a_pTbl, const gse
 			// symbol names
 			insert(CKEY_PARSE_SYMNAME, a_pTbl.getSName());
 			// 
-			insert(CKEY_PARSE_RPBASES, a_pTbl.getRPBase());
-			insert(CKEY_PARSE_RPINDEXES, a_pTbl.getRPartIndex());
-			insert(CKEY_PARSE_RULE2LINES, a_pTbl.getRule2LineNos());
+			insertTable(CKEY_PARSE_RPBASES, a_pTbl.getRPBase());
+			insertTable(CKEY_PARSE_RPINDEXES, a_pTbl.getRPartIndex());
+			insertTable(CKEY_PARSE_RULE2LINES, a_pTbl.getRule2LineNos());
 		}
 		else {
 			insert(CKEY_PARSE_DLEVEL, 0);
@@ -59,6 +59,12 @@ private:
 	// group array by value of its elemnets, and
 	// insert group delimiters between adjacent groups
 	void map2Groups(const vint_t& a_map, vint_t& a_grp) const;
+	// insert an integer table, together with the narrowest element type for it
+	int insertTable(const string& a_strKey, const vint_t &a_vnTbl);
+	// insert full transition table of DFA
+	void insertFullTable(const dtable_t &a_dTbl, const gsetting_t &a_gsetup);
+	// flatten states of DFA for direct-coded scanner
+	void buildDirectStates(const dtable_t &a_dTbl, vint_t &a_vnStates) const;
 public:
 	
 	inline dmmap_t(void)
@@ -42,7 +42,9 @@ namespace coder_ns {
 
 enum {
 	
-	GROUP_DELIMITER = -1
+	GROUP_DELIMITER = -1,
+	// ends labels of a group of transitions in direct-coded scanner
+	LABELS_DELIMITER = -2
 };
 
 class dmodel_t {
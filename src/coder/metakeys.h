@@ -97,6 +97,8 @@
 
 #define CKEY_ENABLE_DECLARE				"EnableDeclare"
 #define CKEY_ENABLE_INTERACTIVE			"EnableInteractive"
+#define CKEY_REENTRANT					"Reentrant"
+#define CKEY_PUSH_MODE					"PushMode"
 
 #define CKEY_FORMAL_PARAMETERS			"FormalParams"
 #define CKEY_ACTUAL_PARAMETERS			"ActualParams"
@@ -123,6 +125,25 @@
 #define CKEY_LEX_DFA_DEFAULTS			"LexDFADefaults"
 #define CKEY_LEX_DFA_ACCEPTS			"LexDFAAccepts"
 #define CKEY_LEX_DFA_LOOKAHEADS			"LexDFALookaheads"
+// full transition table: table, size of its rows, and flag of pre-multiplied states
+#define CKEY_LEX_DFA_FULL				"LexDFAFull"
+#define CKEY_LEX_FULL_STRIDE			"LexFullStride"
+#define CKEY_LEX_FULL_PREMUL			"LexFullPremul"
+// direct-coded scanner: flag, and states of DFA, each state is stored as
+//		state, accepted rule, state, then groups of transitions
+//		(label, ..., label, LABELS_DELIMITER, target, target),
+//		and it ends with a group delimiter
+#define CKEY_LEX_DIRECT					"LexDirectCode"
+#define CKEY_LEX_DIRECT_STATES			"LexDirectStates"
+
+// element type of an integer table, its key is the key of the table followed by
+// the suffix, its value is the narrowest of following types holding all elements
+#define CKEY_ELEMTYPE_SUFFIX			"Type"
+#define CVAL_ELEMTYPE_UINT8				"uint8"
+#define CVAL_ELEMTYPE_INT8				"int8"
+#define CVAL_ELEMTYPE_UINT16			"uint16"
+#define CVAL_ELEMTYPE_INT16				"int16"
+#define CVAL_ELEMTYPE_INT32				"int32"
 
 #define CKEY_LEX_DEFAULT_STATE			"LexDefaultState"
 #define CKEY_LEX_EOFRULEBASE			"LexEOFRuleBase"
@@ -169,6 +190,11 @@
 #define CKEY_PGOTO_BASES				"PGotoBases"
 
 #define CKEY_PDEF_RULES					"ParseDefRules"
+// merged rows(option -k): flag, default goto of each non-terminal,
+//		and base of states having default action only
+#define CKEY_PARSE_ROW_MERGE			"ParseRowMerge"
+#define CKEY_PDEF_GOTOS					"ParseDefGotos"
+#define CKEY_PACTION_DEFBASE			"PActionDefBase"
 #define CKEY_PARSE_ACTIONS				"ParseActions"
 #define CKEY_PARSE_RULE2ACTIONS			"PraseRule2Actions"
 
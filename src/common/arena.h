@@ -0,0 +1,172 @@
+/*
+    Upgen -- a scanner and parser generator.
+    Copyright (C) 2009-2018 Bruce Wu
+
+    This file is a part of Upgen program
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef COMMON_ARENA_H__
+#define COMMON_ARENA_H__
+
+#include "./types.h"
+#include "./common.h"
+
+#include <cstddef>
+#include <new>
+#include <utility>
+
+namespace common_ns {
+
+///////////////////////////////////////////////////////////////////
+//class arena_t definition
+// arena_t: monotonic allocator; memory is carved out of large blocks
+// and given back all at once by release(), destructors are never run,
+// so only objects whose memory all comes from the arena may live in it
+
+class arena_t {
+
+private:
+
+	enum {
+		BLOCK_SIZE = 64 * 1024
+	};
+
+	// allocated blocks
+	vpchar_t m_vpBlocks;
+	// free space of current block
+	char *m_pCur;
+	size_t m_nLeft;
+	// total bytes of all blocks
+	size_t m_nBytes;
+
+private:
+
+	arena_t(const arena_t&);
+	arena_t& operator=(const arena_t&);
+
+public:
+
+	inline arena_t(void)
+	: m_pCur(nullptr)
+	, m_nLeft(0)
+	, m_nBytes(0) {
+	}
+	inline ~arena_t(void) {
+		release();
+	}
+
+public:
+
+	inline void* allocate(size_t a_nSize, size_t a_nAlign) {
+
+		size_t nPad = (a_nAlign - (size_t)m_pCur % a_nAlign) % a_nAlign;
+		if(a_nSize + nPad > m_nLeft) {
+			// oversized requests get a block of their own
+			size_t nBlock = (a_nSize + a_nAlign > BLOCK_SIZE)?
+						a_nSize + a_nAlign : BLOCK_SIZE;
+			m_pCur = static_cast<char*>(::operator new(nBlock));
+			m_nLeft = nBlock;
+			m_nBytes += nBlock;
+			m_vpBlocks.push_back(m_pCur);
+			nPad = (a_nAlign - (size_t)m_pCur % a_nAlign) % a_nAlign;
+		}
+
+		char *p = m_pCur + nPad;
+		m_pCur = p + a_nSize;
+		m_nLeft -= a_nSize + nPad;
+		return p;
+	}
+
+	// construct an object in the arena
+	template<class T, class... Args>
+	inline T* create(Args&&... args) {
+		return new(allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+	}
+
+	// free all blocks at once
+	inline void release(void) {
+		for(size_t i = 0; i < m_vpBlocks.size(); ++i) {
+			::operator delete(m_vpBlocks[i]);
+		}
+		m_vpBlocks.clear();
+		m_pCur = nullptr;
+		m_nLeft = 0;
+		m_nBytes = 0;
+	}
+
+	inline size_t getBytes(void) const {
+		return m_nBytes;
+	}
+};
+
+///////////////////////////////////////////////////////////////////
+//class arena_alloc_t definition
+// arena_alloc_t: STL allocator drawing from an arena; deallocation is
+// a no-op, a default constructed one falls back on the global heap
+
+template<class T>
+class arena_alloc_t {
+
+	template<class U> friend class arena_alloc_t;
+
+public:
+
+	typedef T value_type;
+
+private:
+
+	arena_t *m_pArena;
+
+public:
+
+	inline arena_alloc_t(arena_t *a_pArena = nullptr)
+	: m_pArena(a_pArena) {
+	}
+	template<class U>
+	inline arena_alloc_t(const arena_alloc_t<U> &src)
+	: m_pArena(src.m_pArena) {
+	}
+
+	inline T* allocate(size_t n) {
+		if(m_pArena) {
+			return static_cast<T*>(m_pArena->allocate(n * sizeof(T), alignof(T)));
+		}
+		return static_cast<T*>(::operator new(n * sizeof(T)));
+	}
+	inline void deallocate(T *p, size_t) {
+		if( !m_pArena) {
+			::operator delete(p);
+		}
+	}
+
+	inline arena_t* getArena(void) const {
+		return m_pArena;
+	}
+
+	template<class U>
+	inline bool operator==(const arena_alloc_t<U> &src) const {
+		return m_pArena == src.m_pArena;
+	}
+	template<class U>
+	inline bool operator!=(const arena_alloc_t<U> &src) const {
+		return m_pArena != src.m_pArena;
+	}
+};
+
+}
+
+#endif // COMMON_ARENA_H__
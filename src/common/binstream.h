@@ -0,0 +1,160 @@
+/*
+    Upgen -- a scanner and parser generator.
+    Copyright (C) 2009-2018 Bruce Wu
+
+    This file is a part of Upgen program
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+
+#ifndef COMMON_BINSTREAM_H__
+#define COMMON_BINSTREAM_H__
+
+#include "./types.h"
+
+#include <cstring>
+
+namespace common_ns {
+
+///////////////////////////////////////////////////////////////////
+//class binwriter_t definition
+// binwriter_t: appends integers and strings to a byte buffer in
+// host byte order; what it writes is meant to be read back by
+// binreader_t on the same kind of machine
+
+class binwriter_t {
+
+private:
+
+	string m_strBuf;
+
+public:
+
+	inline void writeInt(int a_nVal) {
+		m_strBuf.append((const char*)&a_nVal, sizeof(a_nVal));
+	}
+	inline void writeUInt64(unsigned long long a_nVal) {
+		m_strBuf.append((const char*)&a_nVal, sizeof(a_nVal));
+	}
+	inline void writeStr(const string &a_str) {
+		writeInt((int)a_str.size());
+		m_strBuf.append(a_str);
+	}
+	inline void writeInts(const vint_t &a_vn) {
+		writeInt((int)a_vn.size());
+		if( ! a_vn.empty()) {
+			m_strBuf.append((const char*)&a_vn[0], a_vn.size() * sizeof(int));
+		}
+	}
+	inline void writeStrs(const vstr_t &a_vstr) {
+		writeInt((int)a_vstr.size());
+		for(int i = 0; i < (int)a_vstr.size(); ++i) {
+			writeStr(a_vstr[i]);
+		}
+	}
+
+	inline const string& getBuffer(void) const {
+		return m_strBuf;
+	}
+};
+
+///////////////////////////////////////////////////////////////////
+//class binreader_t definition
+// binreader_t: reads back what binwriter_t wrote from a byte buffer;
+// reading past the end of buffer yields zeros and empty strings,
+// and marks the reader bad, so callers check isGood() once at the end
+
+class binreader_t {
+
+private:
+
+	const char *m_pchCur;
+	const char *m_pchEnd;
+	bool m_bGood;
+
+private:
+
+	inline bool take(void *a_p, size_t a_nSize) {
+
+		if(m_bGood && (size_t)(m_pchEnd - m_pchCur) >= a_nSize) {
+			memcpy(a_p, m_pchCur, a_nSize);
+			m_pchCur += a_nSize;
+			return true;
+		}
+		m_bGood = false;
+		return false;
+	}
+
+public:
+
+	inline binreader_t(const char *a_pchBuf, size_t a_nSize)
+	: m_pchCur(a_pchBuf)
+	, m_pchEnd(a_pchBuf + a_nSize)
+	, m_bGood(true) {
+	}
+
+public:
+
+	inline int readInt(void) {
+		int nVal = 0;
+		take(&nVal, sizeof(nVal));
+		return nVal;
+	}
+	inline unsigned long long readUInt64(void) {
+		unsigned long long nVal = 0;
+		take(&nVal, sizeof(nVal));
+		return nVal;
+	}
+	// a count of elements, each of which takes at least @a_nElemSize bytes
+	inline int readCount(size_t a_nElemSize = 1) {
+		int n = readInt();
+		if(n < 0 || (size_t)n > (size_t)(m_pchEnd - m_pchCur) / a_nElemSize) {
+			m_bGood = false;
+			return 0;
+		}
+		return n;
+	}
+	inline void readStr(string &a_str) {
+		int n = readCount();
+		a_str.assign(m_pchCur, n);
+		m_pchCur += n;
+	}
+	inline void readInts(vint_t &a_vn) {
+		int n = readCount(sizeof(int));
+		a_vn.resize(n);
+		if(n) {
+			take(&a_vn[0], n * sizeof(int));
+		}
+	}
+	inline void readStrs(vstr_t &a_vstr) {
+		int n = readCount(sizeof(int));
+		a_vstr.resize(n);
+		for(int i = 0; i < n; ++i) {
+			readStr(a_vstr[i]);
+		}
+	}
+
+	inline bool isGood(void) const {
+		return m_bGood;
+	}
+	inline bool isEnd(void) const {
+		return m_pchCur == m_pchEnd;
+	}
+};
+
+}
+
+#endif // COMMON_BINSTREAM_H__
@@ -20,6 +20,7 @@
 */
 
 #include <cstring>
+#include <fstream>
 #include <sys/stat.h>
 
 #include "./filehelper.h"
@@ -47,6 +48,31 @@ bool filehelper_t::isAccessible(const string &a_strFile) {
 	return  0== stat(a_strFile.c_str(), &st);
 }
 
+// read whole content of file at once
+// @a_strFile: name of file to be read
+// @a_strContent: content of the file
+// @return-value: true if the file is read, false otherwise
+bool filehelper_t::readFile(const string &a_strFile, string &a_strContent) {
+	
+	std::ifstream ifs(a_strFile.c_str(), std::ios::in | std::ios::binary);
+	if( ! ifs) {
+		return false;
+	}
+	
+	ifs.seekg(0, std::ios::end);
+	std::streamoff nSize = ifs.tellg();
+	ifs.seekg(0, std::ios::beg);
+	if(nSize < 0) {
+		return false;
+	}
+	
+	a_strContent.resize((size_t)nSize);
+	if(nSize > 0) {
+		ifs.read(&a_strContent[0], nSize);
+	}
+	return (bool)ifs;
+}
+
 // extract name and extended name from whole name of file
 // @a_pcchFile: whole name of file to be extracted
 // @a_strName: basic name extracting from @a_pcchFile
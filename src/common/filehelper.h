@@ -39,6 +39,12 @@ public:
 	// @a_strFile: file name to be tested
 	static bool isAccessible(const string &a_strFile);
 	
+	// read whole content of file at once
+	// @a_strFile: name of file to be read
+	// @a_strContent: content of the file
+	// @return-value: true if the file is read, false otherwise
+	static bool readFile(const string &a_strFile, string &a_strContent);
+	
 	// extract name and extended name from whole name of file
 	// @a_pcchFile: whole name of file to be extracted
 	// @a_strName: basic name extracting from @a_pcchFile
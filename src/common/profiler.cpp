@@ -0,0 +1,166 @@
+/*
+    Upgen -- a scanner and parser generator.
+    Copyright (C) 2009-2018 Bruce Wu
+
+    This file is a part of Upgen program
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#include "./profiler.h"
+
+#include <sys/resource.h>
+#include <iomanip>
+
+namespace common_ns {
+
+profiler_t *profiler_t::sm_pProfiler = nullptr;
+
+long profiler_t::getPeakKB(void) {
+
+	struct rusage ru;
+	if(getrusage(RUSAGE_SELF, &ru)) {
+		return 0;
+	}
+	// kilobytes on Linux, bytes on Mac OS X
+#ifdef __APPLE__
+	return (long)(ru.ru_maxrss / 1024);
+#else
+	return (long)ru.ru_maxrss;
+#endif
+}
+
+void profiler_t::beginPhase(const char *a_pchName) {
+
+	assert(a_pchName);
+
+	phase_t ph;
+	ph.m_strName = a_pchName;
+	ph.m_nDepth = (int)m_vnOpen.size();
+	ph.m_dfMSec = 0;
+	ph.m_nPeakKB = 0;
+	ph.m_nGrowKB = 0;
+
+	m_vnOpen.push_back((int)m_vPhases.size());
+	m_vPhases.push_back(ph);
+	m_vnStartKB.push_back(getPeakKB());
+	m_vStart.push_back(steady_t::now());
+}
+
+void profiler_t::endPhase(void) {
+
+	assert( ! m_vnOpen.empty());
+
+	phase_t &ph = m_vPhases[m_vnOpen.back()];
+	ph.m_dfMSec = std::chrono::duration<double, std::milli>(steady_t::now() - m_vStart.back()).count();
+	ph.m_nPeakKB = getPeakKB();
+	ph.m_nGrowKB = ph.m_nPeakKB - m_vnStartKB.back();
+
+	m_vnOpen.pop_back();
+	m_vStart.pop_back();
+	m_vnStartKB.pop_back();
+}
+
+void profiler_t::addCount(const char *a_pchKey, long a_nValue) {
+
+	assert(a_pchKey);
+	// counts reported out of any phase go to the last one
+	if(m_vPhases.empty()) {
+		return;
+	}
+	phase_t &ph = m_vnOpen.empty()? m_vPhases.back() : m_vPhases[m_vnOpen.back()];
+	ph.m_vCounts.push_back(count_t(a_pchKey, a_nValue));
+}
+
+// phase                      time(ms)   peak(KB)   grow(KB)
+// total                         105.2      20832      18000
+//   parse script                  3.1       3012        900
+//     rules: 12
+void profiler_t::reportText(ostream &os) const {
+
+	std::ios::fmtflags flags = os.flags();
+	std::streamsize prec = os.precision();
+
+	os << std::left << std::setw(32) << "phase" << std::right
+	   << std::setw(12) << "time(ms)" << std::setw(12) << "peak(KB)"
+	   << std::setw(12) << "grow(KB)" << std::endl;
+
+	os << std::fixed << std::setprecision(1);
+	for(int i = 0; i < (int)m_vPhases.size(); ++i) {
+
+		const phase_t &ph = m_vPhases[i];
+		os << std::left << std::setw(32) << (string(ph.m_nDepth * 2, ' ') + ph.m_strName) << std::right
+		   << std::setw(12) << ph.m_dfMSec << std::setw(12) << ph.m_nPeakKB
+		   << std::setw(12) << ph.m_nGrowKB << std::endl;
+
+		for(int j = 0; j < (int)ph.m_vCounts.size(); ++j) {
+			os << string(ph.m_nDepth * 2 + 4, ' ') << ph.m_vCounts[j].first
+			   << ": " << ph.m_vCounts[j].second << std::endl;
+		}
+	}
+
+	os.flags(flags);
+	os.precision(prec);
+}
+
+// quote a name as JSON string, names are ASCII text given by program
+static void toJSONString(const string &a_str, ostream &os) {
+
+	os << '\"';
+	for(int i = 0; i < (int)a_str.size(); ++i) {
+
+		char c = a_str[i];
+		if('\"' == c || '\\' == c) {
+			os << '\\';
+		}
+		os << c;
+	}
+	os << '\"';
+}
+
+// {"phases": [{"name": "total", "depth": 0, "wall_ms": 105.2,
+//		"peak_rss_kb": 20832, "grow_rss_kb": 18000, "counts": {"rules": 12}}, ...]}
+void profiler_t::reportJSON(ostream &os) const {
+
+	std::ios::fmtflags flags = os.flags();
+	std::streamsize prec = os.precision();
+
+	os << std::fixed << std::setprecision(3);
+	os << "{\n\t\"phases\": [";
+	for(int i = 0; i < (int)m_vPhases.size(); ++i) {
+
+		const phase_t &ph = m_vPhases[i];
+		os << (i? ",\n\t\t{" : "\n\t\t{") << "\"name\": ";
+		toJSONString(ph.m_strName, os);
+		os << ", \"depth\": " << ph.m_nDepth
+		   << ", \"wall_ms\": " << ph.m_dfMSec
+		   << ", \"peak_rss_kb\": " << ph.m_nPeakKB
+		   << ", \"grow_rss_kb\": " << ph.m_nGrowKB
+		   << ", \"counts\": {";
+		for(int j = 0; j < (int)ph.m_vCounts.size(); ++j) {
+
+			os << (j? ", " : "");
+			toJSONString(ph.m_vCounts[j].first, os);
+			os << ": " << ph.m_vCounts[j].second;
+		}
+		os << "}}";
+	}
+	os << "\n\t]\n}\n";
+
+	os.flags(flags);
+	os.precision(prec);
+}
+
+}
@@ -0,0 +1,150 @@
+/*
+    Upgen -- a scanner and parser generator.
+    Copyright (C) 2009-2018 Bruce Wu
+
+    This file is a part of Upgen program
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+
+#ifndef COMMON_PROFILER_H__
+#define COMMON_PROFILER_H__
+
+// common library: includes classes which can be shared among different applications
+// profiling of phases of a program
+
+#include "./common.h"
+#include "./types.h"
+
+#include <chrono>
+#include <iostream>
+using std::ostream;
+
+namespace common_ns {
+
+///////////////////////////////////////////////////////////////////
+//class profiler_t definition
+// profiler_t: records wall time, peak memory and counts of named phases;
+// phases nest, and a count goes to the innermost phase still running.
+// Phases are supposed to be begun and ended on one thread.
+
+class profiler_t {
+
+public:
+
+	typedef std::pair<string, long> count_t;
+
+	struct phase_t {
+		string m_strName;
+		// nesting depth, 0 for outermost phases
+		int m_nDepth;
+		// wall time in milliseconds
+		double m_dfMSec;
+		// peak resident set size of process(KB) at end of phase,
+		// and its growth during the phase
+		long m_nPeakKB;
+		long m_nGrowKB;
+		vector<count_t> m_vCounts;
+	};
+
+private:
+
+	typedef std::chrono::steady_clock steady_t;
+
+	static profiler_t *sm_pProfiler;
+
+	// phases in order they are begun
+	vector<phase_t> m_vPhases;
+	// running phases: index, start time, peak memory at start
+	vint_t m_vnOpen;
+	vector<steady_t::time_point> m_vStart;
+	vector<long> m_vnStartKB;
+
+public:
+
+	static profiler_t* setProfiler(profiler_t *a_pProfiler) {
+
+		profiler_t *pFormer = sm_pProfiler;
+		sm_pProfiler = a_pProfiler;
+
+		return pFormer;
+	}
+
+	// nullptr unless profiling is enabled
+	static profiler_t* getProfiler(void) {
+		return sm_pProfiler;
+	}
+
+	// peak resident set size of process so far(KB)
+	static long getPeakKB(void);
+
+public:
+
+	void beginPhase(const char *a_pchName);
+	void endPhase(void);
+	void addCount(const char *a_pchKey, long a_nValue);
+
+	inline const vector<phase_t>& getPhases(void) const {
+		return m_vPhases;
+	}
+
+	// write phases as an indented table
+	void reportText(ostream &os) const;
+	// write phases as a JSON object
+	void reportJSON(ostream &os) const;
+};
+
+// profile_scope_t: a phase lasting as long as the object, if profiling is enabled
+class profile_scope_t {
+
+private:
+
+	profiler_t *m_pProfiler;
+
+	profile_scope_t(const profile_scope_t&);
+	profile_scope_t& operator=(const profile_scope_t&);
+
+public:
+
+	inline explicit profile_scope_t(const char *a_pchName)
+	: m_pProfiler(profiler_t::getProfiler()) {
+		if(m_pProfiler) {
+			m_pProfiler->beginPhase(a_pchName);
+		}
+	}
+	inline ~profile_scope_t(void) {
+		if(m_pProfiler) {
+			m_pProfiler->endPhase();
+		}
+	}
+};
+
+}
+
+#define _PROFILE_CAT2(a, b)	a##b
+#define _PROFILE_CAT(a, b)	_PROFILE_CAT2(a, b)
+
+// profile rest of the enclosing block as a phase
+#define _PROFILE_PHASE(name) \
+	common_ns::profile_scope_t _PROFILE_CAT(profile_scope_, __LINE__)(name)
+
+// attach a count to the innermost running phase
+#define _PROFILE_COUNT(key, n)	{\
+	if(common_ns::profiler_t::getProfiler()) { \
+		common_ns::profiler_t::getProfiler()->addCount(key, (long)(n)); \
+	} \
+	}
+
+#endif // COMMON_PROFILER_H__
@@ -500,4 +500,207 @@ bool charset_t::operator[](const charset_t &src) const {
 	return true;
 }
 
+// switch to bitset if it takes less space than sorted vector
+void iset_t::adjustRep(void) {
+	
+	if(m_bDense || m_nSize < DENSE_MIN_SIZE || m_vElems.front() < 0) {
+		return;
+	}
+	
+	const unsigned int nWords = m_vElems.back() / WORD_BITS + 1;
+	if(nWords > m_nSize) {
+		return;
+	}
+	
+	m_vnBits.assign(nWords, 0);
+	for(unsigned int i = 0; i < m_vElems.size(); ++i) {
+		
+		m_vnBits[m_vElems[i] / WORD_BITS] |= 1u << (m_vElems[i] % WORD_BITS);
+	}
+	vector<value_type>().swap(m_vElems);
+	m_bDense = true;
+}
+
+// switch to sorted vector
+void iset_t::toSparse(void) {
+	
+	if( ! m_bDense) {
+		return;
+	}
+	
+	vector<value_type> vElems;
+	vElems.reserve(m_nSize);
+	for(const_iterator cit = begin(); cit != end(); ++cit) {
+		
+		vElems.push_back(*cit);
+	}
+	m_vElems.swap(vElems);
+	vector<unsigned int>().swap(m_vnBits);
+	m_bDense = false;
+}
+
+bool iset_t::insert(value_type idx) {
+	
+	if(m_bDense && idx < 0) {
+		toSparse();
+	}
+	
+	if(m_bDense) {
+		
+		const unsigned int w = idx / WORD_BITS;
+		const unsigned int nBit = 1u << (idx % WORD_BITS);
+		if(w >= m_vnBits.size()) {
+			m_vnBits.resize(w + 1, 0);
+		}
+		else if(m_vnBits[w] & nBit) {
+			return false;
+		}
+		m_vnBits[w] |= nBit;
+	}
+	else {
+		
+		vector<value_type>::iterator it = std::lower_bound(m_vElems.begin(), m_vElems.end(), idx);
+		if(it != m_vElems.end() && _EQ(*it, idx)) {
+			return false;
+		}
+		m_vElems.insert(it, idx);
+	}
+	
+	++m_nSize;
+	m_nHash += hashElem(idx);
+	adjustRep();
+	return true;
+}
+
+bool iset_t::erase(value_type e) {
+	
+	if(m_bDense) {
+		
+		if( ! include(e)) {
+			return false;
+		}
+		m_vnBits[e / WORD_BITS] &= ~(1u << (e % WORD_BITS));
+	}
+	else {
+		
+		vector<value_type>::iterator it = std::lower_bound(m_vElems.begin(), m_vElems.end(), e);
+		if(it == m_vElems.end() || *it != e) {
+			return false;
+		}
+		m_vElems.erase(it);
+	}
+	
+	--m_nSize;
+	m_nHash -= hashElem(e);
+	return true;
+}
+
+iset_t& iset_t::merge(const iset_t& src) {
+	
+	if(src.empty() || _EQ(&src, this)) {
+		return *this;
+	}
+	
+	if(src.m_bDense && ! m_bDense && (empty() || m_vElems.front() >= 0)) {
+		// union will be at least as dense as @src
+		unsigned int nWords = src.m_vnBits.size();
+		if( ! m_vElems.empty() && m_vElems.back() / WORD_BITS >= (int)nWords) {
+			nWords = m_vElems.back() / WORD_BITS + 1;
+		}
+		m_vnBits.assign(nWords, 0);
+		for(unsigned int i = 0; i < m_vElems.size(); ++i) {
+			
+			m_vnBits[m_vElems[i] / WORD_BITS] |= 1u << (m_vElems[i] % WORD_BITS);
+		}
+		vector<value_type>().swap(m_vElems);
+		m_bDense = true;
+	}
+	
+	if(m_bDense && src.m_bDense) {
+		
+		if(src.m_vnBits.size() > m_vnBits.size()) {
+			m_vnBits.resize(src.m_vnBits.size(), 0);
+		}
+		for(unsigned int w = 0; w < src.m_vnBits.size(); ++w) {
+			
+			unsigned int nNew = src.m_vnBits[w] & ~m_vnBits[w];
+			if(_EQ(nNew, 0u)) {
+				continue;
+			}
+			m_vnBits[w] |= nNew;
+			m_nSize += __builtin_popcount(nNew);
+			while(nNew) {
+				
+				m_nHash += hashElem(w * WORD_BITS + __builtin_ctz(nNew));
+				nNew &= nNew - 1;
+			}
+		}
+	}
+	else if(m_bDense || src.m_bDense) {
+		
+		for(const_iterator cit = src.begin(); cit != src.end(); ++cit) {
+			
+			insert(*cit);
+		}
+	}
+	else {
+		
+		// union of two sorted vectors
+		vector<value_type> vElems;
+		vElems.reserve(m_vElems.size() + src.m_vElems.size());
+		vector<value_type>::const_iterator cit = m_vElems.begin(), citSrc = src.m_vElems.begin();
+		while(cit != m_vElems.end() && citSrc != src.m_vElems.end()) {
+			
+			if(*cit < *citSrc) {
+				vElems.push_back(*cit++);
+			}
+			else if(*citSrc < *cit) {
+				m_nHash += hashElem(*citSrc);
+				vElems.push_back(*citSrc++);
+			}
+			else {
+				vElems.push_back(*cit++);
+				++citSrc;
+			}
+		}
+		vElems.insert(vElems.end(), cit, (vector<value_type>::const_iterator)m_vElems.end());
+		for(; citSrc != src.m_vElems.end(); ++citSrc) {
+			
+			m_nHash += hashElem(*citSrc);
+			vElems.push_back(*citSrc);
+		}
+		m_vElems.swap(vElems);
+		m_nSize = (unsigned int)m_vElems.size();
+		adjustRep();
+	}
+	
+	return *this;
+}
+
+bool iset_t::operator==(const iset_t& src) const {
+	
+	if(m_nSize != src.m_nSize || m_nHash != src.m_nHash) {
+		return false;
+	}
+	
+	if( ! m_bDense && ! src.m_bDense) {
+		return m_vElems == src.m_vElems;
+	}
+	
+	if(m_bDense && src.m_bDense) {
+		
+		const vector<unsigned int> &vnShort = (m_vnBits.size() < src.m_vnBits.size())? m_vnBits: src.m_vnBits;
+		const vector<unsigned int> &vnLong = (m_vnBits.size() < src.m_vnBits.size())? src.m_vnBits: m_vnBits;
+		for(unsigned int w = 0; w < vnLong.size(); ++w) {
+			
+			if(vnLong[w] != (w < vnShort.size()? vnShort[w]: 0u)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	
+	return std::equal(begin(), end(), src.begin());
+}
+
 }
@@ -29,6 +29,9 @@ using std::string;
 using std::set;
 #include <vector>
 using std::vector;
+#include <iterator>
+#include <algorithm>
+#include <cstddef>
 
 #include <cstring>
 #include <cstdlib>
@@ -554,82 +557,206 @@ public:
 
 
 // index set
+// elements are kept in ascending order, either in a sorted vector(sparse
+// representation) or in a word-packed bitset(dense representation);
+// representation is switched to bitset when it is smaller than the vector.
+// hash value is maintained on each update, it doesn't depend on representation
 class iset_t {
 
 public:
 	
 	typedef int value_type;
 	
-	typedef set<value_type> set_t;
+	// iterator visiting elements in ascending order
+	class const_iterator {
+		
+		friend class iset_t;
+		
+	public:
+		
+		typedef std::forward_iterator_tag iterator_category;
+		typedef iset_t::value_type value_type;
+		typedef std::ptrdiff_t difference_type;
+		typedef const value_type* pointer;
+		typedef const value_type& reference;
+		
+	private:
+		
+		const iset_t *m_pSet;
+		// index of element in sparse representation,
+		// or element itself in dense representation
+		value_type m_nPos;
+		
+		inline const_iterator(const iset_t *a_pSet, value_type a_nPos)
+		: m_pSet(a_pSet)
+		, m_nPos(a_nPos) {
+		}
+		
+	public:
+		
+		inline const_iterator(void)
+		: m_pSet(nullptr)
+		, m_nPos(0) {
+		}
+		
+		inline value_type operator*(void) const {
+			
+			return m_pSet->m_bDense? m_nPos: m_pSet->m_vElems[m_nPos];
+		}
+		
+		inline const_iterator& operator++(void) {
+			
+			m_nPos = m_pSet->m_bDense? m_pSet->nextBit(m_nPos + 1): m_nPos + 1;
+			return *this;
+		}
+		
+		inline const_iterator operator++(int) {
+			
+			const_iterator old = *this;
+			++(*this);
+			return old;
+		}
+		
+		inline bool operator==(const const_iterator &src) const {
+			
+			return m_nPos == src.m_nPos && m_pSet == src.m_pSet;
+		}
+		
+		inline bool operator!=(const const_iterator &src) const {
+			
+			return ! operator==(src);
+		}
+	};
 	
+	typedef const_iterator iterator;
 	
-	typedef set_t::iterator iterator;
-	typedef set_t::const_iterator const_iterator;
+private:
 	
-public:
-	iset_t(void){}
-	iset_t(const iset_t &src) {
+	enum {
+		// bits of a bitset word
+		WORD_BITS = 32,
+		// sets smaller than it are always sparse
+		DENSE_MIN_SIZE = 32
+	};
+	
+	// sorted elements in sparse representation
+	vector<value_type> m_vElems;
+	// bit words in dense representation
+	vector<unsigned int> m_vnBits;
+	bool m_bDense;
+	unsigned int m_nSize;
+	// sum of mixed elements, so it is independent of insertion order
+	size_t m_nHash;
+	
+private:
+	
+	inline static size_t hashElem(value_type e) {
 		
-		merge(src);
+		unsigned long long x = (unsigned long long)(unsigned int)e + 0x9e3779b97f4a7c15ULL;
+		x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+		x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+		return (size_t)(x ^ (x >> 31));
 	}
 	
-	inline const_iterator begin(void) const {
+	// position of the first set bit not less than @a_nFrom in dense representation,
+	// or end position if there is none
+	inline value_type nextBit(value_type a_nFrom) const {
 		
-		return m_iSet.begin();
-	}
-	inline iterator begin(void) {
+		const int nWords = (int)m_vnBits.size();
+		int w = a_nFrom / WORD_BITS;
+		if(w >= nWords) {
+			return nWords * WORD_BITS;
+		}
 		
-		return m_iSet.begin();
+		unsigned int nWord = m_vnBits[w] & (~0u << (a_nFrom % WORD_BITS));
+		while(_EQ(nWord, 0u)) {
+			if(++w >= nWords) {
+				return nWords * WORD_BITS;
+			}
+			nWord = m_vnBits[w];
+		}
+		return w * WORD_BITS + __builtin_ctz(nWord);
 	}
 	
-	inline const_iterator end(void) const {
-		
-		return m_iSet.end();
-	}
-	inline iterator end(void) {
+	inline value_type endPos(void) const {
 		
-		return m_iSet.end();
+		return m_bDense? (value_type)(m_vnBits.size() * WORD_BITS): (value_type)m_vElems.size();
 	}
 	
-	inline bool insert(value_type idx) {
-		
-		return (m_iSet.insert(idx)).second;
-		
+	// switch to bitset if it takes less space than sorted vector
+	void adjustRep(void);
+	// switch to sorted vector
+	void toSparse(void);
+	
+public:
+	
+	inline iset_t(void)
+	: m_bDense(false)
+	, m_nSize(0)
+	, m_nHash(0) {
 	}
 	
-	inline bool erase(value_type e) {
-		return (m_iSet.erase(e) > 0);
+	inline iset_t(const iset_t &src)
+	: m_vElems(src.m_vElems)
+	, m_vnBits(src.m_vnBits)
+	, m_bDense(src.m_bDense)
+	, m_nSize(src.m_nSize)
+	, m_nHash(src.m_nHash) {
 	}
 	
-	inline iset_t& merge(const iset_t& src) {
+	inline const_iterator begin(void) const {
 		
-		m_iSet.insert(src.begin(), src.end());
+		return const_iterator(this, m_bDense? nextBit(0): 0);
+	}
+	
+	inline const_iterator end(void) const {
 		
-		return *this;
+		return const_iterator(this, endPos());
 	}
 	
+	bool insert(value_type idx);
+	
+	bool erase(value_type e);
+	
+	iset_t& merge(const iset_t& src);
+	
 	inline bool empty(void) const {
-		return m_iSet.empty();
+		return _EQ(m_nSize, 0u);
 	}
 	
 	inline unsigned int size(void) const {
 		
-		return m_iSet.size();
+		return m_nSize;
+	}
+	
+	inline size_t hash(void) const {
+		
+		return m_nHash;
 	}
 	
 	inline void clear(void) {
 		
-		m_iSet.clear();
+		m_vElems.clear();
+		m_vnBits.clear();
+		m_bDense = false;
+		m_nSize = 0;
+		m_nHash = 0;
 	}
 	
-	inline bool operator==(const iset_t& src) const {
-
-		return this->m_iSet == src.m_iSet; 
+	bool operator==(const iset_t& src) const;
+	
+	inline bool operator!=(const iset_t& src) const {
+		
+		return ! operator==(src);
 	}
 	
+	// lexicographical comparison of ascending elements, same as std::set
 	inline bool operator<(const iset_t& src) const {
 
-		return this->m_iSet < src.m_iSet;
+		if( ! m_bDense && ! src.m_bDense) {
+			return m_vElems < src.m_vElems;
+		}
+		return std::lexicographical_compare(begin(), end(), src.begin(), src.end());
 	}
 	
 	inline iset_t& operator=(const iset_t& src) {
@@ -638,20 +765,23 @@ public:
 			
 			return *this;
 		}
-		clear();
-		merge(src);
+		m_vElems = src.m_vElems;
+		m_vnBits = src.m_vnBits;
+		m_bDense = src.m_bDense;
+		m_nSize = src.m_nSize;
+		m_nHash = src.m_nHash;
 		
 		return *this;
 	}
 	
 	inline bool include(value_type idx) const {
 		
-		return m_iSet.find(idx) != m_iSet.end();
+		if(m_bDense) {
+			return idx >= 0 && idx / WORD_BITS < (int)m_vnBits.size()
+					&& (m_vnBits[idx / WORD_BITS] & (1u << (idx % WORD_BITS)));
+		}
+		return std::binary_search(m_vElems.begin(), m_vElems.end(), idx);
 	}
-	
-private:
-	
-	set_t m_iSet;
 };
 
 typedef vector< iset_t* > viset_t;
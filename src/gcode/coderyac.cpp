@@ -7,6 +7,11 @@ A parser program in C++, generated by Upgen 0.5.4.
 #include <errno.h>
 #include <string.h>
 #include <sys/stat.h>
+#if !defined(_WIN32)
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 // update 14/12/17
 #include <vector>
 #include <unordered_map>
@@ -23,7 +28,7 @@ typedef bufbase_t *YYPBUFFER;
 
 #include "./coderyac.h"
 
-#line 33 "meta/coderyac.upg"
+#line 31 "meta/coderyac.upg"
 
 /*
     Upgen -- a scanner and parser generator.
@@ -67,12 +72,10 @@ using common_ns::strhelper_t;
 using coder_ns::ctoken_t;
 #include "../coder/cmacro.h"
 #include "../coder/cmcond.h"
-#include "../coder/dmmap.h"
-#include "../coder/coder.h"
 #include "../coder/cmmgr.h"
-using coder_ns::coder_t;
+#include "../coder/cspec.h"
+using coder_ns::cspec_t;
 using coder_ns::cmacro_mgr_t;
-using coder_ns::dmmap_t;
 using coder_ns::vterm_t;
 using coder_ns::cmacro_t;
 using coder_ns::cond_t;
@@ -84,7 +87,7 @@ using coder_ns::vmac2cond_t;
 using coder_ns::cmacro_term_t;
 
 
-#line 87 "gcode/coderyac.cpp"
+#line 90 "gcode/coderyac.cpp"
 namespace coder_nsx {
 enum {
 INC_YYTEXT_SIZE = 4096,
@@ -95,7 +98,7 @@ END_OF_ALLFILE = 257,
 INITIAL = 0,
 
 // number of DFA states of scanner
-LEX_STATE_COUNT = 174,
+LEX_STATE_COUNT = 171,
 
 // DFA trap-state of scanner
 LEX_ERROR_STATE = 0,
@@ -133,7 +136,7 @@ PARSE_BMAP_ROWSIZE = 6,
 // base address of indexes of types (aka non-terminals or variables)
 PARSE_TYPE_BASE = 43,
 // number of symbols in parser
-PARSE_SYMBOL_COUNT = 75,
+PARSE_SYMBOL_COUNT = 74,
 
 // number of symbols in parser
 PARSE_TOKENMAP_SIZE = 291,
@@ -145,11 +148,11 @@ PARSE_START_STATE = 1,
 PARSE_ACCEPT_STATE = 5,
 
 // illegal state for parser
-PARSE_ERROR_STATE  = 145,
+PARSE_ERROR_STATE  = 144,
 
 // special ID of invalid rule for parser, indicating current lookahead
 // symbol can not be shifted
-PERROR_RULE = 77,
+PERROR_RULE = 76,
 
 
 MAX_MSG_LENG = 128,
@@ -220,6 +223,10 @@ public:
 	virtual int unget(void) = 0;
 	virtual int unget(int num) = 0;
 	virtual int put(char) = 0;
+	// start of next token if it can be referred in place, otherwise NULL
+	virtual char* textptr(void) { return NULL; }
+	// count of chars read from start of input
+	virtual long tell(void) const { return (long)(gptr + 1 - pbase); }
 
 	inline void reset(void) {
 		xreset();
@@ -316,7 +323,7 @@ inline static const char* sym_text__(const char* ps) {
 	return ps;
 }
 
-static void yyemit_error__(const char *s, coder_t &coder, dmmap_t &dmap, cmacro_mgr_t &cmmgr);
+static void yyemit_error__(const char *s, cspec_t &spec, cmacro_mgr_t &cmmgr);
 
 class yyparser_t {
 
@@ -350,6 +357,7 @@ private:
 				gend = &buf[0];
 				eos = false;
 				bpeeked = false;
+				nfilled = 0;
 			}
 
 		public:
@@ -490,13 +498,26 @@ private:
 				if(ncnt > vacents) {
 					pbase = buf + ((gend - buf) + 1) % BUF_FULL_SIZE;
 				}
+				nfilled += ncnt;
 				return ncnt;
 			}
 
+		public:
+
+			// chars filled so far, less those not read yet
+			virtual long tell(void) const {
+
+				if(gptr == gend) {
+					return nfilled;
+				}
+				return nfilled - ((gend - gptr) + BUF_FULL_SIZE - 1) % BUF_FULL_SIZE;
+			}
+
 		private:
 
 			bool bpeeked;
 			FILE *pfile;
+			long nfilled;
 			by_te_t buf[BUF_FULL_SIZE];
 		};
 
@@ -600,10 +621,158 @@ private:
 				return oldc;
 			}
 
+			virtual char* textptr(void) {
+				return (char*)((gptr == gend)? gend : gptr + 1);
+			}
+
 		private:
 			bool bowner;
 		};
 
+	private:
+
+		// whole file mapped into memory, read linearly without refilling,
+		// so matched text can be referred in place instead of being copied
+		class mmapbuf_t: public bufbase_t {
+
+			friend class bufmgr_t;
+		public:
+
+			// nSize is length of file, one more zero byte follows the mapping
+			mmapbuf_t(by_te_t *pchMap, size_t nSize)
+			: nmap(nSize + 1) {
+
+				pbase = pchMap;
+				gend = pbase + nSize;
+				xreset();
+				imod = false;
+				line = 1;
+				col = 1;
+				tab = 4;
+				pvoid = NULL;
+			}
+
+			virtual ~mmapbuf_t(void) {
+#if !defined(_WIN32)
+				munmap(pbase, nmap);
+#else
+				delete [] pbase;
+#endif
+			}
+
+		public:
+
+			virtual void xreset(void) {
+
+				gptr = pbase - 1;
+				eos = false;
+			}
+			virtual int get(void) {
+
+				if(gptr == gend) {
+					eos = true;
+					return END_OF_ALLFILE;
+				}
+				++gptr;
+
+				return (gptr == gend)? END_OF_FILE : (int)(*gptr);
+			}
+
+			virtual int peek(void) {
+
+				return (gptr == gend) ? (eos ? END_OF_ALLFILE: END_OF_FILE) : 
+					(int)(*(gptr + 1));
+			}
+			virtual int unget(void) {
+				if(eos || (pbase - 1 == gptr)) {
+					return END_OF_FILE;
+				}
+				return (int)(*gptr--);
+			}
+			virtual int unget(int num) {
+
+				if(eos || (pbase - 1 == gptr)) {
+					return 0;
+				}
+				if(gptr - pbase + 1 < num) {
+					num = (int)(gptr - pbase + 1);
+				}
+				gptr -= num;
+
+				return num;
+			}
+
+			virtual int put(char c) {
+
+				if(eos || (pbase - 1 == gptr)) {
+					return END_OF_FILE;
+				}
+
+				int oldc = (int)(*gptr);
+
+				*gptr-- = (by_te_t)c;
+
+				return oldc;
+			}
+
+			virtual char* textptr(void) {
+				return (char*)((gptr == gend)? gend : gptr + 1);
+			}
+
+			// map file @pchFile privately, return NULL on failure
+			static mmapbuf_t* create(const char *pchFile) {
+
+				by_te_t *pmap;
+				size_t nsize;
+#if !defined(_WIN32)
+				struct stat st;
+				int fd = open(pchFile, O_RDONLY);
+				if(fd < 0) {
+					return NULL;
+				}
+				if(fstat(fd, &st) != 0) {
+					close(fd);
+					return NULL;
+				}
+				nsize = (size_t)st.st_size;
+				// reserve one more zero byte, then map the file over it,
+				// pages are copied on write only, for NULL-terminating yytext
+				void *p = mmap(NULL, nsize + 1, PROT_READ | PROT_WRITE,
+						MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+				if(MAP_FAILED == p) {
+					close(fd);
+					return NULL;
+				}
+				if(nsize > 0 && MAP_FAILED == mmap(p, nsize, PROT_READ | PROT_WRITE,
+						MAP_PRIVATE | MAP_FIXED, fd, 0)) {
+					munmap(p, nsize + 1);
+					close(fd);
+					return NULL;
+				}
+				close(fd);
+				pmap = (by_te_t*)p;
+#else
+				FILE *pfile = fopen(pchFile, "rb");
+				if( !pfile) {
+					return NULL;
+				}
+				fseek(pfile, 0, SEEK_END);
+				nsize = (size_t)ftell(pfile);
+				fseek(pfile, 0, SEEK_SET);
+				MYNEWS(pmap, by_te_t, nsize + 1);
+				nsize = fread(pmap, 1, nsize, pfile);
+				pmap[nsize] = '\0';
+				fclose(pfile);
+#endif
+				mmapbuf_t *pbuf;
+				MYNEW(pbuf, mmapbuf_t(pmap, nsize));
+				return pbuf;
+			}
+
+		private:
+			size_t nmap;
+		};
+
 	private:
 
 		struct link_t {
@@ -619,13 +788,16 @@ private:
 	public:
 
 		bufmgr_t(void)
-		: phead(NULL) {
+		: phead(NULL)
+		, pretired(NULL)
+		, bdefer(false) {
 
 			MYNEW(pstdin, filebuf_t);
 			MYNEW(pavail, link_t(pstdin, NULL));
 		}
 		~bufmgr_t(void) {
 
+			purge();
 			while(pavail) {
 
 				link_t *p = pavail->plink;
@@ -692,6 +864,12 @@ private:
 				phead->pxbuf->reset();
 			}
 		}
+		inline char* textptr(void) {
+			return phead? phead->pxbuf->textptr(): NULL;
+		}
+		inline long tell(void) const {
+			return phead? phead->pxbuf->tell(): 0;
+		}
 		inline void pushlsz(int nlsize) {
 			if(phead) {
 				phead->pxbuf->pushlsz(nlsize);
@@ -756,6 +934,16 @@ private:
 
 			return p;
 		}
+		inline bufbase_t* newmmap(const char * pchFile) {
+
+			mmapbuf_t *p = mmapbuf_t::create(pchFile);
+			if( !p) {
+				return NULL;
+			}
+			MYNEW(pavail->plink, link_t(p, pavail->plink));
+
+			return p;
+		}
 		
 		inline bufbase_t* switchto(bufbase_t* pbuf) {
 
@@ -801,14 +989,37 @@ private:
 					link_t *q = p->plink;
 					p->plink = q->plink;
 
-					delete pxb;
-					delete q;
+					if(bdefer) {
+						q->plink = pretired;
+						pretired = q;
+					}
+					else {
+						delete pxb;
+						delete q;
+					}
 				}
 			}
 		}
+
+		// buffers destroyed while deferring are kept until purged,
+		// so text referred in place is still valid
+		inline void defer(bool bd) {
+			bdefer = bd;
+		}
+		void purge(void) {
+
+			while(pretired) {
+				link_t *p = pretired;
+				pretired = p->plink;
+				delete p->pxbuf;
+				delete p;
+			}
+		}
 		
 		void destroyall(void) {
 
+			purge();
+
 			while(pavail->plink) {
 				link_t *p = pavail->plink;
 				pavail->plink = p->plink;
@@ -854,58 +1065,63 @@ private:
 		link_t *phead;
 		// available buffer stack
 		link_t *pavail;
+		// buffers destroyed but not deleted yet
+		link_t *pretired;
+		bool bdefer;
 		// stdin buffer
 		bufbase_t *pstdin;
 	};
 
 
+    // stack on contiguous storage, which is reserved once and reused,
+    // popped elements are left to be overwritten by following pushes
     template<class ElemType, int INIT_SIZE = 4096>
     class sstack_t {
     public:
-        inline sstack_t(void) {
-
+        inline sstack_t(void)
+        : mTop(0) {
+            mStk.resize(INIT_SIZE);
         }
 
-        inline void push(void) {
-            mStk.push_back(ElemType());
+        inline ElemType& push(void) {
+            if(mTop == (int)mStk.size()) {
+                mStk.resize(mStk.size() * 2 + 1);
+            }
+            return mStk[mTop++];
         }
         inline void push(const ElemType &e) {
-            mStk.push_back(e);
+            push() = e;
         }
         inline ElemType& top(void) {
-            return mStk.back();
+            return mStk[mTop - 1];
         }
         inline const ElemType& top(void) const {
-            return mStk.back();
+            return mStk[mTop - 1];
         }
         inline void pop(int n) {
-            while(n > 0 && !mStk.empty()) {
-                mStk.pop_back();
-                n--;
-            }
+            mTop = (n < mTop)? mTop - n : 0;
         }
         inline ElemType& operator[](int down) {
-            const auto sz = (int) mStk.size();
-            return mStk[sz - 1 - down];
+            return mStk[mTop - 1 - down];
         }
         inline const ElemType& operator[](int down) const {
-            const auto sz = (int) mStk.size();
-            return mStk[sz - 1 - down];
+            return mStk[mTop - 1 - down];
         }
 
         inline bool empty(void) const {
-            return mStk.empty();
+            return mTop == 0;
         }
 
         inline int count(void) const {
-            return (int)mStk.size();
+            return mTop;
         }
 
         inline void clear(void) {
-            mStk.clear();
+            mTop = 0;
         }
     private:
         std::vector<ElemType> mStk;
+        int mTop;
     };
 
 
@@ -913,9 +1129,72 @@ private:
 
 	inline void renew_text__(void) {
 
-		MYRENEW(yytext, char, INC_YYTEXT_SIZE + yysize__, yysize__);
+		bool bown = (yytext == yytbuf__);
+		MYRENEW(yytbuf__, char, INC_YYTEXT_SIZE + yysize__, yysize__);
 		yysize__ += INC_YYTEXT_SIZE;
-		yytext[yysize__ - 1] = '\0';
+		yytbuf__[yysize__ - 1] = '\0';
+		if(bown) {
+			yytext = yytbuf__;
+		}
+	}
+
+	// put back the char overwritten by terminating NULL of in-place yytext
+	inline void yyunhold__(void) {
+		if(yyhold_ptr__) {
+			*yyhold_ptr__ = yyhold_char__;
+			yyhold_ptr__ = NULL;
+		}
+	}
+
+	// terminate yytext at @n, the char there is held if yytext is in place
+	inline void yyend_text__(int n) {
+		if(yytext != yytbuf__) {
+			yyunhold__();
+			yyhold_ptr__ = yytext + n;
+			yyhold_char__ = *yyhold_ptr__;
+		}
+		yytext[n] = '\0';
+	}
+
+	// set up yytext for next token: refer to the input in place if current
+	// buffer allows it, otherwise copy matched chars into own text buffer
+	inline void yynew_text__(bool bmore) {
+		yyunhold__();
+		char *p = yybufmgr__.textptr();
+		if(!bmore) {
+			if(p) {
+				yytext = p;
+			}
+			else {
+				yytext = yytbuf__;
+				yytext[0] = '\0';
+			}
+		}
+		else if(yytext != yytbuf__ && yytext + yylaleng != p) {
+			// text to be appended is not adjacent any more
+			yyown_text__();
+		}
+	}
+
+	// copy in-place yytext into own text buffer
+	inline void yyown_text__(void) {
+		if(yytext != yytbuf__) {
+			yyunhold__();
+			while(yylaleng >= yysize__ - 1) {
+				renew_text__();
+			}
+			memcpy(yytbuf__, yytext, yylaleng);
+			yytext = yytbuf__;
+			yytext[yylaleng] = '\0';
+		}
+	}
+
+	inline void yyreset_text__(void) {
+		yyunhold__();
+		yytext = yytbuf__;
+		if(yytext) {
+			yytext[0] = '\0';
+		}
 	}
 
 	inline bool yylex_is_running__(void) const {
@@ -941,7 +1220,7 @@ private:
 		}
 	}
 
-	friend void yyemit_error__(const char *s, coder_t &coder, dmmap_t &dmap, cmacro_mgr_t &cmmgr);
+	friend void yyemit_error__(const char *s, cspec_t &spec, cmacro_mgr_t &cmmgr);
 
 private:
 	// update 16/12/17
@@ -985,7 +1264,7 @@ private:
 	inline int yyget_prule__(int s) const {
 		return s - (PARSE_ERROR_STATE + 1);
 	}
-	inline void yydiscard__(xstype_t &yydval, xltype_t  &yydloc, int yydsymb, coder_t &coder, dmmap_t &dmap, cmacro_mgr_t &cmmgr) {
+	inline void yydiscard__(xstype_t &yydval, xltype_t  &yydloc, int yydsymb, cspec_t &spec, cmacro_mgr_t &cmmgr) {
 	
 	}
 	inline int yynext_pstate__(int s, int t) const {
@@ -1021,6 +1300,10 @@ public:
 	, yytext(NULL)
 	, yyleng(0)
 	, yylaleng(0)
+	, yytbuf__(NULL)
+	, yyhold_ptr__(NULL)
+	, yyhold_char__('\0')
+	, yyrule__(LEX_ERROR_RULE)
 	, yyerr_flag__(false)
 	, yyltok(PARSE_UNDEFSYMB_ID)
 	, yylexer(plex)
@@ -1031,8 +1314,8 @@ public:
 	}
     ~yyparser_t(void) {
 
-		if(yytext) {
-			delete[] yytext;
+		if(yytbuf__) {
+			delete[] yytbuf__;
 		}
 
 	}
@@ -1046,7 +1329,22 @@ public:
 		
 		yy_switch_buffer(pbuf);
 
-		if(!yytext) {
+		if(!yytbuf__) {
+			renew_text__();
+		}
+		return yy_has_buffer();
+	}
+
+	inline bool yylexinit__(const char *pchFile) {
+
+		YYPBUFFER pbuf = yy_new_mmapbuf(pchFile);
+		if( !pbuf ) {
+			return false;
+		}
+		
+		yy_switch_buffer(pbuf);
+
+		if(!yytbuf__) {
 			renew_text__();
 		}
 		return yy_has_buffer();
@@ -1062,7 +1360,7 @@ public:
 
 		yy_switch_buffer(pbuf);
 
-		if(!yytext) {
+		if(!yytbuf__) {
 			renew_text__();
 		}
 		return yy_has_buffer();
@@ -1078,13 +1376,13 @@ public:
 
 		yy_switch_buffer(pbuf);
 
-		if(!yytext) {
+		if(!yytbuf__) {
 			renew_text__();
 		}
 		return yy_has_buffer();
 	}
 
-	int yylex__(coder_t &coder, dmmap_t &dmap, cmacro_mgr_t &cmmgr) {
+	int yylex__(cspec_t &spec, cmacro_mgr_t &cmmgr) {
 		
 		if( !yy_has_buffer()) {yyecode__ = YYE_EOS; return 0;}
 
@@ -1095,18 +1393,18 @@ public:
 		bool yylast_at_bol__ = yyat_bol__;
 		bool bwrap__ = false;
 		
-#line 97 "meta/coderyac.upg"
+#line 93 "meta/coderyac.upg"
 
 	int c;
 
-#line 1102 "gcode/coderyac.cpp"
+#line 1400 "gcode/coderyac.cpp"
 
 		yymore_flag__ = false;
 		yyecode__ = YYE_ALIVE;
 		
 		yyleng = 0;
 		yylaleng = 0;
-		yytext[0] = '\0';
+		yynew_text__(false);
 
 		
 
@@ -1124,11 +1422,12 @@ public:
 
 			if(LEX_ERROR_STATE != yylstate__) {
 
-				if(yylaleng >= yysize__ - 1) {
-					renew_text__();
+				if(yytext == yytbuf__) {
+					if(yylaleng >= yysize__ - 1) {
+						renew_text__();
+					}
+					yytext[yylaleng] = (char)yycchar__;
 				}
-				yytext[yylaleng] = (char)yycchar__;
-
 				++yylaleng;
 
 				if(yyget_lexrule__(yylstate__) != LEX_ERROR_RULE) {
@@ -1155,7 +1454,7 @@ public:
 						yybufmgr__.unget(yylaleng + 1 - yyaccleng__);
 					}
 					yylaleng = yyaccleng__;
-					yytext[yylaleng] = '\0';
+					yyend_text__(yylaleng);
 				 yyleng = yylaleng;
 				}
 
@@ -1190,9 +1489,10 @@ public:
 			}
 				}
 
+		yyrule__ = yylrule__;
 		bwrap__ = (yylrule__ >= LEX_EOFRULE_BASE
 			&& yylrule__ < LEX_EOAF_RULE
-			&& yywrap__(coder, dmap, cmmgr));
+			&& yywrap__(spec, cmmgr));
 
 		if(!bwrap__) {
 				switch(yylrule__) {
@@ -1200,124 +1500,52 @@ public:
 case 0:
 {
 	
-#line 146 "meta/coderyac.upg"
+#line 138 "meta/coderyac.upg"
 		{
 		
-		if(coder.isThrowAway()) {
+        yylval.m_textVal = new int2pstr_t;
+        yylval.m_textVal->second = new string;
+        yylval.m_textVal->first = 0;
+		c = yyinput();
 		
-            yylval.m_textVal = nullptr;
-			
-			while((c = yyinput()) != END_OF_FILE) {
-			
-				switch(c) {
-
-				case ']':
-				
-					if((c = yyinput()) == ']') {
-						if((c = yyinput()) == '>') {
-							c = END_OF_FILE;
-						}
-						else {
-							yyunput(c);
-						}
-					}
-					else {
-						yyunput(c);
-					}
-					
-					break;
-					
-				default:
-	
-					break;
-				}
-				
-				if(END_OF_FILE == c) {
-					break;
-				}
-			}
-		}
-		else {
-			
-            yylval.m_textVal = new int2pstr_t;
-            yylval.m_textVal->second = new string;
-            yylval.m_textVal->first = 0;
-			c = yyinput();
-			
-			while(END_OF_FILE != c) {
+		while(END_OF_FILE != c) {
+		
+			if(']' == c) {
 			
+				c = yyinput();
 				if(']' == c) {
-				
 					c = yyinput();
-					if(']' == c) {
-						c = yyinput();
-						if(c != '>') {
-                            (*yylval.m_textVal->second) += ']';
-                            (*yylval.m_textVal->second) += ']';
-						}
-						else {
-							break;
-						}
+					if(c != '>') {
+                        (*yylval.m_textVal->second) += ']';
+                        (*yylval.m_textVal->second) += ']';
 					}
 					else {
-                        (*yylval.m_textVal->second) += ']';
+						break;
 					}
 				}
-				else if('&' == c) {
+				else {
+                    (*yylval.m_textVal->second) += ']';
+				}
+			}
+			else if('&' == c) {
+				c = yyinput();
+				switch(c) {
+				case '&':
 					c = yyinput();
 					switch(c) {
-					case '&':
-						c = yyinput();
-						switch(c) {
-						case 'g':
-							c = yyinput();
-							if('t' == c) {
-								c = yyinput();
-								if(';' == c) {
-                                    (*yylval.m_textVal->second) += "&gt;";
-								}
-								else {
-                                    (*yylval.m_textVal->second) += "&&gt";
-								}
-							}
-							else {
-                                (*yylval.m_textVal->second) += "&&g";
-							}
-							break;
-						case 'l':
-							c = yyinput();
-							if('t' == c) {
-								c = yyinput();
-								if(';' == c) {
-                                    (*yylval.m_textVal->second) += "&lt;";
-								}
-								else {
-                                    (*yylval.m_textVal->second) += "&&lt";
-								}
-							}
-							else {
-                                (*yylval.m_textVal->second) += "&&l";
-							}
-							break;
-						default:
-                            (*yylval.m_textVal->second) += "&&";
-							break;
-						}
-						break;
 					case 'g':
 						c = yyinput();
 						if('t' == c) {
 							c = yyinput();
 							if(';' == c) {
-                                (*yylval.m_textVal->second) += '>';
-								c = yyinput();
+                                (*yylval.m_textVal->second) += "&gt;";
 							}
 							else {
-                                (*yylval.m_textVal->second) += "&gt";
+                                (*yylval.m_textVal->second) += "&&gt";
 							}
 						}
 						else {
-                            (*yylval.m_textVal->second) += "&g";
+                            (*yylval.m_textVal->second) += "&&g";
 						}
 						break;
 					case 'l':
@@ -1325,31 +1553,66 @@ case 0:
 						if('t' == c) {
 							c = yyinput();
 							if(';' == c) {
-                                (*yylval.m_textVal->second) += '<';
-								c = yyinput();
+                                (*yylval.m_textVal->second) += "&lt;";
 							}
 							else {
-                                (*yylval.m_textVal->second) += "&lt";
+                                (*yylval.m_textVal->second) += "&&lt";
 							}
 						}
 						else {
-                            (*yylval.m_textVal->second) += "&l";
+                            (*yylval.m_textVal->second) += "&&l";
 						}
 						break;
 					default:
-                        (*yylval.m_textVal->second) += '&';
+                        (*yylval.m_textVal->second) += "&&";
 						break;
 					}
-				}
-				
-				if(END_OF_FILE != c) {
-					if(']' != c && '&' != c) {
-						if('\n' == c) {
-                            ++yylval.m_textVal->first;
+					break;
+				case 'g':
+					c = yyinput();
+					if('t' == c) {
+						c = yyinput();
+						if(';' == c) {
+                            (*yylval.m_textVal->second) += '>';
+							c = yyinput();
 						}
-                        (*yylval.m_textVal->second) += c;
+						else {
+                            (*yylval.m_textVal->second) += "&gt";
+						}
+					}
+					else {
+                        (*yylval.m_textVal->second) += "&g";
+					}
+					break;
+				case 'l':
+					c = yyinput();
+					if('t' == c) {
 						c = yyinput();
+						if(';' == c) {
+                            (*yylval.m_textVal->second) += '<';
+							c = yyinput();
+						}
+						else {
+                            (*yylval.m_textVal->second) += "&lt";
+						}
 					}
+					else {
+                        (*yylval.m_textVal->second) += "&l";
+					}
+					break;
+				default:
+                    (*yylval.m_textVal->second) += '&';
+					break;
+				}
+			}
+			
+			if(END_OF_FILE != c) {
+				if(']' != c && '&' != c) {
+					if('\n' == c) {
+                        ++yylval.m_textVal->first;
+					}
+                    (*yylval.m_textVal->second) += c;
+					c = yyinput();
 				}
 			}
 		}
@@ -1358,7 +1621,7 @@ case 0:
 	}
 	
 
-#line 1361 "gcode/coderyac.cpp"
+#line 1624 "gcode/coderyac.cpp"
 
 	}
 	break;
@@ -1366,11 +1629,11 @@ case 0:
 case 1:
 {
 	
-#line 302 "meta/coderyac.upg"
+#line 257 "meta/coderyac.upg"
 		return yytext[0];
 
 
-#line 1373 "gcode/coderyac.cpp"
+#line 1636 "gcode/coderyac.cpp"
 
 	}
 	break;
@@ -1378,11 +1641,11 @@ case 1:
 case 2:
 {
 	
-#line 304 "meta/coderyac.upg"
+#line 259 "meta/coderyac.upg"
 			return LBL_HAS;
 
 
-#line 1385 "gcode/coderyac.cpp"
+#line 1648 "gcode/coderyac.cpp"
 
 	}
 	break;
@@ -1390,11 +1653,11 @@ case 2:
 case 3:
 {
 	
-#line 306 "meta/coderyac.upg"
+#line 261 "meta/coderyac.upg"
 			return LBL_EMPTY;
 
 
-#line 1397 "gcode/coderyac.cpp"
+#line 1660 "gcode/coderyac.cpp"
 
 	}
 	break;
@@ -1402,11 +1665,11 @@ case 3:
 case 4:
 {
 	
-#line 308 "meta/coderyac.upg"
+#line 263 "meta/coderyac.upg"
 			return LBL_EQUAL;
 
 
-#line 1409 "gcode/coderyac.cpp"
+#line 1672 "gcode/coderyac.cpp"
 
 	}
 	break;
@@ -1414,11 +1677,11 @@ case 4:
 case 5:
 {
 	
-#line 310 "meta/coderyac.upg"
+#line 265 "meta/coderyac.upg"
 		return LBL_UNEQUAL;
 
 
-#line 1421 "gcode/coderyac.cpp"
+#line 1684 "gcode/coderyac.cpp"
 
 	}
 	break;
@@ -1426,11 +1689,11 @@ case 5:
 case 6:
 {
 	
-#line 312 "meta/coderyac.upg"
+#line 267 "meta/coderyac.upg"
 			return LBL_END;
 
 
-#line 1433 "gcode/coderyac.cpp"
+#line 1696 "gcode/coderyac.cpp"
 
 	}
 	break;
@@ -1438,11 +1701,11 @@ case 6:
 case 7:
 {
 	
-#line 314 "meta/coderyac.upg"
+#line 269 "meta/coderyac.upg"
 			return 	LBL_LAST;
 
 
-#line 1445 "gcode/coderyac.cpp"
+#line 1708 "gcode/coderyac.cpp"
 
 	}
 	break;
@@ -1450,11 +1713,11 @@ case 7:
 case 8:
 {
 	
-#line 316 "meta/coderyac.upg"
+#line 271 "meta/coderyac.upg"
 			return LBL_MORE;
 
 
-#line 1457 "gcode/coderyac.cpp"
+#line 1720 "gcode/coderyac.cpp"
 
 	}
 	break;
@@ -1462,11 +1725,11 @@ case 8:
 case 9:
 {
 	
-#line 318 "meta/coderyac.upg"
+#line 273 "meta/coderyac.upg"
 	return LBL_GROUPFIRST;
 
 
-#line 1469 "gcode/coderyac.cpp"
+#line 1732 "gcode/coderyac.cpp"
 
 	}
 	break;
@@ -1474,11 +1737,11 @@ case 9:
 case 10:
 {
 	
-#line 320 "meta/coderyac.upg"
+#line 275 "meta/coderyac.upg"
 		return LBL_GROUP;
 
 
-#line 1481 "gcode/coderyac.cpp"
+#line 1744 "gcode/coderyac.cpp"
 
 	}
 	break;
@@ -1486,11 +1749,11 @@ case 10:
 case 11:
 {
 	
-#line 322 "meta/coderyac.upg"
+#line 277 "meta/coderyac.upg"
 			return LBL_MOD;
 
 
-#line 1493 "gcode/coderyac.cpp"
+#line 1756 "gcode/coderyac.cpp"
 
 	}
 	break;
@@ -1498,11 +1761,11 @@ case 11:
 case 12:
 {
 	
-#line 324 "meta/coderyac.upg"
+#line 279 "meta/coderyac.upg"
 			return LBL_TRUE;
 
 
-#line 1505 "gcode/coderyac.cpp"
+#line 1768 "gcode/coderyac.cpp"
 
 	}
 	break;
@@ -1510,11 +1773,11 @@ case 12:
 case 13:
 {
 	
-#line 326 "meta/coderyac.upg"
+#line 281 "meta/coderyac.upg"
 			return LBL_FALSE;
 
 
-#line 1517 "gcode/coderyac.cpp"
+#line 1780 "gcode/coderyac.cpp"
 
 	}
 	break;
@@ -1522,11 +1785,11 @@ case 13:
 case 14:
 {
 	
-#line 328 "meta/coderyac.upg"
+#line 283 "meta/coderyac.upg"
 		return LBL_SCALAR;
 	
 
-#line 1529 "gcode/coderyac.cpp"
+#line 1792 "gcode/coderyac.cpp"
 
 	}
 	break;
@@ -1534,11 +1797,11 @@ case 14:
 case 15:
 {
 	
-#line 330 "meta/coderyac.upg"
+#line 285 "meta/coderyac.upg"
 		return LBL_SETUPHEAD;
 	
 
-#line 1541 "gcode/coderyac.cpp"
+#line 1804 "gcode/coderyac.cpp"
 
 	}
 	break;
@@ -1546,11 +1809,11 @@ case 15:
 case 16:
 {
 	
-#line 332 "meta/coderyac.upg"
+#line 287 "meta/coderyac.upg"
 		return LBL_MSHEAD;
 	
 
-#line 1553 "gcode/coderyac.cpp"
+#line 1816 "gcode/coderyac.cpp"
 
 	}
 	break;
@@ -1558,11 +1821,11 @@ case 16:
 case 17:
 {
 	
-#line 334 "meta/coderyac.upg"
+#line 289 "meta/coderyac.upg"
 		return LBL_MSTAIL;
 	
 
-#line 1565 "gcode/coderyac.cpp"
+#line 1828 "gcode/coderyac.cpp"
 
 	}
 	break;
@@ -1570,11 +1833,11 @@ case 17:
 case 18:
 {
 	
-#line 336 "meta/coderyac.upg"
+#line 291 "meta/coderyac.upg"
 			return LBL_MACRO;
 	
 
-#line 1577 "gcode/coderyac.cpp"
+#line 1840 "gcode/coderyac.cpp"
 
 	}
 	break;
@@ -1582,11 +1845,11 @@ case 18:
 case 19:
 {
 	
-#line 338 "meta/coderyac.upg"
+#line 293 "meta/coderyac.upg"
 		return LBL_DEFAULTHEAD;
 	
 
-#line 1589 "gcode/coderyac.cpp"
+#line 1852 "gcode/coderyac.cpp"
 
 	}
 	break;
@@ -1594,11 +1857,11 @@ case 19:
 case 20:
 {
 	
-#line 340 "meta/coderyac.upg"
+#line 295 "meta/coderyac.upg"
 	return LBL_DEFAULTTAIL;
 
 
-#line 1601 "gcode/coderyac.cpp"
+#line 1864 "gcode/coderyac.cpp"
 
 	}
 	break;
@@ -1606,11 +1869,11 @@ case 20:
 case 21:
 {
 	
-#line 342 "meta/coderyac.upg"
+#line 297 "meta/coderyac.upg"
 			return LBL_CASEHEAD;
 
 
-#line 1613 "gcode/coderyac.cpp"
+#line 1876 "gcode/coderyac.cpp"
 
 	}
 	break;
@@ -1618,11 +1881,11 @@ case 21:
 case 22:
 {
 	
-#line 344 "meta/coderyac.upg"
+#line 299 "meta/coderyac.upg"
 		return LBL_CASETAIL;
 
 
-#line 1625 "gcode/coderyac.cpp"
+#line 1888 "gcode/coderyac.cpp"
 
 	}
 	break;
@@ -1630,11 +1893,11 @@ case 22:
 case 23:
 {
 	
-#line 346 "meta/coderyac.upg"
+#line 301 "meta/coderyac.upg"
 			return LBL_IFHEAD;
 
 
-#line 1637 "gcode/coderyac.cpp"
+#line 1900 "gcode/coderyac.cpp"
 
 	}
 	break;
@@ -1642,11 +1905,11 @@ case 23:
 case 24:
 {
 	
-#line 348 "meta/coderyac.upg"
+#line 303 "meta/coderyac.upg"
 			return LBL_IFTAIL;
 	
 
-#line 1649 "gcode/coderyac.cpp"
+#line 1912 "gcode/coderyac.cpp"
 
 	}
 	break;
@@ -1654,11 +1917,11 @@ case 24:
 case 25:
 {
 	
-#line 350 "meta/coderyac.upg"
+#line 305 "meta/coderyac.upg"
 		return LBL_ELSEHEAD;
 
 
-#line 1661 "gcode/coderyac.cpp"
+#line 1924 "gcode/coderyac.cpp"
 
 	}
 	break;
@@ -1666,11 +1929,11 @@ case 25:
 case 26:
 {
 	
-#line 352 "meta/coderyac.upg"
+#line 307 "meta/coderyac.upg"
 		return LBL_ELSETAIL;
 
 
-#line 1673 "gcode/coderyac.cpp"
+#line 1936 "gcode/coderyac.cpp"
 
 	}
 	break;
@@ -1678,11 +1941,11 @@ case 26:
 case 27:
 {
 	
-#line 354 "meta/coderyac.upg"
+#line 309 "meta/coderyac.upg"
 	return LBL_DECLARE;
 
 
-#line 1685 "gcode/coderyac.cpp"
+#line 1948 "gcode/coderyac.cpp"
 
 	}
 	break;
@@ -1690,11 +1953,11 @@ case 27:
 case 28:
 {
 	
-#line 356 "meta/coderyac.upg"
+#line 311 "meta/coderyac.upg"
 		return LBL_DEFINE;
 
 
-#line 1697 "gcode/coderyac.cpp"
+#line 1960 "gcode/coderyac.cpp"
 
 	}
 	break;
@@ -1702,11 +1965,11 @@ case 28:
 case 29:
 {
 	
-#line 358 "meta/coderyac.upg"
+#line 313 "meta/coderyac.upg"
 		return LBL_PHEAD;
 
 
-#line 1709 "gcode/coderyac.cpp"
+#line 1972 "gcode/coderyac.cpp"
 
 	}
 	break;
@@ -1714,11 +1977,11 @@ case 29:
 case 30:
 {
 	
-#line 360 "meta/coderyac.upg"
+#line 315 "meta/coderyac.upg"
 	return LBL_PTAIL;
 
 
-#line 1721 "gcode/coderyac.cpp"
+#line 1984 "gcode/coderyac.cpp"
 
 	}
 	break;
@@ -1726,19 +1989,14 @@ case 30:
 case 31:
 {
 	
-#line 362 "meta/coderyac.upg"
+#line 317 "meta/coderyac.upg"
 		{
-		if( ! coder.isThrowAway()) {
-			yytext[yyleng - 1] = '\0';
-            yylval.m_pstrVal = new string(&yytext[1]);
-		}
-		else {
-            yylval.m_pstrVal = nullptr;
-		}
+		yytext[yyleng - 1] = '\0';
+		yylval.m_pstrVal = new string(&yytext[1]);
 		return QUOTEDSTR;
 	}
 
-#line 1741 "gcode/coderyac.cpp"
+#line 1999 "gcode/coderyac.cpp"
 
 	}
 	break;
@@ -1746,18 +2004,13 @@ case 31:
 case 32:
 {
 	
-#line 372 "meta/coderyac.upg"
+#line 322 "meta/coderyac.upg"
 		{
-		if( ! coder.isThrowAway()) {		
-            yylval.m_pstrVal = new string(yytext);
-		}
-		else {
-            yylval.m_pstrVal = nullptr;
-		}
+		yylval.m_pstrVal = new string(yytext);
 		return CID;
 	}
 
-#line 1760 "gcode/coderyac.cpp"
+#line 2013 "gcode/coderyac.cpp"
 
 	}
 	break;
@@ -1765,7 +2018,7 @@ case 32:
 case 33:
 {
 	
-#line 381 "meta/coderyac.upg"
+#line 326 "meta/coderyac.upg"
 		{
 		
         strhelper_t::toSnum(yytext, yylval.m_nVal);
@@ -1773,7 +2026,7 @@ case 33:
 		return INTEGER;
 	}
 
-#line 1776 "gcode/coderyac.cpp"
+#line 2029 "gcode/coderyac.cpp"
 
 	}
 	break;
@@ -1781,11 +2034,11 @@ case 33:
 case 34:
 {
 	
-#line 387 "meta/coderyac.upg"
+#line 332 "meta/coderyac.upg"
 
 
 
-#line 1788 "gcode/coderyac.cpp"
+#line 2041 "gcode/coderyac.cpp"
 
 	}
 	break;
@@ -1793,11 +2046,11 @@ case 34:
 case 35:
 {
 	
-#line 388 "meta/coderyac.upg"
+#line 333 "meta/coderyac.upg"
 
 
 
-#line 1800 "gcode/coderyac.cpp"
+#line 2053 "gcode/coderyac.cpp"
 
 	}
 	break;
@@ -1805,12 +2058,12 @@ case 35:
 case 36:
 {
 	
-#line 389 "meta/coderyac.upg"
+#line 334 "meta/coderyac.upg"
 
 
 	
 
-#line 1813 "gcode/coderyac.cpp"
+#line 2066 "gcode/coderyac.cpp"
 
 	}
 	break;
@@ -1820,7 +2073,7 @@ case 37:
 	
 #line 0 "meta/coderyac.upg"
 
-#line 1823 "gcode/coderyac.cpp"
+#line 2076 "gcode/coderyac.cpp"
 
 	}
 	break;
@@ -1837,7 +2090,7 @@ case 37:
 					YYMSG_UNMATCHED[28] = yycchar__;
 					yyecode__ = YYE_UNMATCHED;
 					if(yyerror)
-						yyerror(YYMSG_UNMATCHED, coder, dmap, cmmgr);
+						yyerror(YYMSG_UNMATCHED, spec, cmmgr);
 				
 				break;
 				}
@@ -1859,10 +2112,11 @@ case 37:
 						yyaccleng__ = 0;
 						yylaleng = 0;
 						yyleng = 0;
-						yytext[yylaleng] = '\0';
+						yynew_text__(false);
 					}
 					else {
 						yymore_flag__ = false;
+						yynew_text__(true);
 					}
 				}
 			}
@@ -1871,21 +2125,44 @@ case 37:
 		return (yyecode__ == YYE_EOS)? 0 : yyecode__;
 	}
 
-	int yyparse__(coder_t &coder, dmmap_t &dmap, cmacro_mgr_t &cmmgr) {
+	// scan tokens into @out until @max of them are recorded, or scanner
+	// returns no token; text of token is referred in place if possible
+	int yylex_batch__(yytoken_t *out, int max, cspec_t &spec, cmacro_mgr_t &cmmgr) {
+
+		int n = 0;
+		int tok = 0;
+
+		// buffers of last call are not referred any more
+		yybufmgr__.purge();
+		yybufmgr__.defer(true);
+		while(n < max) {
+
+			tok = yylex__(spec, cmmgr);
+			if(tok <= 0) {
+				break;
+			}
+
+			yytoken_t &t = out[n++];
+			t.id = tok;
+			t.rule = yyrule__;
+			t.offset = yybufmgr__.tell() - yyleng;
+			t.length = yyleng;
+			t.text = (yytext == yytbuf__)? NULL : yytext;
+		}
+		yybufmgr__.defer(false);
+
+		return (n > 0 || tok >= 0)? n : tok;
+	}
+
+	int yyparse__(cspec_t &spec, cmacro_mgr_t &cmmgr) {
 
 		if( ! yylexer) {
 			return YYE_ABORT;
 		}
 
 		yyecode__ = YYE_ALIVE;
-		sstack_t<xstype_t> yys_sv__;
 		xstype_t yyval;
-
-		sstack_t<xltype_t> yys_loc__;
-
 		xltype_t yyloc;
-		sstack_t<int> yys_stt__;
-		sstack_t<int> yys_symb__;
 
 		int yyrplen__;
 		bool yyreducing__;
@@ -1900,9 +2177,10 @@ case 37:
 		yyerr_flag__ = false;
 
 
-		yys_stt__.push(yypstate__);
+		yystk__.clear();
+		yystk__.push().stt = yypstate__;
 
-		while( ! yys_stt__.empty() && yyparse_is_running__(yypstate__)) {
+		while( ! yystk__.empty() && yyparse_is_running__(yypstate__)) {
 			yyprule__ = yyget_defrule(yypstate__);
 			if(is_valid_prule__(yyprule__)) {
 				yyreducing__ = true;
@@ -1910,7 +2188,7 @@ case 37:
 			else {
 				if(PARSE_UNDEFSYMB_ID == yytok__) {
 					if(PARSE_UNDEFSYMB_ID == yyltok) {
-						yytok__ = (yylexer)(coder, dmap, cmmgr);
+						yytok__ = (yylexer)(spec, cmmgr);
 					}
 					else  {
 						yytok__ = yyltok;
@@ -1921,16 +2199,17 @@ case 37:
 				}
 
 
-				yypstate__ = yynext_pstate__(yys_stt__.top(), yysidx__);
+				yypstate__ = yynext_pstate__(yystk__.top().stt, yysidx__);
 
 				if(is_valid_pstate__(yypstate__)) {
 
 
-					yys_symb__.push(yysidx__);
-					yys_stt__.push(yypstate__);
-                    yys_sv__.push(yylval);
+					yyframe_t &yyf__ = yystk__.push();
+					yyf__.stt = yypstate__;
+					yyf__.symb = yysidx__;
+					yyf__.sv = yylval;
 
-                    yys_loc__.push(yylloc);
+					yyf__.loc = yylloc;
  
 					yytok__ = PARSE_UNDEFSYMB_ID;
 					yyreducing__ = false;
@@ -1946,1076 +2225,944 @@ case 37:
 				
 	case 0:
 	{
-#line 394 "meta/coderyac.upg"
+#line 339 "meta/coderyac.upg"
 
-#line 1951 "gcode/coderyac.cpp"
+#line 2230 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 1:
 	{
-#line 394 "meta/coderyac.upg"
+#line 339 "meta/coderyac.upg"
 
 
 			YYACCEPT();
 		
-#line 1963 "gcode/coderyac.cpp"
+#line 2242 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 2:
 	{
-#line 400 "meta/coderyac.upg"
+#line 345 "meta/coderyac.upg"
 
-			
-			if( ! coder.openStream(dmap)) {
-				YYABORT();
-			}
-		
-#line 1977 "gcode/coderyac.cpp"
+#line 2251 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 3:
 	{
-#line 408 "meta/coderyac.upg"
+#line 348 "meta/coderyac.upg"
 
 			
-			if( ! coder.addSetupItem(*(yys_sv__[2].m_pstrVal), *(yys_sv__[0].m_pstrVal))) {
-				
-				string strMsg = " description: setting item `";
-				strMsg += *(yys_sv__[2].m_pstrVal);
-				strMsg += "\' already exists, this setting is discarded.";
-				_WARNING(strMsg);
-			}
+			spec.addSetupItem(*(yystk__[2].sv.m_pstrVal), *(yystk__[0].sv.m_pstrVal));
 			
-			delete (yys_sv__[2].m_pstrVal);
-			delete (yys_sv__[0].m_pstrVal);
+			delete (yystk__[2].sv.m_pstrVal);
+			delete (yystk__[0].sv.m_pstrVal);
 		
-#line 1998 "gcode/coderyac.cpp"
+#line 2266 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 4:
 	{
-#line 421 "meta/coderyac.upg"
+#line 355 "meta/coderyac.upg"
 
 
-			if( ! coder.addSetupItem(*(yys_sv__[2].m_pstrVal), *(yys_sv__[0].m_pstrVal))) {
-				
-				string strMsg = " description: setting item `";
-				strMsg += *(yys_sv__[2].m_pstrVal);
-				strMsg += "\' already exists, this setting is discarded.";
-				_WARNING(strMsg);
-			}
+			spec.addSetupItem(*(yystk__[2].sv.m_pstrVal), *(yystk__[0].sv.m_pstrVal));
 			
-			delete (yys_sv__[2].m_pstrVal);
-			delete (yys_sv__[0].m_pstrVal);
+			delete (yystk__[2].sv.m_pstrVal);
+			delete (yystk__[0].sv.m_pstrVal);
 		
-#line 2019 "gcode/coderyac.cpp"
+#line 2281 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 5:
 	{
-#line 436 "meta/coderyac.upg"
+#line 364 "meta/coderyac.upg"
 
-#line 2028 "gcode/coderyac.cpp"
+#line 2290 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 6:
 	{
-#line 437 "meta/coderyac.upg"
+#line 365 "meta/coderyac.upg"
 
-#line 2037 "gcode/coderyac.cpp"
+#line 2299 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 7:
 	{
-#line 437 "meta/coderyac.upg"
+#line 365 "meta/coderyac.upg"
 
-#line 2046 "gcode/coderyac.cpp"
+#line 2308 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 8:
 	{
-#line 439 "meta/coderyac.upg"
+#line 367 "meta/coderyac.upg"
 
 
-			(yyval.m_pMac) = cmmgr.newMacro(*(yys_sv__[2].m_pstrVal));
-			for(int i = 0; i < (int)(yys_sv__[1].m_pvmac2Cond)->size(); ++i) {
+			(yyval.m_pMac) = cmmgr.newMacro(*(yystk__[2].sv.m_pstrVal));
+			for(int i = 0; i < (int)(yystk__[1].sv.m_pvmac2Cond)->size(); ++i) {
 			
-				(yyval.m_pMac)->addTerms((*(yys_sv__[1].m_pvmac2Cond))[i]->first, (*(yys_sv__[1].m_pvmac2Cond))[i]->second);
-				delete (*(yys_sv__[1].m_pvmac2Cond))[i];
+				(yyval.m_pMac)->addTerms((*(yystk__[1].sv.m_pvmac2Cond))[i]->first, (*(yystk__[1].sv.m_pvmac2Cond))[i]->second);
+				delete (*(yystk__[1].sv.m_pvmac2Cond))[i];
 			}
 			
-			delete (yys_sv__[1].m_pvmac2Cond);
-			delete (yys_sv__[2].m_pstrVal);
+			delete (yystk__[1].sv.m_pvmac2Cond);
+			delete (yystk__[2].sv.m_pstrVal);
 	
-#line 2066 "gcode/coderyac.cpp"
+#line 2328 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 9:
 	{
-#line 451 "meta/coderyac.upg"
+#line 379 "meta/coderyac.upg"
 
 	
-		(yyval.m_pMac) = cmmgr.newMacro(*(yys_sv__[2].m_pstrVal));
+		(yyval.m_pMac) = cmmgr.newMacro(*(yystk__[2].sv.m_pstrVal));
 		
-		(yyval.m_pMac)->addTerms((yys_sv__[1].m_pvmTerms));
+		(yyval.m_pMac)->addTerms((yystk__[1].sv.m_pvmTerms));
 		
-		delete (yys_sv__[2].m_pstrVal);
+		delete (yystk__[2].sv.m_pstrVal);
 	
-#line 2082 "gcode/coderyac.cpp"
+#line 2344 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 10:
 	{
-#line 461 "meta/coderyac.upg"
+#line 389 "meta/coderyac.upg"
 
 			
-			(yyval.m_pstrVal) = (yys_sv__[1].m_pstrVal);
+			(yyval.m_pstrVal) = (yystk__[1].sv.m_pstrVal);
 		
-#line 2094 "gcode/coderyac.cpp"
+#line 2356 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 11:
 	{
-#line 466 "meta/coderyac.upg"
+#line 394 "meta/coderyac.upg"
 
-#line 2103 "gcode/coderyac.cpp"
+#line 2365 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 12:
 	{
-#line 468 "meta/coderyac.upg"
+#line 396 "meta/coderyac.upg"
 
 			
 			(yyval.m_pvmac2Cond) = new vmac2cond_t;
-			(yyval.m_pvmac2Cond)->push_back((yys_sv__[0].m_pmac2Cond));
+			(yyval.m_pvmac2Cond)->push_back((yystk__[0].sv.m_pmac2Cond));
 		
-#line 2116 "gcode/coderyac.cpp"
+#line 2378 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 13:
 	{
-#line 473 "meta/coderyac.upg"
+#line 401 "meta/coderyac.upg"
 
 		
-			(yyval.m_pvmac2Cond) = (yys_sv__[1].m_pvmac2Cond);
-			(yyval.m_pvmac2Cond)->push_back((yys_sv__[0].m_pmac2Cond));
+			(yyval.m_pvmac2Cond) = (yystk__[1].sv.m_pvmac2Cond);
+			(yyval.m_pvmac2Cond)->push_back((yystk__[0].sv.m_pmac2Cond));
 		
-#line 2129 "gcode/coderyac.cpp"
+#line 2391 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 14:
 	{
-#line 479 "meta/coderyac.upg"
+#line 407 "meta/coderyac.upg"
 
 		
 			(yyval.m_pmac2Cond) = new mac2cond_pair_t;
-			(yyval.m_pmac2Cond)->first = (yys_sv__[1].m_pvmTerms);
+			(yyval.m_pmac2Cond)->first = (yystk__[1].sv.m_pvmTerms);
 			(yyval.m_pmac2Cond)->second = nullptr;
 		
-#line 2143 "gcode/coderyac.cpp"
+#line 2405 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 15:
 	{
-#line 485 "meta/coderyac.upg"
+#line 413 "meta/coderyac.upg"
 
 		
 			(yyval.m_pmac2Cond) = new mac2cond_pair_t;
-			(yyval.m_pmac2Cond)->first = (yys_sv__[1].m_pvmTerms);
-			(yyval.m_pmac2Cond)->second = (yys_sv__[2].m_pCpdcond);
+			(yyval.m_pmac2Cond)->first = (yystk__[1].sv.m_pvmTerms);
+			(yyval.m_pmac2Cond)->second = (yystk__[2].sv.m_pCpdcond);
 		
-#line 2157 "gcode/coderyac.cpp"
+#line 2419 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 16:
 	{
-#line 493 "meta/coderyac.upg"
+#line 421 "meta/coderyac.upg"
 
 
-			(yyval.m_pCpdcond) = (yys_sv__[1].m_pCpdcond);
+			(yyval.m_pCpdcond) = (yystk__[1].sv.m_pCpdcond);
 		
-#line 2169 "gcode/coderyac.cpp"
+#line 2431 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 17:
 	{
-#line 499 "meta/coderyac.upg"
+#line 427 "meta/coderyac.upg"
 
 			
-			assert((yys_sv__[0].m_pmTerm));
+			assert((yystk__[0].sv.m_pmTerm));
 			(yyval.m_pvmTerms) = new vterm_t;
-			(yyval.m_pvmTerms)->push_back((yys_sv__[0].m_pmTerm));
+			(yyval.m_pvmTerms)->push_back((yystk__[0].sv.m_pmTerm));
 		
-#line 2183 "gcode/coderyac.cpp"
+#line 2445 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 18:
 	{
-#line 505 "meta/coderyac.upg"
+#line 433 "meta/coderyac.upg"
 
 		
-			assert((yys_sv__[1].m_pvmTerms));
-			(yyval.m_pvmTerms) = (yys_sv__[1].m_pvmTerms);
-			(yyval.m_pvmTerms)->push_back((yys_sv__[0].m_pmTerm));			
+			assert((yystk__[1].sv.m_pvmTerms));
+			(yyval.m_pvmTerms) = (yystk__[1].sv.m_pvmTerms);
+			(yyval.m_pvmTerms)->push_back((yystk__[0].sv.m_pmTerm));			
 			
 		
-#line 2198 "gcode/coderyac.cpp"
+#line 2460 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 19:
 	{
-#line 513 "meta/coderyac.upg"
+#line 441 "meta/coderyac.upg"
 
-			if((yys_sv__[0].m_textVal) && (yys_sv__[0].m_textVal)->second) {
-				(yyval.m_pmTerm) = cmmgr.newTextTerm(*((yys_sv__[0].m_textVal)->second), (yys_sv__[0].m_textVal)->first);
-				delete (yys_sv__[0].m_textVal)->second;
-				delete (yys_sv__[0].m_textVal);
+			if((yystk__[0].sv.m_textVal) && (yystk__[0].sv.m_textVal)->second) {
+				(yyval.m_pmTerm) = cmmgr.newTextTerm(*((yystk__[0].sv.m_textVal)->second), (yystk__[0].sv.m_textVal)->first);
+				delete (yystk__[0].sv.m_textVal)->second;
+				delete (yystk__[0].sv.m_textVal);
 			}
 		
-#line 2213 "gcode/coderyac.cpp"
+#line 2475 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 20:
 	{
-#line 520 "meta/coderyac.upg"
+#line 448 "meta/coderyac.upg"
 
 		
-			if((yys_sv__[0].m_pmacRef)->second) {
+			if((yystk__[0].sv.m_pmacRef)->second) {
 				
-				(yyval.m_pmTerm) = cmmgr.newMacroTerm(*(yys_sv__[0].m_pmacRef)->first, *(yys_sv__[0].m_pmacRef)->second);
-				delete (yys_sv__[0].m_pmacRef)->second;
+				(yyval.m_pmTerm) = cmmgr.newMacroTerm(*(yystk__[0].sv.m_pmacRef)->first, *(yystk__[0].sv.m_pmacRef)->second);
+				delete (yystk__[0].sv.m_pmacRef)->second;
 			}
 			else {
 			
-				(yyval.m_pmTerm) = cmmgr.newMacroTerm(*(yys_sv__[0].m_pmacRef)->first);
+				(yyval.m_pmTerm) = cmmgr.newMacroTerm(*(yystk__[0].sv.m_pmacRef)->first);
 			}
-			delete (yys_sv__[0].m_pmacRef)->first;
-			delete (yys_sv__[0].m_pmacRef);
+			delete (yystk__[0].sv.m_pmacRef)->first;
+			delete (yystk__[0].sv.m_pmacRef);
 		
-#line 2235 "gcode/coderyac.cpp"
+#line 2497 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 21:
 	{
-#line 534 "meta/coderyac.upg"
+#line 462 "meta/coderyac.upg"
 
 			
-			string strVal;
-			if(dmap.getString(*(yys_sv__[2].m_pstrVal), strVal)) {
-			
-				(yyval.m_pmTerm) = cmmgr.newTextTerm(strVal, 0);
-			}
-			else {
-			
-				(yyval.m_pmTerm) = cmmgr.newTextTerm("", 0);
-			}
-			delete (yys_sv__[2].m_pstrVal);
+			(yyval.m_pmTerm) = cmmgr.newScalarTerm(*(yystk__[2].sv.m_pstrVal));
+			delete (yystk__[2].sv.m_pstrVal);
 		
-#line 2256 "gcode/coderyac.cpp"
+#line 2510 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 22:
 	{
-#line 547 "meta/coderyac.upg"
+#line 467 "meta/coderyac.upg"
 
 			
-			string strVal;
-			if(dmap.getString(*(yys_sv__[2].m_pstrVal), strVal)) {
-			
-				(yyval.m_pmTerm) = cmmgr.newTextTerm(strVal, 0);
-			}
-			else {
-			
-				(yyval.m_pmTerm) = cmmgr.newTextTerm("", 0);
-			}
-			delete (yys_sv__[2].m_pstrVal);
+			(yyval.m_pmTerm) = cmmgr.newScalarTerm(*(yystk__[2].sv.m_pstrVal));
+			delete (yystk__[2].sv.m_pstrVal);
 		
-#line 2277 "gcode/coderyac.cpp"
+#line 2523 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 23:
 	{
-#line 561 "meta/coderyac.upg"
+#line 473 "meta/coderyac.upg"
 
 
 			(yyval.m_pCpdcond) = cmmgr.newCompoundCond();
-			(yyval.m_pCpdcond)->addCondItem((yys_sv__[0].m_pcondItem));
+			(yyval.m_pCpdcond)->addCondItem((yystk__[0].sv.m_pcondItem));
 		
-#line 2290 "gcode/coderyac.cpp"
+#line 2536 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 24:
 	{
-#line 566 "meta/coderyac.upg"
+#line 478 "meta/coderyac.upg"
 
 		
-			(yyval.m_pCpdcond) = (yys_sv__[1].m_pCpdcond);
-			(yyval.m_pCpdcond)->addCondItem((yys_sv__[0].m_pcondItem));
+			(yyval.m_pCpdcond) = (yystk__[1].sv.m_pCpdcond);
+			(yyval.m_pCpdcond)->addCondItem((yystk__[0].sv.m_pcondItem));
 		
-#line 2303 "gcode/coderyac.cpp"
+#line 2549 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 25:
 	{
-#line 572 "meta/coderyac.upg"
+#line 484 "meta/coderyac.upg"
 
 
-			(yyval.m_pcondItem) = cmmgr.newOptCond(*(yys_sv__[2].m_pstrVal), (yys_sv__[0].m_nVal));
-			delete (yys_sv__[2].m_pstrVal);
+			(yyval.m_pcondItem) = cmmgr.newOptCond(*(yystk__[2].sv.m_pstrVal), (yystk__[0].sv.m_nVal));
+			delete (yystk__[2].sv.m_pstrVal);
 		
-#line 2316 "gcode/coderyac.cpp"
+#line 2562 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 26:
 	{
-#line 577 "meta/coderyac.upg"
+#line 489 "meta/coderyac.upg"
 
 		
-			(yyval.m_pcondItem) = cmmgr.newOptCond(*(yys_sv__[0].m_pstrVal), true);
-			delete (yys_sv__[0].m_pstrVal);
+			(yyval.m_pcondItem) = cmmgr.newOptCond(*(yystk__[0].sv.m_pstrVal), true);
+			delete (yystk__[0].sv.m_pstrVal);
 		
-#line 2329 "gcode/coderyac.cpp"
+#line 2575 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 27:
 	{
-#line 582 "meta/coderyac.upg"
+#line 494 "meta/coderyac.upg"
 
 		
-			(yyval.m_pcondItem) = cmmgr.newOptCond(*(yys_sv__[2].m_pstrVal), (yys_sv__[0].m_bVal));
-			delete (yys_sv__[2].m_pstrVal);
+			(yyval.m_pcondItem) = cmmgr.newOptCond(*(yystk__[2].sv.m_pstrVal), (yystk__[0].sv.m_bVal));
+			delete (yystk__[2].sv.m_pstrVal);
 		
-#line 2342 "gcode/coderyac.cpp"
+#line 2588 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 28:
 	{
-#line 587 "meta/coderyac.upg"
+#line 499 "meta/coderyac.upg"
 
 		
-			(yyval.m_pcondItem) = cmmgr.newOptCond(*(yys_sv__[2].m_pstrVal), *(yys_sv__[0].m_pstrVal));
-			delete (yys_sv__[2].m_pstrVal);
-			delete (yys_sv__[0].m_pstrVal);
+			(yyval.m_pcondItem) = cmmgr.newOptCond(*(yystk__[2].sv.m_pstrVal), *(yystk__[0].sv.m_pstrVal));
+			delete (yystk__[2].sv.m_pstrVal);
+			delete (yystk__[0].sv.m_pstrVal);
 		
-#line 2356 "gcode/coderyac.cpp"
+#line 2602 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 29:
 	{
-#line 593 "meta/coderyac.upg"
+#line 505 "meta/coderyac.upg"
 
 			
-			(yyval.m_pcondItem) = cmmgr.newERelCond(cond_elemrel_t::EOP_EQ, (yys_sv__[0].m_nVal));
+			(yyval.m_pcondItem) = cmmgr.newERelCond(cond_elemrel_t::EOP_EQ, (yystk__[0].sv.m_nVal));
 		
-#line 2368 "gcode/coderyac.cpp"
+#line 2614 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 30:
 	{
-#line 597 "meta/coderyac.upg"
+#line 509 "meta/coderyac.upg"
 
 
-			(yyval.m_pcondItem) = cmmgr.newERelCond(cond_elemrel_t::EOP_NE, (yys_sv__[0].m_nVal));	
+			(yyval.m_pcondItem) = cmmgr.newERelCond(cond_elemrel_t::EOP_NE, (yystk__[0].sv.m_nVal));	
 		
-#line 2380 "gcode/coderyac.cpp"
+#line 2626 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 31:
 	{
-#line 601 "meta/coderyac.upg"
+#line 513 "meta/coderyac.upg"
 
 			
-			(yyval.m_pcondItem) = cmmgr.newERelCond(cond_elemrel_t::EOP_EQ, (yys_sv__[0].m_bVal));
+			(yyval.m_pcondItem) = cmmgr.newERelCond(cond_elemrel_t::EOP_EQ, (yystk__[0].sv.m_bVal));
 		
-#line 2392 "gcode/coderyac.cpp"
+#line 2638 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 32:
 	{
-#line 605 "meta/coderyac.upg"
+#line 517 "meta/coderyac.upg"
 
 
-			(yyval.m_pcondItem) = cmmgr.newERelCond(cond_elemrel_t::EOP_NE, (yys_sv__[0].m_bVal));	
+			(yyval.m_pcondItem) = cmmgr.newERelCond(cond_elemrel_t::EOP_NE, (yystk__[0].sv.m_bVal));	
 		
-#line 2404 "gcode/coderyac.cpp"
+#line 2650 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 33:
 	{
-#line 609 "meta/coderyac.upg"
+#line 521 "meta/coderyac.upg"
 
 			
-			(yyval.m_pcondItem) = cmmgr.newERelCond(cond_elemrel_t::EOP_EQ, *(yys_sv__[0].m_pstrVal));
-			delete (yys_sv__[0].m_pstrVal);
+			(yyval.m_pcondItem) = cmmgr.newERelCond(cond_elemrel_t::EOP_EQ, *(yystk__[0].sv.m_pstrVal));
+			delete (yystk__[0].sv.m_pstrVal);
 		
-#line 2417 "gcode/coderyac.cpp"
+#line 2663 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 34:
 	{
-#line 614 "meta/coderyac.upg"
+#line 526 "meta/coderyac.upg"
 
 
-			(yyval.m_pcondItem) = cmmgr.newERelCond(cond_elemrel_t::EOP_NE, *(yys_sv__[0].m_pstrVal));
-			delete (yys_sv__[0].m_pstrVal);		
+			(yyval.m_pcondItem) = cmmgr.newERelCond(cond_elemrel_t::EOP_NE, *(yystk__[0].sv.m_pstrVal));
+			delete (yystk__[0].sv.m_pstrVal);		
 		
-#line 2430 "gcode/coderyac.cpp"
+#line 2676 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 35:
 	{
-#line 619 "meta/coderyac.upg"
+#line 531 "meta/coderyac.upg"
 
 		
 			(yyval.m_pcondItem) = cmmgr.getHasCond();
 		
-#line 2442 "gcode/coderyac.cpp"
+#line 2688 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 36:
 	{
-#line 623 "meta/coderyac.upg"
+#line 535 "meta/coderyac.upg"
 
 		
 			(yyval.m_pcondItem) = cmmgr.getEmptyCond();
 		
-#line 2454 "gcode/coderyac.cpp"
+#line 2700 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 37:
 	{
-#line 627 "meta/coderyac.upg"
+#line 539 "meta/coderyac.upg"
 
 		
 			(yyval.m_pcondItem) = cmmgr.getEndCond();
 		
-#line 2466 "gcode/coderyac.cpp"
+#line 2712 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 38:
 	{
-#line 631 "meta/coderyac.upg"
+#line 543 "meta/coderyac.upg"
 
 		
 			(yyval.m_pcondItem) = cmmgr.getLastCond();
 		
-#line 2478 "gcode/coderyac.cpp"
+#line 2724 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 39:
 	{
-#line 635 "meta/coderyac.upg"
+#line 547 "meta/coderyac.upg"
 
 		
 			(yyval.m_pcondItem) = cmmgr.getMoreCond();
 		
-#line 2490 "gcode/coderyac.cpp"
+#line 2736 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 40:
 	{
-#line 639 "meta/coderyac.upg"
+#line 551 "meta/coderyac.upg"
 
 			
 			(yyval.m_pcondItem) = cmmgr.getGroupCond();
 		
-#line 2502 "gcode/coderyac.cpp"
+#line 2748 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 41:
 	{
-#line 643 "meta/coderyac.upg"
+#line 555 "meta/coderyac.upg"
 
 			(yyval.m_pcondItem) = cmmgr.getGroupFirstCond();
 		
-#line 2513 "gcode/coderyac.cpp"
+#line 2759 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 42:
 	{
-#line 646 "meta/coderyac.upg"
+#line 558 "meta/coderyac.upg"
 
 		
-			(yyval.m_pcondItem) = cmmgr.newModCond((yys_sv__[0].m_nVal));
+			(yyval.m_pcondItem) = cmmgr.newModCond((yystk__[0].sv.m_nVal));
 		
-#line 2525 "gcode/coderyac.cpp"
+#line 2771 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 43:
 	{
-#line 651 "meta/coderyac.upg"
+#line 563 "meta/coderyac.upg"
 
 		
 			(yyval.m_bVal) = true;
 		
-#line 2537 "gcode/coderyac.cpp"
+#line 2783 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 44:
 	{
-#line 655 "meta/coderyac.upg"
+#line 567 "meta/coderyac.upg"
 
 		
 			(yyval.m_bVal) = false;
 		
-#line 2549 "gcode/coderyac.cpp"
+#line 2795 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 45:
 	{
-#line 660 "meta/coderyac.upg"
+#line 572 "meta/coderyac.upg"
 
 			
 			(yyval.m_pmacRef) = new pstr2pvn_t;
-			(yyval.m_pmacRef)->first = (yys_sv__[2].m_pstrVal);
+			(yyval.m_pmacRef)->first = (yystk__[2].sv.m_pstrVal);
 			(yyval.m_pmacRef)->second = nullptr;
 		
-#line 2563 "gcode/coderyac.cpp"
+#line 2809 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 46:
 	{
-#line 666 "meta/coderyac.upg"
+#line 578 "meta/coderyac.upg"
 
 		
 			(yyval.m_pmacRef) = new pstr2pvn_t;
-			(yyval.m_pmacRef)->first = (yys_sv__[3].m_pstrVal);;
-			(yyval.m_pmacRef)->second = (yys_sv__[2].m_pvnVal);
+			(yyval.m_pmacRef)->first = (yystk__[3].sv.m_pstrVal);;
+			(yyval.m_pmacRef)->second = (yystk__[2].sv.m_pvnVal);
 		
-#line 2577 "gcode/coderyac.cpp"
+#line 2823 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 47:
 	{
-#line 674 "meta/coderyac.upg"
+#line 586 "meta/coderyac.upg"
 
 
 			(yyval.m_pvnVal) = new vint_t;
-			(yyval.m_pvnVal)->push_back((yys_sv__[0].m_nVal));
+			(yyval.m_pvnVal)->push_back((yystk__[0].sv.m_nVal));
 		
-#line 2590 "gcode/coderyac.cpp"
+#line 2836 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 48:
 	{
-#line 679 "meta/coderyac.upg"
+#line 591 "meta/coderyac.upg"
 
 		
-			(yyval.m_pvnVal) = (yys_sv__[2].m_pvnVal);
-			(yyval.m_pvnVal)->push_back((yys_sv__[0].m_nVal));
+			(yyval.m_pvnVal) = (yystk__[2].sv.m_pvnVal);
+			(yyval.m_pvnVal)->push_back((yystk__[0].sv.m_nVal));
 		
-#line 2603 "gcode/coderyac.cpp"
+#line 2849 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 49:
 	{
-#line 685 "meta/coderyac.upg"
+#line 597 "meta/coderyac.upg"
 
 
-			if( ! coder.isThrowAway()) {
-				(yyval.m_pvstrVal) = new vstr_t;
-				(yyval.m_pvstrVal)->push_back(*(yys_sv__[0].m_pstrVal));
-			}
-			else {
-				(yyval.m_pvstrVal) = nullptr;
-			}
+			(yyval.m_pvstrVal) = new vstr_t;
+			(yyval.m_pvstrVal)->push_back(*(yystk__[0].sv.m_pstrVal));
 			
-			if((yys_sv__[0].m_pstrVal)) {
-				delete (yys_sv__[0].m_pstrVal);
-			}
+			delete (yystk__[0].sv.m_pstrVal);
 		
-#line 2625 "gcode/coderyac.cpp"
+#line 2864 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 50:
 	{
-#line 699 "meta/coderyac.upg"
+#line 604 "meta/coderyac.upg"
 
 		
-			(yyval.m_pvstrVal) = (yys_sv__[1].m_pvstrVal);
-			if( ! coder.isThrowAway()) {
-				(yyval.m_pvstrVal)->push_back(*(yys_sv__[0].m_pstrVal));
-			}
-			if((yys_sv__[0].m_pstrVal)) {
-				delete (yys_sv__[0].m_pstrVal);
-			}
+			(yyval.m_pvstrVal) = (yystk__[1].sv.m_pvstrVal);
+			(yyval.m_pvstrVal)->push_back(*(yystk__[0].sv.m_pstrVal));
+			
+			delete (yystk__[0].sv.m_pstrVal);
 		
-#line 2643 "gcode/coderyac.cpp"
+#line 2879 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
-	case 52:
+	case 51:
 	{
-#line 711 "meta/coderyac.upg"
-
+#line 613 "meta/coderyac.upg"
 
-			coder.switchToDef();
-		
-#line 2655 "gcode/coderyac.cpp"
+#line 2888 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
-	case 51:
+	case 52:
 	{
-#line 714 "meta/coderyac.upg"
-
+#line 616 "meta/coderyac.upg"
 
-			coder.flush();
-		
-#line 2667 "gcode/coderyac.cpp"
+#line 2897 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 53:
 	{
-#line 720 "meta/coderyac.upg"
+#line 616 "meta/coderyac.upg"
 
-#line 2676 "gcode/coderyac.cpp"
+#line 2906 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 54:
 	{
-#line 720 "meta/coderyac.upg"
+#line 619 "meta/coderyac.upg"
 
-#line 2685 "gcode/coderyac.cpp"
+			
+			spec.addText(*((yystk__[0].sv.m_textVal)->second), (yystk__[0].sv.m_textVal)->first);
+			
+			delete (yystk__[0].sv.m_textVal)->second;
+			delete (yystk__[0].sv.m_textVal);
+		
+#line 2921 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 55:
 	{
-#line 723 "meta/coderyac.upg"
+#line 626 "meta/coderyac.upg"
 
-			
-			if((yys_sv__[0].m_textVal) && (yys_sv__[0].m_textVal)->second) {
-				coder.getStream() << *((yys_sv__[0].m_textVal)->second);
-				dmap.addSrcLineNo((yys_sv__[0].m_textVal)->first);
-				
-				delete (yys_sv__[0].m_textVal)->second;
-				delete (yys_sv__[0].m_textVal);
-			}
-		
-#line 2703 "gcode/coderyac.cpp"
+#line 2930 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 56:
 	{
-#line 733 "meta/coderyac.upg"
+#line 627 "meta/coderyac.upg"
 
-#line 2712 "gcode/coderyac.cpp"
+#line 2939 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 57:
 	{
-#line 734 "meta/coderyac.upg"
+#line 628 "meta/coderyac.upg"
 
-#line 2721 "gcode/coderyac.cpp"
+#line 2948 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 58:
 	{
-#line 735 "meta/coderyac.upg"
+#line 631 "meta/coderyac.upg"
 
-#line 2730 "gcode/coderyac.cpp"
+
+			spec.addCall(*(yystk__[3].sv.m_pstrVal), (yystk__[2].sv.m_pvstrVal));
+			
+			delete (yystk__[3].sv.m_pstrVal);
+			delete (yystk__[2].sv.m_pvstrVal);
+		
+#line 2963 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 59:
 	{
-#line 738 "meta/coderyac.upg"
-
+#line 638 "meta/coderyac.upg"
 
-			if( ! coder.isThrowAway()) {
-				cmmgr.expandWithStack(*(yys_sv__[3].m_pstrVal), dmap, *(yys_sv__[2].m_pvstrVal), coder.getStream());
-			}
-			if((yys_sv__[3].m_pstrVal)) {
-				delete (yys_sv__[3].m_pstrVal);
-			}
-			if((yys_sv__[2].m_pvstrVal)) {
-				delete (yys_sv__[2].m_pvstrVal);
-			}
+			
+			spec.addCall(*(yystk__[2].sv.m_pstrVal), nullptr);
+			
+			delete (yystk__[2].sv.m_pstrVal);
 		
-#line 2750 "gcode/coderyac.cpp"
+#line 2977 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 60:
 	{
-#line 750 "meta/coderyac.upg"
+#line 646 "meta/coderyac.upg"
 
-			
-			if( ! coder.isThrowAway()) {
-				cmmgr.expandWithStack(*(yys_sv__[2].m_pstrVal), dmap, cmmgr.getEmptyParam(), coder.getStream());
-			}
-			if((yys_sv__[2].m_pstrVal)) {
-				delete (yys_sv__[2].m_pstrVal);
-			}
+
+			spec.addDeclare();
 		
-#line 2767 "gcode/coderyac.cpp"
+#line 2989 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 61:
 	{
-#line 761 "meta/coderyac.upg"
+#line 650 "meta/coderyac.upg"
 
 
-		if( ! coder.isThrowAway()) {
-				coder.switchToDecl();
-			}
+			spec.addDefine();
 		
-#line 2781 "gcode/coderyac.cpp"
+#line 3001 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 62:
 	{
-#line 767 "meta/coderyac.upg"
+#line 656 "meta/coderyac.upg"
 
-
-			if( coder.isCondTrue()) {
-				coder.switchToDef();
-			}
-		
-#line 2795 "gcode/coderyac.cpp"
+#line 3010 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
-	case 63:
+	case 64:
 	{
-#line 775 "meta/coderyac.upg"
+#line 657 "meta/coderyac.upg"
 
-#line 2804 "gcode/coderyac.cpp"
+			spec.addElse();
+		
+#line 3021 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
-	case 65:
+	case 63:
 	{
-#line 776 "meta/coderyac.upg"
+#line 660 "meta/coderyac.upg"
 
-			coder.addIPCond( ! (yys_sv__[1].m_bVal));
+			spec.addEndElse();
 		
-#line 2815 "gcode/coderyac.cpp"
+#line 3032 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
-	case 64:
+	case 66:
 	{
-#line 779 "meta/coderyac.upg"
+#line 665 "meta/coderyac.upg"
+
 
-			coder.subIPCond( ! (yys_sv__[4].m_bVal));
+			spec.addIf();
 		
-#line 2826 "gcode/coderyac.cpp"
+#line 3044 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
-	case 67:
+	case 65:
 	{
-#line 784 "meta/coderyac.upg"
+#line 669 "meta/coderyac.upg"
 
-
-			coder.addIPCond((yys_sv__[1].m_bVal));
+			spec.addEndIf();
 		
-#line 2838 "gcode/coderyac.cpp"
+#line 3055 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
-	case 66:
+	case 67:
 	{
-#line 788 "meta/coderyac.upg"
+#line 674 "meta/coderyac.upg"
 
-			coder.subIPCond((yys_sv__[4].m_bVal));
-			(yyval.m_bVal) = (yys_sv__[4].m_bVal);
-		
-#line 2850 "gcode/coderyac.cpp"
+#line 3064 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 68:
 	{
-#line 794 "meta/coderyac.upg"
-
+#line 675 "meta/coderyac.upg"
 
-			(yyval.m_bVal) = (yys_sv__[0].m_bVal);
-		
-#line 2862 "gcode/coderyac.cpp"
+#line 3073 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 69:
 	{
-#line 798 "meta/coderyac.upg"
+#line 678 "meta/coderyac.upg"
 
-			(yyval.m_bVal) = (yys_sv__[1].m_bVal) && (yys_sv__[0].m_bVal);
 		
-#line 2873 "gcode/coderyac.cpp"
+			spec.addTestCond(*(yystk__[0].sv.m_pstrVal), true);
+			delete (yystk__[0].sv.m_pstrVal);
+		
+#line 3086 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 70:
 	{
-#line 803 "meta/coderyac.upg"
+#line 683 "meta/coderyac.upg"
 
 		
-			if( coder.isThrowAway()) {
-				(yyval.m_bVal) = false;
-			}
-			else {
-				(yyval.m_bVal) = cmmgr.testCond(dmap, *(yys_sv__[0].m_pstrVal), true);
-			}
-			if((yys_sv__[0].m_pstrVal)) {
-				delete (yys_sv__[0].m_pstrVal);
-			}			
+			spec.addTestNot(*(yystk__[0].sv.m_pstrVal));
+			delete (yystk__[0].sv.m_pstrVal);
 		
-#line 2893 "gcode/coderyac.cpp"
+#line 3099 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 71:
 	{
-#line 815 "meta/coderyac.upg"
+#line 688 "meta/coderyac.upg"
 
+
+			spec.addTestCond(*(yystk__[2].sv.m_pstrVal), (yystk__[0].sv.m_nVal));
+			delete (yystk__[2].sv.m_pstrVal);
 		
-			if( coder.isThrowAway()) {
-				(yyval.m_bVal) = false;
-			}
-			else {
-				(yyval.m_bVal) = ! cmmgr.testCond(dmap, *(yys_sv__[0].m_pstrVal), true);
-			}
-			
-			if((yys_sv__[0].m_pstrVal)) {
-				delete (yys_sv__[0].m_pstrVal);
-			}
-		
-#line 2914 "gcode/coderyac.cpp"
+#line 3112 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 72:
 	{
-#line 828 "meta/coderyac.upg"
-
+#line 693 "meta/coderyac.upg"
 
-			if( coder.isThrowAway()) {
-				(yyval.m_bVal) = false;
-			}
-			else {
-				(yyval.m_bVal) = cmmgr.testCond(dmap, *(yys_sv__[2].m_pstrVal), (yys_sv__[0].m_nVal));
-			}
-			if((yys_sv__[2].m_pstrVal)) {
-				delete (yys_sv__[2].m_pstrVal);
-			}
 		
-#line 2934 "gcode/coderyac.cpp"
+			spec.addTestCond(*(yystk__[2].sv.m_pstrVal), (yystk__[0].sv.m_bVal));
+			delete (yystk__[2].sv.m_pstrVal);
+		
+#line 3125 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 73:
 	{
-#line 840 "meta/coderyac.upg"
+#line 698 "meta/coderyac.upg"
 
 		
-			if( coder.isThrowAway()) {
-				(yyval.m_bVal) = false;
-			}
-			else {
-				(yyval.m_bVal) = cmmgr.testCond(dmap, *(yys_sv__[2].m_pstrVal), (yys_sv__[0].m_bVal));			
-			}
-			if((yys_sv__[2].m_pstrVal)) {
-				delete (yys_sv__[2].m_pstrVal);
-			}
+			spec.addTestCond(*(yystk__[2].sv.m_pstrVal), *(yystk__[0].sv.m_pstrVal));
+			delete (yystk__[2].sv.m_pstrVal);
+			delete (yystk__[0].sv.m_pstrVal);
 		
-#line 2954 "gcode/coderyac.cpp"
+#line 3139 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
 	case 74:
 	{
-#line 852 "meta/coderyac.upg"
-
-		
-			if( coder.isThrowAway()) {
-				(yyval.m_bVal) = false;
-			}
-			else {
-				(yyval.m_bVal) = cmmgr.testCond(dmap, *(yys_sv__[2].m_pstrVal), *(yys_sv__[0].m_pstrVal));
-			}
-			if((yys_sv__[2].m_pstrVal)) {
-				delete (yys_sv__[2].m_pstrVal);
-			}
-			if((yys_sv__[0].m_pstrVal)) {
-				delete (yys_sv__[0].m_pstrVal);
-			}
-		
-#line 2977 "gcode/coderyac.cpp"
+#line 704 "meta/coderyac.upg"
 
-	}
-	break;
-	
-	case 75:
-	{
-#line 867 "meta/coderyac.upg"
-
-			if( coder.isThrowAway()) {
-				(yyval.m_bVal) = false;
-			}
-			else {
-				(yyval.m_bVal) = cmmgr.testHas(dmap, *(yys_sv__[0].m_pstrVal));
-			}
 			
-			if((yys_sv__[0].m_pstrVal)) {
-				delete (yys_sv__[0].m_pstrVal);
-			}
+			spec.addTestHas(*(yystk__[0].sv.m_pstrVal));
+			delete (yystk__[0].sv.m_pstrVal);
 		
-#line 2997 "gcode/coderyac.cpp"
+#line 3152 "gcode/coderyac.cpp"
 
 	}
 	break;
 	
-	case 76:
+	case 75:
 	{
-#line 879 "meta/coderyac.upg"
+#line 709 "meta/coderyac.upg"
 
 			
-			if( coder.isThrowAway()) {
-				(yyval.m_bVal) = false;
-			}
-			else {
-				(yyval.m_bVal) = cmmgr.testEmpty(dmap, *(yys_sv__[0].m_pstrVal));
-			}
-			
-			if((yys_sv__[0].m_pstrVal)) {
-				delete (yys_sv__[0].m_pstrVal);
-			}
+			spec.addTestEmpty(*(yystk__[0].sv.m_pstrVal));
+			delete (yystk__[0].sv.m_pstrVal);
 		
-#line 3018 "gcode/coderyac.cpp"
+#line 3165 "gcode/coderyac.cpp"
 
 	}
 	break;
@@ -3028,7 +3175,7 @@ case 37:
 
 char yycc[MAX_MSG_LENG];
 sprintf(yycc, "Error: syntax error at %d:%d.", yylloc.firstLine, yylloc.firstColumn);
-yyerror(yycc, coder, dmap, cmmgr);
+yyerror(yycc, spec, cmmgr);
 				}
 
 							yyecode__ = YYE_PERROR;
@@ -3047,24 +3194,21 @@ yyerror(yycc, coder, dmap, cmmgr);
 					yytok__ = PARSE_ERRORSYMB_ID;
 					yysidx__ = PARSE_ERRORSYMB_INDEX;
 
-					while(! yys_sv__.empty())  {
-						yypstate__ = yynext_pstate__(yys_stt__.top(), yysidx__);
+					while(yystk__.count() > 1)  {
+						yypstate__ = yynext_pstate__(yystk__.top().stt, yysidx__);
 						if(is_valid_pstate__(yypstate__)) {
 							break;
 						}
 			
 
-						yydiscard__(yys_sv__.top(), yys_loc__.top(), yys_symb__.top(), coder, dmap, cmmgr);
-						yys_loc__.pop(1);
+						yydiscard__(yystk__.top().sv, yystk__.top().loc, yystk__.top().symb, spec, cmmgr);
 
 
-						yys_symb__.pop(1);
-						yys_sv__.pop(1);
-						yys_stt__.pop(1);
+						yystk__.pop(1);
 					}
 
-					if( yys_sv__.empty()) {
-						yys_stt__.pop(1);
+					if(yystk__.count() == 1) {
+						yystk__.pop(1);
 					}
 
 					break;
@@ -3072,49 +3216,50 @@ yyerror(yycc, coder, dmap, cmmgr);
 
 				if(is_valid_prule__(yyprule__) || YYE_ACCEPT == yyecode__) {
 					yyrplen__ = yyprnum[yyprule__];
-					yypstate__ = yynext_goto__(yys_stt__[yyrplen__], yyplid[yyprule__]);
+					yypstate__ = yynext_goto__(yystk__[yyrplen__].stt, yyplid[yyprule__]);
 
 
 					if(YYE_ACCEPT != yyecode__) {
-						yys_stt__.pop(yyrplen__);
-						yys_symb__.pop(yyrplen__);
-						yys_sv__.pop(yyrplen__);
 
-						if(!yys_loc__.empty()) {
+						if(yystk__.count() > 1) {
 							if(yyrplen__ == 0) {
-								yyloc.firstLine = yyloc.lastLine = yys_loc__[0].lastLine;
-								yyloc.firstColumn = yyloc.lastColumn = yys_loc__[0].lastColumn;
+								yyloc.firstLine = yyloc.lastLine = yystk__[0].loc.lastLine;
+								yyloc.firstColumn = yyloc.lastColumn = yystk__[0].loc.lastColumn;
 							}
 							else {
-								yyloc.firstLine = yys_loc__[yyrplen__ - 1].firstLine;
-								yyloc.lastLine = yys_loc__[0].lastLine;
-								yyloc.firstColumn = yys_loc__[yyrplen__ - 1].firstColumn;
-								yyloc.lastColumn = yys_loc__[0].lastColumn;
+								yyloc.firstLine = yystk__[yyrplen__ - 1].loc.firstLine;
+								yyloc.lastLine = yystk__[0].loc.lastLine;
+								yyloc.firstColumn = yystk__[yyrplen__ - 1].loc.firstColumn;
+								yyloc.lastColumn = yystk__[0].loc.lastColumn;
 							}
 						}
-						yys_loc__.pop(yyrplen__);
-						yys_loc__.push(yyloc);
 
-						yys_stt__.push(yypstate__);
-						yys_symb__.push(yyplid[yyprule__] + PARSE_TYPE_BASE);
-						yys_sv__.push(yyval);
+						yystk__.pop(yyrplen__);
+
+						yyframe_t &yyf__ = yystk__.push();
+						yyf__.stt = yypstate__;
+						yyf__.symb = yyplid[yyprule__] + PARSE_TYPE_BASE;
+						yyf__.sv = yyval;
+
+						yyf__.loc = yyloc;
+
 					}
 				}
 			}
 		}
 
-		while( ! yys_sv__.empty()) {
+		while(yystk__.count() > 1) {
 
-			yydiscard__(yys_sv__.top(), yys_loc__.top(), yys_symb__.top(), coder, dmap, cmmgr);
+			yydiscard__(yystk__.top().sv, yystk__.top().loc, yystk__.top().symb, spec, cmmgr);
 
-			yys_sv__.pop(1);
-			yys_symb__.pop(1);
+			yystk__.pop(1);
 		}
+		yystk__.clear();
 
 		if(YYE_ACCEPT == yyecode__) {
 
 
-			yydiscard__(yyval, yyloc, yyplid[yyprule__] + PARSE_TYPE_BASE, coder, dmap, cmmgr);
+			yydiscard__(yyval, yyloc, yyplid[yyprule__] + PARSE_TYPE_BASE, spec, cmmgr);
 
 		}
 
@@ -3130,13 +3275,12 @@ public:
 		
 		yyleng = 0;
 		yylaleng = 0;
-		if(yytext) {
-			yytext[0] = '\0';
-		}
+		yyreset_text__();
 		yybufmgr__.destroyall();
 
 		yyerr_flag__ = false;
 		yyltok = PARSE_UNDEFSYMB_ID;
+		yystk__.clear();
 
 	}
 
@@ -3232,7 +3376,16 @@ private:
 		}
 		return yybufmgr__.newbuf(strbuffer, size);
 	}
+	// yytext refers to the mapping in place for tokens from this buffer
+	inline YYPBUFFER yy_new_mmapbuf(const char *strfile) {
+		if( ! strfile) {
+			return NULL;
+		}
+		return yybufmgr__.newmmap(strfile);
+	}
 	inline void yy_delete_buffer(void) {
+		// yytext may refer to the buffer in place
+		yyown_text__();
 		yybufmgr__.destroytop();
 	}
 	inline void yy_switch_buffer(YYPBUFFER buf) {
@@ -3246,9 +3399,7 @@ private:
 		
 		yyleng = 0;
 		yylaleng = 0;
-		if( yytext ) {
-			yytext[0] = '\0';
-		}
+		yyreset_text__();
 
 		yyscstk__.clear();
 		yybufmgr__.reset();
@@ -3261,22 +3412,25 @@ private:
 	}
 	inline int yyless(int n) {
 
+		// chars given back will be read again, keep them intact
+		yyown_text__();
 		if(n > 0 && n < yyleng) {
 
-			yytext[n] = '\0';
+			yyend_text__(n);
 			n = yyleng - n;
 			yyleng -= n;
 			yylaleng = yyleng;
 			return yybufmgr__.unget(n);
 		}
 		yylaleng = yyleng;
-		yytext[yylaleng] = '\0';
+		yyend_text__(yylaleng);
 
 		return 0;
 	}
 
 	inline int yyinput(void) {
 
+		yyunhold__();
 		int c = yybufmgr__.get();
 		if(c < END_OF_FILE) {
 			if(c == '\t') {
@@ -3297,6 +3451,7 @@ private:
 		return c;
 	}
 	inline bool yyunput(char c) {
+		yyunhold__();
 		int oldc = yybufmgr__.put(c);
 		if(oldc < END_OF_FILE) {
 			int s;
@@ -3316,6 +3471,7 @@ private:
 		return oldc < END_OF_FILE;
 	}
 	inline bool yyunget(void) {
+		yyunhold__();
 		int oldc = yybufmgr__.unget();
 		if(oldc < END_OF_FILE) {
 			int s;
@@ -3361,7 +3517,7 @@ private:
 	inline void yyset_tabsize(int ntab) {
 		yybufmgr__.settabsize(ntab);
 	}
-	bool yywrap__(coder_t &coder, dmmap_t &dmap, cmacro_mgr_t &cmmgr) {
+	bool yywrap__(cspec_t &spec, cmacro_mgr_t &cmmgr) {
 		
 			return false;
 	}
@@ -3385,11 +3541,28 @@ private:
 	char *yytext;
 	int yyleng;
 	int yylaleng;
+	// own text buffer, yytext refers to it unless it is in place
+	char *yytbuf__;
+	// char overwritten by terminating NULL of in-place yytext
+	char *yyhold_ptr__;
+	char yyhold_char__;
+	// rule of token matched last
+	int yyrule__;
+
+	
+	// frame of parse stack: state, symbol, semantic value and location
+	struct yyframe_t {
+		int stt;
+		int symb;
+		xstype_t sv;
+		xltype_t loc;
+	};
 
-	
 	bool yyerr_flag__;
 	int yyltok;
     yylex_t yylexer;
+	// parse stack, its storage is kept and reused by following parses
+	sstack_t<yyframe_t, 256> yystk__;
 
 	FILE* yyoutput;
 	FILE* yylogger;
@@ -3401,25 +3574,25 @@ private:
 ///////////////////////////////////////////////////////////////////////////
 	// lexical tables
 	// start states of DFAs
-	static const int yydsc[2];
+	static const unsigned char yydsc[2];
 
 	// @yydcmap is a char map: char -> transition-label,
 	// that is, chars are grouped, transition label is
 	// representation of equivalent class of chars
-	static const int yydcmap[258];
+	static const unsigned char yydcmap[258];
 
 	// @yydmeta is transition-label map: transition-label -> grouped-transition-label,
 	// that is, transition-label in @yydcmap are further grouped in order to save space
-	static const int yydmeta[47];
+	static const unsigned char yydmeta[47];
 
 	// use next-check-base-default scheme to store DFAs
 	// 
-	static const int yydbase[198];
-	static const int yyddef[198];
+	static const unsigned char yydbase[195];
+	static const unsigned char yyddef[195];
 	// next table is an indeed transition table
-	static const int yydnxt[271];
-	static const int yydchk[271];
-	static const int yydaccpt[174];
+	static const unsigned char yydnxt[298];
+	static const unsigned char yydchk[298];
+	static const signed char yydaccpt[171];
 	
 	static char YYMSG_UNMATCHED[];
 
@@ -3427,32 +3600,32 @@ private:
 	// LALR parse tables
 	// token map: token ID --> token index in token ID table
 	// in fact, it acts like inverse table of token ID table
-	static const int yyptmap[291];
+	static const unsigned char yyptmap[291];
 	// token ID table, which contains token IDs
-	//static const int yyptid[43];
+	//static const unsigned short yyptid[43];
 	// number of symbols in a grammar rule
-	static const int yyprnum[77];
+	static const unsigned char yyprnum[76];
 	// index of left symbol in a grammar rule
-	static const int yyplid[77];
+	static const unsigned char yyplid[76];
 	// parse action table
-	static const int yypact[110];
+	static const unsigned char yypact[119];
 
 	// base array for parse action table
 	// which is used to determine the base location of the entries
 	// for each state stored in the yypack table
-	static const int yypabase[145];
-	static const int yypgoto[23];
-	static const int yypgbase[145];
+	static const signed char yypabase[144];
+	static const unsigned char yypgoto[23];
+	static const signed char yypgbase[144];
 
 	// check table for parse action table
-	static const by_te_t yyvbmap[870];
-	static const int yyparv[145];
-	static const int yyparn[145];
-
-	static const int yypcv[75];
-	static const int yypcn[75];
-	static const int yypgrv[145];
-	static const int yypgrn[145];
+	static const by_te_t yyvbmap[864];
+	static const unsigned char yyparv[144];
+	static const unsigned char yyparn[144];
+
+	static const unsigned char yypcv[74];
+	static const unsigned char yypcn[74];
+	static const unsigned char yypgrv[144];
+	static const unsigned char yypgrn[144];
 	static const std::unordered_map<std::string, int> yyslexemID;
 
 ///////////////////////////////////////////////////////////////////////////////////
@@ -3467,11 +3640,11 @@ private:
 
 char yyparser_t::YYMSG_UNMATCHED[] = "Error: unmatched character ` \'.";
 
-const int yyparser_t::yydsc[2] = {
-173,	173
+const unsigned char yyparser_t::yydsc[2] = {
+170,	170
 };
 
-const int yyparser_t::yydcmap[258] = {
+const unsigned char yyparser_t::yydcmap[258] = {
 0,	0,	0,	0,	0,	0,	0,	0,
 	0,	1,	2,	0,	0,	3,	0,	0,
 	0,	0,	0,	0,	0,	0,	0,	0,
@@ -3507,173 +3680,181 @@ const int yyparser_t::yydcmap[258] = {
 	46,	46
 };
 
-const int yyparser_t::yydmeta[47] = {
+const unsigned char yyparser_t::yydmeta[47] = {
 0,	0,	1,	1,	0,	0,	0,	2,
 	0,	0,	2,	0,	0,	0,	2,	2,
 	2,	2,	2,	2,	2,	2,	2,	2,
 	2,	2,	2,	0,	2,	2,	2,	2,
 	2,	2,	2,	2,	2,	2,	2,	2,
-	2,	2,	2,	2,	2,	2,	3
+	3,	2,	2,	2,	2,	2,	4
 };
 
-const int yyparser_t::yydbase[198] = {
-224,	224,	224,	224,	224,	224,	224,	224,
-	224,	224,	224,	224,	224,	224,	224,	224,
-	224,	224,	224,	224,	224,	224,	224,	224,
-	224,	224,	224,	224,	224,	224,	224,	224,
-	224,	224,	224,	224,	224,	224,	172,	174,
-	169,	187,	164,	166,	161,	157,	150,	189,
-	179,	145,	159,	151,	143,	172,	155,	141,
-	150,	145,	138,	166,	165,	132,	148,	143,
-	144,	144,	140,	142,	137,	133,	126,	128,
-	123,	163,	121,	124,	159,	118,	120,	117,
-	145,	128,	118,	110,	120,	121,	120,	122,
-	106,	107,	118,	114,	103,	132,	101,	104,
-	100,	105,	108,	107,	104,	98,	91,	99,
-	100,	2,	122,	89,	120,	98,	92,	115,
-	83,	89,	112,	111,	113,	109,	108,	107,
-	106,	5,	4,	89,	88,	74,	73,	82,
-	3,	84,	80,	67,	77,	68,	75,	76,
-	61,	63,	72,	56,	51,	3,	2,	1,
-	24,	64,	58,	58,	61,	53,	53,	60,
-	48,	53,	42,	38,	40,	40,	32,	36,
-	26,	32,	21,	30,	21,	28,	10,	21,
-	17,	10,	0,	29,	19,	0,	224,	221,
-	220,	219,	218,	217,	216,	215,	214,	213,
-	212,	211,	210,	209,	208,	207,	206,	205,
-	204,	203,	202,	200,	201,	198
+const unsigned char yyparser_t::yydbase[195] = {
+251,	251,	251,	251,	251,	251,	251,	251,
+	251,	251,	251,	251,	251,	251,	251,	251,
+	251,	251,	251,	251,	251,	251,	251,	251,
+	251,	251,	251,	251,	251,	251,	251,	251,
+	251,	251,	251,	251,	251,	251,	203,	193,
+	175,	177,	172,	189,	170,	165,	161,	156,
+	153,	162,	161,	163,	161,	158,	161,	146,
+	158,	180,	143,	152,	138,	153,	152,	151,
+	137,	5,	136,	138,	133,	132,	138,	140,
+	161,	160,	134,	135,	139,	135,	134,	123,
+	120,	133,	129,	118,	147,	116,	119,	118,
+	124,	123,	111,	108,	113,	138,	137,	115,
+	103,	109,	117,	132,	107,	98,	129,	128,
+	98,	103,	106,	95,	107,	122,	121,	91,
+	96,	102,	87,	116,	83,	116,	112,	8,
+	87,	91,	6,	78,	2,	1,	89,	78,
+	77,	85,	84,	72,	0,	84,	73,	82,
+	70,	72,	64,	60,	60,	65,	64,	61,
+	55,	46,	49,	46,	45,	61,	46,	43,
+	52,	39,	37,	29,	45,	24,	21,	32,
+	25,	29,	14,	27,	19,	18,	10,	0,
+	29,	19,	0,	251,	206,	247,	245,	243,
+	241,	239,	237,	235,	233,	231,	229,	227,
+	225,	223,	221,	219,	217,	215,	213,	211,
+	209,	207,	203
 };
 
-const int yyparser_t::yyddef[198] = {
-174,	0,	0,	0,	0,	0,	0,	0,
+const unsigned char yyparser_t::yyddef[195] = {
+171,	0,	0,	0,	0,	0,	0,	0,
 	0,	0,	0,	0,	0,	0,	0,	0,
-	0,	0,	0,	0,	0,	0,	105,	168,
-	168,	168,	168,	168,	168,	168,	168,	168,
-	168,	168,	168,	168,	168,	168,	0,	0,
+	0,	0,	0,	0,	0,	0,	57,	166,
+	166,	166,	166,	166,	166,	166,	166,	166,
+	166,	166,	166,	166,	166,	174,	0,	0,
 	0,	0,	0,	0,	0,	0,	0,	0,
 	0,	0,	0,	0,	0,	0,	0,	0,
+	0,	193,	192,	191,	190,	187,	186,	185,
+	184,	0,	0,	0,	0,	0,	0,	0,
 	0,	0,	0,	0,	0,	0,	0,	0,
 	0,	0,	0,	0,	0,	0,	0,	0,
 	0,	0,	0,	0,	0,	0,	0,	0,
 	0,	0,	0,	0,	0,	0,	0,	0,
 	0,	0,	0,	0,	0,	0,	0,	0,
-	0,	0,	0,	0,	0,	0,	0,	195,
-	194,	196,	0,	193,	0,	0,	0,	0,
 	0,	0,	0,	0,	0,	0,	0,	0,
-	0,	0,	0,	192,	191,	190,	189,	188,
-	186,	187,	181,	184,	181,	185,	181,	183,
-	184,	185,	183,	187,	187,	187,	187,	187,
-	184,	178,	178,	180,	177,	179,	176,	0,
-	180,	0,	179,	179,	178,	182,	180,	176,
-	179,	176,	180,	176,	179,	176,	182,	177,
-	175,	175,	175,	0,	0,	197,	0,	0,
+	0,	0,	0,	0,	0,	173,	175,	183,
+	183,	175,	175,	183,	173,	181,	0,	0,
+	189,	182,	189,	177,	189,	182,	182,	182,
+	176,	177,	178,	189,	188,	179,	182,	181,
+	179,	180,	178,	177,	179,	177,	179,	181,
+	178,	181,	179,	180,	188,	176,	172,	172,
+	0,	0,	194,	0,	0,	0,	0,	0,
 	0,	0,	0,	0,	0,	0,	0,	0,
 	0,	0,	0,	0,	0,	0,	0,	0,
-	0,	0,	0,	0,	0,	0
+	0,	0,	0
 };
 
-const int yyparser_t::yydnxt[271] = {
-20,	73,	18,	76,	16,	22,	16,	21,
-	122,	16,	121,	172,	16,	16,	108,	106,
-	170,	140,	125,	141,	167,	129,	166,	38,
-	135,	126,	169,	20,	171,	145,	148,	147,
-	39,	43,	42,	45,	133,	163,	138,	44,
-	164,	40,	46,	67,	66,	69,	168,	132,
-	165,	68,	168,	65,	70,	168,	168,	150,
-	139,	168,	27,	168,	30,	168,	168,	127,
-	168,	143,	168,	146,	168,	134,	137,	168,
-	168,	23,	136,	124,	160,	157,	37,	103,
-	168,	83,	168,	168,	104,	168,	130,	82,
-	149,	97,	168,	168,	153,	168,	107,	168,
-	28,	142,	168,	33,	31,	159,	128,	32,
-	24,	123,	26,	144,	152,	168,	36,	29,
-	158,	35,	154,	155,	161,	156,	15,	2,
-	3,	4,	120,	5,	6,	119,	118,	7,
-	117,	116,	106,	131,	48,	34,	162,	78,
-	77,	79,	80,	13,	81,	71,	84,	85,
-	14,	86,	87,	96,	101,	102,	61,	60,
-	59,	58,	57,	56,	55,	12,	54,	11,
-	53,	18,	100,	99,	47,	98,	52,	95,
-	94,	93,	92,	91,	90,	89,	88,	1,
-	51,	10,	9,	50,	49,	41,	109,	110,
-	8,	111,	112,	113,	114,	17,	47,	75,
-	74,	19,	72,	151,	115,	64,	63,	62,
-	25,	105,	168,	105,	168,	168,	168,	168,
-	168,	168,	168,	168,	168,	168,	168,	168,
-	168,	168,	168,	168,	168,	168,	168,	168,
+const unsigned char yyparser_t::yydnxt[298] = {
+13,	38,	14,	65,	15,	22,	15,	14,
+	72,	15,	73,	169,	15,	15,	19,	115,
+	167,	151,	64,	62,	21,	63,	163,	40,
+	132,	131,	155,	13,	168,	137,	128,	28,
+	41,	44,	49,	46,	146,	144,	28,	45,
+	145,	42,	55,	56,	50,	70,	28,	28,
+	34,	71,	28,	51,	66,	127,	141,	125,
+	133,	28,	29,	129,	28,	28,	28,	59,
+	28,	165,	130,	28,	150,	164,	28,	138,
+	143,	28,	148,	31,	152,	36,	28,	28,
+	26,	33,	28,	28,	28,	166,	28,	25,
+	161,	28,	61,	28,	58,	160,	28,	28,
+	28,	28,	60,	158,	136,	96,	28,	159,
+	126,	142,	32,	97,	28,	28,	28,	74,
+	28,	139,	134,	37,	27,	28,	153,	162,
+	23,	94,	117,	119,	20,	99,	124,	30,
+	18,	118,	100,	116,	108,	12,	16,	120,
+	121,	122,	123,	113,	11,	10,	112,	109,
+	1,	107,	106,	105,	111,	17,	7,	90,
+	47,	110,	93,	6,	114,	75,	78,	5,
+	77,	76,	48,	91,	92,	103,	102,	101,
+	104,	98,	39,	73,	84,	85,	88,	89,
+	95,	86,	140,	149,	156,	147,	154,	35,
+	24,	8,	83,	67,	2,	80,	79,	81,
+	82,	135,	87,	9,	68,	4,	69,	3,
+	52,	53,	54,	43,	38,	28,	28,	57,
+	28,	57,	57,	28,	28,	28,	28,	28,
+	28,	28,	28,	28,	28,	28,	28,	28,
+	28,	28,	28,	28,	28,	28,	28,	28,
+	28,	28,	28,	28,	28,	28,	28,	28,
+	28,	28,	28,	28,	28,	28,	28,	28,
+	157,	28,	28,	0,	0,	0,	0,	0,
 	0,	0,	0,	0,	0,	0,	0,	0,
 	0,	0,	0,	0,	0,	0,	0,	0,
 	0,	0,	0,	0,	0,	0,	0,	0,
 	0,	0,	0,	0,	0,	0,	0,	0,
 	0,	0,	0,	0,	0,	0,	0,	0,
-	0,	0,	0,	0,	0,	0,	0
+	0,	0
 };
 
-const int yyparser_t::yydchk[271] = {
-173,	173,	173,	173,	173,	173,	173,	105,
-	173,	173,	173,	173,	173,	173,	122,	121,
-	173,	173,	173,	173,	128,	173,	173,	172,
-	173,	173,	173,	173,	172,	143,	142,	141,
-	172,	172,	172,	172,	170,	170,	166,	172,
-	170,	172,	172,	171,	171,	171,	169,	169,
-	166,	171,	169,	171,	171,	168,	168,	167,
-	167,	168,	165,	164,	163,	162,	161,	162,
-	160,	164,	159,	144,	157,	165,	160,	163,
-	158,	161,	158,	156,	155,	159,	157,	140,
-	154,	153,	155,	150,	139,	156,	154,	153,
-	152,	151,	152,	149,	151,	146,	150,	148,
-	148,	149,	147,	145,	147,	138,	137,	146,
-	136,	135,	134,	133,	132,	145,	131,	130,
-	129,	127,	126,	125,	124,	123,	120,	119,
-	118,	117,	116,	115,	114,	113,	112,	111,
-	110,	109,	108,	107,	106,	104,	103,	102,
-	101,	100,	99,	98,	97,	96,	95,	94,
-	93,	92,	91,	90,	89,	88,	87,	86,
-	85,	84,	83,	82,	81,	80,	79,	78,
-	77,	76,	75,	74,	73,	72,	71,	70,
-	69,	68,	67,	66,	65,	64,	63,	62,
-	61,	60,	59,	58,	57,	56,	55,	54,
-	53,	52,	51,	50,	49,	48,	47,	46,
-	45,	44,	43,	42,	41,	40,	39,	38,
-	197,	196,	195,	196,	194,	193,	192,	191,
-	190,	189,	188,	187,	186,	185,	184,	183,
-	182,	181,	180,	179,	178,	177,	176,	175,
-	174,	174,	174,	174,	174,	174,	174,	174,
-	174,	174,	174,	174,	174,	174,	174,	174,
-	174,	174,	174,	174,	174,	174,	174,	174,
-	174,	174,	174,	174,	174,	174,	174,	174,
-	174,	174,	174,	174,	174,	174,	174,	174,
-	174,	174,	174,	174,	174,	174,	174
+const unsigned char yyparser_t::yydchk[298] = {
+170,	170,	170,	170,	170,	170,	170,	65,
+	170,	170,	170,	170,	170,	170,	124,	122,
+	170,	170,	170,	170,	119,	170,	170,	169,
+	170,	170,	170,	170,	169,	132,	125,	162,
+	169,	169,	169,	169,	167,	167,	158,	169,
+	167,	169,	169,	168,	168,	168,	166,	166,
+	165,	168,	166,	168,	168,	164,	164,	163,
+	162,	161,	160,	165,	159,	157,	156,	158,
+	160,	163,	155,	153,	157,	152,	154,	151,
+	161,	155,	150,	159,	154,	153,	149,	148,
+	148,	147,	146,	145,	147,	144,	151,	156,
+	146,	143,	145,	150,	142,	141,	152,	140,
+	144,	139,	140,	138,	137,	134,	138,	149,
+	139,	136,	143,	134,	136,	142,	141,	135,
+	133,	131,	135,	130,	129,	137,	128,	127,
+	126,	123,	121,	120,	118,	117,	116,	133,
+	115,	114,	113,	112,	111,	110,	109,	108,
+	107,	106,	105,	104,	103,	102,	101,	100,
+	99,	98,	97,	96,	95,	94,	93,	92,
+	91,	90,	89,	88,	87,	86,	85,	84,
+	83,	82,	81,	80,	79,	78,	77,	76,
+	75,	74,	73,	72,	71,	70,	69,	68,
+	67,	66,	64,	63,	62,	61,	60,	59,
+	58,	57,	56,	55,	54,	53,	52,	51,
+	50,	49,	48,	47,	46,	45,	44,	43,
+	42,	41,	40,	39,	38,	194,	194,	193,
+	172,	193,	193,	192,	192,	191,	191,	190,
+	190,	189,	189,	188,	188,	187,	187,	186,
+	186,	185,	185,	184,	184,	183,	183,	182,
+	182,	181,	181,	180,	180,	179,	179,	178,
+	178,	177,	177,	176,	176,	175,	175,	174,
+	174,	173,	173,	171,	171,	171,	171,	171,
+	171,	171,	171,	171,	171,	171,	171,	171,
+	171,	171,	171,	171,	171,	171,	171,	171,
+	171,	171,	171,	171,	171,	171,	171,	171,
+	171,	171,	171,	171,	171,	171,	171,	171,
+	171,	171,	171,	171,	171,	171,	171,	171,
+	171,	171
 };
 
-const int yyparser_t::yydaccpt[174] = {
--1,	0,	30,	20,	29,	28,	19,	17,
-	16,	26,	22,	15,	25,	21,	24,	27,
-	1,	33,	34,	23,	36,	31,	36,	14,
-	7,	32,	8,	11,	5,	12,	6,	2,
-	3,	4,	10,	13,	9,	18,	-1,	-1,
-	-1,	-1,	-1,	-1,	-1,	-1,	-1,	35,
-	33,	-1,	-1,	-1,	-1,	-1,	-1,	-1,
+const signed char yyparser_t::yydaccpt[171] = {
+-1,	27,	0,	33,	23,	24,	21,	25,
+	31,	15,	22,	26,	16,	36,	34,	1,
+	30,	19,	28,	20,	17,	29,	36,	12,
+	14,	2,	5,	8,	32,	10,	9,	7,
+	3,	4,	11,	13,	18,	32,	35,	33,
+	-1,	-1,	-1,	33,	-1,	-1,	-1,	-1,
+	-1,	-1,	-1,	-1,	-1,	-1,	-1,	-1,
+	-1,	-1,	32,	32,	32,	32,	32,	32,
+	32,	36,	-1,	-1,	-1,	-1,	-1,	-1,
+	36,	33,	-1,	-1,	-1,	-1,	-1,	-1,
 	-1,	-1,	-1,	-1,	-1,	-1,	-1,	-1,
 	-1,	-1,	-1,	-1,	-1,	-1,	-1,	-1,
-	-1,	35,	-1,	-1,	36,	-1,	-1,	-1,
 	-1,	-1,	-1,	-1,	-1,	-1,	-1,	-1,
 	-1,	-1,	-1,	-1,	-1,	-1,	-1,	-1,
-	-1,	-1,	-1,	-1,	-1,	-1,	-1,	32,
-	32,	-1,	33,	32,	33,	-1,	-1,	-1,
 	-1,	-1,	-1,	-1,	-1,	-1,	-1,	-1,
-	-1,	33,	36,	32,	32,	32,	32,	32,
+	-1,	-1,	-1,	-1,	-1,	32,	32,	32,
+	32,	32,	32,	32,	32,	32,	-1,	-1,
 	32,	32,	32,	32,	32,	32,	32,	32,
 	32,	32,	32,	32,	32,	32,	32,	32,
-	32,	32,	32,	32,	32,	32,	32,	-1,
-	32,	-1,	32,	32,	32,	32,	32,	32,
 	32,	32,	32,	32,	32,	32,	32,	32,
-	32,	32,	32,	-1,	1,	-1
+	32,	32,	32,	32,	32,	32,	6,	32,
+	-1,	1,	-1
 };
 
 // token map: token ID --> token index in token ID table
 // in fact, it acts like inverse table of token ID table
-const int yyparser_t::yyptmap[291] = {
+const unsigned char yyparser_t::yyptmap[291] = {
 0,	2,	2,	2,	2,	2,	2,	2,
 	2,	2,	2,	2,	2,	2,	2,	2,
 	2,	2,	2,	2,	2,	2,	2,	2,
@@ -3714,7 +3895,7 @@ const int yyparser_t::yyptmap[291] = {
 };
 /*
 // token ID table, containing token IDs
-const int yyparser_t::yyptid[43] = {
+const unsigned short yyparser_t::yyptid[43] = {
 0,	256,	257,	258,	259,	260,	261,	262,
 	263,	264,	265,	266,	267,	268,	269,	270,
 	271,	272,	273,	274,	275,	276,	277,	278,
@@ -3724,89 +3905,88 @@ const int yyparser_t::yyptid[43] = {
 };
 */
 // prnum table, its element is number of symbols in right part of corresponding grammar rule
-const int yyparser_t::yyprnum[77] = {
+const unsigned char yyparser_t::yyprnum[76] = {
 2,	3,	4,	4,	3,	3,	1,	2,
 	3,	3,	4,	4,	1,	2,	3,	3,
 	3,	1,	2,	1,	1,	5,	5,	1,
 	2,	3,	1,	3,	3,	3,	3,	3,
 	3,	3,	3,	1,	1,	1,	1,	1,
 	1,	1,	3,	1,	1,	4,	5,	2,
-	3,	1,	2,	4,	0,	1,	2,	1,
-	1,	1,	1,	5,	4,	1,	1,	1,
-	5,	0,	6,	0,	1,	2,	1,	2,
-	3,	3,	3,	3,	3
+	3,	1,	2,	3,	1,	2,	1,	1,
+	1,	1,	5,	4,	1,	1,	1,	5,
+	0,	6,	0,	1,	2,	1,	2,	3,
+	3,	3,	3,	3
 };
 
 // plid table, its element is the index of left part of corresponding grammar rule in token ID table
-const int yyparser_t::yyplid[77] = {
-17,	2,	18,	21,	21,	19,	22,	22,
-	11,	11,	13,	23,	12,	12,	14,	14,
-	1,	10,	10,	9,	9,	9,	9,	7,
-	7,	8,	8,	8,	8,	8,	8,	8,
-	8,	8,	8,	8,	8,	8,	8,	8,
-	8,	8,	8,	0,	0,	15,	15,	6,
-	6,	16,	16,	20,	25,	24,	24,	26,
-	26,	26,	26,	27,	27,	28,	28,	29,
-	29,	30,	3,	31,	4,	4,	5,	5,
-	5,	5,	5,	5,	5
+const unsigned char yyparser_t::yyplid[76] = {
+14,	2,	15,	18,	18,	16,	19,	19,
+	8,	8,	10,	20,	9,	9,	11,	11,
+	1,	7,	7,	6,	6,	6,	6,	4,
+	4,	5,	5,	5,	5,	5,	5,	5,
+	5,	5,	5,	5,	5,	5,	5,	5,
+	5,	5,	5,	0,	0,	12,	12,	3,
+	3,	13,	13,	17,	21,	21,	22,	22,
+	22,	22,	23,	23,	24,	24,	25,	25,
+	27,	26,	29,	28,	28,	30,	30,	30,
+	30,	30,	30,	30
 };
 
 // parse action table
-const int yyparser_t::yypact[110] = {
-17,	29,	38,	16,	29,	29,	31,	42,
-	223,	31,	31,	58,	57,	59,	60,	61,
-	64,	62,	63,	29,	38,	81,	80,	29,
-	66,	42,	55,	56,	31,	29,	54,	223,
-	69,	93,	31,	82,	92,	91,	95,	223,
-	78,	58,	57,	59,	60,	61,	64,	62,
-	63,	79,	98,	223,	112,	223,	99,	108,
-	55,	56,	115,	118,	54,	113,	116,	223,
-	85,	172,	172,	172,	172,	172,	172,	172,
-	172,	81,	80,	216,	216,	123,	223,	126,
-	172,	172,	124,	127,	172,	38,	38,	223,
-	172,	87,	42,	42,	78,	223,	216,	223,
-	101,	133,	216,	103,	131,	79,	38,	216,
-	38,	223,	223,	42,	223,	42
+const unsigned char yyparser_t::yypact[119] = {
+17,	21,	39,	16,	21,	221,	25,	41,
+	39,	25,	55,	54,	39,	41,	101,	100,
+	221,	41,	67,	66,	68,	69,	70,	73,
+	71,	72,	39,	78,	82,	52,	91,	75,
+	83,	64,	65,	55,	54,	63,	53,	39,
+	39,	214,	214,	102,	41,	41,	106,	21,
+	104,	221,	107,	221,	25,	115,	52,	221,
+	111,	221,	85,	121,	214,	132,	119,	53,
+	214,	87,	133,	221,	221,	214,	67,	66,
+	68,	69,	70,	73,	71,	72,	124,	127,
+	221,	122,	125,	21,	221,	64,	65,	21,
+	25,	63,	221,	221,	25,	94,	171,	171,
+	171,	171,	171,	171,	171,	171,	21,	221,
+	221,	221,	221,	25,	221,	171,	171,	221,
+	221,	171,	221,	221,	221,	171,	96
 };
 
 // base array for parse action table
 // which is used to determine the base location of the entries
 // for each state stored in the yypack table
-const int yyparser_t::yypabase[145] = {
+const signed char yyparser_t::yypabase[144] = {
 0,	0,	0,	0,	0,	0,	0,	0,
-	-33,	0,	0,	0,	0,	0,	-33,	0,
-	0,	0,	0,	-32,	0,	0,	0,	0,
-	-30,	-29,	-3,	-15,	0,	0,	0,	0,
-	0,	0,	0,	0,	-14,	0,	0,	0,
-	0,	0,	0,	0,	0,	0,	7,	0,
-	0,	0,	-11,	-5,	27,	0,	51,	0,
+	-33,	0,	0,	-33,	0,	0,	-32,	0,
+	0,	0,	0,	-30,	0,	0,	0,	0,
+	0,	0,	0,	0,	0,	-4,	0,	0,
+	0,	0,	-26,	-22,	4,	-8,	0,	0,
+	0,	0,	0,	0,	0,	0,	0,	0,
+	-4,	0,	21,	0,	27,	0,	0,	0,
+	0,	0,	0,	5,	6,	56,	0,	80,
+	0,	0,	0,	0,	0,	0,	0,	0,
+	0,	0,	0,	-6,	0,	-18,	7,	0,
+	0,	14,	0,	0,	13,	0,	0,	21,
 	0,	0,	0,	0,	0,	0,	0,	0,
-	0,	0,	-1,	0,	4,	-3,	0,	0,
-	0,	0,	18,	0,	59,	0,	61,	0,
-	0,	0,	0,	0,	0,	0,	0,	20,
-	26,	27,	0,	0,	0,	0,	41,	0,
-	0,	47,	0,	0,	51,	0,	0,	65,
+	27,	46,	47,	0,	0,	0,	0,	25,
+	0,	0,	0,	0,	0,	49,	53,	0,
 	0,	0,	0,	0,	0,	0,	0,	0,
 	0,	0,	0,	0,	0,	0,	0,	0,
 	0,	0,	0,	0,	0,	0,	0,	0,
-	0,	52,	68,	0,	0,	0,	0,	0,
-	0,	0,	0,	0,	0,	0,	0,	70,
-	0
+	0,	68,	0,	0,	0,	0,	0,	0
 };
 
-const int yyparser_t::yypgoto[23] = {
-28,	27,	49,	28,	50,	23,	28,	51,
-	67,	223,	223,	47,	223,	223,	223,	223,
-	223,	223,	223,	223,	223,	223,	65
+const unsigned char yyparser_t::yypgoto[23] = {
+38,	37,	58,	38,	59,	33,	38,	60,
+	76,	221,	221,	56,	221,	221,	221,	221,
+	221,	221,	221,	221,	221,	221,	74
 };
 
-const int yyparser_t::yypgbase[145] = {
+const signed char yyparser_t::yypgbase[144] = {
 0,	0,	0,	0,	0,	0,	0,	0,
-	0,	0,	0,	0,	0,	0,	-9,	0,
-	0,	0,	0,	0,	0,	0,	-12,	0,
-	-6,	-3,	0,	-1,	0,	0,	0,	0,
+	0,	0,	0,	0,	0,	0,	-6,	0,
 	0,	0,	0,	0,	0,	0,	0,	0,
 	0,	0,	0,	0,	0,	0,	0,	0,
+	-9,	0,	-3,	0,	0,	2,	0,	0,
 	0,	0,	0,	0,	0,	0,	0,	0,
 	0,	0,	0,	0,	0,	0,	0,	0,
 	0,	0,	0,	0,	0,	0,	0,	0,
@@ -3819,10 +3999,10 @@ const int yyparser_t::yypgbase[145] = {
 	0,	0,	0,	0,	0,	0,	0,	0,
 	0,	0,	0,	0,	0,	0,	0,	0,
 	0,	0,	0,	0,	0,	0,	0,	0,
-	0
+	0,	0,	0,	0,	0,	0,	0,	0
 };
 
-const by_te_t yyparser_t::yyvbmap[870] = {
+const by_te_t yyparser_t::yyvbmap[864] = {
 0,	0,	0,	0,	0,	0,	0,	0,
 	0,	4,	0,	0,	1,	0,	0,	0,
 	0,	0,	8,	0,	0,	0,	0,	0,
@@ -3837,65 +4017,53 @@ const by_te_t yyparser_t::yyvbmap[870] = {
 	132,	0,	32,	0,	0,	0,	0,	0,
 	0,	0,	0,	0,	32,	0,	0,	0,
 	0,	0,	64,	0,	0,	0,	0,	0,
-	1,	0,	0,	4,	0,	24,	132,	0,
-	0,	0,	0,	1,	0,	0,	16,	0,
-	0,	0,	128,	0,	64,	1,	0,	0,
-	128,	0,	64,	1,	0,	0,	128,	0,
-	0,	0,	0,	0,	132,	0,	0,	0,
-	0,	0,	132,	0,	0,	192,	63,	96,
-	2,	0,	0,	0,	0,	0,	132,	0,
-	128,	2,	0,	0,	132,	0,	128,	2,
-	0,	0,	132,	0,	128,	2,	0,	0,
-	132,	0,	0,	0,	0,	128,	2,	0,
-	0,	0,	0,	0,	1,	0,	8,	0,
-	0,	0,	0,	0,	0,	0,	0,	0,
-	1,	0,	0,	0,	0,	0,	18,	0,
-	0,	4,	0,	26,	132,	0,	0,	44,
+	1,	0,	0,	4,	0,	26,	132,	0,
+	0,	44,	0,	26,	132,	0,	0,	44,
 	0,	26,	132,	0,	0,	44,	0,	26,
 	132,	0,	0,	44,	0,	26,	132,	0,
-	0,	44,	0,	26,	132,	0,	0,	44,
-	0,	26,	132,	0,	0,	0,	0,	0,
-	2,	0,	0,	44,	0,	26,	132,	0,
-	0,	44,	0,	26,	132,	0,	0,	60,
-	0,	26,	132,	0,	0,	192,	0,	0,
-	2,	4,	16,	0,	0,	0,	128,	0,
-	0,	0,	0,	0,	16,	0,	64,	1,
-	0,	0,	128,	0,	0,	2,	0,	0,
-	132,	0,	128,	0,	0,	0,	132,	0,
-	0,	192,	63,	96,	34,	0,	0,	192,
-	63,	96,	34,	0,	0,	192,	63,	96,
-	98,	0,	0,	0,	0,	0,	0,	1,
-	0,	0,	0,	0,	0,	1,	0,	192,
+	0,	44,	0,	26,	132,	0,	0,	0,
+	0,	0,	2,	0,	0,	44,	0,	26,
+	132,	0,	0,	44,	0,	26,	132,	0,
+	0,	60,	0,	26,	132,	0,	0,	192,
+	0,	0,	2,	4,	0,	0,	0,	1,
+	0,	0,	16,	0,	0,	0,	128,	0,
+	64,	1,	0,	0,	128,	0,	64,	1,
+	0,	0,	128,	0,	0,	0,	0,	0,
+	132,	0,	0,	0,	0,	0,	132,	0,
+	0,	192,	63,	96,	2,	0,	0,	0,
+	0,	0,	132,	0,	128,	2,	0,	0,
+	132,	0,	128,	2,	0,	0,	132,	0,
+	128,	2,	0,	0,	132,	0,	0,	0,
+	0,	128,	2,	0,	0,	0,	0,	0,
+	1,	0,	8,	0,	0,	0,	0,	0,
+	0,	0,	0,	0,	1,	0,	0,	0,
+	0,	0,	18,	0,	1,	0,	0,	0,
+	0,	0,	0,	44,	0,	26,	132,	0,
+	0,	0,	0,	0,	17,	0,	0,	4,
+	0,	24,	132,	0,	0,	192,	0,	0,
+	34,	4,	0,	192,	0,	0,	34,	4,
+	0,	192,	0,	0,	98,	4,	0,	0,
+	0,	0,	2,	0,	0,	0,	0,	0,
+	0,	1,	0,	0,	0,	0,	0,	1,
+	16,	0,	0,	0,	128,	0,	0,	0,
+	0,	0,	16,	0,	64,	1,	0,	0,
+	128,	0,	0,	2,	0,	0,	132,	0,
+	128,	0,	0,	0,	132,	0,	0,	192,
 	63,	96,	34,	0,	0,	192,	63,	96,
+	34,	0,	0,	192,	63,	96,	98,	0,
+	0,	0,	0,	0,	0,	1,	0,	0,
+	0,	0,	0,	1,	0,	192,	63,	96,
 	34,	0,	0,	192,	63,	96,	34,	0,
 	0,	192,	63,	96,	34,	0,	0,	192,
 	63,	96,	34,	0,	0,	192,	63,	96,
 	34,	0,	0,	192,	63,	96,	34,	0,
-	0,	0,	0,	0,	0,	1,	16,	0,
-	0,	0,	128,	0,	0,	0,	0,	128,
-	18,	0,	128,	2,	0,	0,	132,	0,
-	0,	0,	0,	0,	3,	0,	0,	0,
-	0,	0,	16,	2,	0,	0,	0,	0,
-	32,	0,	0,	0,	0,	0,	18,	0,
-	1,	0,	0,	0,	0,	0,	0,	44,
-	0,	26,	132,	0,	0,	0,	0,	0,
-	17,	0,	0,	4,	0,	24,	132,	0,
-	0,	192,	0,	0,	34,	4,	0,	192,
-	0,	0,	34,	4,	0,	192,	0,	0,
-	98,	4,	0,	0,	0,	0,	2,	0,
-	0,	0,	0,	0,	0,	1,	0,	0,
-	0,	0,	0,	1,	32,	0,	0,	0,
-	0,	0,	64,	1,	0,	0,	128,	0,
-	64,	1,	0,	0,	128,	0,	0,	0,
-	0,	0,	132,	0,	0,	192,	63,	96,
-	34,	0,	0,	0,	192,	0,	9,	0,
-	0,	0,	192,	0,	9,	0,	0,	0,
-	192,	0,	9,	0,	0,	0,	0,	0,
-	8,	0,	0,	0,	0,	0,	16,	0,
-	0,	0,	0,	0,	16,	0,	0,	0,
-	0,	0,	32,	0,	0,	0,	0,	0,
-	16,	2,	0,	0,	0,	0,	8,	0,
-	64,	1,	0,	0,	132,	0,	0,	0,
+	0,	192,	63,	96,	34,	0,	0,	0,
+	0,	0,	0,	1,	16,	0,	0,	0,
+	128,	0,	0,	0,	0,	128,	18,	0,
+	128,	2,	0,	0,	132,	0,	0,	0,
+	0,	0,	3,	0,	0,	0,	0,	0,
+	16,	2,	0,	0,	0,	0,	32,	0,
+	0,	0,	0,	0,	18,	0,	0,	0,
 	0,	0,	17,	0,	0,	0,	0,	0,
 	17,	0,	0,	0,	0,	0,	32,	0,
 	0,	4,	0,	24,	132,	0,	0,	4,
@@ -3903,151 +4071,158 @@ const by_te_t yyparser_t::yyvbmap[870] = {
 	34,	4,	0,	0,	192,	0,	9,	0,
 	0,	192,	0,	0,	34,	4,	0,	0,
 	0,	0,	1,	0,	0,	0,	0,	0,
-	1,	0,	0,	0,	0,	0,	32,	0,
-	0,	192,	63,	96,	34,	0,	0,	192,
-	63,	96,	34,	0,	0,	192,	63,	96,
-	34,	4,	0,	192,	63,	96,	34,	4,
+	1,	0,	32,	0,	0,	0,	0,	0,
+	64,	1,	0,	0,	128,	0,	64,	1,
+	0,	0,	128,	0,	0,	0,	0,	0,
+	132,	0,	0,	192,	63,	96,	34,	0,
+	0,	0,	192,	0,	9,	0,	0,	0,
+	192,	0,	9,	0,	0,	0,	192,	0,
+	9,	0,	0,	0,	0,	0,	8,	0,
+	0,	0,	0,	0,	16,	0,	0,	0,
+	0,	0,	16,	0,	0,	0,	0,	0,
+	32,	0,	0,	0,	0,	0,	16,	2,
+	0,	0,	0,	0,	8,	0,	64,	1,
+	0,	0,	132,	0,	0,	0,	0,	0,
+	17,	0,	0,	0,	0,	0,	32,	0,
+	0,	44,	0,	26,	132,	0,	0,	36,
+	0,	24,	132,	0,	0,	4,	0,	24,
+	132,	0,	0,	192,	0,	0,	34,	4,
+	0,	192,	0,	0,	34,	4,	0,	192,
+	63,	96,	34,	4,	0,	192,	63,	96,
+	34,	4,	0,	192,	0,	0,	34,	4,
+	0,	192,	0,	0,	34,	4,	0,	192,
+	0,	0,	34,	4,	0,	0,	0,	0,
+	32,	0,	0,	192,	63,	96,	34,	0,
 	0,	192,	63,	96,	34,	0,	0,	192,
 	63,	96,	34,	0,	0,	192,	63,	96,
 	34,	0,	0,	192,	63,	96,	34,	0,
 	0,	192,	63,	96,	34,	0,	0,	192,
 	63,	96,	34,	0,	0,	192,	63,	96,
 	34,	0,	0,	192,	63,	96,	34,	0,
+	0,	192,	63,	96,	34,	0,	0,	0,
+	0,	0,	32,	0,	0,	0,	0,	0,
+	32,	0,	128,	2,	0,	0,	132,	0,
 	0,	0,	0,	0,	32,	0,	0,	0,
-	0,	0,	32,	0,	128,	2,	0,	0,
-	132,	0,	0,	0,	0,	0,	32,	0,
-	0,	0,	0,	0,	8,	0,	0,	0,
-	0,	0,	16,	2,	0,	0,	0,	0,
-	17,	0,	0,	0,	0,	0,	32,	0,
-	0,	44,	0,	26,	132,	0,	0,	36,
-	0,	24,	132,	0,	0,	4,	0,	24,
-	132,	0,	0,	192,	0,	0,	34,	4,
-	0,	192,	0,	0,	34,	4,	0,	192,
-	0,	0,	34,	4,	0,	192,	0,	0,
-	34,	4,	0,	192,	0,	0,	34,	4,
-	16,	0,	0,	0,	128,	0,	128,	2,
-	0,	0,	132,	0,	128,	2,	0,	0,
-	132,	0,	128,	2,	0,	0,	132,	0,
-	0,	0,	0,	0,	16,	2,	0,	44,
-	0,	26,	132,	0,	0,	44,	0,	26,
-	132,	0,	0,	12,	0,	24,	132,	0,
-	0,	60,	0,	26,	132,	0
+	0,	0,	8,	0,	0,	0,	0,	0,
+	16,	2,	0,	44,	0,	26,	132,	0,
+	0,	44,	0,	26,	132,	0,	0,	12,
+	0,	24,	132,	0,	16,	0,	0,	0,
+	128,	0,	128,	2,	0,	0,	132,	0,
+	128,	2,	0,	0,	132,	0,	128,	2,
+	0,	0,	132,	0,	0,	0,	0,	0,
+	16,	2,	0,	60,	0,	26,	132,	0
 };
 
-const int yyparser_t::yyparv[145] = {
-223,	4,	5,	7,	9,	146,	11,	15,
-	223,	18,	147,	198,	15,	152,	223,	32,
-	33,	34,	35,	223,	151,	153,	48,	158,
-	223,	223,	223,	223,	163,	165,	166,	69,
-	70,	148,	71,	150,	223,	199,	201,	202,
-	203,	204,	74,	207,	208,	209,	223,	154,
-	82,	159,	223,	223,	223,	169,	223,	88,
-	89,	181,	182,	183,	184,	185,	186,	187,
-	90,	155,	223,	164,	223,	223,	96,	149,
-	197,	200,	223,	211,	223,	214,	223,	104,
-	105,	106,	107,	160,	161,	162,	170,	223,
-	223,	223,	119,	120,	121,	122,	223,	125,
-	156,	223,	195,	128,	223,	213,	215,	223,
-	217,	134,	135,	136,	171,	173,	189,	190,
-	174,	175,	177,	179,	176,	178,	180,	188,
-	137,	138,	191,	139,	140,	193,	196,	141,
-	206,	223,	223,	218,	219,	220,	221,	222,
-	157,	167,	168,	192,	194,	205,	210,	223,
-	212
+const unsigned char yyparser_t::yyparv[144] = {
+221,	4,	5,	7,	9,	145,	11,	15,
+	221,	18,	146,	221,	15,	151,	221,	42,
+	43,	44,	45,	221,	197,	199,	200,	201,
+	202,	48,	205,	206,	207,	221,	150,	152,
+	57,	157,	221,	221,	221,	221,	162,	164,
+	165,	78,	79,	147,	80,	149,	196,	198,
+	221,	209,	221,	212,	221,	88,	89,	90,
+	153,	91,	158,	221,	221,	221,	168,	221,
+	97,	98,	180,	181,	182,	183,	184,	185,
+	186,	99,	154,	221,	163,	221,	221,	105,
+	148,	221,	194,	108,	221,	211,	213,	221,
+	215,	116,	117,	118,	159,	160,	161,	169,
+	221,	221,	221,	128,	129,	130,	131,	221,
+	134,	155,	195,	135,	204,	221,	221,	216,
+	217,	188,	189,	218,	219,	220,	138,	170,
+	172,	173,	174,	176,	178,	175,	177,	179,
+	187,	139,	140,	190,	141,	142,	192,	203,
+	208,	221,	156,	166,	167,	191,	193,	210
 };
 
 
-const int yyparser_t::yyparn[145] = {
+const unsigned char yyparser_t::yyparn[144] = {
 32,	0,	0,	0,	0,	0,	0,	0,
-	32,	0,	0,	0,	2,	0,	32,	0,
-	0,	0,	0,	32,	0,	0,	2,	0,
-	32,	32,	32,	32,	0,	0,	0,	2,
-	0,	0,	0,	0,	32,	0,	0,	0,
-	0,	0,	0,	0,	0,	2,	32,	0,
-	0,	0,	32,	32,	32,	0,	32,	0,
+	32,	0,	0,	32,	2,	0,	32,	0,
+	0,	0,	0,	32,	0,	0,	0,	0,
+	0,	0,	0,	0,	2,	32,	0,	0,
+	2,	0,	32,	32,	32,	32,	0,	0,
+	0,	2,	0,	0,	0,	0,	0,	0,
+	32,	0,	32,	0,	32,	0,	0,	0,
+	0,	0,	0,	32,	32,	32,	0,	32,
 	0,	0,	0,	0,	0,	0,	0,	0,
-	0,	0,	32,	0,	32,	32,	0,	0,
-	0,	0,	32,	0,	32,	0,	32,	0,
-	0,	0,	0,	0,	0,	0,	0,	32,
-	32,	32,	0,	0,	0,	0,	32,	0,
+	0,	0,	0,	32,	0,	32,	32,	0,
 	0,	32,	0,	0,	32,	0,	0,	32,
 	0,	0,	0,	0,	0,	0,	0,	0,
+	32,	32,	32,	0,	0,	0,	0,	32,
+	0,	0,	0,	0,	0,	32,	32,	0,
+	0,	0,	0,	0,	0,	0,	0,	0,
 	0,	0,	0,	0,	0,	0,	0,	0,
 	0,	0,	0,	0,	0,	0,	0,	0,
-	0,	32,	32,	0,	0,	0,	0,	0,
-	0,	0,	0,	0,	0,	0,	0,	32,
-	0
+	0,	32,	0,	0,	0,	0,	0,	0
 };
 
-const int yyparser_t::yypcv[75] = {
-223,	223,	223,	223,	20,	223,	26,	84,
-	24,	83,	46,	144,	75,	142,	223,	223,
-	223,	223,	223,	223,	223,	223,	110,	111,
-	223,	72,	223,	43,	44,	223,	223,	68,
-	223,	223,	223,	223,	223,	223,	223,	223,
-	223,	223,	223,	223,	25,	2,	45,	76,
-	77,	223,	52,	53,	223,	223,	223,	22,
-	14,	223,	30,	223,	223,	3,	223,	223,
-	223,	12,	223,	223,	223,	37,	39,	40,
-	41,	223,	223
+const unsigned char yyparser_t::yypcv[74] = {
+221,	221,	221,	221,	30,	221,	36,	93,
+	34,	92,	29,	143,	49,	136,	221,	221,
+	221,	221,	221,	221,	221,	221,	113,	114,
+	221,	46,	221,	26,	27,	221,	221,	77,
+	221,	221,	221,	221,	221,	221,	221,	221,
+	221,	221,	221,	221,	35,	2,	221,	61,
+	62,	221,	221,	221,	32,	14,	221,	40,
+	221,	221,	3,	221,	221,	221,	12,	221,
+	221,	20,	22,	23,	24,	28,	221,	50,
+	221,	51
 };
 
-const int yyparser_t::yypcn[75] = {
+const unsigned char yyparser_t::yypcn[74] = {
 32,	32,	32,	32,	1,	32,	1,	1,
 	1,	1,	3,	3,	1,	3,	32,	32,
 	32,	32,	32,	32,	32,	32,	1,	1,
 	32,	3,	32,	3,	3,	32,	32,	1,
 	32,	32,	32,	32,	32,	32,	32,	32,
-	32,	32,	32,	32,	1,	1,	1,	1,
-	1,	32,	1,	1,	32,	32,	32,	1,
-	1,	32,	1,	32,	32,	1,	32,	32,
-	32,	1,	32,	32,	32,	3,	1,	1,
-	1,	32,	32
+	32,	32,	32,	32,	1,	1,	32,	1,
+	1,	32,	32,	32,	1,	1,	32,	1,
+	32,	32,	1,	32,	32,	32,	1,	32,
+	32,	3,	1,	1,	1,	1,	32,	1,
+	32,	1
 };
 
 
-const int yyparser_t::yypgrv[145] = {
-223,	223,	223,	6,	8,	223,	10,	13,
-	223,	223,	223,	19,	21,	223,	223,	223,
-	223,	223,	223,	36,	223,	223,	223,	223,
-	223,	223,	223,	223,	223,	223,	223,	223,
-	223,	223,	223,	223,	73,	223,	223,	223,
-	223,	223,	223,	223,	223,	223,	223,	223,
-	223,	223,	67,	67,	86,	223,	223,	223,
-	223,	223,	223,	223,	223,	223,	223,	223,
-	223,	223,	223,	223,	223,	94,	223,	223,
-	223,	223,	97,	100,	102,	223,	223,	223,
-	223,	223,	223,	223,	223,	223,	223,	109,
-	114,	117,	223,	223,	223,	223,	223,	223,
-	223,	223,	223,	223,	129,	130,	223,	132,
-	223,	223,	223,	223,	223,	223,	223,	223,
-	223,	223,	223,	223,	223,	223,	223,	223,
-	223,	223,	223,	223,	223,	223,	223,	223,
-	223,	73,	143,	223,	223,	223,	223,	223,
-	223,	223,	223,	223,	223,	223,	223,	73,
-	223
+const unsigned char yyparser_t::yypgrv[144] = {
+221,	221,	221,	6,	8,	221,	10,	13,
+	221,	221,	221,	19,	31,	221,	221,	221,
+	221,	221,	221,	47,	221,	221,	221,	221,
+	221,	221,	221,	221,	221,	221,	221,	221,
+	221,	221,	221,	221,	221,	221,	221,	221,
+	221,	221,	221,	221,	221,	221,	221,	221,
+	81,	84,	86,	221,	221,	221,	221,	221,
+	221,	221,	221,	76,	76,	95,	221,	221,
+	221,	221,	221,	221,	221,	221,	221,	221,
+	221,	221,	221,	221,	221,	221,	103,	221,
+	221,	221,	221,	221,	109,	110,	221,	112,
+	221,	221,	221,	221,	221,	221,	221,	221,
+	120,	123,	126,	221,	221,	221,	221,	221,
+	221,	221,	221,	221,	221,	47,	137,	221,
+	221,	221,	221,	221,	221,	221,	221,	221,
+	221,	221,	221,	221,	221,	221,	221,	221,
+	221,	221,	221,	221,	221,	221,	221,	221,
+	221,	47,	221,	221,	221,	221,	221,	221
 };
 
-const int yyparser_t::yypgrn[145] = {
+const unsigned char yyparser_t::yypgrn[144] = {
 32,	32,	32,	0,	0,	32,	0,	2,
-	32,	32,	32,	0,	2,	32,	32,	32,
-	32,	32,	32,	4,	32,	32,	32,	32,
+	32,	32,	32,	4,	2,	32,	32,	32,
+	32,	32,	32,	2,	32,	32,	32,	32,
 	32,	32,	32,	32,	32,	32,	32,	32,
-	32,	32,	32,	32,	2,	32,	32,	32,
 	32,	32,	32,	32,	32,	32,	32,	32,
-	32,	32,	2,	2,	0,	32,	32,	32,
 	32,	32,	32,	32,	32,	32,	32,	32,
-	32,	32,	32,	32,	32,	0,	32,	32,
-	32,	32,	0,	0,	0,	32,	32,	32,
-	32,	32,	32,	32,	32,	32,	32,	0,
-	0,	0,	32,	32,	32,	32,	32,	32,
+	0,	0,	0,	32,	32,	32,	32,	32,
+	32,	32,	32,	2,	2,	0,	32,	32,
+	32,	32,	32,	32,	32,	32,	32,	32,
+	32,	32,	32,	32,	32,	32,	0,	32,
 	32,	32,	32,	32,	4,	0,	32,	0,
 	32,	32,	32,	32,	32,	32,	32,	32,
+	0,	0,	0,	32,	32,	32,	32,	32,
+	32,	32,	32,	32,	32,	2,	4,	32,
+	32,	32,	32,	32,	32,	32,	32,	32,
 	32,	32,	32,	32,	32,	32,	32,	32,
 	32,	32,	32,	32,	32,	32,	32,	32,
-	32,	2,	4,	32,	32,	32,	32,	32,
-	32,	32,	32,	32,	32,	32,	32,	2,
-	32
+	32,	2,	32,	32,	32,	32,	32,	32
 };
 
 const std::unordered_map<std::string, int> yyparser_t::yyslexemID{
@@ -4071,7 +4246,7 @@ void yysetstream(FILE *poutput, FILE *plogger) {
 	yyp.yylogger = plogger;
 }
 
-void yyemit_error__(const char *s, coder_t &coder, dmmap_t &dmap, cmacro_mgr_t &cmmgr) {
+void yyemit_error__(const char *s, cspec_t &spec, cmacro_mgr_t &cmmgr) {
     yyparser_t& yyp = getTheParser();
 	if(yyp.yylogger) 
 		fprintf(yyp.yylogger, "%s\n", s);
@@ -4106,13 +4281,22 @@ int yylexstr(char *strbuffer, int size) {
 int yylexcstr(const char *strbuffer, int size) {
 	return getTheParser().yylexinit__(strbuffer, size)? 0: -1;
 }
+// initializing memory-mapped file buffer before parsing or patter-matching
+int yylexmmap(const char *pchFile) {
+	return getTheParser().yylexinit__(pchFile)? 0: -1;
+}
 
 // generated scanner, can be replaced
-int yylex(coder_t &coder, dmmap_t &dmap, cmacro_mgr_t &cmmgr) {
+int yylex(cspec_t &spec, cmacro_mgr_t &cmmgr) {
 
-	return getTheParser().yylex__(coder, dmap, cmmgr);
+	return getTheParser().yylex__(spec, cmmgr);
 } 
 
+// scanning tokens in one call
+int yylex_batch(yytoken_t *out, int max, cspec_t &spec, cmacro_mgr_t &cmmgr) {
+	return getTheParser().yylex_batch__(out, max, spec, cmmgr);
+}
+
 // assign new scanner and return the old one 
 yylex_t yysetlex(yylex_t plex) {
 	
@@ -4124,15 +4308,15 @@ yylex_t yysetlex(yylex_t plex) {
 }
 
 // generated parser, it should not be replaced
-int yyparse(coder_t &coder, dmmap_t &dmap, cmacro_mgr_t &cmmgr) {
-	return getTheParser().yyparse__(coder, dmap, cmmgr);
+int yyparse(cspec_t &spec, cmacro_mgr_t &cmmgr) {
+	return getTheParser().yyparse__(spec, cmmgr);
 }
 } // namspace
 
-#line 894 "meta/coderyac.upg"
+#line 716 "meta/coderyac.upg"
 
 
 
-#line 4136 "gcode/coderyac.cpp"
+#line 4320 "gcode/coderyac.cpp"
 
 
@@ -2,8 +2,8 @@
 A parser program in C++, generated by Upgen 0.5.4.
 ******************************************************************************/
 
-#ifndef CLASS_coder_PARSE_T_FILE_CODERYAC_1528898937_H__
-#define CLASS_coder_PARSE_T_FILE_CODERYAC_1528898937_H__
+#ifndef CLASS_coder_PARSE_T_FILE_CODERYAC_1792289761_H__
+#define CLASS_coder_PARSE_T_FILE_CODERYAC_1792289761_H__
 
 #line 1 "meta/coderyac.upg"
 
@@ -30,15 +30,13 @@ A parser program in C++, generated by Upgen 0.5.4.
 
 #include "../coder/ctoken.h"
 using coder_ns::ctoken_t;
-#include "../coder/dmmap.h"
-#include "../coder/coder.h"
 #include "../coder/cmmgr.h"
-using coder_ns::coder_t;
+#include "../coder/cspec.h"
+using coder_ns::cspec_t;
 using coder_ns::cmacro_mgr_t;
-using coder_ns::dmmap_t;
 
 
-#line 41 "coderyac.h"
+#line 39 "coderyac.h"
 namespace coder_nsx {
 
 // token ID definition
@@ -81,7 +79,7 @@ __UPGEN_GENERATED_PARSE_TOKEN_VALUE = 0
 };
 
 // function type for error-reporting
-typedef void(*yyerror_t)(const char* msg, coder_t &coder, dmmap_t &dmap, cmacro_mgr_t &cmmgr);
+typedef void(*yyerror_t)(const char* msg, cspec_t &spec, cmacro_mgr_t &cmmgr);
 
 // assign new log stream
 void yysetstream(FILE *poutput, FILE *plogger);
@@ -103,7 +101,7 @@ struct yyltype_t {
 typedef ctoken_t xstype_t;
 typedef yyltype_t xltype_t;
 // function type for scanning
-typedef int (*yylex_t)(coder_t &coder, dmmap_t &dmap, cmacro_mgr_t &cmmgr);
+typedef int (*yylex_t)(cspec_t &spec, cmacro_mgr_t &cmmgr);
 
 // assign new scanner and return the old one
 yylex_t yysetlex(yylex_t);
@@ -114,13 +112,33 @@ int yylexfile(const char* pchFile, bool iMod = false);
 int yylexstr(char *strbuffer, int size);
 // initializing const string buffer before parsing or patter-matching
 int yylexcstr(const char *strbuffer, int size);
+// initializing memory-mapped file buffer before parsing or patter-matching
+int yylexmmap(const char *pchFile);
 
 // generated scanner, can be replaced
-int yylex(coder_t &coder, dmmap_t &dmap, cmacro_mgr_t &cmmgr);
+int yylex(cspec_t &spec, cmacro_mgr_t &cmmgr);
+
+// token recorded by yylex_batch
+struct yytoken_t {
+	// value returned by action
+	int id;
+	// index of matched rule
+	int rule;
+	// offset of text from start of input
+	long offset;
+	int length;
+	// text in input buffer, not NULL-terminated; NULL if input is read
+	// from file by pieces, or given by chunks
+	const char *text;
+};
+// scanning at most @max tokens into @out, return count of them, 0 at end of
+// input, or error code if none is scanned; text of tokens is valid until
+// next call
+int yylex_batch(yytoken_t *out, int max, cspec_t &spec, cmacro_mgr_t &cmmgr);
 
 
 // generated parser, it should not be replaced
-int yyparse(coder_t &coder, dmmap_t &dmap, cmacro_mgr_t &cmmgr);
+int yyparse(cspec_t &spec, cmacro_mgr_t &cmmgr);
 
 extern xstype_t yylval;
 extern xltype_t yylloc;
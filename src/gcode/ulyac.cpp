@@ -7,6 +7,11 @@ A parser program in C++, generated by Upgen 0.5.4.
 #include <errno.h>
 #include <string.h>
 #include <sys/stat.h>
+#if !defined(_WIN32)
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 // update 14/12/17
 #include <vector>
 #include <unordered_map>
@@ -184,7 +189,7 @@ static int sn_nVarDeclInit = -1;
 
 
 
-#line 187 "gcode/ulyac.cpp"
+#line 192 "gcode/ulyac.cpp"
 namespace yynsx {
 enum {
 INC_YYTEXT_SIZE = 4096,
@@ -207,7 +212,7 @@ DSCRD_SC = 22,
 PLVAR_SC = 24,
 
 // number of DFA states of scanner
-LEX_STATE_COUNT = 570,
+LEX_STATE_COUNT = 523,
 
 // DFA trap-state of scanner
 LEX_ERROR_STATE = 0,
@@ -323,6 +328,43 @@ enum {
 class bufbase_t;
 typedef bufbase_t *YYPBUFFER;
 
+// cycstack_t: stack of the last CYCSTACK_SIZE values, older ones are
+// overwritten, so that its memory does not grow with the input;
+// popping more than it keeps yields 0
+class cycstack_t {
+
+public:
+	enum {
+		CYCSTACK_SIZE = 64
+	};
+
+	cycstack_t(void) : bs(0), tp(0) {}
+
+	inline void push(int n) {
+		tp = (tp + 1) % CYCSTACK_SIZE;
+		el[tp] = n;
+		if(tp == bs) {
+			bs = (tp + 1) % CYCSTACK_SIZE;
+		}
+	}
+	inline int pop(void) {
+		if(tp == bs) {
+			return 0;
+		}
+		int n = el[tp];
+		tp = (tp + CYCSTACK_SIZE - 1) % CYCSTACK_SIZE;
+		return n;
+	}
+	inline void clear(void) {
+		tp = bs;
+	}
+
+private:
+	int el[CYCSTACK_SIZE];
+	int bs;
+	int tp;
+};
+
 class bufbase_t {
 
 public:
@@ -332,6 +374,10 @@ public:
 	virtual int unget(void) = 0;
 	virtual int unget(int num) = 0;
 	virtual int put(char) = 0;
+	// start of next token if it can be referred in place, otherwise NULL
+	virtual char* textptr(void) { return NULL; }
+	// count of chars read from start of input
+	virtual long tell(void) const { return (long)(gptr + 1 - pbase); }
 
 	inline void reset(void) {
 		xreset();
@@ -367,35 +413,23 @@ protected:
 	void *pvoid;
 
 public:
-    // update 14/12/17
-    inline void pushlsz(int nlsize) {
-        stlsz.push_back(nlsize);
-    }
-    inline int poplsz(void) {
-        if(stlsz.empty()) {
-            return 0;
-        }
-        auto n = stlsz.back();
-        stlsz.pop_back();
-        return n;
-    }
-
-    inline void pushtsz(int ntsize) {
-        // update 14/12/17
-        sttsz.push_back(ntsize);
-    }
-    inline int poptsz(void) {
-        if(sttsz.empty()) {
-            return 0;
-        }
-        auto n = sttsz.back();
-        sttsz.pop_back();
-        return n;
-    }
+	// sizes of lines and tabs read lately, so that columns can be
+	// restored when newlines and tabs are put back
+	inline void pushlsz(int nlsize) {
+		stlsz.push(nlsize);
+	}
+	inline int poplsz(void) {
+		return stlsz.pop();
+	}
+	inline void pushtsz(int ntsize) {
+		sttsz.push(ntsize);
+	}
+	inline int poptsz(void) {
+		return sttsz.pop();
+	}
 protected:
-    // update 14/12/17
-    std::vector<int> stlsz;
-    std::vector<int> sttsz;
+	cycstack_t stlsz;
+	cycstack_t sttsz;
 
 };
 
@@ -464,6 +498,7 @@ private:
 				gend = &buf[0];
 				eos = false;
 				bpeeked = false;
+				nfilled = 0;
 			}
 
 		public:
@@ -604,13 +639,26 @@ private:
 				if(ncnt > vacents) {
 					pbase = buf + ((gend - buf) + 1) % BUF_FULL_SIZE;
 				}
+				nfilled += ncnt;
 				return ncnt;
 			}
 
+		public:
+
+			// chars filled so far, less those not read yet
+			virtual long tell(void) const {
+
+				if(gptr == gend) {
+					return nfilled;
+				}
+				return nfilled - ((gend - gptr) + BUF_FULL_SIZE - 1) % BUF_FULL_SIZE;
+			}
+
 		private:
 
 			bool bpeeked;
 			FILE *pfile;
+			long nfilled;
 			by_te_t buf[BUF_FULL_SIZE];
 		};
 
@@ -714,10 +762,158 @@ private:
 				return oldc;
 			}
 
+			virtual char* textptr(void) {
+				return (char*)((gptr == gend)? gend : gptr + 1);
+			}
+
 		private:
 			bool bowner;
 		};
 
+	private:
+
+		// whole file mapped into memory, read linearly without refilling,
+		// so matched text can be referred in place instead of being copied
+		class mmapbuf_t: public bufbase_t {
+
+			friend class bufmgr_t;
+		public:
+
+			// nSize is length of file, one more zero byte follows the mapping
+			mmapbuf_t(by_te_t *pchMap, size_t nSize)
+			: nmap(nSize + 1) {
+
+				pbase = pchMap;
+				gend = pbase + nSize;
+				xreset();
+				imod = false;
+				line = 1;
+				col = 1;
+				tab = 4;
+				pvoid = NULL;
+			}
+
+			virtual ~mmapbuf_t(void) {
+#if !defined(_WIN32)
+				munmap(pbase, nmap);
+#else
+				delete [] pbase;
+#endif
+			}
+
+		public:
+
+			virtual void xreset(void) {
+
+				gptr = pbase - 1;
+				eos = false;
+			}
+			virtual int get(void) {
+
+				if(gptr == gend) {
+					eos = true;
+					return END_OF_ALLFILE;
+				}
+				++gptr;
+
+				return (gptr == gend)? END_OF_FILE : (int)(*gptr);
+			}
+
+			virtual int peek(void) {
+
+				return (gptr == gend) ? (eos ? END_OF_ALLFILE: END_OF_FILE) : 
+					(int)(*(gptr + 1));
+			}
+			virtual int unget(void) {
+				if(eos || (pbase - 1 == gptr)) {
+					return END_OF_FILE;
+				}
+				return (int)(*gptr--);
+			}
+			virtual int unget(int num) {
+
+				if(eos || (pbase - 1 == gptr)) {
+					return 0;
+				}
+				if(gptr - pbase + 1 < num) {
+					num = (int)(gptr - pbase + 1);
+				}
+				gptr -= num;
+
+				return num;
+			}
+
+			virtual int put(char c) {
+
+				if(eos || (pbase - 1 == gptr)) {
+					return END_OF_FILE;
+				}
+
+				int oldc = (int)(*gptr);
+
+				*gptr-- = (by_te_t)c;
+
+				return oldc;
+			}
+
+			virtual char* textptr(void) {
+				return (char*)((gptr == gend)? gend : gptr + 1);
+			}
+
+			// map file @pchFile privately, return NULL on failure
+			static mmapbuf_t* create(const char *pchFile) {
+
+				by_te_t *pmap;
+				size_t nsize;
+#if !defined(_WIN32)
+				struct stat st;
+				int fd = open(pchFile, O_RDONLY);
+				if(fd < 0) {
+					return NULL;
+				}
+				if(fstat(fd, &st) != 0) {
+					close(fd);
+					return NULL;
+				}
+				nsize = (size_t)st.st_size;
+				// reserve one more zero byte, then map the file over it,
+				// pages are copied on write only, for NULL-terminating yytext
+				void *p = mmap(NULL, nsize + 1, PROT_READ | PROT_WRITE,
+						MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+				if(MAP_FAILED == p) {
+					close(fd);
+					return NULL;
+				}
+				if(nsize > 0 && MAP_FAILED == mmap(p, nsize, PROT_READ | PROT_WRITE,
+						MAP_PRIVATE | MAP_FIXED, fd, 0)) {
+					munmap(p, nsize + 1);
+					close(fd);
+					return NULL;
+				}
+				close(fd);
+				pmap = (by_te_t*)p;
+#else
+				FILE *pfile = fopen(pchFile, "rb");
+				if( !pfile) {
+					return NULL;
+				}
+				fseek(pfile, 0, SEEK_END);
+				nsize = (size_t)ftell(pfile);
+				fseek(pfile, 0, SEEK_SET);
+				MYNEWS(pmap, by_te_t, nsize + 1);
+				nsize = fread(pmap, 1, nsize, pfile);
+				pmap[nsize] = '\0';
+				fclose(pfile);
+#endif
+				mmapbuf_t *pbuf;
+				MYNEW(pbuf, mmapbuf_t(pmap, nsize));
+				return pbuf;
+			}
+
+		private:
+			size_t nmap;
+		};
+
 	private:
 
 		struct link_t {
@@ -733,13 +929,16 @@ private:
 	public:
 
 		bufmgr_t(void)
-		: phead(NULL) {
+		: phead(NULL)
+		, pretired(NULL)
+		, bdefer(false) {
 
 			MYNEW(pstdin, filebuf_t);
 			MYNEW(pavail, link_t(pstdin, NULL));
 		}
 		~bufmgr_t(void) {
 
+			purge();
 			while(pavail) {
 
 				link_t *p = pavail->plink;
@@ -806,6 +1005,12 @@ private:
 				phead->pxbuf->reset();
 			}
 		}
+		inline char* textptr(void) {
+			return phead? phead->pxbuf->textptr(): NULL;
+		}
+		inline long tell(void) const {
+			return phead? phead->pxbuf->tell(): 0;
+		}
 		inline void pushlsz(int nlsize) {
 			if(phead) {
 				phead->pxbuf->pushlsz(nlsize);
@@ -870,6 +1075,16 @@ private:
 
 			return p;
 		}
+		inline bufbase_t* newmmap(const char * pchFile) {
+
+			mmapbuf_t *p = mmapbuf_t::create(pchFile);
+			if( !p) {
+				return NULL;
+			}
+			MYNEW(pavail->plink, link_t(p, pavail->plink));
+
+			return p;
+		}
 		
 		inline bufbase_t* switchto(bufbase_t* pbuf) {
 
@@ -915,14 +1130,37 @@ private:
 					link_t *q = p->plink;
 					p->plink = q->plink;
 
-					delete pxb;
-					delete q;
+					if(bdefer) {
+						q->plink = pretired;
+						pretired = q;
+					}
+					else {
+						delete pxb;
+						delete q;
+					}
 				}
 			}
 		}
+
+		// buffers destroyed while deferring are kept until purged,
+		// so text referred in place is still valid
+		inline void defer(bool bd) {
+			bdefer = bd;
+		}
+		void purge(void) {
+
+			while(pretired) {
+				link_t *p = pretired;
+				pretired = p->plink;
+				delete p->pxbuf;
+				delete p;
+			}
+		}
 		
 		void destroyall(void) {
 
+			purge();
+
 			while(pavail->plink) {
 				link_t *p = pavail->plink;
 				pavail->plink = p->plink;
@@ -968,58 +1206,63 @@ private:
 		link_t *phead;
 		// available buffer stack
 		link_t *pavail;
+		// buffers destroyed but not deleted yet
+		link_t *pretired;
+		bool bdefer;
 		// stdin buffer
 		bufbase_t *pstdin;
 	};
 
 
+    // stack on contiguous storage, which is reserved once and reused,
+    // popped elements are left to be overwritten by following pushes
     template<class ElemType, int INIT_SIZE = 4096>
     class sstack_t {
     public:
-        inline sstack_t(void) {
-
+        inline sstack_t(void)
+        : mTop(0) {
+            mStk.resize(INIT_SIZE);
         }
 
-        inline void push(void) {
-            mStk.push_back(ElemType());
+        inline ElemType& push(void) {
+            if(mTop == (int)mStk.size()) {
+                mStk.resize(mStk.size() * 2 + 1);
+            }
+            return mStk[mTop++];
         }
         inline void push(const ElemType &e) {
-            mStk.push_back(e);
+            push() = e;
         }
         inline ElemType& top(void) {
-            return mStk.back();
+            return mStk[mTop - 1];
         }
         inline const ElemType& top(void) const {
-            return mStk.back();
+            return mStk[mTop - 1];
         }
         inline void pop(int n) {
-            while(n > 0 && !mStk.empty()) {
-                mStk.pop_back();
-                n--;
-            }
+            mTop = (n < mTop)? mTop - n : 0;
         }
         inline ElemType& operator[](int down) {
-            const auto sz = (int) mStk.size();
-            return mStk[sz - 1 - down];
+            return mStk[mTop - 1 - down];
         }
         inline const ElemType& operator[](int down) const {
-            const auto sz = (int) mStk.size();
-            return mStk[sz - 1 - down];
+            return mStk[mTop - 1 - down];
         }
 
         inline bool empty(void) const {
-            return mStk.empty();
+            return mTop == 0;
         }
 
         inline int count(void) const {
-            return (int)mStk.size();
+            return mTop;
         }
 
         inline void clear(void) {
-            mStk.clear();
+            mTop = 0;
         }
     private:
         std::vector<ElemType> mStk;
+        int mTop;
     };
 
 
@@ -1027,9 +1270,72 @@ private:
 
 	inline void renew_text__(void) {
 
-		MYRENEW(yytext, char, INC_YYTEXT_SIZE + yysize__, yysize__);
+		bool bown = (yytext == yytbuf__);
+		MYRENEW(yytbuf__, char, INC_YYTEXT_SIZE + yysize__, yysize__);
 		yysize__ += INC_YYTEXT_SIZE;
-		yytext[yysize__ - 1] = '\0';
+		yytbuf__[yysize__ - 1] = '\0';
+		if(bown) {
+			yytext = yytbuf__;
+		}
+	}
+
+	// put back the char overwritten by terminating NULL of in-place yytext
+	inline void yyunhold__(void) {
+		if(yyhold_ptr__) {
+			*yyhold_ptr__ = yyhold_char__;
+			yyhold_ptr__ = NULL;
+		}
+	}
+
+	// terminate yytext at @n, the char there is held if yytext is in place
+	inline void yyend_text__(int n) {
+		if(yytext != yytbuf__) {
+			yyunhold__();
+			yyhold_ptr__ = yytext + n;
+			yyhold_char__ = *yyhold_ptr__;
+		}
+		yytext[n] = '\0';
+	}
+
+	// set up yytext for next token: refer to the input in place if current
+	// buffer allows it, otherwise copy matched chars into own text buffer
+	inline void yynew_text__(bool bmore) {
+		yyunhold__();
+		char *p = yybufmgr__.textptr();
+		if(!bmore) {
+			if(p) {
+				yytext = p;
+			}
+			else {
+				yytext = yytbuf__;
+				yytext[0] = '\0';
+			}
+		}
+		else if(yytext != yytbuf__ && yytext + yylaleng != p) {
+			// text to be appended is not adjacent any more
+			yyown_text__();
+		}
+	}
+
+	// copy in-place yytext into own text buffer
+	inline void yyown_text__(void) {
+		if(yytext != yytbuf__) {
+			yyunhold__();
+			while(yylaleng >= yysize__ - 1) {
+				renew_text__();
+			}
+			memcpy(yytbuf__, yytext, yylaleng);
+			yytext = yytbuf__;
+			yytext[yylaleng] = '\0';
+		}
+	}
+
+	inline void yyreset_text__(void) {
+		yyunhold__();
+		yytext = yytbuf__;
+		if(yytext) {
+			yytext[0] = '\0';
+		}
 	}
 
 	inline bool yylex_is_running__(void) const {
@@ -1139,6 +1445,10 @@ public:
 	, yytext(NULL)
 	, yyleng(0)
 	, yylaleng(0)
+	, yytbuf__(NULL)
+	, yyhold_ptr__(NULL)
+	, yyhold_char__('\0')
+	, yyrule__(LEX_ERROR_RULE)
 	, yyerr_flag__(false)
 	, yyltok(PARSE_UNDEFSYMB_ID)
 	, yylexer(plex)
@@ -1149,8 +1459,8 @@ public:
 	}
     ~yyparser_t(void) {
 
-		if(yytext) {
-			delete[] yytext;
+		if(yytbuf__) {
+			delete[] yytbuf__;
 		}
 
 	}
@@ -1164,7 +1474,22 @@ public:
 		
 		yy_switch_buffer(pbuf);
 
-		if(!yytext) {
+		if(!yytbuf__) {
+			renew_text__();
+		}
+		return yy_has_buffer();
+	}
+
+	inline bool yylexinit__(const char *pchFile) {
+
+		YYPBUFFER pbuf = yy_new_mmapbuf(pchFile);
+		if( !pbuf ) {
+			return false;
+		}
+		
+		yy_switch_buffer(pbuf);
+
+		if(!yytbuf__) {
 			renew_text__();
 		}
 		return yy_has_buffer();
@@ -1180,7 +1505,7 @@ public:
 
 		yy_switch_buffer(pbuf);
 
-		if(!yytext) {
+		if(!yytbuf__) {
 			renew_text__();
 		}
 		return yy_has_buffer();
@@ -1196,7 +1521,7 @@ public:
 
 		yy_switch_buffer(pbuf);
 
-		if(!yytext) {
+		if(!yytbuf__) {
 			renew_text__();
 		}
 		return yy_has_buffer();
@@ -1220,14 +1545,14 @@ public:
 	int c, i, j;
 	string strMsg;
 
-#line 1223 "gcode/ulyac.cpp"
+#line 1548 "gcode/ulyac.cpp"
 
 		yymore_flag__ = false;
 		yyecode__ = YYE_ALIVE;
 		
 		yyleng = 0;
 		yylaleng = 0;
-		yytext[0] = '\0';
+		yynew_text__(false);
 
 		
 
@@ -1245,11 +1570,12 @@ public:
 
 			if(LEX_ERROR_STATE != yylstate__) {
 
-				if(yylaleng >= yysize__ - 1) {
-					renew_text__();
+				if(yytext == yytbuf__) {
+					if(yylaleng >= yysize__ - 1) {
+						renew_text__();
+					}
+					yytext[yylaleng] = (char)yycchar__;
 				}
-				yytext[yylaleng] = (char)yycchar__;
-
 				++yylaleng;
 
 				if(yyget_lexrule__(yylstate__) != LEX_ERROR_RULE) {
@@ -1276,7 +1602,7 @@ public:
 						yybufmgr__.unget(yylaleng + 1 - yyaccleng__);
 					}
 					yylaleng = yyaccleng__;
-					yytext[yylaleng] = '\0';
+					yyend_text__(yylaleng);
 				 yyleng = yylaleng;
 				}
 
@@ -1285,22 +1611,36 @@ public:
 				int nline = yyget_lineno();
 				int ncol = yyget_colno() - 1;
 				int nt = yyget_tabsize();
-				int ts, yyt1__;
-				for(yyt1__ = 0; yyt1__ < yyleng; ++yyt1__) {
-					if(yytext[yyt1__] == '\t') {
-
-						ts = nt - ncol % nt;
-						yybufmgr__.pushtsz(ts);
-						ncol += ts;
-					}
-					else if(yytext[yyt1__] == '\n') {
-						yybufmgr__.pushlsz(ncol + 1);
-						ncol = 0;
-						++nline;
+				int ts;
+				// find newlines by memchr, only lines with tabs are walked
+				const char *yyt1__ = yytext, *yyt2__, *yyt3__;
+				const char *yyt4__ = yytext + yyleng;
+				while(yyt1__ < yyt4__) {
+					yyt2__ = (const char*)memchr(yyt1__, '\n', yyt4__ - yyt1__);
+					yyt3__ = yyt2__? yyt2__: yyt4__;
+					if(memchr(yyt1__, '\t', yyt3__ - yyt1__)) {
+						for(; yyt1__ < yyt3__; ++yyt1__) {
+							if(*yyt1__ == '\t') {
+
+								ts = nt - ncol % nt;
+								yybufmgr__.pushtsz(ts);
+								ncol += ts;
+							}
+							else {
+								++ncol;
+							}
+						}
 					}
 					else {
-						++ncol;
+						ncol += (int)(yyt3__ - yyt1__);
+					}
+					if( !yyt2__) {
+						break;
 					}
+					yybufmgr__.pushlsz(ncol + 1);
+					ncol = 0;
+					++nline;
+					yyt1__ = yyt2__ + 1;
 				}
                 yylloc.firstLine = yyget_lineno();
                 yylloc.firstColumn = yyget_colno();
@@ -1311,6 +1651,7 @@ public:
 			}
 				}
 
+		yyrule__ = yylrule__;
 		bwrap__ = (yylrule__ >= LEX_EOFRULE_BASE
 			&& yylrule__ < LEX_EOAF_RULE
 			&& yywrap__(lexer, dtbl, grammar, ptbl, dmap, gsetup));
@@ -1321,14 +1662,14 @@ public:
 case 0:
 {
 	
-#line 346 "meta/ulyac.upg"
+#line 347 "meta/ulyac.upg"
 	{
 
 		yy_set_bol(true);
 	}
 	
 
-#line 1331 "gcode/ulyac.cpp"
+#line 1672 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -1336,14 +1677,14 @@ case 0:
 case 1:
 {
 	
-#line 351 "meta/ulyac.upg"
+#line 352 "meta/ulyac.upg"
 	{
 		
 		PROCESS_ACTION_1(c, '*', '/', NULL_ACTION)
 	}
 	
 
-#line 1346 "gcode/ulyac.cpp"
+#line 1687 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -1351,7 +1692,7 @@ case 1:
 case 2:
 {
 	
-#line 356 "meta/ulyac.upg"
+#line 357 "meta/ulyac.upg"
 		{
 
 		c = yyinput();
@@ -1389,7 +1730,7 @@ case 2:
 	}
 
 
-#line 1392 "gcode/ulyac.cpp"
+#line 1733 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -1397,14 +1738,14 @@ case 2:
 case 3:
 {
 	
-#line 392 "meta/ulyac.upg"
+#line 393 "meta/ulyac.upg"
 		{
 
 		LEX_BEGIN(PRS_SC);		
 		return SECT_DELIM;
 	}
 
-#line 1407 "gcode/ulyac.cpp"
+#line 1748 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -1412,7 +1753,7 @@ case 3:
 case 4:
 {
 	
-#line 397 "meta/ulyac.upg"
+#line 398 "meta/ulyac.upg"
 		{
 		
 		// scanning code section comes here		
@@ -1430,7 +1771,7 @@ case 4:
 	}
 
 
-#line 1433 "gcode/ulyac.cpp"
+#line 1774 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -1438,7 +1779,7 @@ case 4:
 case 5:
 {
 	
-#line 413 "meta/ulyac.upg"
+#line 414 "meta/ulyac.upg"
 	{
 
 		int idx = 8;
@@ -1462,7 +1803,7 @@ case 5:
 	}
 	
 
-#line 1465 "gcode/ulyac.cpp"
+#line 1806 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -1470,14 +1811,14 @@ case 5:
 case 6:
 {
 	
-#line 435 "meta/ulyac.upg"
+#line 436 "meta/ulyac.upg"
 				{
 
 		CRET
 	}
 	
 
-#line 1480 "gcode/ulyac.cpp"
+#line 1821 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -1485,7 +1826,7 @@ case 6:
 case 7:
 {
 	
-#line 440 "meta/ulyac.upg"
+#line 441 "meta/ulyac.upg"
 		{
 		if(!strhelper_t::toSnum(yytext, yylval.m_nVal)) {
 			
@@ -1504,7 +1845,7 @@ case 7:
 	}
 	
 
-#line 1507 "gcode/ulyac.cpp"
+#line 1848 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -1512,14 +1853,14 @@ case 7:
 case 8:
 {
 	
-#line 457 "meta/ulyac.upg"
+#line 458 "meta/ulyac.upg"
 	{
 
         return KW_ON;
     }
 
 
-#line 1522 "gcode/ulyac.cpp"
+#line 1863 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -1527,14 +1868,14 @@ case 8:
 case 9:
 {
 	
-#line 462 "meta/ulyac.upg"
+#line 463 "meta/ulyac.upg"
 	{
 
         return KW_OFF;
     }
 
 
-#line 1537 "gcode/ulyac.cpp"
+#line 1878 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -1544,7 +1885,7 @@ case 10:
 case 11:
 {
 	
-#line 468 "meta/ulyac.upg"
+#line 469 "meta/ulyac.upg"
 	{
 
 		char *tx = yytext;
@@ -1577,7 +1918,7 @@ case 11:
 		return CSTR;
 	}
 
-#line 1580 "gcode/ulyac.cpp"
+#line 1921 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -1585,14 +1926,14 @@ case 11:
 case 12:
 {
 	
-#line 499 "meta/ulyac.upg"
+#line 500 "meta/ulyac.upg"
 		{
 		
 		LEX_BEGIN(INITIAL);
 	}
 
 
-#line 1595 "gcode/ulyac.cpp"
+#line 1936 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -1602,7 +1943,7 @@ case 13:
 case 14:
 {
 	
-#line 505 "meta/ulyac.upg"
+#line 506 "meta/ulyac.upg"
 		{
 		
 		LEX_BEGIN(XISC_SC);
@@ -1617,7 +1958,7 @@ case 14:
 	}
 
 
-#line 1620 "gcode/ulyac.cpp"
+#line 1961 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -1625,7 +1966,7 @@ case 14:
 case 15:
 {
 	
-#line 518 "meta/ulyac.upg"
+#line 519 "meta/ulyac.upg"
 		{
 		
 		yylval.m_pchVal = new char[yyleng + 1];
@@ -1637,7 +1978,7 @@ case 15:
 		return XISC;
 	}
 
-#line 1640 "gcode/ulyac.cpp"
+#line 1981 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -1645,12 +1986,12 @@ case 15:
 case 16:
 {
 	
-#line 528 "meta/ulyac.upg"
+#line 529 "meta/ulyac.upg"
 
 
 	
 
-#line 1653 "gcode/ulyac.cpp"
+#line 1994 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -1658,14 +1999,14 @@ case 16:
 case 17:
 {
 	
-#line 530 "meta/ulyac.upg"
+#line 531 "meta/ulyac.upg"
 		{
 	
 		LEX_BEGIN(INITIAL);
 	}
 
 
-#line 1668 "gcode/ulyac.cpp"
+#line 2009 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -1673,7 +2014,7 @@ case 17:
 case 18:
 {
 	
-#line 535 "meta/ulyac.upg"
+#line 536 "meta/ulyac.upg"
 	{
 
 		i = 7;
@@ -1688,7 +2029,7 @@ case 18:
 	}
 
 
-#line 1691 "gcode/ulyac.cpp"
+#line 2032 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -1696,7 +2037,7 @@ case 18:
 case 19:
 {
 	
-#line 548 "meta/ulyac.upg"
+#line 549 "meta/ulyac.upg"
 		{
 
 		if(dmap.isAction(CKEY_LTYPE_DECLARE)) {
@@ -1735,7 +2076,7 @@ case 19:
 	}
 
 
-#line 1738 "gcode/ulyac.cpp"
+#line 2079 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -1743,7 +2084,7 @@ case 19:
 case 20:
 {
 	
-#line 585 "meta/ulyac.upg"
+#line 586 "meta/ulyac.upg"
 			{
 		
 		if(dmap.isAction(CKEY_STYPE_DECLARE)) {
@@ -1785,7 +2126,7 @@ case 20:
 	}
 
 
-#line 1788 "gcode/ulyac.cpp"
+#line 2129 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -1799,7 +2140,7 @@ case 23:
 case 24:
 {
 	
-#line 628 "meta/ulyac.upg"
+#line 629 "meta/ulyac.upg"
 	{
 
 		string strKey;
@@ -1877,7 +2218,7 @@ case 24:
 
 	
 
-#line 1880 "gcode/ulyac.cpp"
+#line 2221 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -1889,7 +2230,7 @@ case 26:
 case 27:
 {
 	
-#line 706 "meta/ulyac.upg"
+#line 707 "meta/ulyac.upg"
 		{
 
 		bool bret;
@@ -1938,7 +2279,7 @@ case 27:
 
 
 
-#line 1941 "gcode/ulyac.cpp"
+#line 2282 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -1946,7 +2287,7 @@ case 27:
 case 28:
 {
 	
-#line 753 "meta/ulyac.upg"
+#line 754 "meta/ulyac.upg"
 		{
 
 		if( ! sn_pactDeclHeader) {
@@ -1960,7 +2301,7 @@ case 28:
 	}
 
 
-#line 1963 "gcode/ulyac.cpp"
+#line 2304 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -1968,13 +2309,13 @@ case 28:
 case 29:
 {
 	
-#line 765 "meta/ulyac.upg"
+#line 766 "meta/ulyac.upg"
 			{
 		LEX_PUSH_STATE(TOK_SC);
 		return TOKEN_LABEL;
 	}
 
-#line 1977 "gcode/ulyac.cpp"
+#line 2318 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -1982,13 +2323,13 @@ case 29:
 case 30:
 {
 	
-#line 769 "meta/ulyac.upg"
+#line 770 "meta/ulyac.upg"
 			{
 		LEX_PUSH_STATE(TOK_SC);
 		return LEFT_LABEL;
 	}
 
-#line 1991 "gcode/ulyac.cpp"
+#line 2332 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -1996,13 +2337,13 @@ case 30:
 case 31:
 {
 	
-#line 773 "meta/ulyac.upg"
+#line 774 "meta/ulyac.upg"
 			{
 		LEX_PUSH_STATE(TOK_SC);
 		return RIGHT_LABEL;
 	}
 
-#line 2005 "gcode/ulyac.cpp"
+#line 2346 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -2010,13 +2351,13 @@ case 31:
 case 32:
 {
 	
-#line 777 "meta/ulyac.upg"
+#line 778 "meta/ulyac.upg"
 		{
 		LEX_PUSH_STATE(TOK_SC);
 		return NONASSOC_LABEL;
 	}
 
-#line 2019 "gcode/ulyac.cpp"
+#line 2360 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -2024,14 +2365,14 @@ case 32:
 case 33:
 {
 	
-#line 781 "meta/ulyac.upg"
+#line 782 "meta/ulyac.upg"
 			{
 		LEX_PUSH_STATE(TYP_SC);
 		return TYPE_LABEL;
 	}
 
 
-#line 2034 "gcode/ulyac.cpp"
+#line 2375 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -2041,7 +2382,7 @@ case 34:
 case 35:
 {
 	
-#line 787 "meta/ulyac.upg"
+#line 788 "meta/ulyac.upg"
  {		
 		yylval.m_pDstrct = new action_t(yylloc.firstLine);
 		
@@ -2101,7 +2442,7 @@ case 35:
 		return DESTRUCTOR_LABEL;
 	}
 
-#line 2104 "gcode/ulyac.cpp"
+#line 2445 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -2109,13 +2450,13 @@ case 35:
 case 36:
 {
 	
-#line 845 "meta/ulyac.upg"
+#line 846 "meta/ulyac.upg"
 		{
 		sn_nVarDeclInit = 0;
 		LEX_PUSH_STATE(PLVAR_SC);
 	}
 
-#line 2118 "gcode/ulyac.cpp"
+#line 2459 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -2123,13 +2464,13 @@ case 36:
 case 37:
 {
 	
-#line 849 "meta/ulyac.upg"
+#line 850 "meta/ulyac.upg"
 		{
 		sn_nVarDeclInit = 1;
 		LEX_PUSH_STATE(PLVAR_SC);
 	}
 
-#line 2132 "gcode/ulyac.cpp"
+#line 2473 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -2137,13 +2478,13 @@ case 37:
 case 38:
 {
 	
-#line 853 "meta/ulyac.upg"
+#line 854 "meta/ulyac.upg"
 		{
 		sn_nVarDeclInit = 2;
 		LEX_PUSH_STATE(PLVAR_SC);
 	}
 
-#line 2146 "gcode/ulyac.cpp"
+#line 2487 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -2151,14 +2492,14 @@ case 38:
 case 39:
 {
 	
-#line 857 "meta/ulyac.upg"
+#line 858 "meta/ulyac.upg"
 		{
 		sn_nVarDeclInit = 3;
 		LEX_PUSH_STATE(PLVAR_SC);
 	}
 	
 
-#line 2161 "gcode/ulyac.cpp"
+#line 2502 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -2166,13 +2507,13 @@ case 39:
 case 40:
 {
 	
-#line 862 "meta/ulyac.upg"
+#line 863 "meta/ulyac.upg"
 		{
 		sn_nVarDeclInit = 0;
 		LEX_PUSH_STATE(PLVAR_SC);
 	}
 
-#line 2175 "gcode/ulyac.cpp"
+#line 2516 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -2180,13 +2521,13 @@ case 40:
 case 41:
 {
 	
-#line 866 "meta/ulyac.upg"
+#line 867 "meta/ulyac.upg"
 		{
 		sn_nVarDeclInit = 1;
 		LEX_PUSH_STATE(PLVAR_SC);
 	}
 
-#line 2189 "gcode/ulyac.cpp"
+#line 2530 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -2194,13 +2535,13 @@ case 41:
 case 42:
 {
 	
-#line 870 "meta/ulyac.upg"
+#line 871 "meta/ulyac.upg"
 		{
 		sn_nVarDeclInit = 2;
 		LEX_PUSH_STATE(PLVAR_SC);
 	}
 
-#line 2203 "gcode/ulyac.cpp"
+#line 2544 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -2208,14 +2549,14 @@ case 42:
 case 43:
 {
 	
-#line 874 "meta/ulyac.upg"
+#line 875 "meta/ulyac.upg"
 		{
 		sn_nVarDeclInit = 3;
 		LEX_PUSH_STATE(PLVAR_SC);
 	}
 	
 
-#line 2218 "gcode/ulyac.cpp"
+#line 2559 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -2223,13 +2564,13 @@ case 43:
 case 44:
 {
 	
-#line 879 "meta/ulyac.upg"
+#line 880 "meta/ulyac.upg"
 			{
 		sn_nVarDeclInit = 4;
 		LEX_PUSH_STATE(PLVAR_SC);
 	}
 
-#line 2232 "gcode/ulyac.cpp"
+#line 2573 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -2237,14 +2578,14 @@ case 44:
 case 45:
 {
 	
-#line 883 "meta/ulyac.upg"
+#line 884 "meta/ulyac.upg"
 			{
 		sn_nVarDeclInit = 5;
 		LEX_PUSH_STATE(PLVAR_SC);
 	}
 
 
-#line 2247 "gcode/ulyac.cpp"
+#line 2588 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -2252,7 +2593,7 @@ case 45:
 case 46:
 {
 	
-#line 888 "meta/ulyac.upg"
+#line 889 "meta/ulyac.upg"
 		{
 
 		string strKey;
@@ -2318,7 +2659,7 @@ case 46:
 	}
 
 
-#line 2321 "gcode/ulyac.cpp"
+#line 2662 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -2326,7 +2667,7 @@ case 46:
 case 47:
 {
 	
-#line 952 "meta/ulyac.upg"
+#line 953 "meta/ulyac.upg"
 		{
 		
 		if(! sn_pactDefHeader) {
@@ -2340,7 +2681,7 @@ case 47:
 	}
 
 
-#line 2343 "gcode/ulyac.cpp"
+#line 2684 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -2348,7 +2689,7 @@ case 47:
 case 48:
 {
 	
-#line 964 "meta/ulyac.upg"
+#line 965 "meta/ulyac.upg"
 	{
 
 		c = yyleng - 1;
@@ -2363,7 +2704,7 @@ case 48:
 	}
 
 
-#line 2366 "gcode/ulyac.cpp"
+#line 2707 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -2371,7 +2712,7 @@ case 48:
 case 49:
 {
 	
-#line 977 "meta/ulyac.upg"
+#line 978 "meta/ulyac.upg"
 	{
 
 		yylval.m_pchVal = new char[yyleng + 1];
@@ -2381,7 +2722,7 @@ case 49:
 		return CID;
 	}
 
-#line 2384 "gcode/ulyac.cpp"
+#line 2725 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -2389,12 +2730,12 @@ case 49:
 case 50:
 {
 	
-#line 985 "meta/ulyac.upg"
+#line 986 "meta/ulyac.upg"
 	{
 		CRET
 	}
 
-#line 2397 "gcode/ulyac.cpp"
+#line 2738 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -2402,13 +2743,13 @@ case 50:
 case 51:
 {
 	
-#line 988 "meta/ulyac.upg"
+#line 989 "meta/ulyac.upg"
 		{
         yylval.m_cVal = strhelper_t::toEsc(&yytext[1]);
 		return QCHAR;
 	}
 
-#line 2411 "gcode/ulyac.cpp"
+#line 2752 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -2416,13 +2757,13 @@ case 51:
 case 52:
 {
 	
-#line 992 "meta/ulyac.upg"
+#line 993 "meta/ulyac.upg"
 		{	
 		yylval.m_cVal = (char)strhelper_t::ostr2Num(&yytext[1]);
 		return QCHAR;
 	}
 
-#line 2425 "gcode/ulyac.cpp"
+#line 2766 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -2430,13 +2771,13 @@ case 52:
 case 53:
 {
 	
-#line 996 "meta/ulyac.upg"
+#line 997 "meta/ulyac.upg"
 		{
 		yylval.m_cVal = (char)strhelper_t::hstr2Num(&yytext[1]);
 		return QCHAR;
 	}
 
-#line 2439 "gcode/ulyac.cpp"
+#line 2780 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -2444,13 +2785,13 @@ case 53:
 case 54:
 {
 	
-#line 1000 "meta/ulyac.upg"
+#line 1001 "meta/ulyac.upg"
 	{
 		yylval.m_cVal = yytext[1];
 		return QCHAR;
 	}
 
-#line 2453 "gcode/ulyac.cpp"
+#line 2794 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -2458,13 +2799,13 @@ case 54:
 case 55:
 {
 	
-#line 1004 "meta/ulyac.upg"
+#line 1005 "meta/ulyac.upg"
 		{
 		yylval.m_cVal = yytext[2];
 		return QCHAR;
 	}
 
-#line 2467 "gcode/ulyac.cpp"
+#line 2808 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -2472,7 +2813,7 @@ case 55:
 case 56:
 {
 	
-#line 1008 "meta/ulyac.upg"
+#line 1009 "meta/ulyac.upg"
            {
         std::string tstr;
         for(auto i = 0; i < yyleng; ) {
@@ -2515,7 +2856,7 @@ case 56:
 
     }
 
-#line 2518 "gcode/ulyac.cpp"
+#line 2859 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -2523,7 +2864,7 @@ case 56:
 case 57:
 {
 	
-#line 1049 "meta/ulyac.upg"
+#line 1050 "meta/ulyac.upg"
 		{
 
 		if(!strhelper_t::toSnum(yytext, yylval.m_nVal)) {		
@@ -2540,7 +2881,7 @@ case 57:
 		return INT;
 	}
 
-#line 2543 "gcode/ulyac.cpp"
+#line 2884 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -2548,12 +2889,12 @@ case 57:
 case 58:
 {
 	
-#line 1064 "meta/ulyac.upg"
+#line 1065 "meta/ulyac.upg"
 		{
 		return yytext[0];
 	}
 
-#line 2556 "gcode/ulyac.cpp"
+#line 2897 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -2561,14 +2902,14 @@ case 58:
 case 59:
 {
 	
-#line 1067 "meta/ulyac.upg"
+#line 1068 "meta/ulyac.upg"
 	{
 		LEX_POP_STATE();
 		return '\n';
 	}
 	
 
-#line 2571 "gcode/ulyac.cpp"
+#line 2912 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -2576,7 +2917,7 @@ case 59:
 case 60:
 {
 	
-#line 1072 "meta/ulyac.upg"
+#line 1073 "meta/ulyac.upg"
 		{
 
 		strMsg = strhelper_t::fromInt(yylloc.firstLine);
@@ -2599,7 +2940,7 @@ case 60:
 	}
 
 
-#line 2602 "gcode/ulyac.cpp"
+#line 2943 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -2607,7 +2948,7 @@ case 60:
 case 61:
 {
 	
-#line 1093 "meta/ulyac.upg"
+#line 1094 "meta/ulyac.upg"
 		{
 
 		LEX_PUSH_STATE(SCR_SC);
@@ -2615,7 +2956,7 @@ case 61:
 		CRET
 	}
 
-#line 2618 "gcode/ulyac.cpp"
+#line 2959 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -2623,14 +2964,14 @@ case 61:
 case 62:
 {
 	
-#line 1099 "meta/ulyac.upg"
+#line 1100 "meta/ulyac.upg"
 	{
 
 		return KW_INITIAL;
 	}
 	
 
-#line 2633 "gcode/ulyac.cpp"
+#line 2974 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -2638,7 +2979,7 @@ case 62:
 case 63:
 {
 	
-#line 1104 "meta/ulyac.upg"
+#line 1105 "meta/ulyac.upg"
 		{
 
 		yylval.m_pchVal = new char[yyleng + 1];
@@ -2648,7 +2989,7 @@ case 63:
 	}
 	
 
-#line 2651 "gcode/ulyac.cpp"
+#line 2992 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -2656,14 +2997,14 @@ case 63:
 case 64:
 {
 	
-#line 1112 "meta/ulyac.upg"
+#line 1113 "meta/ulyac.upg"
 			{
 
 		CRET
 	}
 	
 
-#line 2666 "gcode/ulyac.cpp"
+#line 3007 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -2671,7 +3012,7 @@ case 64:
 case 65:
 {
 	
-#line 1117 "meta/ulyac.upg"
+#line 1118 "meta/ulyac.upg"
 			{
 
 		LEX_POP_STATE();
@@ -2680,7 +3021,7 @@ case 65:
 	}
 	
 
-#line 2683 "gcode/ulyac.cpp"
+#line 3024 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -2688,13 +3029,13 @@ case 65:
 case 66:
 {
 	
-#line 1124 "meta/ulyac.upg"
+#line 1125 "meta/ulyac.upg"
 			{
 		return KW_ALLSC;
 	}
 
 
-#line 2697 "gcode/ulyac.cpp"
+#line 3038 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -2702,13 +3043,13 @@ case 66:
 case 67:
 {
 	
-#line 1128 "meta/ulyac.upg"
+#line 1129 "meta/ulyac.upg"
 		{
 		return KW_EOF;
 	}
 
 
-#line 2711 "gcode/ulyac.cpp"
+#line 3052 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -2716,7 +3057,7 @@ case 67:
 case 68:
 {
 	
-#line 1132 "meta/ulyac.upg"
+#line 1133 "meta/ulyac.upg"
 		{
 
 		i = yyleng - 1;
@@ -2736,7 +3077,7 @@ case 68:
 	}
 
 
-#line 2739 "gcode/ulyac.cpp"
+#line 3080 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -2744,7 +3085,7 @@ case 68:
 case 69:
 {
 	
-#line 1150 "meta/ulyac.upg"
+#line 1151 "meta/ulyac.upg"
 	{
 
 		LEX_POP_STATE();
@@ -2752,7 +3093,7 @@ case 69:
 	}
 
 
-#line 2755 "gcode/ulyac.cpp"
+#line 3096 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -2760,7 +3101,7 @@ case 69:
 case 70:
 {
 	
-#line 1156 "meta/ulyac.upg"
+#line 1157 "meta/ulyac.upg"
 		{
 		
 		yylval.m_nPosix = charset_t::ALNUM;
@@ -2769,7 +3110,7 @@ case 70:
 	}
 
 
-#line 2772 "gcode/ulyac.cpp"
+#line 3113 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -2777,7 +3118,7 @@ case 70:
 case 71:
 {
 	
-#line 1163 "meta/ulyac.upg"
+#line 1164 "meta/ulyac.upg"
 		{
 		
 		yylval.m_nPosix = charset_t::ALPHA;
@@ -2786,7 +3127,7 @@ case 71:
 	}
 	
 
-#line 2789 "gcode/ulyac.cpp"
+#line 3130 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -2794,7 +3135,7 @@ case 71:
 case 72:
 {
 	
-#line 1170 "meta/ulyac.upg"
+#line 1171 "meta/ulyac.upg"
 		{
 
 		yylval.m_nPosix = charset_t::BLANK;
@@ -2803,7 +3144,7 @@ case 72:
 	}
 	
 
-#line 2806 "gcode/ulyac.cpp"
+#line 3147 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -2811,7 +3152,7 @@ case 72:
 case 73:
 {
 	
-#line 1177 "meta/ulyac.upg"
+#line 1178 "meta/ulyac.upg"
 		{
 		
 		yylval.m_nPosix = charset_t::CNTRL;
@@ -2820,7 +3161,7 @@ case 73:
 	}
 	
 
-#line 2823 "gcode/ulyac.cpp"
+#line 3164 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -2828,7 +3169,7 @@ case 73:
 case 74:
 {
 	
-#line 1184 "meta/ulyac.upg"
+#line 1185 "meta/ulyac.upg"
 		{
 		
 		yylval.m_nPosix = charset_t::DIGIT;
@@ -2837,7 +3178,7 @@ case 74:
 	}
 	
 
-#line 2840 "gcode/ulyac.cpp"
+#line 3181 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -2845,7 +3186,7 @@ case 74:
 case 75:
 {
 	
-#line 1191 "meta/ulyac.upg"
+#line 1192 "meta/ulyac.upg"
 		{
 
 		yylval.m_nPosix = charset_t::GRAPH;
@@ -2854,7 +3195,7 @@ case 75:
 	}
 	
 
-#line 2857 "gcode/ulyac.cpp"
+#line 3198 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -2862,7 +3203,7 @@ case 75:
 case 76:
 {
 	
-#line 1198 "meta/ulyac.upg"
+#line 1199 "meta/ulyac.upg"
 		{
 
 		yylval.m_nPosix = charset_t::LOWER;
@@ -2871,7 +3212,7 @@ case 76:
 	}
 	
 
-#line 2874 "gcode/ulyac.cpp"
+#line 3215 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -2879,7 +3220,7 @@ case 76:
 case 77:
 {
 	
-#line 1205 "meta/ulyac.upg"
+#line 1206 "meta/ulyac.upg"
 		{
 
 		yylval.m_nPosix = charset_t::PRINT;
@@ -2888,7 +3229,7 @@ case 77:
 	}
 	
 
-#line 2891 "gcode/ulyac.cpp"
+#line 3232 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -2896,7 +3237,7 @@ case 77:
 case 78:
 {
 	
-#line 1212 "meta/ulyac.upg"
+#line 1213 "meta/ulyac.upg"
 		{
 
 		yylval.m_nPosix = charset_t::PUNCT;
@@ -2905,7 +3246,7 @@ case 78:
 	}
 	
 
-#line 2908 "gcode/ulyac.cpp"
+#line 3249 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -2913,7 +3254,7 @@ case 78:
 case 79:
 {
 	
-#line 1219 "meta/ulyac.upg"
+#line 1220 "meta/ulyac.upg"
 		{
 		
 		yylval.m_nPosix = charset_t::SPACE;
@@ -2922,7 +3263,7 @@ case 79:
 	}
 	
 
-#line 2925 "gcode/ulyac.cpp"
+#line 3266 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -2930,7 +3271,7 @@ case 79:
 case 80:
 {
 	
-#line 1226 "meta/ulyac.upg"
+#line 1227 "meta/ulyac.upg"
 		{
 		
 		yylval.m_nPosix = charset_t::UPPER;
@@ -2939,7 +3280,7 @@ case 80:
 	}
 	
 
-#line 2942 "gcode/ulyac.cpp"
+#line 3283 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -2947,7 +3288,7 @@ case 80:
 case 81:
 {
 	
-#line 1233 "meta/ulyac.upg"
+#line 1234 "meta/ulyac.upg"
 		{
 		
 		yylval.m_nPosix = charset_t::XDIGIT;
@@ -2955,7 +3296,7 @@ case 81:
 		return POSIX_SET;
 	}
 
-#line 2958 "gcode/ulyac.cpp"
+#line 3299 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -2963,7 +3304,7 @@ case 81:
 case 82:
 {
 	
-#line 1239 "meta/ulyac.upg"
+#line 1240 "meta/ulyac.upg"
 			{
 		
 		yylval.m_nPosix = charset_t::CIDF;
@@ -2972,7 +3313,7 @@ case 82:
 	}
 	
 
-#line 2975 "gcode/ulyac.cpp"
+#line 3316 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -2980,7 +3321,7 @@ case 82:
 case 83:
 {
 	
-#line 1246 "meta/ulyac.upg"
+#line 1247 "meta/ulyac.upg"
 			{
 
 		yylval.m_nPosix = charset_t::CIDS;
@@ -2989,7 +3330,7 @@ case 83:
 	}
 	
 
-#line 2992 "gcode/ulyac.cpp"
+#line 3333 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -2997,7 +3338,7 @@ case 83:
 case 84:
 {
 	
-#line 1253 "meta/ulyac.upg"
+#line 1254 "meta/ulyac.upg"
 		{
 
 		LEX_PUSH_STATE(CSH_SC);	
@@ -3005,7 +3346,7 @@ case 84:
 	}
 	
 
-#line 3008 "gcode/ulyac.cpp"
+#line 3349 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -3013,14 +3354,14 @@ case 84:
 case 85:
 {
 	
-#line 1259 "meta/ulyac.upg"
+#line 1260 "meta/ulyac.upg"
 		{
 
 		LEX_PUSH_STATE(CSH_SC);
 		return NCS;
 	}
 
-#line 3023 "gcode/ulyac.cpp"
+#line 3364 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -3028,14 +3369,14 @@ case 85:
 case 86:
 {
 	
-#line 1264 "meta/ulyac.upg"
+#line 1265 "meta/ulyac.upg"
 	{
 		
 		yylval.m_cVal = yytext[1];
 		return CCHAR;
 	}
 
-#line 3038 "gcode/ulyac.cpp"
+#line 3379 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -3043,7 +3384,7 @@ case 86:
 case 87:
 {
 	
-#line 1269 "meta/ulyac.upg"
+#line 1270 "meta/ulyac.upg"
 		{
 
         yylval.m_cVal = strhelper_t::toEsc(yytext);
@@ -3051,7 +3392,7 @@ case 87:
 	}
 	
 
-#line 3054 "gcode/ulyac.cpp"
+#line 3395 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -3059,7 +3400,7 @@ case 87:
 case 88:
 {
 	
-#line 1275 "meta/ulyac.upg"
+#line 1276 "meta/ulyac.upg"
 		{
 	
 		yylval.m_cVal = (char)strhelper_t::ostr2Num(yytext);
@@ -3067,7 +3408,7 @@ case 88:
 		return CCHAR;
 	}
 
-#line 3070 "gcode/ulyac.cpp"
+#line 3411 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -3075,7 +3416,7 @@ case 88:
 case 89:
 {
 	
-#line 1281 "meta/ulyac.upg"
+#line 1282 "meta/ulyac.upg"
 		{
 
 		yylval.m_cVal = (char)strhelper_t::hstr2Num(yytext);
@@ -3083,7 +3424,7 @@ case 89:
 		return CCHAR;
 	}
 
-#line 3086 "gcode/ulyac.cpp"
+#line 3427 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -3091,7 +3432,7 @@ case 89:
 case 90:
 {
 	
-#line 1287 "meta/ulyac.upg"
+#line 1288 "meta/ulyac.upg"
 	{
 
 		if(yytext[0] == '\\') {
@@ -3107,7 +3448,7 @@ case 90:
 	}
 	
 
-#line 3110 "gcode/ulyac.cpp"
+#line 3451 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -3115,13 +3456,13 @@ case 90:
 case 91:
 {
 	
-#line 1301 "meta/ulyac.upg"
+#line 1302 "meta/ulyac.upg"
 			{
 		CRET
 	}
 
 
-#line 3124 "gcode/ulyac.cpp"
+#line 3465 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -3129,7 +3470,7 @@ case 91:
 case 92:
 {
 	
-#line 1305 "meta/ulyac.upg"
+#line 1306 "meta/ulyac.upg"
 			{
 
 		LEX_POP_STATE();
@@ -3137,7 +3478,7 @@ case 92:
 		CRET
 	}
 
-#line 3140 "gcode/ulyac.cpp"
+#line 3481 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -3145,7 +3486,7 @@ case 92:
 case 93:
 {
 	
-#line 1311 "meta/ulyac.upg"
+#line 1312 "meta/ulyac.upg"
 			{
 
 		yylval.m_cVal = yytext[0];
@@ -3154,7 +3495,7 @@ case 93:
 	}
 
 
-#line 3157 "gcode/ulyac.cpp"
+#line 3498 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -3162,14 +3503,14 @@ case 93:
 case 94:
 {
 	
-#line 1318 "meta/ulyac.upg"
+#line 1319 "meta/ulyac.upg"
 		{
 
 		CRET
 	}
 	
 
-#line 3172 "gcode/ulyac.cpp"
+#line 3513 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -3177,7 +3518,7 @@ case 94:
 case 95:
 {
 	
-#line 1323 "meta/ulyac.upg"
+#line 1324 "meta/ulyac.upg"
 		{
 
 		yylval.m_pchVal = new char[yyleng - 1];
@@ -3188,7 +3529,7 @@ case 95:
 	}
 	
 
-#line 3191 "gcode/ulyac.cpp"
+#line 3532 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -3196,7 +3537,7 @@ case 95:
 case 96:
 {
 	
-#line 1332 "meta/ulyac.upg"
+#line 1333 "meta/ulyac.upg"
 		{
 
 		char cc = yytext[yyleng - 1];
@@ -3214,7 +3555,7 @@ case 96:
 	}
 
 
-#line 3217 "gcode/ulyac.cpp"
+#line 3558 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -3222,7 +3563,7 @@ case 96:
 case 97:
 {
 	
-#line 1348 "meta/ulyac.upg"
+#line 1349 "meta/ulyac.upg"
 		{
 
 		char cc = yytext[yyleng - 1];
@@ -3239,7 +3580,7 @@ case 97:
 	}
 	
 
-#line 3242 "gcode/ulyac.cpp"
+#line 3583 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -3247,7 +3588,7 @@ case 97:
 case 98:
 {
 	
-#line 1363 "meta/ulyac.upg"
+#line 1364 "meta/ulyac.upg"
 		{
 		
 		char cc = yytext[yyleng - 2];
@@ -3265,7 +3606,7 @@ case 98:
 	}
 	
 
-#line 3268 "gcode/ulyac.cpp"
+#line 3609 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -3273,7 +3614,7 @@ case 98:
 case 99:
 {
 	
-#line 1379 "meta/ulyac.upg"
+#line 1380 "meta/ulyac.upg"
 		{
 
 		int n;
@@ -3301,7 +3642,7 @@ case 99:
 		return RANGE_BET;
 	}
 
-#line 3304 "gcode/ulyac.cpp"
+#line 3645 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -3309,7 +3650,7 @@ case 99:
 case 100:
 {
 	
-#line 1405 "meta/ulyac.upg"
+#line 1406 "meta/ulyac.upg"
 	{
 
 		yylval.m_cVal = yytext[0];
@@ -3317,7 +3658,7 @@ case 100:
 	}
 	
 
-#line 3320 "gcode/ulyac.cpp"
+#line 3661 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -3327,7 +3668,7 @@ case 101:
 case 102:
 {
 	
-#line 1412 "meta/ulyac.upg"
+#line 1413 "meta/ulyac.upg"
 	{
 
 		yylval.m_pchVal = new char[yyleng - 1];
@@ -3338,7 +3679,7 @@ case 102:
 	}
 	
 
-#line 3341 "gcode/ulyac.cpp"
+#line 3682 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -3346,7 +3687,7 @@ case 102:
 case 103:
 {
 	
-#line 1421 "meta/ulyac.upg"
+#line 1422 "meta/ulyac.upg"
 	{
 
 		if('\n' != yytext[yyleng - 1]) {
@@ -3379,7 +3720,7 @@ case 103:
 	}
 
 
-#line 3382 "gcode/ulyac.cpp"
+#line 3723 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -3389,7 +3730,7 @@ case 104:
 case 105:
 {
 	
-#line 1453 "meta/ulyac.upg"
+#line 1454 "meta/ulyac.upg"
 		{
 
 		c = yytext[yyleng - 1];
@@ -3432,7 +3773,7 @@ case 105:
 	}
 	
 
-#line 3435 "gcode/ulyac.cpp"
+#line 3776 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -3440,13 +3781,13 @@ case 105:
 case 106:
 {
 	
-#line 1494 "meta/ulyac.upg"
+#line 1495 "meta/ulyac.upg"
 		{
 		CRET
 	}
 
 
-#line 3449 "gcode/ulyac.cpp"
+#line 3790 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -3454,13 +3795,13 @@ case 106:
 case 107:
 {
 	
-#line 1498 "meta/ulyac.upg"
+#line 1499 "meta/ulyac.upg"
 	{
 
 		return DPRE_LABEL;
 	}
 
-#line 3463 "gcode/ulyac.cpp"
+#line 3804 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -3468,13 +3809,13 @@ case 107:
 case 108:
 {
 	
-#line 1502 "meta/ulyac.upg"
+#line 1503 "meta/ulyac.upg"
 		{
 
 		return PREC_LABEL;
 	}
 
-#line 3477 "gcode/ulyac.cpp"
+#line 3818 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -3482,7 +3823,7 @@ case 108:
 case 109:
 {
 	
-#line 1506 "meta/ulyac.upg"
+#line 1507 "meta/ulyac.upg"
 				{
 
 		LEX_PUSH_STATE(PACT_SC);
@@ -3491,7 +3832,7 @@ case 109:
 		return PACT_BEGIN;
 	}
 
-#line 3494 "gcode/ulyac.cpp"
+#line 3835 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -3499,7 +3840,7 @@ case 109:
 case 110:
 {
 	
-#line 1513 "meta/ulyac.upg"
+#line 1514 "meta/ulyac.upg"
 		{
 
 		LEX_POP_STATE();
@@ -3508,7 +3849,7 @@ case 110:
 	
 	/* ` is considered as escape char during action processing */
 
-#line 3511 "gcode/ulyac.cpp"
+#line 3852 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -3518,13 +3859,13 @@ case 111:
 case 112:
 {
 	
-#line 1521 "meta/ulyac.upg"
+#line 1522 "meta/ulyac.upg"
 		{
 
 		ptbl.addActionText(&yytext[1]);
 	}
 
-#line 3527 "gcode/ulyac.cpp"
+#line 3868 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -3532,7 +3873,7 @@ case 112:
 case 113:
 {
 	
-#line 1525 "meta/ulyac.upg"
+#line 1526 "meta/ulyac.upg"
 		{
 
 		int nRuleID = grammar.getLastProdIndex();
@@ -3571,7 +3912,7 @@ case 113:
 		}
 	}
 
-#line 3574 "gcode/ulyac.cpp"
+#line 3915 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -3579,7 +3920,7 @@ case 113:
 case 114:
 {
 	
-#line 1562 "meta/ulyac.upg"
+#line 1563 "meta/ulyac.upg"
 		{
 		yytext[yyleng - 2] = '\0';
 		ptbl.addActionMacro(SKEY_SVNAME_LEFT, &yytext[2]);
@@ -3596,7 +3937,7 @@ case 114:
 		}
 	}
 
-#line 3599 "gcode/ulyac.cpp"
+#line 3940 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -3604,7 +3945,7 @@ case 114:
 case 115:
 {
 	
-#line 1577 "meta/ulyac.upg"
+#line 1578 "meta/ulyac.upg"
 		{
 
 		int nVal;
@@ -3672,7 +4013,7 @@ case 115:
 		}
 	}
 
-#line 3675 "gcode/ulyac.cpp"
+#line 4016 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -3680,7 +4021,7 @@ case 115:
 case 116:
 {
 	
-#line 1643 "meta/ulyac.upg"
+#line 1644 "meta/ulyac.upg"
 	{
 
 		i = yyleng - 1;
@@ -3736,7 +4077,7 @@ case 116:
 		}
 	}
 
-#line 3739 "gcode/ulyac.cpp"
+#line 4080 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -3744,7 +4085,7 @@ case 116:
 case 117:
 {
 	
-#line 1697 "meta/ulyac.upg"
+#line 1698 "meta/ulyac.upg"
 			{
 		ptbl.addActionText(yytext[0]);
 	}
@@ -3752,7 +4093,7 @@ case 117:
 	/********* default pattern ******/
 	
 
-#line 3755 "gcode/ulyac.cpp"
+#line 4096 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -3760,11 +4101,11 @@ case 117:
 case 118:
 {
 	
-#line 1703 "meta/ulyac.upg"
+#line 1704 "meta/ulyac.upg"
 
 
 
-#line 3767 "gcode/ulyac.cpp"
+#line 4108 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -3772,12 +4113,12 @@ case 118:
 case 119:
 {
 	
-#line 1704 "meta/ulyac.upg"
+#line 1705 "meta/ulyac.upg"
 
 
 	
 
-#line 3780 "gcode/ulyac.cpp"
+#line 4121 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -3785,7 +4126,7 @@ case 119:
 case 120:
 {
 	
-#line 1706 "meta/ulyac.upg"
+#line 1707 "meta/ulyac.upg"
 		{
 		
 		strMsg = strhelper_t::fromInt(yylloc.firstLine);
@@ -3920,7 +4261,7 @@ case 120:
 	}
 
 
-#line 3923 "gcode/ulyac.cpp"
+#line 4264 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -3930,7 +4271,7 @@ case 121:
 	
 #line 0 "meta/ulyac.upg"
 
-#line 3933 "gcode/ulyac.cpp"
+#line 4274 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -3940,7 +4281,7 @@ case 122:
 	
 #line 0 "meta/ulyac.upg"
 
-#line 3943 "gcode/ulyac.cpp"
+#line 4284 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -3950,7 +4291,7 @@ case 123:
 	
 #line 0 "meta/ulyac.upg"
 
-#line 3953 "gcode/ulyac.cpp"
+#line 4294 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -3960,7 +4301,7 @@ case 124:
 	
 #line 0 "meta/ulyac.upg"
 
-#line 3963 "gcode/ulyac.cpp"
+#line 4304 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -3970,7 +4311,7 @@ case 125:
 	
 #line 0 "meta/ulyac.upg"
 
-#line 3973 "gcode/ulyac.cpp"
+#line 4314 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -3980,7 +4321,7 @@ case 126:
 	
 #line 0 "meta/ulyac.upg"
 
-#line 3983 "gcode/ulyac.cpp"
+#line 4324 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -3990,7 +4331,7 @@ case 127:
 	
 #line 0 "meta/ulyac.upg"
 
-#line 3993 "gcode/ulyac.cpp"
+#line 4334 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -4000,7 +4341,7 @@ case 128:
 	
 #line 0 "meta/ulyac.upg"
 
-#line 4003 "gcode/ulyac.cpp"
+#line 4344 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -4010,7 +4351,7 @@ case 129:
 	
 #line 0 "meta/ulyac.upg"
 
-#line 4013 "gcode/ulyac.cpp"
+#line 4354 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -4020,7 +4361,7 @@ case 130:
 	
 #line 0 "meta/ulyac.upg"
 
-#line 4023 "gcode/ulyac.cpp"
+#line 4364 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -4030,7 +4371,7 @@ case 131:
 	
 #line 0 "meta/ulyac.upg"
 
-#line 4033 "gcode/ulyac.cpp"
+#line 4374 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -4040,7 +4381,7 @@ case 132:
 	
 #line 0 "meta/ulyac.upg"
 
-#line 4043 "gcode/ulyac.cpp"
+#line 4384 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -4050,7 +4391,7 @@ case 133:
 	
 #line 0 "meta/ulyac.upg"
 
-#line 4053 "gcode/ulyac.cpp"
+#line 4394 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -4089,10 +4430,11 @@ case 133:
 						yyaccleng__ = 0;
 						yylaleng = 0;
 						yyleng = 0;
-						yytext[yylaleng] = '\0';
+						yynew_text__(false);
 					}
 					else {
 						yymore_flag__ = false;
+						yynew_text__(true);
 					}
 				}
 			}
@@ -4101,6 +4443,37 @@ case 133:
 		return (yyecode__ == YYE_EOS)? 0 : yyecode__;
 	}
 
+	// scan tokens into @out until @max of them are recorded, or scanner
+	// returns no token; text of token is referred in place if possible
+	int yylex_batch__(yytoken_t *out, int max, lexer_ns::lexer_t& lexer, lexer_ns::dtable_t &dtbl,
+	parser_ns::grammar_t &grammar, parser_ns::ptable_t &ptbl,
+	dmmap_t &dmap, gsetting_t &gsetup) {
+
+		int n = 0;
+		int tok = 0;
+
+		// buffers of last call are not referred any more
+		yybufmgr__.purge();
+		yybufmgr__.defer(true);
+		while(n < max) {
+
+			tok = yylex__(lexer, dtbl, grammar, ptbl, dmap, gsetup);
+			if(tok <= 0) {
+				break;
+			}
+
+			yytoken_t &t = out[n++];
+			t.id = tok;
+			t.rule = yyrule__;
+			t.offset = yybufmgr__.tell() - yyleng;
+			t.length = yyleng;
+			t.text = (yytext == yytbuf__)? NULL : yytext;
+		}
+		yybufmgr__.defer(false);
+
+		return (n > 0 || tok >= 0)? n : tok;
+	}
+
 	int yyparse__(lexer_ns::lexer_t& lexer, lexer_ns::dtable_t &dtbl,
 	parser_ns::grammar_t &grammar, parser_ns::ptable_t &ptbl,
 	dmmap_t &dmap, gsetting_t &gsetup) {
@@ -4110,14 +4483,8 @@ case 133:
 		}
 
 		yyecode__ = YYE_ALIVE;
-		sstack_t<xstype_t> yys_sv__;
 		xstype_t yyval;
-
-		sstack_t<xltype_t> yys_loc__;
-
 		xltype_t yyloc;
-		sstack_t<int> yys_stt__;
-		sstack_t<int> yys_symb__;
 
 		int yyrplen__;
 		bool yyreducing__;
@@ -4143,16 +4510,17 @@ case 133:
 	
 	int s_nCurLeftSymbol = INVALID_INDEX;
 
-#line 4146 "gcode/ulyac.cpp"
+#line 4513 "gcode/ulyac.cpp"
 
 
 		yyltok = PARSE_UNDEFSYMB_ID;
 		yyerr_flag__ = false;
 
 
-		yys_stt__.push(yypstate__);
+		yystk__.clear();
+		yystk__.push().stt = yypstate__;
 
-		while( ! yys_stt__.empty() && yyparse_is_running__(yypstate__)) {
+		while( ! yystk__.empty() && yyparse_is_running__(yypstate__)) {
 			yyprule__ = yyget_defrule(yypstate__);
 			if(is_valid_prule__(yyprule__)) {
 				yyreducing__ = true;
@@ -4171,16 +4539,17 @@ case 133:
 				}
 
 
-				yypstate__ = yynext_pstate__(yys_stt__.top(), yysidx__);
+				yypstate__ = yynext_pstate__(yystk__.top().stt, yysidx__);
 
 				if(is_valid_pstate__(yypstate__)) {
 
 
-					yys_symb__.push(yysidx__);
-					yys_stt__.push(yypstate__);
-                    yys_sv__.push(yylval);
+					yyframe_t &yyf__ = yystk__.push();
+					yyf__.stt = yypstate__;
+					yyf__.symb = yysidx__;
+					yyf__.sv = yylval;
 
-                    yys_loc__.push(yylloc);
+					yyf__.loc = yylloc;
  
 					yytok__ = PARSE_UNDEFSYMB_ID;
 					yyreducing__ = false;
@@ -4196,16 +4565,16 @@ case 133:
 				
 	case 0:
 	{
-#line 1841 "meta/ulyac.upg"
+#line 1842 "meta/ulyac.upg"
 
-#line 4201 "gcode/ulyac.cpp"
+#line 4570 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 2:
 	{
-#line 1842 "meta/ulyac.upg"
+#line 1843 "meta/ulyac.upg"
 
 			if(_GETERR() >= ERRID_BASE) {
 				YYABORT();
@@ -4223,41 +4592,41 @@ case 133:
 				s_nCounter = 0;
 			}
 		
-#line 4226 "gcode/ulyac.cpp"
+#line 4595 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 3:
 	{
-#line 1860 "meta/ulyac.upg"
+#line 1861 "meta/ulyac.upg"
 
 			if(_GETERR() >= ERRID_BASE) {
 				YYABORT();
 			}
 		
-#line 4239 "gcode/ulyac.cpp"
+#line 4608 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 4:
 	{
-#line 1866 "meta/ulyac.upg"
+#line 1867 "meta/ulyac.upg"
 
 
 			if(_GETERR() >= ERRID_BASE) {
 				YYABORT();
 			}
 		
-#line 4253 "gcode/ulyac.cpp"
+#line 4622 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 1:
 	{
-#line 1872 "meta/ulyac.upg"
+#line 1873 "meta/ulyac.upg"
 
 			if(s_vstrSName.size() > 0) {
 				grammar.addTokens(s_vstrSName, s_vnToken);
@@ -4283,183 +4652,183 @@ case 133:
 				YYACCEPT();
 			}
 		
-#line 4286 "gcode/ulyac.cpp"
+#line 4655 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 5:
 	{
-#line 1898 "meta/ulyac.upg"
+#line 1899 "meta/ulyac.upg"
 
-#line 4295 "gcode/ulyac.cpp"
+#line 4664 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 6:
 	{
-#line 1898 "meta/ulyac.upg"
+#line 1899 "meta/ulyac.upg"
 
-#line 4304 "gcode/ulyac.cpp"
+#line 4673 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 7:
 	{
-#line 1901 "meta/ulyac.upg"
+#line 1902 "meta/ulyac.upg"
 
 			grammar.reset();
 		
-#line 4315 "gcode/ulyac.cpp"
+#line 4684 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 8:
 	{
-#line 1905 "meta/ulyac.upg"
+#line 1906 "meta/ulyac.upg"
 
-#line 4324 "gcode/ulyac.cpp"
+#line 4693 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 9:
 	{
-#line 1906 "meta/ulyac.upg"
+#line 1907 "meta/ulyac.upg"
 
-#line 4333 "gcode/ulyac.cpp"
+#line 4702 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 10:
 	{
-#line 1909 "meta/ulyac.upg"
+#line 1910 "meta/ulyac.upg"
 
-#line 4342 "gcode/ulyac.cpp"
+#line 4711 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 11:
 	{
-#line 1910 "meta/ulyac.upg"
+#line 1911 "meta/ulyac.upg"
 
-#line 4351 "gcode/ulyac.cpp"
+#line 4720 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 12:
 	{
-#line 1911 "meta/ulyac.upg"
+#line 1912 "meta/ulyac.upg"
 
-#line 4360 "gcode/ulyac.cpp"
+#line 4729 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 13:
 	{
-#line 1912 "meta/ulyac.upg"
+#line 1913 "meta/ulyac.upg"
 
-#line 4369 "gcode/ulyac.cpp"
+#line 4738 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 14:
 	{
-#line 1913 "meta/ulyac.upg"
+#line 1914 "meta/ulyac.upg"
 
-#line 4378 "gcode/ulyac.cpp"
+#line 4747 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 15:
 	{
-#line 1914 "meta/ulyac.upg"
+#line 1915 "meta/ulyac.upg"
 
 				
-				if(!lexer.addXSC((yys_sv__[0].m_pchVal))) {
+				if(!lexer.addXSC((yystk__[0].sv.m_pchVal))) {
 				
-					strMsg = strhelper_t::fromInt((yys_loc__[0]).firstLine);
+					strMsg = strhelper_t::fromInt((yystk__[0].loc).firstLine);
 					strMsg += ':';
-					strMsg += strhelper_t::fromInt((yys_loc__[0]).firstColumn);
+					strMsg += strhelper_t::fromInt((yystk__[0].loc).firstColumn);
 					strMsg += "; description: start-condition `";
-					strMsg += (yys_sv__[0].m_pchVal);
+					strMsg += (yystk__[0].sv.m_pchVal);
 					strMsg += "\' duplicated and discarded.";
 					_WARNING(strMsg);
 				}
-				delete[] (yys_sv__[0].m_pchVal);
+				delete[] (yystk__[0].sv.m_pchVal);
 			
-#line 4400 "gcode/ulyac.cpp"
+#line 4769 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 16:
 	{
-#line 1928 "meta/ulyac.upg"
+#line 1929 "meta/ulyac.upg"
 
 				
-				if(!lexer.addISC((yys_sv__[0].m_pchVal)))  {
+				if(!lexer.addISC((yystk__[0].sv.m_pchVal)))  {
 				
-					strMsg = strhelper_t::fromInt((yys_loc__[0]).firstLine);
+					strMsg = strhelper_t::fromInt((yystk__[0].loc).firstLine);
 					strMsg += ':';
-					strMsg += strhelper_t::fromInt((yys_loc__[0]).firstColumn);
+					strMsg += strhelper_t::fromInt((yystk__[0].loc).firstColumn);
 					strMsg += "; description: start-condition `";
-					strMsg += (yys_sv__[0].m_pchVal);
+					strMsg += (yystk__[0].sv.m_pchVal);
 					strMsg += "\' duplicated and discarded.";
 					_WARNING(strMsg);
 				}
-				delete[] (yys_sv__[0].m_pchVal);
+				delete[] (yystk__[0].sv.m_pchVal);
 			
-#line 4422 "gcode/ulyac.cpp"
+#line 4791 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 17:
 	{
-#line 1942 "meta/ulyac.upg"
+#line 1943 "meta/ulyac.upg"
 
 				if(s_strStartSymbol.empty()) {
-					s_strStartSymbol = (yys_sv__[0].m_pchVal);
+					s_strStartSymbol = (yystk__[0].sv.m_pchVal);
 					s_sname2Idx.insert(s2i_pair_t(s_strStartSymbol, INVALID_INDEX));	
 				}
 				else {
-					strMsg = strhelper_t::fromInt((yys_loc__[0]).firstLine);
+					strMsg = strhelper_t::fromInt((yystk__[0].loc).firstLine);
 					strMsg += ':';
-					strMsg += strhelper_t::fromInt((yys_loc__[0]).firstColumn);
+					strMsg += strhelper_t::fromInt((yystk__[0].loc).firstColumn);
 					strMsg += "; description: start symbol is already set as `";
 					strMsg += s_strStartSymbol;
 					strMsg += "\', this setting discarded.";
 					_WARNING(strMsg);
 				}
-				delete[] (yys_sv__[0].m_pchVal);
+				delete[] (yystk__[0].sv.m_pchVal);
 			
-#line 4446 "gcode/ulyac.cpp"
+#line 4815 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 18:
 	{
-#line 1959 "meta/ulyac.upg"
+#line 1960 "meta/ulyac.upg"
 
-#line 4455 "gcode/ulyac.cpp"
+#line 4824 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 19:
 	{
-#line 1960 "meta/ulyac.upg"
+#line 1961 "meta/ulyac.upg"
 
 
 			strMsg = "token name expected.";
@@ -4467,14 +4836,14 @@ case 133:
 			
 			yyerrok();
 		
-#line 4470 "gcode/ulyac.cpp"
+#line 4839 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 20:
 	{
-#line 1967 "meta/ulyac.upg"
+#line 1968 "meta/ulyac.upg"
 
 
 			strMsg = "semantic value type or token name expected.";
@@ -4482,214 +4851,214 @@ case 133:
 			
 			yyerrok();
 		
-#line 4485 "gcode/ulyac.cpp"
+#line 4854 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 21:
 	{
-#line 1975 "meta/ulyac.upg"
+#line 1976 "meta/ulyac.upg"
 
 			s_nCurAssoc = ASSOC_UNKNOWN;
 			s_nCurPrec = DEFAULT_PREC;
 			s_nCurSVTID = DEFAULT_SVT_ID;
 		
-#line 4498 "gcode/ulyac.cpp"
+#line 4867 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 22:
 	{
-#line 1980 "meta/ulyac.upg"
+#line 1981 "meta/ulyac.upg"
 
 			s_nCurAssoc = ASSOC_LEFT;
 			s_nCurPrec = s_nCounter;
 			s_nCurSVTID = DEFAULT_SVT_ID;
 			++s_nCounter;
 		
-#line 4512 "gcode/ulyac.cpp"
+#line 4881 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 23:
 	{
-#line 1986 "meta/ulyac.upg"
+#line 1987 "meta/ulyac.upg"
 
 			s_nCurAssoc = ASSOC_RIGHT;
 			s_nCurPrec = s_nCounter;
 			s_nCurSVTID = DEFAULT_SVT_ID;
 			++s_nCounter;
 		
-#line 4526 "gcode/ulyac.cpp"
+#line 4895 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 24:
 	{
-#line 1992 "meta/ulyac.upg"
+#line 1993 "meta/ulyac.upg"
 
 			s_nCurAssoc = ASSOC_NO;
 			s_nCurPrec = DEFAULT_PREC;
 			s_nCurSVTID = DEFAULT_SVT_ID;
 		
-#line 4539 "gcode/ulyac.cpp"
+#line 4908 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 26:
 	{
-#line 1998 "meta/ulyac.upg"
+#line 1999 "meta/ulyac.upg"
 
-			s_nCurSVTID = grammar.addSVT((yys_sv__[0].m_pchVal)).first;
+			s_nCurSVTID = grammar.addSVT((yystk__[0].sv.m_pchVal)).first;
 			
-			delete[] (yys_sv__[0].m_pchVal);
+			delete[] (yystk__[0].sv.m_pchVal);
 		
-#line 4552 "gcode/ulyac.cpp"
+#line 4921 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 25:
 	{
-#line 1998 "meta/ulyac.upg"
+#line 1999 "meta/ulyac.upg"
 
-#line 4561 "gcode/ulyac.cpp"
+#line 4930 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 27:
 	{
-#line 2004 "meta/ulyac.upg"
+#line 2005 "meta/ulyac.upg"
 
-#line 4570 "gcode/ulyac.cpp"
+#line 4939 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 28:
 	{
-#line 2006 "meta/ulyac.upg"
+#line 2007 "meta/ulyac.upg"
 
-#line 4579 "gcode/ulyac.cpp"
+#line 4948 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 29:
 	{
-#line 2007 "meta/ulyac.upg"
+#line 2008 "meta/ulyac.upg"
 
-#line 4588 "gcode/ulyac.cpp"
+#line 4957 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 30:
 	{
-#line 2009 "meta/ulyac.upg"
+#line 2010 "meta/ulyac.upg"
 
-			if(s_sname2Idx.find((yys_sv__[0].m_pchVal)) != s_sname2Idx.end()) {
-				strMsg = strhelper_t::fromInt((yys_loc__[0]).firstLine);
+			if(s_sname2Idx.find((yystk__[0].sv.m_pchVal)) != s_sname2Idx.end()) {
+				strMsg = strhelper_t::fromInt((yystk__[0].loc).firstLine);
 				strMsg += ':';
-				strMsg += strhelper_t::fromInt((yys_loc__[0]).firstColumn);
+				strMsg += strhelper_t::fromInt((yystk__[0].loc).firstColumn);
 				strMsg += "; description: identifier `";
-				strMsg += (yys_sv__[0].m_pchVal);
+				strMsg += (yystk__[0].sv.m_pchVal);
 				strMsg += "\' already be name of a symbol, this definition discarded.";
 				_WARNING(strMsg);			
 			}
 			else {
-				i2b_pair_t pairRet = grammar.addToken((yys_sv__[0].m_pchVal), s_nCurSVTID, s_nCurPrec, s_nCurAssoc);
+				i2b_pair_t pairRet = grammar.addToken((yystk__[0].sv.m_pchVal), s_nCurSVTID, s_nCurPrec, s_nCurAssoc);
 				if(!pairRet.second) {
-					strMsg = strhelper_t::fromInt((yys_loc__[0]).firstLine);
+					strMsg = strhelper_t::fromInt((yystk__[0].loc).firstLine);
 					strMsg += ':';
-					strMsg += strhelper_t::fromInt((yys_loc__[0]).firstColumn);
+					strMsg += strhelper_t::fromInt((yystk__[0].loc).firstColumn);
 					strMsg += "; description: identifier `";
-					strMsg += (yys_sv__[0].m_pchVal);
+					strMsg += (yystk__[0].sv.m_pchVal);
 					strMsg += "\' already be name of a token, this definition discarded.";
 					_WARNING(strMsg);
 				}
 			}
-			delete[] (yys_sv__[0].m_pchVal);		
+			delete[] (yystk__[0].sv.m_pchVal);		
 		
-#line 4620 "gcode/ulyac.cpp"
+#line 4989 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 31:
 	{
-#line 2033 "meta/ulyac.upg"
+#line 2034 "meta/ulyac.upg"
 
-			i2b_pair_t pairRet = grammar.addToken(strhelper_t::quotedChar((yys_sv__[0].m_cVal)), (int)(yys_sv__[0].m_cVal),
+			i2b_pair_t pairRet = grammar.addToken(strhelper_t::quotedChar((yystk__[0].sv.m_cVal)), (int)(yystk__[0].sv.m_cVal),
 				s_nCurSVTID, s_nCurPrec, s_nCurAssoc, false);
 			if(!pairRet.second) {
-				strMsg = strhelper_t::fromInt((yys_loc__[0]).firstLine);
+				strMsg = strhelper_t::fromInt((yystk__[0].loc).firstLine);
 				strMsg += ':';
-				strMsg += strhelper_t::fromInt((yys_loc__[0]).firstColumn);
+				strMsg += strhelper_t::fromInt((yystk__[0].loc).firstColumn);
 				strMsg += "; description: character `";
-				strMsg += (yys_sv__[0].m_cVal);
+				strMsg += (yystk__[0].sv.m_cVal);
 				strMsg += "\' already be name of a token, this definition discarded.";
 				_WARNING(strMsg);
 			}
 		
-#line 4641 "gcode/ulyac.cpp"
+#line 5010 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 32:
 	{
-#line 2046 "meta/ulyac.upg"
+#line 2047 "meta/ulyac.upg"
 
-            std::string tokenText((yys_sv__[0].m_pchVal));
-            delete[] (yys_sv__[0].m_pchVal);
+            std::string tokenText((yystk__[0].sv.m_pchVal));
+            delete[] (yystk__[0].sv.m_pchVal);
 
             auto pairRet = grammar.addToken(tokenText, s_nCurSVTID, s_nCurPrec, s_nCurAssoc);
             if(!pairRet.second) {
-                strMsg = strhelper_t::fromInt((yys_loc__[0]).firstLine);
+                strMsg = strhelper_t::fromInt((yystk__[0].loc).firstLine);
                 strMsg += ':';
-                strMsg += strhelper_t::fromInt((yys_loc__[0]).firstColumn);
+                strMsg += strhelper_t::fromInt((yystk__[0].loc).firstColumn);
                 strMsg += "; description: character `";
                 strMsg += tokenText;
                 strMsg += "\' already be name of a token, this definition discarded.";
                 _WARNING(strMsg);
             }
         
-#line 4664 "gcode/ulyac.cpp"
+#line 5033 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 34:
 	{
-#line 2063 "meta/ulyac.upg"
+#line 2064 "meta/ulyac.upg"
 
-			s_nCurSVTID = grammar.addSVT((yys_sv__[0].m_pchVal)).first;
-			delete[] (yys_sv__[0].m_pchVal);
+			s_nCurSVTID = grammar.addSVT((yystk__[0].sv.m_pchVal)).first;
+			delete[] (yystk__[0].sv.m_pchVal);
 		
-#line 4676 "gcode/ulyac.cpp"
+#line 5045 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 33:
 	{
-#line 2063 "meta/ulyac.upg"
+#line 2064 "meta/ulyac.upg"
 
-#line 4685 "gcode/ulyac.cpp"
+#line 5054 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 35:
 	{
-#line 2067 "meta/ulyac.upg"
+#line 2068 "meta/ulyac.upg"
 
 		
 			strMsg = "semantic value type expected.";
@@ -4697,14 +5066,14 @@ case 133:
 			_ERROR(strMsg, ESYN(1));
 			yyerrok();		
 		
-#line 4700 "gcode/ulyac.cpp"
+#line 5069 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 36:
 	{
-#line 2074 "meta/ulyac.upg"
+#line 2075 "meta/ulyac.upg"
 
 		
 			strMsg = "semantic value type or type name expected.";
@@ -4712,1282 +5081,1240 @@ case 133:
 			_ERROR(strMsg, ESYN(1));
 			yyerrok();		
 		
-#line 4715 "gcode/ulyac.cpp"
+#line 5084 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 37:
 	{
-#line 2083 "meta/ulyac.upg"
+#line 2084 "meta/ulyac.upg"
 
-			if(grammar.isToken((yys_sv__[0].m_pchVal))) {
-				strMsg = strhelper_t::fromInt((yys_loc__[0]).firstLine);
+			if(grammar.isToken((yystk__[0].sv.m_pchVal))) {
+				strMsg = strhelper_t::fromInt((yystk__[0].loc).firstLine);
 				strMsg += ':';
-				strMsg += strhelper_t::fromInt((yys_loc__[0]).firstColumn);
+				strMsg += strhelper_t::fromInt((yystk__[0].loc).firstColumn);
 				strMsg += "; description: identifier `";
-				strMsg += (yys_sv__[0].m_pchVal);
+				strMsg += (yystk__[0].sv.m_pchVal);
 				strMsg += "\' is already name of a token, this definition discarded.";
 				_WARNING(strMsg);
 			}
 			else {
-				if(s_strStartSymbol == string((yys_sv__[0].m_pchVal))) {
+				if(s_strStartSymbol == string((yystk__[0].sv.m_pchVal))) {
 					s2i_it_t it = s_sname2Idx.find(s_strStartSymbol);
 					assert(it != s_sname2Idx.end());
 					if(it->second == INVALID_INDEX) {
 						it->second = s_nCurSVTID;
 					}
 					else {
-						strMsg = strhelper_t::fromInt((yys_loc__[0]).firstLine);
+						strMsg = strhelper_t::fromInt((yystk__[0].loc).firstLine);
 						strMsg += ':';
-						strMsg += strhelper_t::fromInt((yys_loc__[0]).firstColumn);
+						strMsg += strhelper_t::fromInt((yystk__[0].loc).firstColumn);
 						strMsg += "; description: identifier `";
-						strMsg += (yys_sv__[0].m_pchVal);
+						strMsg += (yystk__[0].sv.m_pchVal);
 						strMsg += "\' is already name of a type, this definition discarded.";
 						_WARNING(strMsg);					
 					}
 				}
-				else if( ! s_sname2Idx.insert(s2i_pair_t(string((yys_sv__[0].m_pchVal)), s_nCurSVTID)).second) {
-					strMsg = strhelper_t::fromInt((yys_loc__[0]).firstLine);
+				else if( ! s_sname2Idx.insert(s2i_pair_t(string((yystk__[0].sv.m_pchVal)), s_nCurSVTID)).second) {
+					strMsg = strhelper_t::fromInt((yystk__[0].loc).firstLine);
 					strMsg += ':';
-					strMsg += strhelper_t::fromInt((yys_loc__[0]).firstColumn);
+					strMsg += strhelper_t::fromInt((yystk__[0].loc).firstColumn);
 					strMsg += "; description: identifier `";
-					strMsg += (yys_sv__[0].m_pchVal);
+					strMsg += (yystk__[0].sv.m_pchVal);
 					strMsg += "\' is already name of a type, this definition discarded.";
 					_WARNING(strMsg);
 				}
 			}
-			delete[] (yys_sv__[0].m_pchVal);
+			delete[] (yystk__[0].sv.m_pchVal);
 		
-#line 4762 "gcode/ulyac.cpp"
+#line 5131 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 38:
 	{
-#line 2122 "meta/ulyac.upg"
+#line 2123 "meta/ulyac.upg"
 
-			if(grammar.isToken((yys_sv__[0].m_pchVal))) {
-				strMsg = strhelper_t::fromInt((yys_loc__[0]).firstLine);
+			if(grammar.isToken((yystk__[0].sv.m_pchVal))) {
+				strMsg = strhelper_t::fromInt((yystk__[0].loc).firstLine);
 				strMsg += ':';
-				strMsg += strhelper_t::fromInt((yys_loc__[0]).firstColumn);
+				strMsg += strhelper_t::fromInt((yystk__[0].loc).firstColumn);
 				strMsg += "; description: identifier `";
-				strMsg += (yys_sv__[0].m_pchVal);
+				strMsg += (yystk__[0].sv.m_pchVal);
 				strMsg += "\' is already name of a token, this definition discarded.";
 				_WARNING(strMsg);
 			}
 			else {
-				if(s_strStartSymbol == string((yys_sv__[0].m_pchVal))) {
+				if(s_strStartSymbol == string((yystk__[0].sv.m_pchVal))) {
 					s2i_it_t it = s_sname2Idx.find(s_strStartSymbol);
 					assert(it != s_sname2Idx.end());
 					if(it->second == INVALID_INDEX) {
 						it->second = s_nCurSVTID;
 					}
 					else {
-						strMsg = strhelper_t::fromInt((yys_loc__[0]).firstLine);
+						strMsg = strhelper_t::fromInt((yystk__[0].loc).firstLine);
 						strMsg += ':';
-						strMsg += strhelper_t::fromInt((yys_loc__[0]).firstColumn);
+						strMsg += strhelper_t::fromInt((yystk__[0].loc).firstColumn);
 						strMsg += "; description: identifier `";
-						strMsg += (yys_sv__[0].m_pchVal);
+						strMsg += (yystk__[0].sv.m_pchVal);
 						strMsg += "\' is already name of a type, this definition discarded.";
 						_WARNING(strMsg);					
 					}
 				}
-				else if( !s_sname2Idx.insert(s2i_pair_t(string((yys_sv__[0].m_pchVal)), s_nCurSVTID)).second) {
-					strMsg = strhelper_t::fromInt((yys_loc__[0]).firstLine);
+				else if( !s_sname2Idx.insert(s2i_pair_t(string((yystk__[0].sv.m_pchVal)), s_nCurSVTID)).second) {
+					strMsg = strhelper_t::fromInt((yystk__[0].loc).firstLine);
 					strMsg += ':';
-					strMsg += strhelper_t::fromInt((yys_loc__[0]).firstColumn);
+					strMsg += strhelper_t::fromInt((yystk__[0].loc).firstColumn);
 					strMsg += "; description: identifier `";
-					strMsg += (yys_sv__[0].m_pchVal);
+					strMsg += (yystk__[0].sv.m_pchVal);
 					strMsg += "\' is already name of a type, this definition discarded.";
 					_WARNING(strMsg);			
 				}
 			}
-			delete[] (yys_sv__[0].m_pchVal);
+			delete[] (yystk__[0].sv.m_pchVal);
 		
-#line 4809 "gcode/ulyac.cpp"
+#line 5178 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 39:
 	{
-#line 2163 "meta/ulyac.upg"
+#line 2164 "meta/ulyac.upg"
 
-		if( ! grammar.setUntagDstrct((yys_sv__[3].m_pDstrct))) {
-			delete (yys_sv__[3].m_pDstrct);
+		if( ! grammar.setUntagDstrct((yystk__[3].sv.m_pDstrct))) {
+			delete (yystk__[3].sv.m_pDstrct);
 		}
 	
-#line 4822 "gcode/ulyac.cpp"
+#line 5191 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 40:
 	{
-#line 2168 "meta/ulyac.upg"
+#line 2169 "meta/ulyac.upg"
 
-		if( ! grammar.setOtherDstrct((yys_sv__[4].m_pDstrct))) {
-			delete (yys_sv__[4].m_pDstrct);
+		if( ! grammar.setOtherDstrct((yystk__[4].sv.m_pDstrct))) {
+			delete (yystk__[4].sv.m_pDstrct);
 		}
 	
-#line 4835 "gcode/ulyac.cpp"
+#line 5204 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 41:
 	{
-#line 2173 "meta/ulyac.upg"
+#line 2174 "meta/ulyac.upg"
 
 	
-		if( ! grammar.addDstrctBySVT((yys_sv__[4].m_pDstrct), (yys_sv__[2].m_pchVal))) {
-			delete (yys_sv__[4].m_pDstrct);
+		if( ! grammar.addDstrctBySVT((yystk__[4].sv.m_pDstrct), (yystk__[2].sv.m_pchVal))) {
+			delete (yystk__[4].sv.m_pDstrct);
 		}
 		else {
 		
-			for(int i = 0; i < (yys_sv__[4].m_pDstrct)->getPHCount(); ++i) {
-				(yys_sv__[4].m_pDstrct)->updateMacroPH(i, (yys_sv__[2].m_pchVal));
+			for(int i = 0; i < (yystk__[4].sv.m_pDstrct)->getPHCount(); ++i) {
+				(yystk__[4].sv.m_pDstrct)->updateMacroPH(i, (yystk__[2].sv.m_pchVal));
 			}
 		}
-		delete[] (yys_sv__[2].m_pchVal);
+		delete[] (yystk__[2].sv.m_pchVal);
 	
-#line 4856 "gcode/ulyac.cpp"
+#line 5225 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 42:
 	{
-#line 2186 "meta/ulyac.upg"
+#line 2187 "meta/ulyac.upg"
 
-		assert((yys_sv__[1].m_pvstrSymbs));
-		if( ! grammar.addDstrctBySymbs((yys_sv__[2].m_pDstrct), *(yys_sv__[1].m_pvstrSymbs))) {
-			delete (yys_sv__[2].m_pDstrct);
+		assert((yystk__[1].sv.m_pvstrSymbs));
+		if( ! grammar.addDstrctBySymbs((yystk__[2].sv.m_pDstrct), *(yystk__[1].sv.m_pvstrSymbs))) {
+			delete (yystk__[2].sv.m_pDstrct);
 		}
 
-		delete (yys_sv__[1].m_pvstrSymbs);
+		delete (yystk__[1].sv.m_pvstrSymbs);
 	
-#line 4872 "gcode/ulyac.cpp"
+#line 5241 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 43:
 	{
-#line 2194 "meta/ulyac.upg"
+#line 2195 "meta/ulyac.upg"
 
 		
 		strMsg = "semantic value type or symbol name expected.";
 		_ERROR(strMsg, ESYN(1));
 		
-		delete (yys_sv__[2].m_pDstrct);
+		delete (yystk__[2].sv.m_pDstrct);
 		
 		yyerrok();
 	
-#line 4889 "gcode/ulyac.cpp"
+#line 5258 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 44:
 	{
-#line 2203 "meta/ulyac.upg"
+#line 2204 "meta/ulyac.upg"
 
 	
 		strMsg = "semantic value type or symbol name expected.";
 		_ERROR(strMsg, ESYN(1));
 		
-		delete (yys_sv__[3].m_pDstrct);
-		delete (yys_sv__[2].m_pvstrSymbs);
+		delete (yystk__[3].sv.m_pDstrct);
+		delete (yystk__[2].sv.m_pvstrSymbs);
 		yyerrok();	
 	
-#line 4906 "gcode/ulyac.cpp"
+#line 5275 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 45:
 	{
-#line 2214 "meta/ulyac.upg"
+#line 2215 "meta/ulyac.upg"
 
-		(yyval.m_pvstrSymbs) = (yys_sv__[1].m_pvstrSymbs);
-		(yyval.m_pvstrSymbs)->push_back((yys_sv__[0].m_pchVal));
-		delete[] (yys_sv__[0].m_pchVal);
+		(yyval.m_pvstrSymbs) = (yystk__[1].sv.m_pvstrSymbs);
+		(yyval.m_pvstrSymbs)->push_back((yystk__[0].sv.m_pchVal));
+		delete[] (yystk__[0].sv.m_pchVal);
 	
-#line 4919 "gcode/ulyac.cpp"
+#line 5288 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 46:
 	{
-#line 2219 "meta/ulyac.upg"
+#line 2220 "meta/ulyac.upg"
 
-		(yyval.m_pvstrSymbs) = (yys_sv__[1].m_pvstrSymbs);
-		(yyval.m_pvstrSymbs)->push_back(strhelper_t::quotedChar((yys_sv__[0].m_cVal)));
+		(yyval.m_pvstrSymbs) = (yystk__[1].sv.m_pvstrSymbs);
+		(yyval.m_pvstrSymbs)->push_back(strhelper_t::quotedChar((yystk__[0].sv.m_cVal)));
 	
-#line 4931 "gcode/ulyac.cpp"
+#line 5300 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 47:
 	{
-#line 2223 "meta/ulyac.upg"
+#line 2224 "meta/ulyac.upg"
 
-        (yyval.m_pvstrSymbs) = (yys_sv__[1].m_pvstrSymbs);
-        (yyval.m_pvstrSymbs)->push_back((yys_sv__[0].m_pchVal));
-        delete[] (yys_sv__[0].m_pchVal);
+        (yyval.m_pvstrSymbs) = (yystk__[1].sv.m_pvstrSymbs);
+        (yyval.m_pvstrSymbs)->push_back((yystk__[0].sv.m_pchVal));
+        delete[] (yystk__[0].sv.m_pchVal);
     
-#line 4944 "gcode/ulyac.cpp"
+#line 5313 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 48:
 	{
-#line 2228 "meta/ulyac.upg"
+#line 2229 "meta/ulyac.upg"
 
 		(yyval.m_pvstrSymbs) = new vstr_t;
-		(yyval.m_pvstrSymbs)->push_back((yys_sv__[0].m_pchVal));
+		(yyval.m_pvstrSymbs)->push_back((yystk__[0].sv.m_pchVal));
 		
-		delete[] (yys_sv__[0].m_pchVal);
+		delete[] (yystk__[0].sv.m_pchVal);
 	
-#line 4958 "gcode/ulyac.cpp"
+#line 5327 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 49:
 	{
-#line 2234 "meta/ulyac.upg"
+#line 2235 "meta/ulyac.upg"
 
 		(yyval.m_pvstrSymbs) = new vstr_t;
-		(yyval.m_pvstrSymbs)->push_back(strhelper_t::quotedChar((yys_sv__[0].m_cVal)));
+		(yyval.m_pvstrSymbs)->push_back(strhelper_t::quotedChar((yystk__[0].sv.m_cVal)));
 	
-#line 4970 "gcode/ulyac.cpp"
+#line 5339 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 50:
 	{
-#line 2238 "meta/ulyac.upg"
+#line 2239 "meta/ulyac.upg"
 
         (yyval.m_pvstrSymbs) = new vstr_t;
-        (yyval.m_pvstrSymbs)->push_back((yys_sv__[0].m_pchVal));
+        (yyval.m_pvstrSymbs)->push_back((yystk__[0].sv.m_pchVal));
 
-        delete[] (yys_sv__[0].m_pchVal);
+        delete[] (yystk__[0].sv.m_pchVal);
     
-#line 4984 "gcode/ulyac.cpp"
+#line 5353 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 51:
 	{
-#line 2246 "meta/ulyac.upg"
+#line 2247 "meta/ulyac.upg"
 
-            if(!gsetup.setStringOption((yys_sv__[2].m_pchVal), (yys_sv__[0].m_pchVal))) {
-                if(! dmap.insert((yys_sv__[2].m_pchVal), (yys_sv__[0].m_pchVal))) {
+            if(!gsetup.setStringOption((yystk__[2].sv.m_pchVal), (yystk__[0].sv.m_pchVal))) {
+                if(! dmap.insert((yystk__[2].sv.m_pchVal), (yystk__[0].sv.m_pchVal))) {
 
-                    strMsg = strhelper_t::fromInt((yys_loc__[2]).firstLine);
+                    strMsg = strhelper_t::fromInt((yystk__[2].loc).firstLine);
                     strMsg += ':';
-                    strMsg += strhelper_t::fromInt((yys_loc__[2]).firstColumn);
+                    strMsg += strhelper_t::fromInt((yystk__[2].loc).firstColumn);
                     strMsg += "; description: option `";
-                    strMsg += (yys_sv__[2].m_pchVal);
+                    strMsg += (yystk__[2].sv.m_pchVal);
                     strMsg += "\' duplicated and discarded.";
                     _WARNING(strMsg);
                 }
             }
 			
-			delete[] (yys_sv__[2].m_pchVal);
-			delete[] (yys_sv__[0].m_pchVal);
+			delete[] (yystk__[2].sv.m_pchVal);
+			delete[] (yystk__[0].sv.m_pchVal);
 		
-#line 5009 "gcode/ulyac.cpp"
+#line 5378 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 52:
 	{
-#line 2263 "meta/ulyac.upg"
+#line 2264 "meta/ulyac.upg"
 
 		
-            if(!gsetup.setIntOption((yys_sv__[2].m_pchVal), (yys_sv__[0].m_nVal))) {
-                if( ! dmap.insert((yys_sv__[2].m_pchVal), (yys_sv__[0].m_nVal))) {
+            if(!gsetup.setIntOption((yystk__[2].sv.m_pchVal), (yystk__[0].sv.m_nVal))) {
+                if( ! dmap.insert((yystk__[2].sv.m_pchVal), (yystk__[0].sv.m_nVal))) {
 
-                    strMsg = strhelper_t::fromInt((yys_loc__[2]).firstLine);
+                    strMsg = strhelper_t::fromInt((yystk__[2].loc).firstLine);
                     strMsg += ':';
-                    strMsg += strhelper_t::fromInt((yys_loc__[2]).firstColumn);
+                    strMsg += strhelper_t::fromInt((yystk__[2].loc).firstColumn);
                     strMsg += "; description: option `";
-                    strMsg += (yys_sv__[2].m_pchVal);
+                    strMsg += (yystk__[2].sv.m_pchVal);
                     strMsg += "\' duplicated and discarded.";
                     _WARNING(strMsg);
                 }
             }
 
-			delete[] (yys_sv__[2].m_pchVal);
+			delete[] (yystk__[2].sv.m_pchVal);
 		
-#line 5034 "gcode/ulyac.cpp"
+#line 5403 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 53:
 	{
-#line 2280 "meta/ulyac.upg"
+#line 2281 "meta/ulyac.upg"
 
 
-            if(!gsetup.setBoolOption((yys_sv__[2].m_pchVal), false)) {
-                if( ! dmap.insert((yys_sv__[2].m_pchVal), false)) {
+            if(!gsetup.setBoolOption((yystk__[2].sv.m_pchVal), false)) {
+                if( ! dmap.insert((yystk__[2].sv.m_pchVal), false)) {
 
-                    strMsg = strhelper_t::fromInt((yys_loc__[2]).firstLine);
+                    strMsg = strhelper_t::fromInt((yystk__[2].loc).firstLine);
                     strMsg += ':';
-                    strMsg += strhelper_t::fromInt((yys_loc__[2]).firstColumn);
+                    strMsg += strhelper_t::fromInt((yystk__[2].loc).firstColumn);
                     strMsg += "; description: option `";
-                    strMsg += (yys_sv__[2].m_pchVal);
+                    strMsg += (yystk__[2].sv.m_pchVal);
                     strMsg += "\' duplicated and discarded.";
                     _WARNING(strMsg);
                 }
             }
 
-			delete[] (yys_sv__[2].m_pchVal);
+			delete[] (yystk__[2].sv.m_pchVal);
 		
-#line 5059 "gcode/ulyac.cpp"
+#line 5428 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 54:
 	{
-#line 2297 "meta/ulyac.upg"
+#line 2298 "meta/ulyac.upg"
 
 		
-            if(!gsetup.setBoolOption((yys_sv__[2].m_pchVal), true)) {
-                if( ! dmap.insert((yys_sv__[2].m_pchVal), true)) {
+            if(!gsetup.setBoolOption((yystk__[2].sv.m_pchVal), true)) {
+                if( ! dmap.insert((yystk__[2].sv.m_pchVal), true)) {
 
-                    strMsg = strhelper_t::fromInt((yys_loc__[2]).firstLine);
+                    strMsg = strhelper_t::fromInt((yystk__[2].loc).firstLine);
                     strMsg += ':';
-                    strMsg += strhelper_t::fromInt((yys_loc__[2]).firstColumn);
+                    strMsg += strhelper_t::fromInt((yystk__[2].loc).firstColumn);
                     strMsg += "; description: option `";
-                    strMsg += (yys_sv__[2].m_pchVal);
+                    strMsg += (yystk__[2].sv.m_pchVal);
                     strMsg += "\' duplicated and discarded.";
                     _WARNING(strMsg);
                 }
             }
 
-			delete[] (yys_sv__[2].m_pchVal);
+			delete[] (yystk__[2].sv.m_pchVal);
 		
-#line 5084 "gcode/ulyac.cpp"
+#line 5453 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 55:
 	{
-#line 2314 "meta/ulyac.upg"
+#line 2315 "meta/ulyac.upg"
 
 
-            if(!gsetup.setStringOption((yys_sv__[1].m_pchVal), (yys_sv__[0].m_pchVal))) {
-                if( ! dmap.insert((yys_sv__[1].m_pchVal), (yys_sv__[0].m_pchVal))) {
+            if(!gsetup.setStringOption((yystk__[1].sv.m_pchVal), (yystk__[0].sv.m_pchVal))) {
+                if( ! dmap.insert((yystk__[1].sv.m_pchVal), (yystk__[0].sv.m_pchVal))) {
 
-                    strMsg = strhelper_t::fromInt((yys_loc__[1]).firstLine);
+                    strMsg = strhelper_t::fromInt((yystk__[1].loc).firstLine);
                     strMsg += ':';
-                    strMsg += strhelper_t::fromInt((yys_loc__[1]).firstColumn);
+                    strMsg += strhelper_t::fromInt((yystk__[1].loc).firstColumn);
                     strMsg += "; description: option `";
-                    strMsg += (yys_sv__[1].m_pchVal);
+                    strMsg += (yystk__[1].sv.m_pchVal);
                     strMsg += "\' duplicated and discarded.";
                     _WARNING(strMsg);
                 }
             }
 
-            delete[] (yys_sv__[1].m_pchVal);
-            delete[] (yys_sv__[0].m_pchVal);
+            delete[] (yystk__[1].sv.m_pchVal);
+            delete[] (yystk__[0].sv.m_pchVal);
         
-#line 5110 "gcode/ulyac.cpp"
+#line 5479 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 56:
 	{
-#line 2332 "meta/ulyac.upg"
+#line 2333 "meta/ulyac.upg"
 
 
-            if(!gsetup.setIntOption((yys_sv__[1].m_pchVal), (yys_sv__[0].m_nVal))) {
-                if( ! dmap.insert((yys_sv__[1].m_pchVal), (yys_sv__[0].m_nVal))) {
+            if(!gsetup.setIntOption((yystk__[1].sv.m_pchVal), (yystk__[0].sv.m_nVal))) {
+                if( ! dmap.insert((yystk__[1].sv.m_pchVal), (yystk__[0].sv.m_nVal))) {
 
-                    strMsg = strhelper_t::fromInt((yys_loc__[1]).firstLine);
+                    strMsg = strhelper_t::fromInt((yystk__[1].loc).firstLine);
                     strMsg += ':';
-                    strMsg += strhelper_t::fromInt((yys_loc__[1]).firstColumn);
+                    strMsg += strhelper_t::fromInt((yystk__[1].loc).firstColumn);
                     strMsg += "; description: option `";
-                    strMsg += (yys_sv__[1].m_pchVal);
+                    strMsg += (yystk__[1].sv.m_pchVal);
                     strMsg += "\' duplicated and discarded.";
                     _WARNING(strMsg);
                 }
             }
 
-            delete[] (yys_sv__[1].m_pchVal);
+            delete[] (yystk__[1].sv.m_pchVal);
         
-#line 5135 "gcode/ulyac.cpp"
+#line 5504 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 57:
 	{
-#line 2349 "meta/ulyac.upg"
+#line 2350 "meta/ulyac.upg"
 
 
-            if(!gsetup.setBoolOption((yys_sv__[1].m_pchVal), false)) {
-                if( ! dmap.insert((yys_sv__[1].m_pchVal), false)) {
+            if(!gsetup.setBoolOption((yystk__[1].sv.m_pchVal), false)) {
+                if( ! dmap.insert((yystk__[1].sv.m_pchVal), false)) {
 
-                    strMsg = strhelper_t::fromInt((yys_loc__[1]).firstLine);
+                    strMsg = strhelper_t::fromInt((yystk__[1].loc).firstLine);
                     strMsg += ':';
-                    strMsg += strhelper_t::fromInt((yys_loc__[1]).firstColumn);
+                    strMsg += strhelper_t::fromInt((yystk__[1].loc).firstColumn);
                     strMsg += "; description: option `";
-                    strMsg += (yys_sv__[1].m_pchVal);
+                    strMsg += (yystk__[1].sv.m_pchVal);
                     strMsg += "\' duplicated and discarded.";
                     _WARNING(strMsg);
                 }
             }
 
-            delete[] (yys_sv__[1].m_pchVal);
+            delete[] (yystk__[1].sv.m_pchVal);
         
-#line 5160 "gcode/ulyac.cpp"
+#line 5529 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 58:
 	{
-#line 2366 "meta/ulyac.upg"
+#line 2367 "meta/ulyac.upg"
 
-            if(!gsetup.setBoolOption((yys_sv__[1].m_pchVal), true)) {
-                if( ! dmap.insert((yys_sv__[1].m_pchVal), true)) {
+            if(!gsetup.setBoolOption((yystk__[1].sv.m_pchVal), true)) {
+                if( ! dmap.insert((yystk__[1].sv.m_pchVal), true)) {
 
-                    strMsg = strhelper_t::fromInt((yys_loc__[1]).firstLine);
+                    strMsg = strhelper_t::fromInt((yystk__[1].loc).firstLine);
                     strMsg += ':';
-                    strMsg += strhelper_t::fromInt((yys_loc__[1]).firstColumn);
+                    strMsg += strhelper_t::fromInt((yystk__[1].loc).firstColumn);
                     strMsg += "; description: option `";
-                    strMsg += (yys_sv__[1].m_pchVal);
+                    strMsg += (yystk__[1].sv.m_pchVal);
                     strMsg += "\' duplicated and discarded.";
                     _WARNING(strMsg);
                 }
             }
 
-            delete[] (yys_sv__[1].m_pchVal);
+            delete[] (yystk__[1].sv.m_pchVal);
         
-#line 5184 "gcode/ulyac.cpp"
+#line 5553 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 59:
 	{
-#line 2382 "meta/ulyac.upg"
+#line 2383 "meta/ulyac.upg"
 
-            if(!gsetup.setBoolOption((yys_sv__[0].m_pchVal), true)) {
-                if( ! dmap.insert((yys_sv__[0].m_pchVal), true)) {
+            if(!gsetup.setBoolOption((yystk__[0].sv.m_pchVal), true)) {
+                if( ! dmap.insert((yystk__[0].sv.m_pchVal), true)) {
 
-                    strMsg = strhelper_t::fromInt((yys_loc__[0]).firstLine);
+                    strMsg = strhelper_t::fromInt((yystk__[0].loc).firstLine);
                     strMsg += ':';
-                    strMsg += strhelper_t::fromInt((yys_loc__[0]).firstColumn);
+                    strMsg += strhelper_t::fromInt((yystk__[0].loc).firstColumn);
                     strMsg += "; description: option `";
-                    strMsg += (yys_sv__[0].m_pchVal);
+                    strMsg += (yystk__[0].sv.m_pchVal);
                     strMsg += "\' duplicated and discarded.";
                     _WARNING(strMsg);
                 }
             }
 
-            delete (yys_sv__[0].m_pchVal);
+            delete (yystk__[0].sv.m_pchVal);
         
-#line 5208 "gcode/ulyac.cpp"
+#line 5577 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 60:
 	{
-#line 2400 "meta/ulyac.upg"
+#line 2401 "meta/ulyac.upg"
 
 
-			if(!lexer.addMacro((yys_sv__[2].m_pchVal), (yys_sv__[1].m_pRENode))) {
+			if(!lexer.addMacro((yystk__[2].sv.m_pchVal), (yystk__[1].sv.m_pRENode))) {
 			
-				strMsg = strhelper_t::fromInt((yys_loc__[2]).firstLine);
+				strMsg = strhelper_t::fromInt((yystk__[2].loc).firstLine);
 				strMsg += ':';
-				strMsg += strhelper_t::fromInt((yys_loc__[2]).firstColumn);
+				strMsg += strhelper_t::fromInt((yystk__[2].loc).firstColumn);
 				strMsg += "; description: macro is duplicated and ignored `";
-				strMsg += (yys_sv__[2].m_pchVal);
+				strMsg += (yystk__[2].sv.m_pchVal);
 				strMsg += "\'";
 				
 				_ERROR(strMsg, ESYN(1));
 			}
 				
-			delete[] (yys_sv__[2].m_pchVal);
+			delete[] (yystk__[2].sv.m_pchVal);
 		
-#line 5232 "gcode/ulyac.cpp"
+#line 5601 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 61:
 	{
-#line 2416 "meta/ulyac.upg"
+#line 2417 "meta/ulyac.upg"
 
 
-			lexer.addMacro((yys_sv__[3].m_pchVal), (yys_sv__[2].m_pRENode));
+			lexer.addMacro((yystk__[3].sv.m_pchVal), (yystk__[2].sv.m_pRENode));
 			
 			strMsg = "invalid symbol.";
 			
 			_ERROR(strMsg, ESYN(1));
 
-			delete[] (yys_sv__[3].m_pchVal);
+			delete[] (yystk__[3].sv.m_pchVal);
 			
 			yyerrok();
 		
-#line 5252 "gcode/ulyac.cpp"
+#line 5621 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 62:
 	{
-#line 2428 "meta/ulyac.upg"
+#line 2429 "meta/ulyac.upg"
 
 			
 			strMsg = "invalid symbol.";
 			
 			_ERROR(strMsg, ESYN(1));
 
-			delete[] (yys_sv__[2].m_pchVal);
+			delete[] (yystk__[2].sv.m_pchVal);
 			yyerrok();
 		
-#line 5269 "gcode/ulyac.cpp"
+#line 5638 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 63:
 	{
-#line 2439 "meta/ulyac.upg"
+#line 2440 "meta/ulyac.upg"
 
-#line 5278 "gcode/ulyac.cpp"
+#line 5647 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 64:
 	{
-#line 2440 "meta/ulyac.upg"
+#line 2441 "meta/ulyac.upg"
 
-#line 5287 "gcode/ulyac.cpp"
+#line 5656 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 65:
 	{
-#line 2443 "meta/ulyac.upg"
+#line 2444 "meta/ulyac.upg"
 
 		
-			assert((yys_sv__[1].m_prTrees));
-			assert((yys_sv__[0].m_nVal) >= 0);
+			assert((yystk__[1].sv.m_prTrees));
+			assert((yystk__[0].sv.m_nVal) >= 0);
 			
-			for(unsigned int i = 0; i < (yys_sv__[1].m_prTrees)->size(); ++i) {
+			for(unsigned int i = 0; i < (yystk__[1].sv.m_prTrees)->size(); ++i) {
 				
-				lexer.attachAction((*(yys_sv__[1].m_prTrees))[i], (yys_sv__[0].m_nVal));
-				dtbl.mapRule2Action(lexer.tree2Rule((*(yys_sv__[1].m_prTrees))[i]->getID()), (yys_sv__[0].m_nVal));
+				lexer.attachAction((*(yystk__[1].sv.m_prTrees))[i], (yystk__[0].sv.m_nVal));
+				dtbl.mapRule2Action(lexer.tree2Rule((*(yystk__[1].sv.m_prTrees))[i]->getID()), (yystk__[0].sv.m_nVal));
 			}
 			
-			delete (yys_sv__[1].m_prTrees);
+			delete (yystk__[1].sv.m_prTrees);
 		
-#line 5308 "gcode/ulyac.cpp"
+#line 5677 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 66:
 	{
-#line 2456 "meta/ulyac.upg"
+#line 2457 "meta/ulyac.upg"
 
 		
-			assert((yys_sv__[2].m_prTrees));
+			assert((yystk__[2].sv.m_prTrees));
 			
 			strMsg = "invalid symbol.";
 			
 			_ERROR(strMsg, ESYN(2));
 			
-			delete (yys_sv__[2].m_prTrees);
+			delete (yystk__[2].sv.m_prTrees);
 			
 			yyerrok();
 		
-#line 5328 "gcode/ulyac.cpp"
+#line 5697 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 67:
 	{
-#line 2470 "meta/ulyac.upg"
+#line 2471 "meta/ulyac.upg"
 
 
-			assert((yys_sv__[0].m_pRETree));
+			assert((yystk__[0].sv.m_pRETree));
 			(yyval.m_prTrees) = new rtpool_t;
-			(yyval.m_prTrees)->push_back((yys_sv__[0].m_pRETree));
+			(yyval.m_prTrees)->push_back((yystk__[0].sv.m_pRETree));
 		
-#line 5342 "gcode/ulyac.cpp"
+#line 5711 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 68:
 	{
-#line 2476 "meta/ulyac.upg"
+#line 2477 "meta/ulyac.upg"
 
 			
-			assert((yys_sv__[2].m_prTrees) && (yys_sv__[0].m_pRETree));
-			(yyval.m_prTrees) = (yys_sv__[2].m_prTrees);
-			(yyval.m_prTrees)->push_back((yys_sv__[0].m_pRETree));
+			assert((yystk__[2].sv.m_prTrees) && (yystk__[0].sv.m_pRETree));
+			(yyval.m_prTrees) = (yystk__[2].sv.m_prTrees);
+			(yyval.m_prTrees)->push_back((yystk__[0].sv.m_pRETree));
 		
-#line 5356 "gcode/ulyac.cpp"
+#line 5725 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 69:
 	{
-#line 2484 "meta/ulyac.upg"
+#line 2485 "meta/ulyac.upg"
 
 
-			assert((yys_sv__[0].m_pRETree));
+			assert((yystk__[0].sv.m_pRETree));
 			
-			if( ! (yys_sv__[1].m_pIndices)) {
+			if( ! (yystk__[1].sv.m_pIndices)) {
 			
-				lexer.addSCTree((yys_sv__[0].m_pRETree)->getID());
+				lexer.addSCTree((yystk__[0].sv.m_pRETree)->getID());
 			}
 			else {
 				
-				for(unsigned int i = 0; i < (yys_sv__[1].m_pIndices)->size(); ++i) {
+				for(unsigned int i = 0; i < (yystk__[1].sv.m_pIndices)->size(); ++i) {
 
-					lexer.addSCTree((*(yys_sv__[1].m_pIndices))[i], (yys_sv__[0].m_pRETree)->getID());
+					lexer.addSCTree((*(yystk__[1].sv.m_pIndices))[i], (yystk__[0].sv.m_pRETree)->getID());
 				}
 				
-				delete (yys_sv__[1].m_pIndices);
+				delete (yystk__[1].sv.m_pIndices);
 			}
 
-			(yyval.m_pRETree) = (yys_sv__[0].m_pRETree);
+			(yyval.m_pRETree) = (yystk__[0].sv.m_pRETree);
 			
-			dtbl.mapRule2Line(lexer.tree2Rule((yys_sv__[0].m_pRETree)->getID()), (yys_loc__[0]).firstLine); 
+			dtbl.mapRule2Line(lexer.tree2Rule((yystk__[0].sv.m_pRETree)->getID()), (yystk__[0].loc).firstLine); 
 		
-#line 5386 "gcode/ulyac.cpp"
+#line 5755 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 70:
 	{
-#line 2508 "meta/ulyac.upg"
+#line 2509 "meta/ulyac.upg"
 
 
-			(yyval.m_nVal) = (yys_sv__[0].m_nVal);
+			(yyval.m_nVal) = (yystk__[0].sv.m_nVal);
 		
-#line 5398 "gcode/ulyac.cpp"
+#line 5767 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 71:
 	{
-#line 2512 "meta/ulyac.upg"
+#line 2513 "meta/ulyac.upg"
 
 		
-			assert((yys_sv__[1].m_nVal) == (yys_sv__[0].m_nVal));
-			(yyval.m_nVal) = (yys_sv__[1].m_nVal);
+			assert((yystk__[1].sv.m_nVal) == (yystk__[0].sv.m_nVal));
+			(yyval.m_nVal) = (yystk__[1].sv.m_nVal);
 		
-#line 5411 "gcode/ulyac.cpp"
+#line 5780 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 72:
 	{
-#line 2519 "meta/ulyac.upg"
+#line 2520 "meta/ulyac.upg"
 
 			
-			(yyval.m_pIndices) = (yys_sv__[1].m_pIndices);
+			(yyval.m_pIndices) = (yystk__[1].sv.m_pIndices);
 		
-#line 5423 "gcode/ulyac.cpp"
+#line 5792 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 73:
 	{
-#line 2523 "meta/ulyac.upg"
+#line 2524 "meta/ulyac.upg"
 
 		
 			(yyval.m_pIndices) = nullptr;
 		
-#line 5435 "gcode/ulyac.cpp"
+#line 5804 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 74:
 	{
-#line 2527 "meta/ulyac.upg"
+#line 2528 "meta/ulyac.upg"
 
 		
 			(yyval.m_pIndices) = new vint_t;
 			(yyval.m_pIndices)->push_back(0);
 		
-#line 5448 "gcode/ulyac.cpp"
+#line 5817 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 75:
 	{
-#line 2534 "meta/ulyac.upg"
+#line 2535 "meta/ulyac.upg"
 
 
 			(yyval.m_pIndices) = new vint_t;
-			(yyval.m_pIndices)->push_back((yys_sv__[0].m_nVal));
+			(yyval.m_pIndices)->push_back((yystk__[0].sv.m_nVal));
 		
-#line 5461 "gcode/ulyac.cpp"
+#line 5830 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 76:
 	{
-#line 2539 "meta/ulyac.upg"
+#line 2540 "meta/ulyac.upg"
 
 		
-			assert((yys_sv__[2].m_pIndices));
-			(yys_sv__[2].m_pIndices)->push_back((yys_sv__[0].m_nVal));
-			(yyval.m_pIndices) = (yys_sv__[2].m_pIndices);
+			assert((yystk__[2].sv.m_pIndices));
+			(yystk__[2].sv.m_pIndices)->push_back((yystk__[0].sv.m_nVal));
+			(yyval.m_pIndices) = (yystk__[2].sv.m_pIndices);
 		
-#line 5475 "gcode/ulyac.cpp"
+#line 5844 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 77:
 	{
-#line 2547 "meta/ulyac.upg"
+#line 2548 "meta/ulyac.upg"
 
 
-			(yyval.m_nVal) = lexer.getSCIdx((yys_sv__[0].m_pchVal));
+			(yyval.m_nVal) = lexer.getSCIdx((yystk__[0].sv.m_pchVal));
 			if(_EQ(INVALID_INDEX, (yyval.m_nVal))) {
 			
-				strMsg = strhelper_t::fromInt((yys_loc__[0]).firstLine);
+				strMsg = strhelper_t::fromInt((yystk__[0].loc).firstLine);
 				strMsg += ':';
-				strMsg += strhelper_t::fromInt((yys_loc__[0]).firstColumn);
+				strMsg += strhelper_t::fromInt((yystk__[0].loc).firstColumn);
 				strMsg += "; description: invalid start condition `";
-				strMsg += (yys_sv__[0].m_pchVal);
+				strMsg += (yystk__[0].sv.m_pchVal);
 				strMsg += "\'";
 				
 				(yyval.m_nVal) = 0;
 				_ERROR(strMsg, ESYN(2));
 			}
 			
-			delete[] (yys_sv__[0].m_pchVal);
+			delete[] (yystk__[0].sv.m_pchVal);
 		
-#line 5501 "gcode/ulyac.cpp"
+#line 5870 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 78:
 	{
-#line 2565 "meta/ulyac.upg"
+#line 2566 "meta/ulyac.upg"
 
 		
 			(yyval.m_nVal) = 0;
 		
-#line 5513 "gcode/ulyac.cpp"
+#line 5882 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 79:
 	{
-#line 2571 "meta/ulyac.upg"
+#line 2572 "meta/ulyac.upg"
 
 
-			(yys_sv__[0].m_pRENode) = lexer.addConcatNode((yys_sv__[0].m_pRENode), lexer.addEorNode(false));
-			(yyval.m_pRETree) = lexer.addTree(dtbl.addRule(), (yys_sv__[0].m_pRENode), false);
+			(yystk__[0].sv.m_pRENode) = lexer.addConcatNode((yystk__[0].sv.m_pRENode), lexer.addEorNode(false));
+			(yyval.m_pRETree) = lexer.addTree(dtbl.addRule(), (yystk__[0].sv.m_pRENode), false);
 			lexer.setLookaheadFlag(false);
 		
-#line 5527 "gcode/ulyac.cpp"
+#line 5896 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 80:
 	{
-#line 2577 "meta/ulyac.upg"
+#line 2578 "meta/ulyac.upg"
 
 		
-			(yys_sv__[0].m_pRENode) = lexer.addConcatNode((yys_sv__[0].m_pRENode), lexer.addEorNode(false));
-			(yyval.m_pRETree) = lexer.addTree(dtbl.addRule(), (yys_sv__[0].m_pRENode), true);
+			(yystk__[0].sv.m_pRENode) = lexer.addConcatNode((yystk__[0].sv.m_pRENode), lexer.addEorNode(false));
+			(yyval.m_pRETree) = lexer.addTree(dtbl.addRule(), (yystk__[0].sv.m_pRENode), true);
 			lexer.setLookaheadFlag(false);
 		
-#line 5541 "gcode/ulyac.cpp"
+#line 5910 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 81:
 	{
-#line 2583 "meta/ulyac.upg"
+#line 2584 "meta/ulyac.upg"
 
 		
 			(yyval.m_pRETree) = lexer.addTree(dtbl.addRule(), lexer.addEofNode(), false, true);
 		
-#line 5553 "gcode/ulyac.cpp"
+#line 5922 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 82:
 	{
-#line 2589 "meta/ulyac.upg"
+#line 2590 "meta/ulyac.upg"
 
 			
-			(yyval.m_pRENode) = (yys_sv__[0].m_pRENode);
+			(yyval.m_pRENode) = (yystk__[0].sv.m_pRENode);
 		
-#line 5565 "gcode/ulyac.cpp"
+#line 5934 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 83:
 	{
-#line 2593 "meta/ulyac.upg"
+#line 2594 "meta/ulyac.upg"
 
 			lexer.setLookaheadFlag(true);
 			(yyval.m_pRENode) = lexer.addLeafNode(new charset_t('\n'), false);
-			(yyval.m_pRENode) = lexer.addConcatNode((yys_sv__[1].m_pRENode), (yyval.m_pRENode));
+			(yyval.m_pRENode) = lexer.addConcatNode((yystk__[1].sv.m_pRENode), (yyval.m_pRENode));
 		
-#line 5578 "gcode/ulyac.cpp"
+#line 5947 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 84:
 	{
-#line 2598 "meta/ulyac.upg"
+#line 2599 "meta/ulyac.upg"
 		
 			
-			(yyval.m_pRENode) = lexer.addConcatNode((yys_sv__[1].m_pRENode), (yys_sv__[0].m_pRENode));
+			(yyval.m_pRENode) = lexer.addConcatNode((yystk__[1].sv.m_pRENode), (yystk__[0].sv.m_pRENode));
 		
-#line 5590 "gcode/ulyac.cpp"
+#line 5959 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 85:
 	{
-#line 2604 "meta/ulyac.upg"
+#line 2605 "meta/ulyac.upg"
 
 		
 			lexer.setLookaheadFlag(true);
-			(yyval.m_pRENode) = (yys_sv__[1].m_pRENode);
+			(yyval.m_pRENode) = (yystk__[1].sv.m_pRENode);
 		
-#line 5603 "gcode/ulyac.cpp"
+#line 5972 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 86:
 	{
-#line 2611 "meta/ulyac.upg"
+#line 2612 "meta/ulyac.upg"
 
 
-			(yyval.m_pRENode) = lexer.addUnionNode((yys_sv__[2].m_pRENode), (yys_sv__[0].m_pRENode));
+			(yyval.m_pRENode) = lexer.addUnionNode((yystk__[2].sv.m_pRENode), (yystk__[0].sv.m_pRENode));
 		
-#line 5615 "gcode/ulyac.cpp"
+#line 5984 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 87:
 	{
-#line 2615 "meta/ulyac.upg"
+#line 2616 "meta/ulyac.upg"
 
 		
-			(yyval.m_pRENode) = (yys_sv__[0].m_pRENode);
+			(yyval.m_pRENode) = (yystk__[0].sv.m_pRENode);
         
-#line 5627 "gcode/ulyac.cpp"
+#line 5996 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 88:
 	{
-#line 2621 "meta/ulyac.upg"
+#line 2622 "meta/ulyac.upg"
 
 			
-			(yyval.m_pRENode) = lexer.addConcatNode((yys_sv__[1].m_pRENode), (yys_sv__[0].m_pRENode));
+			(yyval.m_pRENode) = lexer.addConcatNode((yystk__[1].sv.m_pRENode), (yystk__[0].sv.m_pRENode));
 		
-#line 5639 "gcode/ulyac.cpp"
+#line 6008 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 89:
 	{
-#line 2625 "meta/ulyac.upg"
+#line 2626 "meta/ulyac.upg"
 
 			
-			(yyval.m_pRENode) = (yys_sv__[0].m_pRENode);
+			(yyval.m_pRENode) = (yystk__[0].sv.m_pRENode);
 		
-#line 5651 "gcode/ulyac.cpp"
+#line 6020 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 90:
 	{
-#line 2631 "meta/ulyac.upg"
+#line 2632 "meta/ulyac.upg"
 
 			
-			(yyval.m_pRENode) = (yys_sv__[1].m_pRENode);
-			
-			for(; (yys_sv__[0].m_nRange).m_nLower > 1; --((yys_sv__[0].m_nRange).m_nLower)) {
-			
-				(yyval.m_pRENode) = lexer.addConcatNode((yyval.m_pRENode), lexer.copySubtree((yys_sv__[1].m_pRENode)));
-			}			
+			(yyval.m_pRENode) = lexer.addRepeatNode((yystk__[1].sv.m_pRENode), (yystk__[0].sv.m_nRange).m_nLower, (yystk__[0].sv.m_nRange).m_nLower, false);
 		
-#line 5668 "gcode/ulyac.cpp"
+#line 6032 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 91:
 	{
-#line 2640 "meta/ulyac.upg"
+#line 2636 "meta/ulyac.upg"
 
 		
-			(yys_sv__[1].m_pRENode)->setNullable(true);
-			(yyval.m_pRENode) = (yys_sv__[1].m_pRENode);
-			
-			for(; (yys_sv__[0].m_nRange).m_nUpper > 1; --((yys_sv__[0].m_nRange).m_nUpper)) {
-			
-				(yyval.m_pRENode) = lexer.addConcatNode((yyval.m_pRENode), lexer.copySubtree((yys_sv__[1].m_pRENode)));
-			}
+			(yyval.m_pRENode) = lexer.addRepeatNode((yystk__[1].sv.m_pRENode), (yystk__[0].sv.m_nRange).m_nUpper, 0, false);
 		
-#line 5686 "gcode/ulyac.cpp"
+#line 6044 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 92:
 	{
-#line 2650 "meta/ulyac.upg"
+#line 2640 "meta/ulyac.upg"
 
 			
-			(yyval.m_pRENode) = (yys_sv__[1].m_pRENode);
-			
-			for(; (yys_sv__[0].m_nRange).m_nLower > 1; --((yys_sv__[0].m_nRange).m_nLower)) {
-			
-				(yyval.m_pRENode) = lexer.addConcatNode((yyval.m_pRENode), lexer.copySubtree((yys_sv__[1].m_pRENode)));
+			// at least one instance before the repeating one
+			if((yystk__[0].sv.m_nRange).m_nLower < 1) {
+				(yystk__[0].sv.m_nRange).m_nLower = 1;
 			}
-			
-			(yyval.m_pRENode) = lexer.addConcatNode((yyval.m_pRENode), lexer.addStarNode(lexer.copySubtree((yys_sv__[1].m_pRENode))));
+			(yyval.m_pRENode) = lexer.addRepeatNode((yystk__[1].sv.m_pRENode), (yystk__[0].sv.m_nRange).m_nLower + 1, (yystk__[0].sv.m_nRange).m_nLower, true);
 		
-#line 5705 "gcode/ulyac.cpp"
+#line 6060 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 93:
 	{
-#line 2661 "meta/ulyac.upg"
+#line 2648 "meta/ulyac.upg"
 
 		
-			if((yys_sv__[0].m_nRange).m_nLower > (yys_sv__[0].m_nRange).m_nUpper || _EQ(0, (yys_sv__[0].m_nRange).m_nUpper)) {
+			if((yystk__[0].sv.m_nRange).m_nLower > (yystk__[0].sv.m_nRange).m_nUpper || _EQ(0, (yystk__[0].sv.m_nRange).m_nUpper)) {
 			
-				strMsg = strhelper_t::fromInt((yys_loc__[0]).firstLine);
+				strMsg = strhelper_t::fromInt((yystk__[0].loc).firstLine);
 				strMsg += ':';
-				strMsg += strhelper_t::fromInt((yys_loc__[0]).firstColumn);
+				strMsg += strhelper_t::fromInt((yystk__[0].loc).firstColumn);
 				strMsg += "; description: invalid range `{";
-				strMsg += strhelper_t::fromInt((yys_sv__[0].m_nRange).m_nLower);
+				strMsg += strhelper_t::fromInt((yystk__[0].sv.m_nRange).m_nLower);
 				strMsg += ",";
-				strMsg += strhelper_t::fromInt((yys_sv__[0].m_nRange).m_nUpper);
+				strMsg += strhelper_t::fromInt((yystk__[0].sv.m_nRange).m_nUpper);
 				strMsg += "}\'";
 				
-				(yys_sv__[0].m_nRange).m_nLower = (yys_sv__[0].m_nRange).m_nUpper = 1;
+				(yystk__[0].sv.m_nRange).m_nLower = (yystk__[0].sv.m_nRange).m_nUpper = 1;
 				_ERROR(strMsg, ESYN(3));
 			}
 			
-			(yyval.m_pRENode) = (yys_sv__[1].m_pRENode);
-			int i = 1;
-			
-			if((yys_sv__[0].m_nRange).m_nLower <= 0) {
-				(yys_sv__[1].m_pRENode)->setNullable(true);
-			}
-			else {
-				for(; i < (yys_sv__[0].m_nRange).m_nLower; ++i) {
-				
-					(yyval.m_pRENode) = lexer.addConcatNode((yyval.m_pRENode), lexer.copySubtree((yys_sv__[1].m_pRENode)));
-				}
-			}
-			
-			for(; i < (yys_sv__[0].m_nRange).m_nUpper; ++i) {
-			
-				renode_t *pNode = lexer.copySubtree((yys_sv__[1].m_pRENode));
-				pNode->setNullable(true);
-				
-				(yyval.m_pRENode) = lexer.addConcatNode((yyval.m_pRENode), pNode);
-			}
+			(yyval.m_pRENode) = lexer.addRepeatNode((yystk__[1].sv.m_pRENode), (yystk__[0].sv.m_nRange).m_nUpper, (yystk__[0].sv.m_nRange).m_nLower, false);
 		
-#line 5751 "gcode/ulyac.cpp"
+#line 6087 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 94:
 	{
-#line 2699 "meta/ulyac.upg"
+#line 2667 "meta/ulyac.upg"
 
 			
-			(yyval.m_pRENode) = lexer.addStarNode((yys_sv__[1].m_pRENode));
+			(yyval.m_pRENode) = lexer.addStarNode((yystk__[1].sv.m_pRENode));
 		
-#line 5763 "gcode/ulyac.cpp"
+#line 6099 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 95:
 	{
-#line 2703 "meta/ulyac.upg"
+#line 2671 "meta/ulyac.upg"
 
 			
-			renode_t *pNode = lexer.copySubtree((yys_sv__[1].m_pRENode));
-			
-			assert(pNode);
-			
-			(yyval.m_pRENode) = lexer.addConcatNode((yys_sv__[1].m_pRENode), lexer.addStarNode(pNode));			
+			(yyval.m_pRENode) = lexer.addRepeatNode((yystk__[1].sv.m_pRENode), 2, 1, true);
 		
-#line 5779 "gcode/ulyac.cpp"
+#line 6111 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 96:
 	{
-#line 2711 "meta/ulyac.upg"
+#line 2675 "meta/ulyac.upg"
 
 			
-			(yyval.m_pRENode) = (yys_sv__[1].m_pRENode);
-			(yys_sv__[1].m_pRENode)->setNullable(true);
+			(yyval.m_pRENode) = (yystk__[1].sv.m_pRENode);
+			(yystk__[1].sv.m_pRENode)->setNullable(true);
 		
-#line 5792 "gcode/ulyac.cpp"
+#line 6124 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 97:
 	{
-#line 2716 "meta/ulyac.upg"
+#line 2680 "meta/ulyac.upg"
 
 			
-			(yyval.m_pRENode) = (yys_sv__[0].m_pRENode);
+			(yyval.m_pRENode) = (yystk__[0].sv.m_pRENode);
 		
-#line 5804 "gcode/ulyac.cpp"
+#line 6136 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 98:
 	{
-#line 2722 "meta/ulyac.upg"
+#line 2686 "meta/ulyac.upg"
 
 
-			(yyval.m_pRENode) = (yys_sv__[1].m_pRENode);
+			(yyval.m_pRENode) = (yystk__[1].sv.m_pRENode);
 		
-#line 5816 "gcode/ulyac.cpp"
+#line 6148 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 99:
 	{
-#line 2726 "meta/ulyac.upg"
+#line 2690 "meta/ulyac.upg"
 
 			
-			(yyval.m_pRENode) = (yys_sv__[0].m_pRENode);
+			(yyval.m_pRENode) = (yystk__[0].sv.m_pRENode);
 		
-#line 5828 "gcode/ulyac.cpp"
+#line 6160 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 100:
 	{
-#line 2732 "meta/ulyac.upg"
+#line 2696 "meta/ulyac.upg"
 
 			
-			(yyval.m_pRENode) = (yys_sv__[0].m_pRENode);
+			(yyval.m_pRENode) = (yystk__[0].sv.m_pRENode);
 		
-#line 5840 "gcode/ulyac.cpp"
+#line 6172 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 101:
 	{
-#line 2736 "meta/ulyac.upg"
+#line 2700 "meta/ulyac.upg"
 		
 			
-			(yyval.m_pRENode) = lexer.copyMacrotree((yys_sv__[0].m_pchVal));
+			(yyval.m_pRENode) = lexer.copyMacrotree((yystk__[0].sv.m_pchVal));
 			if(_EQ(nullptr, (yyval.m_pRENode))) {
 				
-				strMsg = strhelper_t::fromInt((yys_loc__[0]).firstLine);
+				strMsg = strhelper_t::fromInt((yystk__[0].loc).firstLine);
 				strMsg += ':';
-				strMsg += strhelper_t::fromInt((yys_loc__[0]).firstColumn);
+				strMsg += strhelper_t::fromInt((yystk__[0].loc).firstColumn);
 				strMsg += "; description: undefined regular expression macro `";
-				strMsg += (yys_sv__[0].m_pchVal);
+				strMsg += (yystk__[0].sv.m_pchVal);
 				strMsg += "\'";	
 				
 				(yyval.m_pRENode) = lexer.addLeafNode('a');			
 				_ERROR(strMsg, ESYN(4));
 			}
 			
-			delete[] (yys_sv__[0].m_pchVal);
+			delete[] (yystk__[0].sv.m_pchVal);
 		
-#line 5866 "gcode/ulyac.cpp"
+#line 6198 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 102:
 	{
-#line 2755 "meta/ulyac.upg"
+#line 2719 "meta/ulyac.upg"
 
 
-			(yyval.m_pRENode) = lexer.addConcatNode((yys_sv__[1].m_pRENode), (yys_sv__[0].m_pRENode));
+			(yyval.m_pRENode) = lexer.addConcatNode((yystk__[1].sv.m_pRENode), (yystk__[0].sv.m_pRENode));
 		
-#line 5878 "gcode/ulyac.cpp"
+#line 6210 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 103:
 	{
-#line 2759 "meta/ulyac.upg"
+#line 2723 "meta/ulyac.upg"
 
 		
-			(yyval.m_pRENode) = (yys_sv__[0].m_pRENode);
+			(yyval.m_pRENode) = (yystk__[0].sv.m_pRENode);
 		
-#line 5890 "gcode/ulyac.cpp"
+#line 6222 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 104:
 	{
-#line 2764 "meta/ulyac.upg"
+#line 2728 "meta/ulyac.upg"
 
 			
-			(yyval.m_pRENode) = (yys_sv__[1].m_pRENode);
-			
-			for(; (yys_sv__[0].m_nRange).m_nLower > 1; --((yys_sv__[0].m_nRange).m_nLower)) {
-			
-				(yyval.m_pRENode) = lexer.addConcatNode((yyval.m_pRENode), lexer.copySubtree((yys_sv__[1].m_pRENode)));
-			}			
+			(yyval.m_pRENode) = lexer.addRepeatNode((yystk__[1].sv.m_pRENode), (yystk__[0].sv.m_nRange).m_nLower, (yystk__[0].sv.m_nRange).m_nLower, false);
 		
-#line 5907 "gcode/ulyac.cpp"
+#line 6234 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 105:
 	{
-#line 2773 "meta/ulyac.upg"
+#line 2732 "meta/ulyac.upg"
 
 
-			(yyval.m_pRENode) = (yys_sv__[1].m_pRENode);
+			(yyval.m_pRENode) = (yystk__[1].sv.m_pRENode);
 		
-#line 5919 "gcode/ulyac.cpp"
+#line 6246 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 106:
 	{
-#line 2777 "meta/ulyac.upg"
+#line 2736 "meta/ulyac.upg"
 
 		
-			(yyval.m_pRENode) = (yys_sv__[0].m_pRENode);
+			(yyval.m_pRENode) = (yystk__[0].sv.m_pRENode);
 		
-#line 5931 "gcode/ulyac.cpp"
+#line 6258 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 107:
 	{
-#line 2783 "meta/ulyac.upg"
+#line 2742 "meta/ulyac.upg"
 
-			(yyval.m_pRENode) = lexer.addLeafNode((yys_sv__[0].m_pCS));
+			(yyval.m_pRENode) = lexer.addLeafNode((yystk__[0].sv.m_pCS));
 		
-#line 5942 "gcode/ulyac.cpp"
+#line 6269 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 108:
 	{
-#line 2786 "meta/ulyac.upg"
+#line 2745 "meta/ulyac.upg"
 
-			charset_t *pcs = new charset_t((yys_sv__[0].m_cVal));	
+			charset_t *pcs = new charset_t((yystk__[0].sv.m_cVal));	
 			if( ! gsetup.m_bCaseSensitive) {
-				if((yys_sv__[0].m_cVal) >= 65 && (yys_sv__[0].m_cVal) <= 90) {
-					pcs->set((yys_sv__[0].m_cVal) + 32);
+				if((yystk__[0].sv.m_cVal) >= 65 && (yystk__[0].sv.m_cVal) <= 90) {
+					pcs->set((yystk__[0].sv.m_cVal) + 32);
 				}
-				else if((yys_sv__[0].m_cVal) >= 97 && (yys_sv__[0].m_cVal) <= 122) {
-					pcs->set((yys_sv__[0].m_cVal) - 32);
+				else if((yystk__[0].sv.m_cVal) >= 97 && (yystk__[0].sv.m_cVal) <= 122) {
+					pcs->set((yystk__[0].sv.m_cVal) - 32);
 				}
 			}
 			(yyval.m_pRENode) = lexer.addLeafNode(pcs);
 		
-#line 5962 "gcode/ulyac.cpp"
+#line 6289 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 109:
 	{
-#line 2798 "meta/ulyac.upg"
+#line 2757 "meta/ulyac.upg"
 
-			if( ! gsetup.m_bCaseSensitive && (charset_t::LOWER == (yys_sv__[0].m_nPosix) || charset_t::UPPER == (yys_sv__[0].m_nPosix))) {
+			if( ! gsetup.m_bCaseSensitive && (charset_t::LOWER == (yystk__[0].sv.m_nPosix) || charset_t::UPPER == (yystk__[0].sv.m_nPosix))) {
 			
-				(yys_sv__[0].m_nPosix) = charset_t::ALPHA;
+				(yystk__[0].sv.m_nPosix) = charset_t::ALPHA;
 			}
-			(yyval.m_pRENode) = lexer.addLeafNode((yys_sv__[0].m_nPosix));
+			(yyval.m_pRENode) = lexer.addLeafNode((yystk__[0].sv.m_nPosix));
 		
-#line 5977 "gcode/ulyac.cpp"
+#line 6304 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 110:
 	{
-#line 2805 "meta/ulyac.upg"
+#line 2764 "meta/ulyac.upg"
 
 		
 			string str;
 			
 			bool bret =
-				strhelper_t::ustr2Str((yys_sv__[0].m_pchVal), str);
+				strhelper_t::ustr2Str((yystk__[0].sv.m_pchVal), str);
 			assert(bret);
 			
 			charset_t *pcs = nullptr;
@@ -6018,134 +6345,134 @@ case 133:
 				}
 				(yyval.m_pRENode) = lexer.addConcatNode((yyval.m_pRENode), lexer.addLeafNode(pcs));
 			}
-			delete (yys_sv__[0].m_pchVal);
+			delete (yystk__[0].sv.m_pchVal);
 		
-#line 6023 "gcode/ulyac.cpp"
+#line 6350 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 111:
 	{
-#line 2843 "meta/ulyac.upg"
+#line 2802 "meta/ulyac.upg"
 
 			
 			const char cc[2] = {'\n', '\0'};
 			(yyval.m_pRENode) = lexer.addLeafNode(cc, true);
 		
-#line 6036 "gcode/ulyac.cpp"
+#line 6363 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 112:
 	{
-#line 2850 "meta/ulyac.upg"
+#line 2809 "meta/ulyac.upg"
 
 
-			(yyval.m_pCS) = (yys_sv__[1].m_pCS);
+			(yyval.m_pCS) = (yystk__[1].sv.m_pCS);
 		
-#line 6048 "gcode/ulyac.cpp"
+#line 6375 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 113:
 	{
-#line 2854 "meta/ulyac.upg"
+#line 2813 "meta/ulyac.upg"
 
 
-			(yyval.m_pCS) = (yys_sv__[1].m_pCS);
-			(yys_sv__[1].m_pCS)->flip();			
+			(yyval.m_pCS) = (yystk__[1].sv.m_pCS);
+			(yystk__[1].sv.m_pCS)->flip();			
 		
-#line 6061 "gcode/ulyac.cpp"
+#line 6388 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 114:
 	{
-#line 2861 "meta/ulyac.upg"
+#line 2820 "meta/ulyac.upg"
 
 		
-			(yyval.m_pCS) = (yys_sv__[0].m_pCS);
+			(yyval.m_pCS) = (yystk__[0].sv.m_pCS);
 		
-#line 6073 "gcode/ulyac.cpp"
+#line 6400 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 115:
 	{
-#line 2865 "meta/ulyac.upg"
+#line 2824 "meta/ulyac.upg"
 
 			
-			*((yys_sv__[1].m_pCS)) |= *((yys_sv__[0].m_pCS));
-			(yyval.m_pCS) = (yys_sv__[1].m_pCS);
+			*((yystk__[1].sv.m_pCS)) |= *((yystk__[0].sv.m_pCS));
+			(yyval.m_pCS) = (yystk__[1].sv.m_pCS);
 
-			delete (yys_sv__[0].m_pCS);
+			delete (yystk__[0].sv.m_pCS);
 		
-#line 6088 "gcode/ulyac.cpp"
+#line 6415 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 116:
 	{
-#line 2874 "meta/ulyac.upg"
+#line 2833 "meta/ulyac.upg"
 
 			
 			(yyval.m_pCS) = new charset_t('\n', true);			
 		
-#line 6100 "gcode/ulyac.cpp"
+#line 6427 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 117:
 	{
-#line 2878 "meta/ulyac.upg"
+#line 2837 "meta/ulyac.upg"
 
 		
-			(yyval.m_pCS) = new charset_t((yys_sv__[0].m_cVal));
+			(yyval.m_pCS) = new charset_t((yystk__[0].sv.m_cVal));
 			
 			if( ! gsetup.m_bCaseSensitive) {
-				if((yys_sv__[0].m_cVal) >= 65 && (yys_sv__[0].m_cVal) <= 90) {
-					(yyval.m_pCS)->set((yys_sv__[0].m_cVal) + 32);
+				if((yystk__[0].sv.m_cVal) >= 65 && (yystk__[0].sv.m_cVal) <= 90) {
+					(yyval.m_pCS)->set((yystk__[0].sv.m_cVal) + 32);
 				}
-				else if((yys_sv__[0].m_cVal) >= 97 && (yys_sv__[0].m_cVal) <= 122) {
-					(yyval.m_pCS)->set((yys_sv__[0].m_cVal) - 32);
+				else if((yystk__[0].sv.m_cVal) >= 97 && (yystk__[0].sv.m_cVal) <= 122) {
+					(yyval.m_pCS)->set((yystk__[0].sv.m_cVal) - 32);
 				}
 			}
 		
-#line 6121 "gcode/ulyac.cpp"
+#line 6448 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 118:
 	{
-#line 2891 "meta/ulyac.upg"
+#line 2850 "meta/ulyac.upg"
 
 		
-			if((unsigned char)(yys_sv__[2].m_cVal) > (unsigned char)(yys_sv__[0].m_cVal)) {
+			if((unsigned char)(yystk__[2].sv.m_cVal) > (unsigned char)(yystk__[0].sv.m_cVal)) {
 			
-				strMsg = strhelper_t::fromInt((yys_loc__[2]).firstLine);
+				strMsg = strhelper_t::fromInt((yystk__[2].loc).firstLine);
 				strMsg += ':';
-				strMsg += strhelper_t::fromInt((yys_loc__[2]).firstColumn);
+				strMsg += strhelper_t::fromInt((yystk__[2].loc).firstColumn);
 				strMsg += "; description: char range `";
-				strMsg += (yys_sv__[2].m_cVal);
+				strMsg += (yystk__[2].sv.m_cVal);
 				strMsg += "-";
-				strMsg += (yys_sv__[0].m_cVal);
+				strMsg += (yystk__[0].sv.m_cVal);
 				strMsg += "\' empty and ignored.";
 				_ERROR(strMsg, ESYN(5));
 
-				(yys_sv__[2].m_cVal) = (yys_sv__[0].m_cVal);
+				(yystk__[2].sv.m_cVal) = (yystk__[0].sv.m_cVal);
 			}
 			
-			(yyval.m_pCS) = new charset_t((yys_sv__[2].m_cVal), (yys_sv__[0].m_cVal));
+			(yyval.m_pCS) = new charset_t((yystk__[2].sv.m_cVal), (yystk__[0].sv.m_cVal));
 			if( ! gsetup.m_bCaseSensitive) {
-				for(unsigned char c = (unsigned char)(yys_sv__[2].m_cVal); c <= 122 && c <= (unsigned char)(yys_sv__[0].m_cVal); ++c ) {
+				for(unsigned char c = (unsigned char)(yystk__[2].sv.m_cVal); c <= 122 && c <= (unsigned char)(yystk__[0].sv.m_cVal); ++c ) {
 					
 					if(c >= 65 && c <= 90) {
 					
@@ -6158,93 +6485,93 @@ case 133:
 				}
 			} 
 		
-#line 6161 "gcode/ulyac.cpp"
+#line 6488 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 119:
 	{
-#line 2923 "meta/ulyac.upg"
+#line 2882 "meta/ulyac.upg"
 
 		
-			if( ! gsetup.m_bCaseSensitive && (charset_t::LOWER == (yys_sv__[0].m_nPosix) || charset_t::UPPER == (yys_sv__[0].m_nPosix))) {
+			if( ! gsetup.m_bCaseSensitive && (charset_t::LOWER == (yystk__[0].sv.m_nPosix) || charset_t::UPPER == (yystk__[0].sv.m_nPosix))) {
 			
-				(yys_sv__[0].m_nPosix) = charset_t::ALPHA;
+				(yystk__[0].sv.m_nPosix) = charset_t::ALPHA;
 			}
-			(yyval.m_pCS) = new charset_t((yys_sv__[0].m_nPosix));
+			(yyval.m_pCS) = new charset_t((yystk__[0].sv.m_nPosix));
 		
-#line 6177 "gcode/ulyac.cpp"
+#line 6504 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 120:
 	{
-#line 2933 "meta/ulyac.upg"
+#line 2892 "meta/ulyac.upg"
 
-#line 6186 "gcode/ulyac.cpp"
+#line 6513 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 121:
 	{
-#line 2934 "meta/ulyac.upg"
+#line 2893 "meta/ulyac.upg"
 
-#line 6195 "gcode/ulyac.cpp"
+#line 6522 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 122:
 	{
-#line 2936 "meta/ulyac.upg"
+#line 2895 "meta/ulyac.upg"
 
-#line 6204 "gcode/ulyac.cpp"
+#line 6531 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 123:
 	{
-#line 2937 "meta/ulyac.upg"
+#line 2896 "meta/ulyac.upg"
 
-				strMsg = strhelper_t::fromInt((yys_loc__[0]).lastLine);
+				strMsg = strhelper_t::fromInt((yystk__[0].loc).lastLine);
 				strMsg += ':';
-				strMsg += strhelper_t::fromInt((yys_loc__[0]).lastColumn);
+				strMsg += strhelper_t::fromInt((yystk__[0].loc).lastColumn);
 				strMsg += "; description: lack of `;\'.";
 				_WARNING(strMsg);
 		
-#line 6219 "gcode/ulyac.cpp"
+#line 6546 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 124:
 	{
-#line 2944 "meta/ulyac.upg"
+#line 2903 "meta/ulyac.upg"
 
 				strMsg = "invalid syntactic rule.";
 				_ERROR(strMsg, ESYN(5));
 				yyerrok();
 		
-#line 6232 "gcode/ulyac.cpp"
+#line 6559 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 125:
 	{
-#line 2950 "meta/ulyac.upg"
+#line 2909 "meta/ulyac.upg"
 
 			
-			if( grammar.isToken((yys_sv__[0].m_pchVal))) {
-				strMsg = strhelper_t::fromInt((yys_loc__[0]).firstLine);
+			if( grammar.isToken((yystk__[0].sv.m_pchVal))) {
+				strMsg = strhelper_t::fromInt((yystk__[0].loc).firstLine);
 				strMsg += ':';
-				strMsg += strhelper_t::fromInt((yys_loc__[0]).firstColumn);
+				strMsg += strhelper_t::fromInt((yystk__[0].loc).firstColumn);
 				strMsg += "; description: declaration of type `";
-				strMsg += (yys_sv__[0].m_pchVal);
+				strMsg += (yystk__[0].sv.m_pchVal);
 				strMsg += "\' expected.";
 				_ERROR(strMsg, ESYN(5));
 
@@ -6254,13 +6581,13 @@ case 133:
 			}
 			else {
 			
-				(yyval.m_nVal) = grammar.getSymbolIndex((yys_sv__[0].m_pchVal));
+				(yyval.m_nVal) = grammar.getSymbolIndex((yystk__[0].sv.m_pchVal));
 				if(INVALID_INDEX == (yyval.m_nVal)) {
-					(yyval.m_nVal) = grammar.addType((yys_sv__[0].m_pchVal), DEFAULT_SVT_ID).first;
+					(yyval.m_nVal) = grammar.addType((yystk__[0].sv.m_pchVal), DEFAULT_SVT_ID).first;
 					++s_nCounter;
 				}
 				else {
-					(yyval.m_nVal) = grammar.getSymbolIndex((yys_sv__[0].m_pchVal));
+					(yyval.m_nVal) = grammar.getSymbolIndex((yystk__[0].sv.m_pchVal));
 				}
 			}
 				
@@ -6282,346 +6609,346 @@ case 133:
 				pr->addRight(END_SYMBOL_INDEX);
 				grammar.setAcceptRule(pr->getID());
 				
-				int nActID = ptbl.addEmptyAction((yys_loc__[0]).firstLine);
+				int nActID = ptbl.addEmptyAction((yystk__[0].loc).firstLine);
 				ptbl.mapRule2Action(pr->getID(), nActID);			
-				ptbl.mapRule2Line(pr->getID(), (yys_loc__[0]).firstLine);
+				ptbl.mapRule2Line(pr->getID(), (yystk__[0].loc).firstLine);
 			}
 			
-			delete[] (yys_sv__[0].m_pchVal);
+			delete[] (yystk__[0].sv.m_pchVal);
 		
-#line 6292 "gcode/ulyac.cpp"
+#line 6619 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 127:
 	{
-#line 3004 "meta/ulyac.upg"
+#line 2963 "meta/ulyac.upg"
 
 
 			grammar.addEmptyRule(s_nCurLeftSymbol);
 		
-#line 6304 "gcode/ulyac.cpp"
+#line 6631 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 126:
 	{
-#line 3004 "meta/ulyac.upg"
+#line 2963 "meta/ulyac.upg"
 
-#line 6313 "gcode/ulyac.cpp"
+#line 6640 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 129:
 	{
-#line 3009 "meta/ulyac.upg"
+#line 2968 "meta/ulyac.upg"
 
 			grammar.addEmptyRule(s_nCurLeftSymbol);
 		
-#line 6324 "gcode/ulyac.cpp"
+#line 6651 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 128:
 	{
-#line 3009 "meta/ulyac.upg"
+#line 2968 "meta/ulyac.upg"
 
-#line 6333 "gcode/ulyac.cpp"
+#line 6660 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 130:
 	{
-#line 3014 "meta/ulyac.upg"
+#line 2973 "meta/ulyac.upg"
 
 			
-			(yyval.m_pProd) = (yys_sv__[4].m_pProd);
-			(yyval.m_pProd)->setPrec((yys_sv__[2].m_nVal));
-			(yyval.m_pProd)->setActionIndex((yys_sv__[1].m_nVal));
-			ptbl.mapRule2Action((yyval.m_pProd)->getID(), (yys_sv__[1].m_nVal));			
-			ptbl.mapRule2Line((yyval.m_pProd)->getID(), (yys_loc__[4]).firstLine);
+			(yyval.m_pProd) = (yystk__[4].sv.m_pProd);
+			(yyval.m_pProd)->setPrec((yystk__[2].sv.m_nVal));
+			(yyval.m_pProd)->setActionIndex((yystk__[1].sv.m_nVal));
+			ptbl.mapRule2Action((yyval.m_pProd)->getID(), (yystk__[1].sv.m_nVal));			
+			ptbl.mapRule2Line((yyval.m_pProd)->getID(), (yystk__[4].loc).firstLine);
 			
 			grammar.clearMidSVT();
 		
-#line 6351 "gcode/ulyac.cpp"
+#line 6678 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 131:
 	{
-#line 3024 "meta/ulyac.upg"
+#line 2983 "meta/ulyac.upg"
 
 			
-			(yyval.m_pProd) = (yys_sv__[2].m_pProd);
-			(yyval.m_pProd)->setPrec((yys_sv__[0].m_nVal));
-			int nActID = ptbl.addEmptyAction((yys_loc__[2]).firstLine);
+			(yyval.m_pProd) = (yystk__[2].sv.m_pProd);
+			(yyval.m_pProd)->setPrec((yystk__[0].sv.m_nVal));
+			int nActID = ptbl.addEmptyAction((yystk__[2].loc).firstLine);
 			ptbl.mapRule2Action((yyval.m_pProd)->getID(), nActID);
-			ptbl.mapRule2Line((yyval.m_pProd)->getID(), (yys_loc__[2]).firstLine);
+			ptbl.mapRule2Line((yyval.m_pProd)->getID(), (yystk__[2].loc).firstLine);
 			(yyval.m_pProd)->setActionIndex(nActID);
 		
-#line 6368 "gcode/ulyac.cpp"
+#line 6695 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 132:
 	{
-#line 3033 "meta/ulyac.upg"
+#line 2992 "meta/ulyac.upg"
 
 		
 			(yyval.m_pProd) = grammar.getProd(grammar.getLastProdIndex());
-			(yyval.m_pProd)->setPrec((yys_sv__[2].m_nVal));
-			(yyval.m_pProd)->setActionIndex((yys_sv__[1].m_nVal));
-			ptbl.mapRule2Action((yyval.m_pProd)->getID(), (yys_sv__[1].m_nVal));
-			ptbl.mapRule2Line((yyval.m_pProd)->getID(), (yys_loc__[3]).firstLine);
+			(yyval.m_pProd)->setPrec((yystk__[2].sv.m_nVal));
+			(yyval.m_pProd)->setActionIndex((yystk__[1].sv.m_nVal));
+			ptbl.mapRule2Action((yyval.m_pProd)->getID(), (yystk__[1].sv.m_nVal));
+			ptbl.mapRule2Line((yyval.m_pProd)->getID(), (yystk__[3].loc).firstLine);
 			
 			grammar.clearMidSVT();
 		
-#line 6386 "gcode/ulyac.cpp"
+#line 6713 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 133:
 	{
-#line 3043 "meta/ulyac.upg"
+#line 3002 "meta/ulyac.upg"
 
 		
 			(yyval.m_pProd) = grammar.getProd(grammar.getLastProdIndex());
-			(yyval.m_pProd)->setPrec((yys_sv__[0].m_nVal));
-			int nActID = ptbl.addEmptyAction((yys_loc__[1]).firstLine);
+			(yyval.m_pProd)->setPrec((yystk__[0].sv.m_nVal));
+			int nActID = ptbl.addEmptyAction((yystk__[1].loc).firstLine);
 			ptbl.mapRule2Action((yyval.m_pProd)->getID(), nActID);
-			ptbl.mapRule2Line((yyval.m_pProd)->getID(), (yys_loc__[1]).firstLine);
+			ptbl.mapRule2Line((yyval.m_pProd)->getID(), (yystk__[1].loc).firstLine);
 			(yyval.m_pProd)->setActionIndex(nActID);
 		
-#line 6403 "gcode/ulyac.cpp"
+#line 6730 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 134:
 	{
-#line 3052 "meta/ulyac.upg"
+#line 3011 "meta/ulyac.upg"
 
 			
-			(yyval.m_pProd) = (yys_sv__[2].m_pProd);
-			(yyval.m_pProd)->setActionIndex((yys_sv__[1].m_nVal));
-			ptbl.mapRule2Action((yyval.m_pProd)->getID(), (yys_sv__[1].m_nVal));
-			ptbl.mapRule2Line((yyval.m_pProd)->getID(), (yys_loc__[2]).firstLine);
+			(yyval.m_pProd) = (yystk__[2].sv.m_pProd);
+			(yyval.m_pProd)->setActionIndex((yystk__[1].sv.m_nVal));
+			ptbl.mapRule2Action((yyval.m_pProd)->getID(), (yystk__[1].sv.m_nVal));
+			ptbl.mapRule2Line((yyval.m_pProd)->getID(), (yystk__[2].loc).firstLine);
 			
 			grammar.clearMidSVT();
 		
-#line 6420 "gcode/ulyac.cpp"
+#line 6747 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 135:
 	{
-#line 3061 "meta/ulyac.upg"
+#line 3020 "meta/ulyac.upg"
 
-			(yyval.m_pProd) = (yys_sv__[0].m_pProd);
-			int nActID = ptbl.addEmptyAction((yys_loc__[0]).firstLine);
+			(yyval.m_pProd) = (yystk__[0].sv.m_pProd);
+			int nActID = ptbl.addEmptyAction((yystk__[0].loc).firstLine);
 			ptbl.mapRule2Action((yyval.m_pProd)->getID(), nActID);
-			ptbl.mapRule2Line((yyval.m_pProd)->getID(), (yys_loc__[0]).firstLine);
+			ptbl.mapRule2Line((yyval.m_pProd)->getID(), (yystk__[0].loc).firstLine);
 			(yyval.m_pProd)->setActionIndex(nActID);
 		
-#line 6435 "gcode/ulyac.cpp"
+#line 6762 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 136:
 	{
-#line 3068 "meta/ulyac.upg"
+#line 3027 "meta/ulyac.upg"
 
 			
 			(yyval.m_pProd) = grammar.getProd(grammar.getLastProdIndex());
-			(yyval.m_pProd)->setActionIndex((yys_sv__[1].m_nVal));
-			ptbl.mapRule2Action((yyval.m_pProd)->getID(), (yys_sv__[1].m_nVal));
-			ptbl.mapRule2Line((yyval.m_pProd)->getID(), (yys_loc__[1]).firstLine);
+			(yyval.m_pProd)->setActionIndex((yystk__[1].sv.m_nVal));
+			ptbl.mapRule2Action((yyval.m_pProd)->getID(), (yystk__[1].sv.m_nVal));
+			ptbl.mapRule2Line((yyval.m_pProd)->getID(), (yystk__[1].loc).firstLine);
 			
 			grammar.clearMidSVT();
 		
-#line 6452 "gcode/ulyac.cpp"
+#line 6779 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 137:
 	{
-#line 3077 "meta/ulyac.upg"
+#line 3036 "meta/ulyac.upg"
 
 			(yyval.m_pProd) = grammar.getProd(grammar.getLastProdIndex());
-			int nActID = ptbl.addEmptyAction((yys_loc__[0]).firstLine);
+			int nActID = ptbl.addEmptyAction((yystk__[0].loc).firstLine);
 			ptbl.mapRule2Action((yyval.m_pProd)->getID(), nActID);
-			ptbl.mapRule2Line(nActID, (yys_loc__[0]).firstLine);
+			ptbl.mapRule2Line(nActID, (yystk__[0].loc).firstLine);
 			(yyval.m_pProd)->setActionIndex(nActID);			
 		
-#line 6467 "gcode/ulyac.cpp"
+#line 6794 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 138:
 	{
-#line 3085 "meta/ulyac.upg"
+#line 3044 "meta/ulyac.upg"
 
-			(yyval.m_pProd) = (yys_sv__[3].m_pProd);
-			prod_t* pr = grammar.addMidRule((yys_sv__[2].m_nVal));
+			(yyval.m_pProd) = (yystk__[3].sv.m_pProd);
+			prod_t* pr = grammar.addMidRule((yystk__[2].sv.m_nVal));
 			assert(pr);
 			(yyval.m_pProd)->addRight(pr->getLeft());
-			(yyval.m_pProd)->addRight((yys_sv__[0].m_pPItem)->m_nSymbol, (yys_sv__[0].m_pPItem)->m_nPrec, (yys_sv__[0].m_pPItem)->m_nAssoc);
+			(yyval.m_pProd)->addRight((yystk__[0].sv.m_pPItem)->m_nSymbol, (yystk__[0].sv.m_pPItem)->m_nPrec, (yystk__[0].sv.m_pPItem)->m_nAssoc);
 			
-			ptbl.mapRule2Action(pr->getID(), (yys_sv__[2].m_nVal));
-			ptbl.mapRule2Line(pr->getID(), (yys_loc__[2]).firstLine);
-			pr->setActionIndex((yys_sv__[2].m_nVal));
+			ptbl.mapRule2Action(pr->getID(), (yystk__[2].sv.m_nVal));
+			ptbl.mapRule2Line(pr->getID(), (yystk__[2].loc).firstLine);
+			pr->setActionIndex((yystk__[2].sv.m_nVal));
 			
-			delete (yys_sv__[0].m_pPItem);
+			delete (yystk__[0].sv.m_pPItem);
 		
-#line 6488 "gcode/ulyac.cpp"
+#line 6815 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 139:
 	{
-#line 3098 "meta/ulyac.upg"
+#line 3057 "meta/ulyac.upg"
 
-			(yyval.m_pProd) = (yys_sv__[1].m_pProd);
-			(yyval.m_pProd)->addRight((yys_sv__[0].m_pPItem)->m_nSymbol, (yys_sv__[0].m_pPItem)->m_nPrec, (yys_sv__[0].m_pPItem)->m_nAssoc);
+			(yyval.m_pProd) = (yystk__[1].sv.m_pProd);
+			(yyval.m_pProd)->addRight((yystk__[0].sv.m_pPItem)->m_nSymbol, (yystk__[0].sv.m_pPItem)->m_nPrec, (yystk__[0].sv.m_pPItem)->m_nAssoc);
 			
-			delete (yys_sv__[0].m_pPItem);
+			delete (yystk__[0].sv.m_pPItem);
 		
-#line 6502 "gcode/ulyac.cpp"
+#line 6829 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 140:
 	{
-#line 3104 "meta/ulyac.upg"
+#line 3063 "meta/ulyac.upg"
 
-			prod_t* pr = grammar.addMidRule((yys_sv__[2].m_nVal));
+			prod_t* pr = grammar.addMidRule((yystk__[2].sv.m_nVal));
 			assert(pr);
 			
 			(yyval.m_pProd) = grammar.getProd(grammar.getLastProdIndex());
 			(yyval.m_pProd)->addRight(pr->getLeft());
-			(yyval.m_pProd)->addRight((yys_sv__[0].m_pPItem)->m_nSymbol, (yys_sv__[0].m_pPItem)->m_nPrec, (yys_sv__[0].m_pPItem)->m_nAssoc);
+			(yyval.m_pProd)->addRight((yystk__[0].sv.m_pPItem)->m_nSymbol, (yystk__[0].sv.m_pPItem)->m_nPrec, (yystk__[0].sv.m_pPItem)->m_nAssoc);
 			
-			ptbl.mapRule2Action(pr->getID(), (yys_sv__[2].m_nVal));
-			ptbl.mapRule2Line(pr->getID(), (yys_loc__[2]).firstLine);
-			pr->setActionIndex((yys_sv__[2].m_nVal));
+			ptbl.mapRule2Action(pr->getID(), (yystk__[2].sv.m_nVal));
+			ptbl.mapRule2Line(pr->getID(), (yystk__[2].loc).firstLine);
+			pr->setActionIndex((yystk__[2].sv.m_nVal));
 			
-			delete (yys_sv__[0].m_pPItem);
+			delete (yystk__[0].sv.m_pPItem);
 		
-#line 6524 "gcode/ulyac.cpp"
+#line 6851 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 141:
 	{
-#line 3118 "meta/ulyac.upg"
+#line 3077 "meta/ulyac.upg"
 
 			(yyval.m_pProd) = grammar.getProd(grammar.getLastProdIndex());
-			(yyval.m_pProd)->addRight((yys_sv__[0].m_pPItem)->m_nSymbol, (yys_sv__[0].m_pPItem)->m_nPrec, (yys_sv__[0].m_pPItem)->m_nAssoc);
+			(yyval.m_pProd)->addRight((yystk__[0].sv.m_pPItem)->m_nSymbol, (yystk__[0].sv.m_pPItem)->m_nPrec, (yystk__[0].sv.m_pPItem)->m_nAssoc);
 			
-			delete (yys_sv__[0].m_pPItem);
+			delete (yystk__[0].sv.m_pPItem);
 		
-#line 6538 "gcode/ulyac.cpp"
+#line 6865 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 142:
 	{
-#line 3125 "meta/ulyac.upg"
+#line 3084 "meta/ulyac.upg"
 
-			if((yys_sv__[2].m_nVal) >= grammar.getTypeBase()) {
+			if((yystk__[2].sv.m_nVal) >= grammar.getTypeBase()) {
 				strMsg = "at line ";
-				strMsg += strhelper_t::fromInt((yys_loc__[2]).firstLine);
+				strMsg += strhelper_t::fromInt((yystk__[2].loc).firstLine);
 				strMsg += "; description: %prec can not apply to types, ignored.";
 				_WARNING(strMsg);
 				
-				(yyval.m_pPItem) = new prod_item_t((yys_sv__[2].m_nVal));
+				(yyval.m_pPItem) = new prod_item_t((yystk__[2].sv.m_nVal));
 			}
 			else {
-				const symbol_t* psym = grammar.getSymbolObj((yys_sv__[0].m_pchVal));
+				const symbol_t* psym = grammar.getSymbolObj((yystk__[0].sv.m_pchVal));
 		// update 18/06/09
                 if( ! psym || !psym->isToken()) {
-					strMsg = strhelper_t::fromInt((yys_loc__[0]).firstLine);
+					strMsg = strhelper_t::fromInt((yystk__[0].loc).firstLine);
 					strMsg += ':';
-					strMsg += strhelper_t::fromInt((yys_loc__[0]).firstColumn);
+					strMsg += strhelper_t::fromInt((yystk__[0].loc).firstColumn);
 					strMsg += "; description: declaration of token `";
-					strMsg += (yys_sv__[0].m_pchVal);
+					strMsg += (yystk__[0].sv.m_pchVal);
 					strMsg += "\' expected.";
 					_ERROR(strMsg, ESYN(6));
 					
                     psym = grammar.getSymbolObj(ERROR_SYMBOL_INDEX);
                 }
                 (const_cast<symbol_t*>(psym))->setUsed(true);
-                (yyval.m_pPItem) = new prod_item_t((yys_sv__[2].m_nVal), psym->getPrec(), psym->getAssoc());
+                (yyval.m_pPItem) = new prod_item_t((yystk__[2].sv.m_nVal), psym->getPrec(), psym->getAssoc());
 
 			}
-			delete[] (yys_sv__[0].m_pchVal);
+			delete[] (yystk__[0].sv.m_pchVal);
 		
-#line 6575 "gcode/ulyac.cpp"
+#line 6902 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 143:
 	{
-#line 3154 "meta/ulyac.upg"
+#line 3113 "meta/ulyac.upg"
 
 		
-			if((yys_sv__[0].m_nVal) >= grammar.getTypeBase()) {				
-				(yyval.m_pPItem) = new prod_item_t((yys_sv__[0].m_nVal));
+			if((yystk__[0].sv.m_nVal) >= grammar.getTypeBase()) {				
+				(yyval.m_pPItem) = new prod_item_t((yystk__[0].sv.m_nVal));
 			}
 			else {
-				if((yys_sv__[0].m_nVal) < 0) {
-					(yyval.m_pPItem) = new prod_item_t((yys_sv__[0].m_nVal));
+				if((yystk__[0].sv.m_nVal) < 0) {
+					(yyval.m_pPItem) = new prod_item_t((yystk__[0].sv.m_nVal));
 				}
 				else {
-					const symbol_t* psym = grammar.getSymbolObj((yys_sv__[0].m_nVal));
+					const symbol_t* psym = grammar.getSymbolObj((yystk__[0].sv.m_nVal));
 					assert(psym && psym->isToken());
-					(yyval.m_pPItem) = new prod_item_t((yys_sv__[0].m_nVal), psym->getPrec(), psym->getAssoc());					
+					(yyval.m_pPItem) = new prod_item_t((yystk__[0].sv.m_nVal), psym->getPrec(), psym->getAssoc());					
 				}
 			}
 		
-#line 6599 "gcode/ulyac.cpp"
+#line 6926 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 144:
 	{
-#line 3171 "meta/ulyac.upg"
+#line 3130 "meta/ulyac.upg"
 
-			(yyval.m_nVal) = grammar.getSymbolIndex((yys_sv__[0].m_pchVal));
+			(yyval.m_nVal) = grammar.getSymbolIndex((yystk__[0].sv.m_pchVal));
 			if(INVALID_INDEX == (yyval.m_nVal)) {
-				(yyval.m_nVal) = grammar.addType((yys_sv__[0].m_pchVal), DEFAULT_SVT_ID).first;
+				(yyval.m_nVal) = grammar.addType((yystk__[0].sv.m_pchVal), DEFAULT_SVT_ID).first;
 				++s_nCounter;
 			}
-			delete[] (yys_sv__[0].m_pchVal);
+			delete[] (yystk__[0].sv.m_pchVal);
 		
-#line 6615 "gcode/ulyac.cpp"
+#line 6942 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 145:
 	{
-#line 3179 "meta/ulyac.upg"
+#line 3138 "meta/ulyac.upg"
 
-				string strSName = strhelper_t::quotedChar((yys_sv__[0].m_cVal));
+				string strSName = strhelper_t::quotedChar((yystk__[0].sv.m_cVal));
 				(yyval.m_nVal) = grammar.getSymbolIndex(strSName);
 				if(INVALID_INDEX == (yyval.m_nVal)) {
 				
@@ -6629,7 +6956,7 @@ case 133:
 						if(cit == s_sname2Idx.end()) {
 							
 							s_vstrSName.push_back(strSName);
-							s_vnToken.push_back((int)(yys_sv__[0].m_cVal));
+							s_vnToken.push_back((int)(yystk__[0].sv.m_cVal));
 							
 							(yyval.m_nVal) = (int)s_vstrSName.size();
 							(yyval.m_nVal) = - (yyval.m_nVal);
@@ -6640,17 +6967,17 @@ case 133:
 						}
 				}
 		
-#line 6643 "gcode/ulyac.cpp"
+#line 6970 "gcode/ulyac.cpp"
 
 	}
 	break;
 	
 	case 146:
 	{
-#line 3199 "meta/ulyac.upg"
+#line 3158 "meta/ulyac.upg"
 
-            std::string strSName{(yys_sv__[0].m_pchVal)};
-            delete[] (yys_sv__[0].m_pchVal);
+            std::string strSName{(yystk__[0].sv.m_pchVal)};
+            delete[] (yystk__[0].sv.m_pchVal);
 
             (yyval.m_nVal) = grammar.getSymbolIndex(strSName);
             if(INVALID_INDEX == (yyval.m_nVal)) {
@@ -6670,7 +6997,7 @@ case 133:
                 }
             }
         
-#line 6673 "gcode/ulyac.cpp"
+#line 7000 "gcode/ulyac.cpp"
 
 	}
 	break;
@@ -6702,24 +7029,21 @@ yyerror(yycc, lexer, dtbl, grammar, ptbl, dmap, gsetup);
 					yytok__ = PARSE_ERRORSYMB_ID;
 					yysidx__ = PARSE_ERRORSYMB_INDEX;
 
-					while(! yys_sv__.empty())  {
-						yypstate__ = yynext_pstate__(yys_stt__.top(), yysidx__);
+					while(yystk__.count() > 1)  {
+						yypstate__ = yynext_pstate__(yystk__.top().stt, yysidx__);
 						if(is_valid_pstate__(yypstate__)) {
 							break;
 						}
 			
 
-						yydiscard__(yys_sv__.top(), yys_loc__.top(), yys_symb__.top(), lexer, dtbl, grammar, ptbl, dmap, gsetup);
-						yys_loc__.pop(1);
+						yydiscard__(yystk__.top().sv, yystk__.top().loc, yystk__.top().symb, lexer, dtbl, grammar, ptbl, dmap, gsetup);
 
 
-						yys_symb__.pop(1);
-						yys_sv__.pop(1);
-						yys_stt__.pop(1);
+						yystk__.pop(1);
 					}
 
-					if( yys_sv__.empty()) {
-						yys_stt__.pop(1);
+					if(yystk__.count() == 1) {
+						yystk__.pop(1);
 					}
 
 					break;
@@ -6727,44 +7051,45 @@ yyerror(yycc, lexer, dtbl, grammar, ptbl, dmap, gsetup);
 
 				if(is_valid_prule__(yyprule__) || YYE_ACCEPT == yyecode__) {
 					yyrplen__ = yyprnum[yyprule__];
-					yypstate__ = yynext_goto__(yys_stt__[yyrplen__], yyplid[yyprule__]);
+					yypstate__ = yynext_goto__(yystk__[yyrplen__].stt, yyplid[yyprule__]);
 
 
 					if(YYE_ACCEPT != yyecode__) {
-						yys_stt__.pop(yyrplen__);
-						yys_symb__.pop(yyrplen__);
-						yys_sv__.pop(yyrplen__);
 
-						if(!yys_loc__.empty()) {
+						if(yystk__.count() > 1) {
 							if(yyrplen__ == 0) {
-								yyloc.firstLine = yyloc.lastLine = yys_loc__[0].lastLine;
-								yyloc.firstColumn = yyloc.lastColumn = yys_loc__[0].lastColumn;
+								yyloc.firstLine = yyloc.lastLine = yystk__[0].loc.lastLine;
+								yyloc.firstColumn = yyloc.lastColumn = yystk__[0].loc.lastColumn;
 							}
 							else {
-								yyloc.firstLine = yys_loc__[yyrplen__ - 1].firstLine;
-								yyloc.lastLine = yys_loc__[0].lastLine;
-								yyloc.firstColumn = yys_loc__[yyrplen__ - 1].firstColumn;
-								yyloc.lastColumn = yys_loc__[0].lastColumn;
+								yyloc.firstLine = yystk__[yyrplen__ - 1].loc.firstLine;
+								yyloc.lastLine = yystk__[0].loc.lastLine;
+								yyloc.firstColumn = yystk__[yyrplen__ - 1].loc.firstColumn;
+								yyloc.lastColumn = yystk__[0].loc.lastColumn;
 							}
 						}
-						yys_loc__.pop(yyrplen__);
-						yys_loc__.push(yyloc);
 
-						yys_stt__.push(yypstate__);
-						yys_symb__.push(yyplid[yyprule__] + PARSE_TYPE_BASE);
-						yys_sv__.push(yyval);
+						yystk__.pop(yyrplen__);
+
+						yyframe_t &yyf__ = yystk__.push();
+						yyf__.stt = yypstate__;
+						yyf__.symb = yyplid[yyprule__] + PARSE_TYPE_BASE;
+						yyf__.sv = yyval;
+
+						yyf__.loc = yyloc;
+
 					}
 				}
 			}
 		}
 
-		while( ! yys_sv__.empty()) {
+		while(yystk__.count() > 1) {
 
-			yydiscard__(yys_sv__.top(), yys_loc__.top(), yys_symb__.top(), lexer, dtbl, grammar, ptbl, dmap, gsetup);
+			yydiscard__(yystk__.top().sv, yystk__.top().loc, yystk__.top().symb, lexer, dtbl, grammar, ptbl, dmap, gsetup);
 
-			yys_sv__.pop(1);
-			yys_symb__.pop(1);
+			yystk__.pop(1);
 		}
+		yystk__.clear();
 
 		if(YYE_ACCEPT == yyecode__) {
 
@@ -6785,13 +7110,12 @@ public:
 		
 		yyleng = 0;
 		yylaleng = 0;
-		if(yytext) {
-			yytext[0] = '\0';
-		}
+		yyreset_text__();
 		yybufmgr__.destroyall();
 
 		yyerr_flag__ = false;
 		yyltok = PARSE_UNDEFSYMB_ID;
+		yystk__.clear();
 
 	}
 
@@ -6887,7 +7211,16 @@ private:
 		}
 		return yybufmgr__.newbuf(strbuffer, size);
 	}
+	// yytext refers to the mapping in place for tokens from this buffer
+	inline YYPBUFFER yy_new_mmapbuf(const char *strfile) {
+		if( ! strfile) {
+			return NULL;
+		}
+		return yybufmgr__.newmmap(strfile);
+	}
 	inline void yy_delete_buffer(void) {
+		// yytext may refer to the buffer in place
+		yyown_text__();
 		yybufmgr__.destroytop();
 	}
 	inline void yy_switch_buffer(YYPBUFFER buf) {
@@ -6901,9 +7234,7 @@ private:
 		
 		yyleng = 0;
 		yylaleng = 0;
-		if( yytext ) {
-			yytext[0] = '\0';
-		}
+		yyreset_text__();
 
 		yyscstk__.clear();
 		yybufmgr__.reset();
@@ -6916,22 +7247,25 @@ private:
 	}
 	inline int yyless(int n) {
 
+		// chars given back will be read again, keep them intact
+		yyown_text__();
 		if(n > 0 && n < yyleng) {
 
-			yytext[n] = '\0';
+			yyend_text__(n);
 			n = yyleng - n;
 			yyleng -= n;
 			yylaleng = yyleng;
 			return yybufmgr__.unget(n);
 		}
 		yylaleng = yyleng;
-		yytext[yylaleng] = '\0';
+		yyend_text__(yylaleng);
 
 		return 0;
 	}
 
 	inline int yyinput(void) {
 
+		yyunhold__();
 		int c = yybufmgr__.get();
 		if(c < END_OF_FILE) {
 			if(c == '\t') {
@@ -6952,6 +7286,7 @@ private:
 		return c;
 	}
 	inline bool yyunput(char c) {
+		yyunhold__();
 		int oldc = yybufmgr__.put(c);
 		if(oldc < END_OF_FILE) {
 			int s;
@@ -6971,6 +7306,7 @@ private:
 		return oldc < END_OF_FILE;
 	}
 	inline bool yyunget(void) {
+		yyunhold__();
 		int oldc = yybufmgr__.unget();
 		if(oldc < END_OF_FILE) {
 			int s;
@@ -7042,11 +7378,28 @@ private:
 	char *yytext;
 	int yyleng;
 	int yylaleng;
+	// own text buffer, yytext refers to it unless it is in place
+	char *yytbuf__;
+	// char overwritten by terminating NULL of in-place yytext
+	char *yyhold_ptr__;
+	char yyhold_char__;
+	// rule of token matched last
+	int yyrule__;
+
+	
+	// frame of parse stack: state, symbol, semantic value and location
+	struct yyframe_t {
+		int stt;
+		int symb;
+		xstype_t sv;
+		xltype_t loc;
+	};
 
-	
 	bool yyerr_flag__;
 	int yyltok;
     yylex_t yylexer;
+	// parse stack, its storage is kept and reused by following parses
+	sstack_t<yyframe_t, 256> yystk__;
 
 	FILE* yyoutput;
 	FILE* yylogger;
@@ -7058,25 +7411,25 @@ private:
 ///////////////////////////////////////////////////////////////////////////
 	// lexical tables
 	// start states of DFAs
-	static const int yydsc[26];
+	static const unsigned short yydsc[26];
 
 	// @yydcmap is a char map: char -> transition-label,
 	// that is, chars are grouped, transition label is
 	// representation of equivalent class of chars
-	static const int yydcmap[258];
+	static const unsigned char yydcmap[258];
 
 	// @yydmeta is transition-label map: transition-label -> grouped-transition-label,
 	// that is, transition-label in @yydcmap are further grouped in order to save space
-	static const int yydmeta[76];
+	static const unsigned char yydmeta[76];
 
 	// use next-check-base-default scheme to store DFAs
 	// 
-	static const int yydbase[667];
-	static const int yyddef[667];
+	static const unsigned short yydbase[607];
+	static const unsigned short yyddef[607];
 	// next table is an indeed transition table
-	static const int yydnxt[3003];
-	static const int yydchk[3003];
-	static const int yydaccpt[570];
+	static const unsigned short yydnxt[2519];
+	static const unsigned short yydchk[2519];
+	static const signed char yydaccpt[523];
 	
 	static char YYMSG_UNMATCHED[];
 
@@ -7084,32 +7437,32 @@ private:
 	// LALR parse tables
 	// token map: token ID --> token index in token ID table
 	// in fact, it acts like inverse table of token ID table
-	static const int yyptmap[295];
+	static const unsigned char yyptmap[295];
 	// token ID table, which contains token IDs
-	//static const int yyptid[59];
+	//static const unsigned short yyptid[59];
 	// number of symbols in a grammar rule
-	static const int yyprnum[147];
+	static const unsigned char yyprnum[147];
 	// index of left symbol in a grammar rule
-	static const int yyplid[147];
+	static const unsigned char yyplid[147];
 	// parse action table
-	static const int yypact[599];
+	static const unsigned short yypact[599];
 
 	// base array for parse action table
 	// which is used to determine the base location of the entries
 	// for each state stored in the yypack table
-	static const int yypabase[209];
-	static const int yypgoto[35];
-	static const int yypgbase[209];
+	static const short yypabase[209];
+	static const unsigned short yypgoto[35];
+	static const signed char yypgbase[209];
 
 	// check table for parse action table
 	static const by_te_t yyvbmap[1672];
-	static const int yyparv[209];
-	static const int yyparn[209];
+	static const unsigned short yyparv[209];
+	static const unsigned char yyparn[209];
 
-	static const int yypcv[113];
-	static const int yypcn[113];
-	static const int yypgrv[209];
-	static const int yypgrn[209];
+	static const unsigned short yypcv[113];
+	static const unsigned char yypcn[113];
+	static const unsigned short yypgrv[209];
+	static const unsigned char yypgrn[209];
 	static const std::unordered_map<std::string, int> yyslexemID;
 
 ///////////////////////////////////////////////////////////////////////////////////
@@ -7124,14 +7477,14 @@ private:
 
 char yyparser_t::YYMSG_UNMATCHED[] = "Error: unmatched character ` \'.";
 
-const int yyparser_t::yydsc[26] = {
-506,	490,	566,	566,	568,	568,	386,	385,
-	536,	536,	567,	567,	487,	487,	553,	553,
-	435,	435,	332,	331,	546,	546,	436,	436,
-	491,	491
+const unsigned short yyparser_t::yydsc[26] = {
+494,	441,	519,	519,	521,	521,	327,	326,
+	495,	495,	520,	520,	440,	440,	512,	512,
+	390,	390,	283,	284,	461,	461,	391,	391,
+	442,	442
 };
 
-const int yyparser_t::yydcmap[258] = {
+const unsigned char yyparser_t::yydcmap[258] = {
 0,	0,	0,	0,	0,	0,	0,	0,
 	0,	1,	2,	0,	0,	3,	0,	0,
 	0,	0,	0,	0,	0,	0,	0,	0,
@@ -7167,109 +7520,100 @@ const int yyparser_t::yydcmap[258] = {
 	75,	75
 };
 
-const int yyparser_t::yydmeta[76] = {
+const unsigned char yyparser_t::yydmeta[76] = {
 0,	1,	2,	3,	4,	5,	6,	7,
 	8,	9,	7,	10,	10,	7,	10,	11,
-	12,	13,	13,	13,	13,	14,	15,	16,
-	17,	16,	18,	4,	4,	4,	4,	4,
+	12,	13,	13,	13,	14,	15,	16,	17,
+	18,	17,	19,	4,	4,	4,	4,	4,
 	4,	4,	4,	4,	4,	4,	4,	4,
-	4,	4,	19,	20,	7,	10,	8,	4,
+	4,	4,	20,	21,	7,	10,	8,	4,
 	4,	4,	4,	4,	4,	4,	4,	4,
 	4,	4,	4,	4,	4,	4,	4,	4,
-	4,	21,	4,	4,	4,	4,	22,	23,
+	4,	4,	4,	4,	4,	4,	22,	23,
 	7,	24,	25,	26
 };
 
-const int yyparser_t::yydbase[667] = {
-2927,	2927,	2927,	2927,	2927,	2927,	2927,	2927,
-	2927,	2927,	2927,	2927,	2927,	2927,	2927,	2927,
-	2927,	2927,	2927,	2927,	2927,	2927,	2927,	2927,
-	2927,	2927,	2927,	2927,	2927,	2927,	2927,	2927,
-	2927,	2927,	2927,	2927,	2927,	2927,	2927,	2927,
-	2927,	2927,	2927,	2927,	2927,	2927,	2927,	2927,
-	2927,	2927,	2927,	2927,	2927,	2927,	2927,	2927,
-	2927,	2927,	2927,	2927,	2927,	2927,	2927,	2927,
-	2927,	2927,	2927,	2927,	2927,	2927,	2927,	2927,
-	2927,	2927,	2927,	2927,	2927,	2927,	2927,	2927,
-	2927,	2927,	2927,	2927,	2927,	2927,	2927,	2927,
-	2927,	2927,	2927,	2927,	2927,	2927,	2927,	2927,
-	2927,	2927,	2927,	2927,	2927,	2927,	2927,	2927,
-	2927,	2927,	2927,	2927,	2927,	2927,	2927,	2927,
-	2927,	2927,	2927,	2927,	2927,	2927,	2927,	2927,
-	2927,	2927,	2927,	2927,	2927,	2927,	2927,	2927,
-	2927,	2927,	2927,	2927,	2927,	2927,	2927,	2927,
-	2927,	2927,	2927,	2927,	2927,	2927,	2927,	2927,
-	2927,	2927,	2927,	2927,	2927,	2927,	2927,	2927,
-	2927,	2927,	2927,	2927,	2927,	2927,	2927,	2927,
-	2927,	2927,	2927,	2927,	2927,	2927,	1389,	1325,
-	1327,	1336,	1384,	1323,	1382,	1362,	1320,	1326,
-	1359,	1358,	1357,	1375,	1355,	1331,	1330,	1348,
-	1351,	1346,	1349,	1299,	1347,	1346,	1296,	1334,
-	1329,	1361,	1341,	1340,	1339,	1357,	1294,	1287,
-	1312,	1325,	1329,	1283,	1350,	1307,	1306,	1305,
-	1304,	1340,	1302,	1275,	1300,	1281,	1270,	1271,
-	1296,	1318,	1294,	1293,	1292,	1291,	1283,	1263,
-	1285,	1261,	1266,	1254,	1259,	1318,	1249,	1254,
-	1308,	1252,	1300,	1231,	1285,	1265,	1280,	1231,
-	1251,	1172,	1160,	1205,	1162,	1198,	1122,	1121,
-	1153,	1148,	1101,	1149,	1131,	1087,	1083,	1082,
-	1081,	1063,	1100,	1092,	1049,	1049,	1030,	1024,
-	1021,	1003,	985,	989,	978,	974,	952,	1005,
-	961,	955,	950,	952,	937,	937,	938,	923,
-	927,	911,	912,	961,	892,	892,	875,	883,
-	873,	858,	890,	885,	883,	807,	797,	760,
-	759,	732,	721,	718,	721,	689,	674,	646,
-	687,	656,	639,	602,	571,	564,	548,	558,
-	540,	515,	513,	488,	501,	498,	481,	411,
-	391,	383,	408,	345,	3,	290,	268,	187,
-	184,	114,	46,	20,	13,	953,	933,	86,
-	858,	1012,	1008,	547,	839,	799,	307,	744,
-	278,	825,	731,	703,	3,	416,	243,	559,
-	727,	652,	502,	370,	726,	28,	125,	675,
-	108,	448,	632,	602,	202,	538,	351,	593,
-	383,	327,	427,	422,	314,	367,	278,	247,
-	172,	186,	224,	196,	191,	101,	148,	167,
-	83,	74,	12,	1310,	1275,	1272,	1259,	1271,
-	1270,	1267,	1249,	1266,	1257,	1256,	1255,	1253,
-	1252,	1250,	1241,	1228,	1221,	1218,	1130,	792,
-	708,	935,	1243,	915,	895,	855,	1256,	1251,
-	835,	806,	0,	795,	1190,	1162,	1038,	620,
-	215,	555,	341,	1232,	1228,	624,	385,	327,
-	148,	122,	32,	197,	52,	1210,	508,	1175,
-	1174,	1169,	1163,	1157,	1140,	1156,	1150,	1134,
-	1161,	1128,	636,	1125,	1121,	1114,	1111,	1105,
-	1098,	1121,	1088,	1109,	1076,	1070,	1064,	1058,
-	1085,	1049,	1052,	1045,	505,	1035,	1028,	1027,
-	397,	651,	317,	615,	1020,	1016,	1012,	1008,
-	1038,	699,	777,	719,	599,	572,	312,	106,
-	53,	496,	451,	225,	985,	11,	731,	76,
-	281,	121,	531,	568,	425,	256,	207,	154,
-	276,	3,	103,	990,	984,	970,	964,	950,
-	944,	930,	924,	910,	904,	890,	884,	870,
-	864,	850,	844,	830,	824,	810,	804,	790,
-	784,	769,	763,	424,	390,	354,	318,	246,
-	175,	764,	739,	738,	713,	710,	696,	682,
-	661,	178,	31,	676,	667,	640,	617,	613,
-	561,	582,	530,	524,	488,	482,	430,	414,
-	378,	342,	306,	270,	83,	209,	193,	148,
-	73,	0,	2927,	1419,	1417,	1406,	1405,	1449,
-	1445,	2292,	2276,	2260,	2244,	1500,	2905,	2894,
-	2883,	2872,	2861,	2850,	2839,	1416,	2828,	2817,
-	2806,	2795,	2784,	2773,	2757,	2741,	2730,	2714,
-	2698,	2682,	2666,	2650,	2634,	2618,	2602,	2586,
-	2570,	2554,	2538,	2522,	2506,	2490,	2474,	2458,
-	2442,	2426,	2410,	2394,	2378,	2362,	2346,	2330,
-	2314,	2298,	2282,	2266,	2250,	2234,	2223,	2203,
-	2183,	2163,	2143,	2123,	2103,	2083,	1440,	2061,
-	2035,	2010,	1987,	1962,	1936,	1910,	1885,	1863,
-	1838,	1813,	1788,	1763,	1738,	1713,	1687,	1661,
-	1635,	1609,	1583,	1557,	1531,	1505,	1486,	1464,
-	1439,	1417,	1391
+const unsigned short yyparser_t::yydbase[607] = {
+2443,	2443,	2443,	2443,	2443,	2443,	2443,	2443,
+	2443,	2443,	2443,	2443,	2443,	2443,	2443,	2443,
+	2443,	2443,	2443,	2443,	2443,	2443,	2443,	2443,
+	2443,	2443,	2443,	2443,	2443,	2443,	2443,	2443,
+	2443,	2443,	2443,	2443,	2443,	2443,	2443,	2443,
+	2443,	2443,	2443,	2443,	2443,	2443,	2443,	2443,
+	2443,	2443,	2443,	2443,	2443,	2443,	2443,	2443,
+	2443,	2443,	2443,	2443,	2443,	2443,	2443,	2443,
+	2443,	2443,	2443,	2443,	2443,	2443,	2443,	2443,
+	2443,	2443,	2443,	2443,	2443,	2443,	2443,	2443,
+	2443,	2443,	2443,	2443,	2443,	2443,	2443,	2443,
+	2443,	2443,	2443,	2443,	2443,	2443,	2443,	2443,
+	2443,	2443,	2443,	2443,	2443,	2443,	2443,	2443,
+	2443,	2443,	2443,	2443,	2443,	2443,	2443,	2443,
+	2443,	2443,	2443,	2443,	2443,	2443,	2443,	2443,
+	2443,	2443,	2443,	2443,	2443,	2443,	2443,	2443,
+	2443,	1279,	1258,	1225,	1228,	1225,	1273,	1230,
+	1211,	1202,	1210,	1215,	1197,	1247,	1246,	1245,
+	1244,	1243,	1261,	1200,	1202,	1190,	1208,	1237,
+	1236,	1235,	1193,	1211,	1198,	1203,	1237,	1188,
+	1202,	1188,	1196,	1199,	1198,	1197,	1188,	1193,
+	1190,	1185,	1176,	1213,	1212,	1235,	1163,	1233,
+	1163,	1162,	1161,	1175,	1204,	1219,	1197,	1171,
+	1164,	1180,	1214,	1213,	1174,	1211,	1210,	1159,
+	1215,	1149,	1143,	1164,	1211,	1161,	1164,	1166,
+	1139,	1207,	1205,	1159,	1203,	1145,	1159,	1158,
+	1157,	1156,	1155,	1154,	1135,	1142,	1130,	1150,
+	1172,	1183,	1136,	1146,	1187,	1186,	1143,	1165,
+	1141,	1114,	1181,	1175,	1160,	1155,	1154,	1138,
+	1118,	1149,	1088,	1093,	1075,	1064,	1058,	1062,
+	1045,	1046,	1046,	982,	972,	955,	929,	904,
+	909,	902,	899,	890,	870,	877,	824,	814,
+	775,	758,	747,	717,	673,	657,	615,	677,
+	601,	533,	554,	437,	493,	398,	362,	406,
+	365,	326,	346,	316,	283,	181,	162,	3,
+	129,	51,	44,	39,	12,	1075,	1071,	868,
+	787,	731,	939,	948,	162,	1001,	531,	313,
+	699,	544,	649,	599,	442,	640,	9,	381,
+	249,	388,	573,	590,	569,	798,	759,	487,
+	56,	349,	181,	340,	260,	140,	204,	326,
+	324,	21,	39,	142,	440,	4,	70,	1,
+	1158,	1154,	817,	498,	1119,	1078,	1105,	1097,
+	1101,	1100,	1093,	1078,	1083,	1093,	1092,	1084,
+	1077,	1070,	1074,	1052,	1044,	1045,	1058,	1044,
+	1055,	1044,	1030,	1023,	830,	742,	1032,	1026,
+	1022,	1019,	1016,	867,	131,	1009,	618,	113,
+	546,	0,	1013,	136,	1056,	1055,	1054,	744,
+	1047,	996,	712,	868,	733,	126,	648,	713,
+	0,	311,	699,	127,	424,	182,	558,	530,
+	1033,	456,	990,	979,	979,	974,	970,	967,
+	956,	954,	952,	949,	938,	932,	935,	919,
+	922,	918,	915,	904,	902,	900,	897,	888,
+	885,	693,	868,	822,	551,	874,	868,	866,
+	853,	851,	845,	832,	191,	236,	815,	596,
+	254,	846,	561,	834,	370,	396,	295,	26,
+	164,	490,	280,	814,	830,	837,	833,	829,
+	825,	821,	460,	502,	791,	689,	519,	434,
+	108,	23,	17,	771,	719,	361,	763,	762,
+	751,	742,	733,	724,	710,	704,	690,	682,
+	681,	662,	661,	643,	637,	627,	618,	266,
+	617,	609,	598,	590,	589,	571,	570,	449,
+	280,	261,	386,	186,	163,	103,	103,	577,
+	546,	536,	526,	508,	179,	3,	480,	464,
+	463,	442,	439,	422,	391,	390,	178,	371,
+	281,	365,	329,	323,	83,	271,	209,	193,
+	148,	73,	0,	2443,	1399,	1380,	1327,	1307,
+	1295,	1405,	1524,	1446,	1403,	1377,	1332,	2423,
+	2412,	2401,	2390,	2379,	2368,	1306,	2357,	2346,
+	2335,	2324,	2313,	2302,	2290,	2278,	2266,	2254,
+	2242,	2230,	2218,	2206,	2194,	2182,	2170,	2158,
+	2146,	2134,	2122,	2110,	2098,	2086,	2074,	2062,
+	2050,	2038,	2026,	2014,	2002,	1990,	1978,	1966,
+	1954,	1942,	1930,	1910,	1890,	1870,	1331,	1848,
+	1823,	1798,	1777,	1752,	1726,	1700,	1674,	1648,
+	1627,	1605,	1579,	1553,	1527,	1501,	1475,	1449,
+	1423,	1402,	1380,	1354,	1329,	1307,	1281
 };
 
-const int yyparser_t::yyddef[667] = {
-570,	0,	0,	0,	0,	0,	0,	0,
-	0,	0,	0,	0,	0,	0,	0,	0,
+const unsigned short yyparser_t::yyddef[607] = {
+523,	0,	0,	0,	0,	0,	0,	0,
 	0,	0,	0,	0,	0,	0,	0,	0,
 	0,	0,	0,	0,	0,	0,	0,	0,
 	0,	0,	0,	0,	0,	0,	0,	0,
@@ -7279,17 +7623,18 @@ const int yyparser_t::yyddef[667] = {
 	0,	0,	0,	0,	0,	0,	0,	0,
 	0,	0,	0,	0,	0,	0,	0,	0,
 	0,	0,	0,	0,	0,	0,	0,	0,
+	0,	0,	0,	0,	173,	443,	443,	443,
+	443,	443,	443,	443,	443,	443,	443,	443,
+	443,	443,	443,	300,	444,	540,	539,	538,
+	537,	536,	531,	530,	384,	371,	388,	381,
+	330,	443,	580,	581,	522,	431,	431,	443,
+	443,	548,	524,	525,	526,	527,	584,	529,
+	583,	0,	0,	0,	0,	0,	0,	0,
 	0,	0,	0,	0,	0,	0,	0,	0,
-	0,	348,	492,	492,	492,	492,	492,	492,
-	492,	492,	492,	492,	492,	492,	492,	428,
-	492,	492,	492,	492,	492,	492,	364,	304,
-	127,	587,	437,	437,	125,	585,	584,	583,
-	582,	578,	577,	427,	427,	488,	438,	427,
-	428,	550,	547,	414,	425,	428,	410,	418,
-	410,	415,	410,	410,	569,	547,	547,	547,
-	427,	428,	387,	571,	572,	573,	574,	596,
-	641,	640,	631,	575,	597,	576,	0,	0,
 	0,	0,	0,	0,	0,	0,	0,	0,
+	0,	0,	562,	586,	577,	575,	574,	573,
+	571,	570,	569,	567,	566,	564,	563,	0,
+	561,	560,	553,	545,	544,	543,	542,	532,
 	0,	0,	0,	0,	0,	0,	0,	0,
 	0,	0,	0,	0,	0,	0,	0,	0,
 	0,	0,	0,	0,	0,	0,	0,	0,
@@ -7297,50 +7642,43 @@ const int yyparser_t::yyddef[667] = {
 	0,	0,	0,	0,	0,	0,	0,	0,
 	0,	0,	0,	0,	0,	0,	0,	0,
 	0,	0,	0,	0,	0,	0,	0,	0,
-	0,	0,	0,	0,	0,	0,	0,	642,
 	0,	0,	0,	0,	0,	0,	0,	0,
 	0,	0,	0,	0,	0,	0,	0,	0,
 	0,	0,	0,	0,	0,	0,	0,	0,
-	0,	0,	629,	628,	627,	0,	0,	0,
-	0,	0,	0,	0,	626,	625,	624,	623,
-	622,	0,	0,	579,	621,	620,	0,	0,
 	0,	0,	0,	0,	0,	0,	0,	0,
-	618,	617,	0,	616,	0,	615,	614,	590,
-	591,	592,	593,	0,	0,	0,	0,	0,
-	611,	612,	588,	588,	619,	572,	571,	601,
-	610,	612,	619,	611,	596,	610,	601,	601,
-	601,	576,	575,	663,	663,	0,	0,	0,
-	599,	603,	603,	0,	604,	604,	0,	604,
-	654,	606,	606,	0,	653,	0,	608,	0,
-	0,	0,	603,	0,	609,	0,	0,	0,
-	0,	603,	604,	604,	594,	604,	603,	606,
-	606,	603,	604,	604,	603,	606,	603,	603,
-	603,	606,	604,	604,	599,	609,	608,	645,
-	645,	666,	666,	0,	0,	0,	0,	607,
-	607,	607,	613,	607,	607,	607,	607,	607,
-	607,	607,	607,	607,	607,	607,	607,	607,
-	607,	0,	632,	0,	0,	0,	0,	0,
-	580,	0,	0,	0,	613,	613,	613,	581,
-	0,	0,	0,	648,	647,	648,	632,	647,
-	647,	632,	648,	656,	656,	586,	0,	598,
-	602,	598,	602,	598,	598,	602,	602,	602,
-	586,	598,	0,	602,	602,	605,	602,	598,
-	602,	586,	598,	586,	598,	598,	598,	602,
-	586,	602,	598,	602,	0,	602,	598,	602,
-	0,	598,	602,	598,	605,	605,	605,	605,
-	635,	605,	633,	635,	634,	633,	634,	657,
-	0,	0,	655,	655,	595,	589,	595,	595,
-	595,	595,	643,	644,	644,	644,	644,	644,
-	643,	643,	658,	600,	600,	600,	600,	600,
-	600,	600,	600,	600,	600,	600,	600,	600,
-	600,	600,	600,	600,	600,	600,	600,	600,
-	600,	600,	600,	600,	600,	600,	600,	600,
-	660,	595,	595,	595,	595,	595,	595,	595,
-	595,	595,	659,	639,	639,	639,	639,	639,
-	0,	661,	0,	0,	0,	0,	646,	636,
-	652,	651,	650,	637,	649,	630,	665,	662,
-	664,	638,	0,	0,	0,	0,	0,	0,
 	0,	0,	0,	0,	0,	0,	0,	0,
+	0,	579,	528,	527,	528,	525,	524,	548,
+	529,	583,	584,	603,	603,	579,	0,	0,
+	0,	0,	568,	594,	0,	0,	0,	0,
+	0,	0,	0,	568,	593,	0,	0,	0,
+	0,	555,	559,	546,	568,	572,	572,	572,
+	576,	572,	572,	568,	568,	572,	568,	590,
+	555,	559,	576,	555,	579,	590,	606,	606,
+	0,	0,	0,	0,	565,	554,	551,	556,
+	551,	551,	551,	551,	565,	556,	556,	556,
+	554,	556,	565,	554,	554,	565,	556,	565,
+	556,	556,	551,	551,	551,	551,	565,	556,
+	556,	565,	565,	565,	554,	550,	551,	551,
+	565,	554,	556,	0,	533,	0,	0,	550,
+	0,	0,	550,	0,	0,	0,	550,	534,
+	0,	550,	0,	0,	0,	550,	598,	598,
+	0,	0,	557,	558,	549,	557,	549,	557,
+	558,	558,	557,	557,	549,	558,	557,	558,
+	557,	549,	557,	558,	558,	557,	557,	557,
+	557,	557,	558,	558,	558,	549,	549,	549,
+	549,	549,	549,	549,	558,	557,	549,	585,
+	549,	589,	588,	589,	588,	585,	0,	0,
+	596,	595,	595,	547,	535,	0,	0,	0,
+	0,	0,	0,	591,	535,	535,	535,	535,
+	535,	535,	541,	547,	547,	597,	552,	552,
+	552,	552,	552,	552,	552,	552,	552,	552,
+	552,	552,	552,	552,	552,	547,	552,	547,
+	552,	552,	552,	552,	552,	552,	552,	552,
+	552,	552,	0,	0,	0,	0,	599,	600,
+	587,	587,	587,	587,	587,	587,	547,	547,
+	547,	547,	547,	547,	547,	547,	547,	0,
+	602,	0,	0,	0,	0,	592,	578,	605,
+	601,	604,	582,	0,	0,	0,	0,	0,
 	0,	0,	0,	0,	0,	0,	0,	0,
 	0,	0,	0,	0,	0,	0,	0,	0,
 	0,	0,	0,	0,	0,	0,	0,	0,
@@ -7350,378 +7688,316 @@ const int yyparser_t::yyddef[667] = {
 	0,	0,	0,	0,	0,	0,	0,	0,
 	0,	0,	0,	0,	0,	0,	0,	0,
 	0,	0,	0,	0,	0,	0,	0,	0,
-	0,	0,	0,	0,	0,	0,	0,	0,
-	0,	0,	0
+	0,	0,	0,	0,	0,	0,	0
 };
 
-const int yyparser_t::yydnxt[3003] = {
-0,	418,	44,	197,	324,	73,	75,	75,
-	82,	73,	75,	75,	75,	75,	75,	75,
-	75,	387,	154,	209,	489,	75,	75,	75,
-	390,	75,	74,	424,	271,	360,	360,	360,
-	16,	15,	292,	352,	150,	330,	286,	150,
-	556,	138,	75,	73,	75,	75,	335,	73,
-	73,	427,	427,	427,	73,	16,	488,	43,
-	193,	162,	163,	73,	150,	239,	73,	3,
-	73,	150,	73,	138,	556,	129,	75,	75,
-	75,	9,	415,	80,	251,	351,	160,	77,
-	77,	77,	161,	77,	77,	77,	77,	77,
-	77,	77,	311,	348,	66,	309,	77,	78,
-	77,	353,	77,	77,	153,	153,	153,	153,
-	6,	8,	291,	166,	32,	229,	565,	153,
-	153,	153,	153,	339,	148,	77,	77,	355,
-	499,	472,	283,	112,	418,	6,	480,	479,
-	6,	348,	153,	153,	153,	153,	153,	153,
-	369,	130,	112,	147,	147,	147,	397,	493,
-	77,	77,	499,	1,	33,	34,	8,	170,
-	365,	33,	33,	33,	362,	33,	33,	33,
-	33,	33,	37,	33,	33,	111,	111,	111,
-	112,	33,	34,	33,	112,	33,	33,	168,
-	6,	8,	291,	416,	68,	112,	150,	112,
-	383,	270,	171,	112,	40,	150,	173,	569,
-	35,	33,	414,	83,	179,	6,	97,	319,
-	39,	150,	9,	347,	151,	383,	9,	464,
-	9,	469,	137,	137,	137,	137,	150,	547,
-	13,	84,	33,	33,	33,	112,	33,	17,
-	502,	112,	425,	501,	551,	112,	151,	498,
-	225,	439,	503,	504,	333,	150,	112,	312,
-	112,	9,	150,	112,	112,	502,	114,	326,
-	94,	116,	444,	527,	501,	551,	504,	407,
-	375,	498,	150,	382,	376,	285,	503,	462,
-	112,	168,	495,	150,	513,	354,	494,	392,
-	532,	380,	296,	28,	171,	116,	526,	29,
-	36,	172,	324,	474,	150,	18,	150,	410,
-	410,	410,	410,	505,	112,	466,	112,	2,
-	514,	112,	410,	410,	410,	410,	112,	150,
-	537,	112,	112,	150,	112,	384,	112,	67,
-	150,	486,	150,	112,	505,	410,	410,	410,
-	410,	410,	410,	135,	135,	135,	135,	110,
-	112,	433,	433,	507,	112,	384,	135,	135,
-	135,	135,	150,	112,	150,	112,	426,	112,
-	136,	136,	136,	112,	215,	485,	510,	66,
-	563,	135,	135,	135,	135,	135,	135,	428,
-	428,	428,	428,	373,	328,	112,	293,	112,
-	289,	112,	428,	428,	428,	428,	112,	112,
-	467,	112,	112,	112,	563,	12,	113,	67,
-	112,	480,	344,	112,	112,	428,	428,	428,
-	428,	428,	428,	152,	152,	152,	152,	544,
-	266,	441,	144,	144,	144,	112,	152,	152,
-	152,	152,	112,	88,	112,	112,	112,	214,
-	214,	214,	112,	28,	112,	485,	476,	112,
-	99,	152,	152,	152,	152,	152,	152,	146,
-	146,	146,	146,	249,	112,	112,	525,	248,
-	103,	112,	146,	146,	146,	146,	112,	468,
-	450,	112,	112,	454,	6,	150,	391,	151,
-	249,	486,	358,	112,	150,	146,	146,	146,
-	146,	146,	146,	355,	240,	65,	557,	461,
-	150,	249,	301,	112,	151,	245,	245,	237,
-	112,	401,	245,	112,	112,	150,	393,	5,
-	112,	245,	112,	24,	245,	112,	245,	112,
-	245,	367,	557,	554,	554,	554,	554,	19,
-	4,	555,	555,	555,	555,	112,	554,	554,
-	554,	554,	26,	276,	555,	555,	555,	555,
-	457,	9,	388,	388,	388,	438,	438,	438,
-	438,	554,	554,	554,	554,	554,	554,	555,
-	555,	555,	555,	555,	555,	62,	62,	62,
-	62,	459,	168,	259,	259,	259,	259,	112,
-	62,	62,	62,	62,	140,	171,	259,	259,
-	259,	259,	223,	515,	150,	329,	18,	549,
-	552,	150,	516,	62,	62,	62,	62,	62,
-	62,	259,	259,	259,	259,	259,	259,	6,
-	30,	238,	165,	162,	150,	434,	434,	239,
-	70,	549,	520,	150,	150,	112,	138,	134,
-	134,	134,	134,	150,	6,	31,	399,	31,
-	274,	273,	359,	272,	562,	263,	265,	150,
-	430,	430,	264,	138,	64,	423,	357,	261,
-	262,	76,	257,	187,	150,	254,	150,	150,
-	150,	150,	550,	550,	550,	550,	269,	559,
-	562,	132,	132,	132,	548,	24,	112,	151,
-	150,	255,	108,	150,	150,	388,	388,	388,
-	150,	150,	150,	150,	150,	545,	417,	202,
-	317,	548,	112,	559,	211,	150,	112,	150,
-	151,	112,	150,	201,	150,	456,	150,	500,
-	112,	318,	150,	409,	150,	150,	150,	150,
-	232,	227,	91,	321,	150,	150,	150,	150,
-	150,	419,	138,	150,	112,	150,	112,	190,
-	347,	500,	150,	150,	112,	112,	150,	423,
-	112,	394,	426,	150,	112,	187,	69,	138,
-	215,	112,	112,	112,	17,	361,	150,	112,
-	150,	112,	275,	89,	150,	112,	226,	150,
-	432,	432,	202,	412,	413,	150,	112,	112,
-	112,	203,	199,	112,	112,	302,	201,	112,
-	92,	463,	370,	345,	112,	112,	112,	564,
-	112,	112,	112,	112,	112,	411,	90,	112,
-	281,	337,	112,	230,	112,	112,	282,	112,
-	112,	470,	465,	112,	91,	112,	112,	88,
-	112,	112,	112,	564,	404,	112,	112,	112,
-	341,	529,	429,	429,	419,	533,	112,	112,
-	112,	112,	190,	313,	112,	112,	112,	417,
-	86,	85,	346,	112,	112,	211,	112,	112,
-	112,	560,	400,	112,	422,	250,	112,	112,
-	112,	112,	112,	112,	112,	112,	112,	445,
-	112,	112,	93,	112,	416,	112,	112,	112,
-	112,	112,	270,	112,	112,	560,	443,	519,
-	112,	112,	112,	112,	247,	112,	112,	112,
-	413,	112,	496,	112,	112,	112,	199,	112,
-	112,	90,	112,	112,	112,	112,	112,	112,
-	246,	471,	101,	366,	89,	112,	112,	112,
-	112,	112,	316,	112,	112,	8,	112,	8,
-	112,	112,	112,	112,	71,	112,	497,	372,
-	412,	112,	492,	112,	112,	112,	203,	112,
-	112,	94,	112,	112,	112,	112,	112,	112,
-	244,	112,	453,	112,	411,	112,	363,	112,
-	112,	112,	230,	112,	112,	85,	112,	112,
-	117,	112,	112,	447,	242,	112,	106,	112,
-	409,	112,	150,	112,	112,	112,	227,	112,
-	112,	241,	112,	11,	112,	112,	112,	112,
-	446,	112,	100,	112,	268,	112,	150,	112,
-	112,	112,	283,	112,	112,	86,	112,	235,
-	542,	112,	112,	112,	233,	112,	405,	112,
-	150,	112,	267,	112,	112,	112,	398,	112,
-	112,	93,	112,	508,	164,	112,	378,	112,
-	343,	112,	112,	112,	150,	112,	395,	112,
-	112,	112,	349,	112,	112,	92,	112,	342,
-	102,	112,	112,	112,	224,	112,	107,	112,
-	298,	112,	472,	112,	112,	112,	94,	541,
-	112,	231,	112,	323,	112,	112,	112,	112,
-	112,	112,	104,	112,	112,	112,	368,	112,
-	112,	112,	105,	112,	112,	112,	112,	112,
-	320,	112,	374,	112,	449,	112,	112,	431,
-	431,	112,	112,	112,	509,	115,	280,	112,
-	112,	300,	522,	279,	112,	396,	524,	371,
-	112,	112,	112,	379,	420,	112,	561,	112,
-	112,	308,	112,	228,	112,	112,	112,	109,
-	112,	112,	543,	307,	521,	112,	475,	112,
-	112,	299,	167,	112,	253,	22,	112,	112,
-	112,	112,	561,	112,	112,	23,	539,	327,
-	112,	123,	112,	528,	112,	112,	123,	314,
-	460,	112,	112,	123,	295,	112,	112,	112,
-	538,	112,	96,	169,	112,	294,	112,	112,
-	95,	123,	112,	112,	24,	278,	123,	123,
-	478,	350,	112,	315,	112,	448,	402,	80,
-	174,	112,	123,	123,	112,	25,	112,	123,
-	112,	112,	25,	408,	112,	112,	112,	112,
-	112,	325,	112,	112,	473,	540,	175,	112,
-	381,	112,	112,	112,	176,	112,	112,	523,
-	112,	112,	403,	112,	112,	123,	112,	421,
-	112,	112,	437,	123,	322,	112,	112,	123,
-	112,	112,	112,	112,	277,	112,	356,	26,
-	340,	177,	112,	112,	455,	112,	27,	112,
-	178,	112,	112,	112,	112,	112,	112,	112,
-	112,	531,	98,	112,	518,	180,	112,	406,
-	112,	112,	112,	338,	535,	112,	123,	112,
-	112,	112,	112,	123,	123,	141,	141,	141,
-	123,	131,	131,	131,	145,	71,	290,	481,
-	451,	139,	81,	236,	142,	142,	142,	477,
-	112,	112,	112,	112,	112,	112,	112,	112,
-	181,	297,	558,	284,	112,	310,	310,	310,
-	112,	112,	30,	112,	112,	112,	182,	81,
-	112,	63,	63,	63,	258,	258,	258,	184,
-	112,	112,	112,	112,	112,	234,	112,	458,
-	442,	534,	186,	336,	517,	232,	512,	112,
-	112,	440,	112,	112,	188,	112,	452,	93,
-	32,	112,	511,	189,	92,	377,	112,	389,
-	389,	389,	287,	76,	288,	76,	256,	49,
-	48,	50,	51,	212,	52,	87,	61,	260,
-	47,	89,	53,	45,	54,	55,	56,	57,
-	46,	86,	42,	192,	58,	85,	217,	44,
-	220,	221,	219,	43,	191,	185,	90,	218,
-	216,	91,	210,	183,	208,	41,	59,	60,
-	207,	83,	206,	205,	200,	198,	196,	552,
-	36,	222,	8,	195,	213,	194,	234,	9,
-	133,	46,	204,	79,	160,	77,	77,	79,
-	161,	77,	77,	77,	79,	77,	78,	77,
-	79,	77,	339,	148,	79,	493,	143,	79,
-	1,	149,	158,	157,	303,	149,	303,	149,
-	149,	149,	149,	149,	149,	149,	156,	149,
-	155,	149,	303,	149,	149,	303,	149,	149,
-	149,	149,	149,	79,	72,	0,	0,	79,
-	72,	0,	0,	7,	79,	72,	0,	10,
-	79,	72,	158,	0,	79,	72,	157,	79,
-	9,	6,	8,	291,	364,	162,	364,	9,
-	9,	239,	9,	9,	355,	134,	20,	21,
-	9,	9,	364,	9,	9,	364,	9,	20,
-	9,	9,	38,	0,	0,	0,	38,	0,
-	0,	0,	0,	38,	0,	0,	0,	38,
-	121,	9,	121,	38,	0,	120,	38,	120,
-	9,	9,	0,	9,	9,	9,	121,	9,
-	0,	121,	9,	120,	9,	9,	120,	9,
-	9,	9,	9,	9,	0,	0,	0,	122,
-	9,	122,	9,	9,	9,	9,	9,	9,
-	9,	9,	0,	9,	9,	122,	9,	9,
-	122,	9,	9,	9,	9,	14,	0,	0,
-	0,	14,	14,	0,	14,	14,	14,	14,
-	14,	14,	14,	14,	0,	14,	14,	14,
-	14,	14,	14,	14,	14,	14,	14,	9,
-	0,	0,	0,	119,	9,	119,	9,	9,
-	9,	9,	9,	0,	9,	9,	0,	9,
-	9,	119,	9,	9,	119,	9,	9,	9,
-	9,	9,	0,	0,	0,	124,	9,	124,
-	9,	9,	9,	9,	9,	9,	9,	9,
-	0,	9,	9,	124,	9,	9,	124,	9,
-	9,	9,	9,	9,	6,	30,	238,	120,
-	0,	120,	9,	9,	0,	9,	9,	9,
-	9,	9,	6,	31,	9,	120,	9,	9,
-	120,	9,	9,	9,	9,	9,	0,	8,
-	291,	9,	9,	9,	9,	9,	9,	9,
-	9,	0,	9,	9,	6,	9,	9,	9,
-	9,	9,	9,	0,	9,	9,	9,	344,
-	344,	0,	0,	344,	344,	344,	344,	344,
-	344,	344,	344,	344,	344,	344,	344,	344,
-	344,	344,	344,	344,	344,	344,	344,	344,
-	344,	348,	348,	0,	0,	348,	0,	348,
-	348,	348,	348,	348,	348,	348,	348,	348,
-	348,	348,	348,	348,	348,	0,	348,	348,
-	348,	348,	348,	131,	0,	0,	131,	0,
-	131,	131,	131,	0,	131,	131,	131,	0,
-	131,	131,	131,	131,	131,	131,	0,	131,
-	131,	131,	131,	131,	141,	0,	0,	141,
-	0,	141,	141,	141,	0,	141,	141,	141,
-	0,	141,	141,	141,	141,	141,	141,	0,
-	141,	141,	141,	141,	141,	131,	0,	0,
-	131,	0,	131,	131,	131,	0,	131,	131,
-	131,	0,	131,	131,	131,	131,	131,	131,
-	0,	131,	131,	131,	131,	131,	141,	0,
-	0,	141,	0,	141,	141,	141,	0,	141,
-	141,	141,	0,	141,	141,	141,	141,	141,
-	141,	0,	141,	141,	141,	141,	141,	131,
-	0,	0,	131,	67,	131,	131,	131,	0,
-	131,	131,	131,	131,	131,	131,	131,	131,
-	131,	131,	485,	131,	131,	131,	131,	131,
-	141,	0,	0,	141,	0,	141,	141,	141,
-	66,	141,	141,	141,	141,	141,	141,	141,
-	141,	141,	141,	480,	141,	141,	141,	141,
-	141,	252,	0,	252,	252,	252,	0,	252,
-	252,	252,	252,	252,	252,	252,	252,	0,
-	252,	0,	252,	252,	252,	252,	150,	0,
-	0,	0,	150,	0,	150,	150,	150,	150,
-	150,	150,	150,	150,	150,	150,	150,	0,
-	150,	150,	334,	150,	150,	150,	150,	150,
-	150,	0,	0,	0,	150,	0,	150,	150,
-	150,	150,	150,	150,	150,	150,	150,	150,
-	150,	0,	150,	150,	334,	150,	150,	150,
-	150,	150,	150,	0,	0,	0,	150,	0,
-	150,	150,	150,	150,	150,	150,	150,	150,
-	150,	150,	150,	0,	150,	150,	334,	150,
-	150,	150,	150,	150,	243,	0,	0,	243,
-	243,	243,	243,	243,	243,	243,	243,	243,
-	243,	243,	243,	243,	243,	243,	243,	0,
-	243,	243,	243,	131,	0,	0,	131,	0,
-	131,	131,	131,	0,	131,	131,	131,	131,
-	131,	131,	131,	131,	131,	131,	482,	131,
-	131,	131,	131,	131,	141,	0,	0,	141,
-	0,	141,	141,	141,	0,	141,	141,	141,
-	141,	141,	141,	141,	141,	141,	141,	483,
-	141,	141,	141,	141,	141,	150,	0,	0,
-	0,	150,	0,	150,	150,	150,	150,	150,
-	150,	150,	0,	150,	150,	150,	0,	150,
-	150,	334,	0,	150,	150,	150,	150,	142,
-	0,	142,	142,	142,	142,	142,	142,	142,
-	0,	142,	142,	142,	142,	142,	142,	0,
-	142,	142,	142,	142,	0,	142,	142,	142,
-	142,	142,	142,	142,	0,	142,	142,	142,
-	142,	142,	142,	0,	142,	142,	142,	141,
-	141,	141,	141,	141,	141,	141,	141,	141,
-	141,	141,	141,	141,	141,	141,	141,	141,
-	141,	141,	141,	142,	142,	142,	142,	142,
-	142,	142,	142,	142,	142,	142,	142,	142,
-	142,	142,	142,	142,	142,	142,	142,	131,
-	131,	131,	131,	131,	131,	131,	131,	131,
-	131,	131,	131,	131,	131,	131,	131,	131,
-	131,	131,	131,	142,	28,	142,	142,	142,
-	142,	142,	142,	142,	142,	142,	142,	142,
-	142,	142,	142,	486,	142,	142,	142,	142,
-	0,	142,	142,	142,	142,	142,	142,	142,
-	142,	142,	142,	142,	142,	142,	142,	484,
-	142,	142,	142,	112,	0,	112,	0,	112,
-	0,	112,	112,	0,	112,	0,	112,	0,
-	112,	112,	112,	0,	112,	112,	0,	112,
-	126,	0,	126,	0,	112,	0,	112,	112,
-	112,	0,	112,	0,	112,	112,	126,	112,
-	128,	126,	128,	0,	112,	0,	112,	112,
-	112,	0,	112,	0,	112,	112,	128,	112,
-	305,	128,	305,	0,	112,	0,	112,	112,
-	112,	0,	112,	0,	112,	112,	305,	112,
-	306,	305,	306,	0,	112,	0,	112,	112,
-	112,	0,	112,	0,	112,	112,	306,	112,
-	0,	306,	0,	0,	112,	0,	112,	112,
-	112,	0,	112,	0,	112,	112,	0,	112,
-	0,	0,	0,	0,	112,	0,	112,	112,
-	112,	0,	112,	0,	112,	112,	0,	112,
-	0,	0,	0,	0,	112,	0,	112,	112,
-	112,	0,	112,	0,	112,	112,	0,	112,
-	0,	0,	0,	0,	112,	0,	112,	112,
-	112,	0,	112,	0,	112,	112,	0,	112,
-	0,	0,	0,	0,	112,	0,	112,	112,
-	112,	0,	112,	0,	112,	112,	0,	112,
-	0,	0,	0,	0,	112,	0,	112,	112,
-	112,	0,	112,	0,	112,	112,	0,	112,
-	0,	0,	0,	0,	112,	0,	112,	112,
-	112,	0,	112,	0,	112,	112,	0,	112,
-	0,	0,	0,	0,	112,	0,	112,	112,
-	112,	0,	112,	0,	112,	112,	0,	112,
-	0,	0,	0,	0,	112,	0,	112,	112,
-	112,	0,	112,	0,	112,	112,	0,	112,
-	0,	0,	0,	0,	112,	0,	112,	112,
-	112,	0,	112,	0,	112,	112,	0,	112,
-	0,	0,	0,	0,	112,	0,	112,	112,
-	112,	0,	112,	0,	112,	112,	0,	112,
-	0,	0,	0,	0,	112,	0,	112,	112,
-	112,	0,	112,	0,	112,	112,	0,	112,
-	0,	0,	0,	0,	112,	0,	112,	112,
-	112,	0,	112,	0,	112,	112,	0,	112,
-	0,	0,	0,	0,	112,	0,	112,	112,
-	112,	0,	112,	0,	112,	112,	0,	112,
-	0,	0,	0,	0,	112,	0,	112,	112,
-	112,	0,	112,	0,	112,	112,	0,	112,
-	0,	0,	0,	0,	112,	0,	112,	112,
-	112,	0,	112,	0,	112,	112,	0,	112,
-	0,	0,	0,	0,	112,	0,	112,	112,
-	112,	0,	112,	0,	112,	112,	0,	112,
-	0,	0,	0,	0,	112,	0,	112,	112,
-	112,	0,	112,	0,	112,	112,	0,	112,
-	0,	0,	0,	0,	112,	0,	112,	112,
-	112,	0,	112,	0,	112,	112,	0,	112,
-	0,	0,	0,	0,	112,	0,	112,	112,
-	112,	0,	112,	0,	112,	112,	0,	112,
-	0,	0,	0,	0,	112,	0,	112,	112,
-	112,	0,	112,	0,	112,	112,	0,	112,
-	0,	0,	0,	0,	112,	0,	112,	112,
-	112,	0,	112,	0,	112,	112,	0,	112,
-	0,	0,	0,	0,	112,	0,	112,	112,
-	112,	0,	112,	0,	112,	112,	0,	112,
-	0,	0,	0,	0,	112,	0,	112,	112,
-	112,	0,	112,	0,	112,	112,	0,	112,
-	0,	0,	0,	0,	112,	0,	112,	112,
-	112,	0,	112,	0,	112,	112,	0,	112,
-	0,	0,	0,	0,	112,	0,	112,	112,
-	112,	0,	112,	0,	112,	112,	0,	112,
-	0,	0,	0,	0,	112,	0,	112,	112,
-	112,	0,	112,	0,	112,	112,	0,	112,
-	0,	112,	0,	112,	112,	112,	0,	112,
-	112,	0,	112,	0,	0,	0,	0,	112,
-	0,	159,	530,	159,	0,	159,	0,	159,
-	159,	0,	159,	0,	0,	0,	0,	159,
-	0,	112,	159,	112,	0,	112,	0,	112,
-	112,	0,	112,	0,	118,	0,	118,	112,
-	0,	0,	112,	118,	0,	118,	0,	306,
-	0,	306,	118,	0,	0,	118,	306,	0,
-	306,	0,	305,	0,	305,	306,	0,	0,
-	306,	305,	0,	305,	0,	304,	0,	304,
-	305,	0,	0,	305,	304,	0,	304,	0,
-	303,	0,	303,	304,	0,	0,	304,	303,
-	0,	303,	0,	123,	0,	123,	303,	0,
-	0,	303,	123,	0,	123,	0,	121,	0,
-	121,	123,	0,	0,	123,	121,	0,	121,
-	0,	123,	0,	123,	121,	0,	0,	121,
-	123,	0,	123,	0,	125,	0,	125,	123,
-	0,	0,	123,	125,	0,	125,	0,	126,
-	0,	126,	125,	0,	0,	125,	126,	0,
-	126,	0,	127,	0,	127,	126,	0,	0,
-	126,	127,	0,	127,	0,	128,	0,	128,
-	127,	0,	0,	127,	128,	0,	128,	0,
-	0,	0,	0,	128,	0,	0,	128,	0,
-	0,	0,	0,	0,	0,	0,	0,	0,
+const unsigned short yyparser_t::yydnxt[2519] = {
+0,	384,	22,	220,	279,	41,	43,	43,
+	227,	41,	43,	43,	43,	43,	43,	43,
+	43,	112,	330,	387,	180,	43,	43,	43,
+	295,	43,	43,	439,	18,	233,	331,	118,
+	182,	118,	253,	491,	491,	491,	118,	434,
+	515,	496,	43,	41,	43,	43,	438,	41,
+	41,	34,	118,	444,	41,	98,	118,	444,
+	444,	444,	462,	41,	33,	452,	41,	118,
+	41,	434,	41,	496,	515,	98,	43,	43,
+	43,	61,	371,	2,	263,	45,	126,	45,
+	45,	418,	128,	45,	45,	45,	45,	45,
+	45,	45,	310,	345,	56,	302,	45,	45,
+	45,	384,	45,	45,	514,	514,	514,	514,
+	64,	62,	134,	323,	98,	16,	518,	514,
+	514,	514,	514,	297,	522,	45,	45,	304,
+	125,	125,	125,	125,	417,	64,	106,	381,
+	21,	202,	514,	514,	514,	514,	514,	514,
+	444,	109,	2,	268,	457,	444,	444,	458,
+	45,	45,	444,	44,	80,	80,	62,	271,
+	107,	80,	80,	80,	169,	80,	80,	80,
+	80,	80,	77,	80,	80,	201,	82,	204,
+	23,	80,	80,	80,	98,	80,	80,	474,
+	393,	138,	98,	372,	490,	490,	490,	490,
+	98,	137,	64,	57,	136,	98,	272,	116,
+	78,	80,	111,	21,	221,	66,	300,	393,
+	422,	508,	98,	492,	492,	492,	492,	118,
+	483,	117,	451,	451,	451,	451,	118,	118,
+	58,	75,	80,	80,	80,	214,	80,	213,
+	499,	98,	118,	498,	437,	98,	117,	501,
+	432,	98,	497,	36,	288,	403,	98,	118,
+	98,	118,	478,	98,	98,	499,	113,	98,
+	68,	119,	98,	98,	498,	437,	98,	94,
+	363,	501,	36,	398,	59,	161,	497,	162,
+	157,	291,	459,	279,	299,	311,	460,	361,
+	405,	321,	368,	98,	189,	119,	364,	83,
+	187,	388,	64,	49,	196,	98,	273,	200,
+	274,	276,	155,	428,	56,	98,	98,	98,
+	61,	189,	392,	392,	392,	392,	35,	64,
+	47,	476,	47,	98,	98,	98,	98,	516,
+	443,	98,	189,	98,	98,	98,	189,	189,
+	406,	98,	16,	189,	180,	98,	98,	98,
+	98,	98,	189,	98,	98,	189,	411,	189,
+	182,	189,	382,	516,	513,	513,	513,	513,
+	98,	138,	217,	217,	217,	217,	76,	513,
+	513,	513,	513,	55,	136,	217,	217,	217,
+	217,	404,	98,	117,	226,	66,	402,	493,
+	194,	285,	513,	513,	513,	513,	513,	513,
+	217,	217,	217,	217,	217,	217,	29,	29,
+	29,	29,	511,	98,	275,	117,	463,	386,
+	380,	29,	29,	29,	29,	177,	176,	393,
+	336,	431,	389,	293,	293,	293,	293,	294,
+	62,	118,	464,	98,	29,	29,	29,	29,
+	29,	29,	256,	255,	289,	259,	431,	383,
+	261,	110,	223,	436,	264,	178,	117,	257,
+	301,	242,	265,	118,	269,	98,	98,	241,
+	379,	98,	98,	377,	228,	51,	262,	17,
+	436,	260,	98,	98,	98,	98,	98,	117,
+	98,	98,	36,	184,	42,	38,	444,	98,
+	374,	373,	444,	444,	456,	98,	267,	225,
+	444,	98,	446,	446,	446,	445,	445,	445,
+	445,	376,	98,	285,	98,	286,	98,	149,
+	98,	98,	98,	64,	26,	98,	76,	2,
+	412,	296,	98,	98,	98,	98,	98,	98,
+	98,	98,	304,	52,	98,	81,	98,	98,
+	48,	98,	98,	98,	449,	449,	449,	451,
+	451,	451,	451,	98,	98,	98,	98,	98,
+	32,	98,	98,	98,	31,	53,	46,	273,
+	435,	280,	118,	155,	98,	79,	98,	118,
+	118,	287,	98,	453,	467,	98,	50,	444,
+	444,	444,	118,	435,	118,	444,	127,	118,
+	61,	433,	118,	61,	118,	511,	319,	61,
+	118,	61,	118,	118,	118,	118,	118,	185,
+	431,	118,	64,	62,	134,	118,	118,	118,
+	385,	98,	433,	319,	118,	37,	72,	298,
+	118,	118,	188,	98,	118,	431,	118,	64,
+	500,	98,	73,	98,	98,	166,	118,	98,
+	118,	455,	98,	65,	98,	118,	400,	98,
+	480,	98,	98,	98,	98,	98,	320,	98,
+	98,	98,	500,	118,	175,	98,	118,	98,
+	98,	413,	98,	98,	98,	356,	98,	98,
+	98,	98,	98,	98,	98,	98,	98,	98,
+	118,	98,	298,	98,	98,	315,	98,	118,
+	352,	98,	98,	419,	98,	193,	86,	98,
+	98,	334,	98,	98,	98,	98,	65,	98,
+	98,	98,	98,	98,	98,	98,	98,	2,
+	98,	414,	98,	472,	98,	81,	342,	98,
+	98,	98,	98,	98,	98,	98,	98,	98,
+	98,	98,	98,	312,	386,	98,	179,	339,
+	98,	191,	177,	477,	317,	98,	98,	98,
+	98,	98,	383,	98,	98,	444,	98,	203,
+	178,	444,	100,	444,	98,	98,	366,	444,
+	408,	348,	98,	98,	98,	98,	380,	98,
+	98,	347,	98,	98,	176,	98,	98,	48,
+	98,	98,	98,	98,	468,	138,	98,	98,
+	98,	98,	98,	98,	98,	98,	98,	98,
+	136,	98,	424,	98,	98,	98,	423,	340,
+	93,	42,	98,	98,	131,	98,	90,	98,
+	98,	98,	98,	98,	98,	168,	98,	26,
+	98,	163,	195,	98,	421,	98,	254,	98,
+	118,	98,	396,	98,	503,	87,	337,	346,
+	98,	98,	98,	38,	354,	98,	98,	98,
+	239,	338,	401,	98,	98,	98,	98,	98,
+	98,	98,	98,	444,	489,	98,	322,	454,
+	444,	444,	98,	98,	76,	444,	118,	362,
+	292,	98,	328,	328,	328,	165,	450,	450,
+	450,	450,	140,	140,	140,	140,	448,	448,
+	448,	448,	447,	447,	447,	447,	247,	247,
+	247,	247,	444,	98,	475,	98,	444,	444,
+	444,	98,	410,	325,	444,	379,	98,	198,
+	118,	118,	98,	262,	98,	98,	98,	118,
+	98,	487,	98,	98,	431,	98,	98,	98,
+	212,	98,	393,	325,	353,	31,	305,	98,
+	98,	27,	118,	98,	343,	27,	98,	118,
+	351,	27,	466,	98,	98,	31,	431,	118,
+	98,	98,	40,	98,	473,	98,	98,	98,
+	98,	98,	98,	98,	430,	98,	98,	98,
+	170,	306,	98,	98,	98,	98,	341,	367,
+	98,	98,	81,	236,	98,	98,	98,	98,
+	98,	98,	98,	394,	235,	98,	74,	146,
+	316,	243,	98,	98,	98,	98,	98,	479,
+	98,	98,	139,	98,	98,	395,	98,	98,
+	89,	355,	98,	98,	98,	98,	96,	98,
+	31,	98,	98,	360,	98,	98,	98,	502,
+	98,	98,	98,	141,	98,	416,	98,	98,
+	98,	98,	510,	98,	164,	377,	98,	397,
+	98,	98,	142,	260,	98,	98,	98,	98,
+	426,	98,	98,	399,	98,	98,	393,	98,
+	98,	98,	332,	98,	357,	420,	482,	98,
+	98,	98,	98,	369,	143,	98,	349,	98,
+	98,	507,	98,	98,	313,	98,	98,	98,
+	314,	98,	318,	98,	216,	407,	98,	98,
+	376,	98,	392,	392,	392,	392,	149,	374,
+	373,	372,	378,	409,	98,	267,	225,	137,
+	98,	308,	48,	135,	98,	98,	98,	98,
+	98,	36,	333,	98,	99,	98,	98,	98,
+	324,	484,	98,	98,	98,	509,	98,	98,
+	98,	98,	98,	98,	98,	335,	350,	358,
+	183,	98,	98,	98,	98,	98,	506,	98,
+	98,	98,	98,	98,	98,	151,	505,	98,
+	359,	98,	99,	95,	152,	50,	324,	98,
+	153,	98,	98,	98,	53,	46,	68,	98,
+	145,	98,	98,	488,	98,	429,	88,	481,
+	98,	425,	98,	130,	98,	98,	156,	98,
+	266,	144,	98,	98,	85,	120,	97,	18,
+	98,	231,	91,	158,	98,	98,	98,	98,
+	98,	98,	471,	504,	98,	98,	98,	470,
+	465,	230,	98,	181,	181,	181,	98,	30,
+	30,	30,	98,	229,	71,	252,	19,	62,
+	46,	14,	224,	1,	21,	22,	11,	240,
+	63,	222,	4,	246,	245,	234,	5,	6,
+	7,	8,	9,	10,	244,	82,	258,	21,
+	201,	76,	3,	205,	238,	49,	303,	15,
+	197,	18,	251,	54,	55,	250,	55,	56,
+	12,	249,	248,	232,	60,	69,	148,	26,
+	42,	38,	175,	24,	129,	277,	278,	485,
+	415,	370,	25,	290,	159,	309,	427,	160,
+	154,	365,	486,	375,	92,	469,	517,	344,
+	207,	208,	209,	132,	50,	237,	133,	74,
+	206,	210,	211,	215,	199,	27,	270,	147,
+	68,	150,	39,	62,	167,	28,	218,	219,
+	129,	61,	439,	18,	192,	13,	126,	45,
+	45,	13,	128,	45,	45,	45,	13,	13,
+	45,	45,	45,	13,	45,	297,	522,	458,
+	108,	13,	44,	118,	329,	0,	174,	118,
+	174,	118,	118,	118,	118,	118,	118,	118,
+	125,	125,	118,	118,	118,	174,	118,	118,
+	0,	118,	118,	118,	118,	13,	0,	13,
+	101,	13,	101,	13,	124,	124,	13,	13,
+	13,	13,	0,	13,	0,	13,	0,	101,
+	0,	13,	61,	64,	62,	134,	307,	273,
+	307,	61,	61,	155,	61,	61,	304,	392,
+	392,	67,	67,	61,	61,	307,	61,	61,
+	61,	67,	61,	61,	61,	105,	0,	105,
+	102,	0,	102,	61,	61,	0,	61,	61,
+	61,	123,	123,	61,	105,	0,	61,	102,
+	61,	61,	61,	61,	61,	61,	13,	104,
+	0,	104,	13,	20,	122,	122,	0,	13,
+	13,	0,	124,	124,	13,	0,	104,	61,
+	0,	0,	13,	444,	61,	444,	61,	61,
+	61,	61,	61,	61,	61,	61,	61,	0,
+	61,	61,	444,	61,	61,	61,	61,	61,
+	61,	61,	171,	0,	171,	84,	61,	84,
+	61,	61,	61,	61,	61,	0,	61,	61,
+	61,	171,	61,	61,	84,	61,	61,	61,
+	61,	61,	61,	61,	64,	49,	196,	102,
+	0,	102,	61,	61,	0,	61,	61,	61,
+	61,	61,	61,	64,	47,	61,	102,	61,
+	61,	61,	61,	61,	61,	70,	70,	70,
+	0,	70,	70,	0,	70,	70,	70,	70,
+	70,	70,	70,	70,	70,	70,	70,	70,
+	70,	70,	70,	70,	70,	70,	70,	61,
+	172,	0,	172,	103,	61,	103,	61,	61,
+	61,	61,	61,	61,	61,	61,	61,	172,
+	61,	61,	103,	61,	61,	61,	61,	61,
+	61,	61,	0,	62,	134,	61,	61,	61,
+	61,	61,	61,	61,	61,	0,	61,	61,
+	61,	64,	61,	61,	61,	61,	61,	0,
+	61,	61,	61,	291,	291,	0,	0,	291,
+	291,	291,	291,	291,	291,	291,	291,	291,
+	291,	291,	291,	291,	291,	291,	291,	291,
+	291,	291,	291,	291,	291,	99,	99,	0,
+	0,	99,	0,	99,	99,	99,	99,	99,
+	99,	99,	99,	99,	99,	99,	99,	99,
+	99,	99,	0,	99,	99,	99,	99,	186,
+	0,	186,	186,	186,	0,	186,	186,	186,
+	186,	186,	186,	186,	186,	186,	0,	186,
+	118,	186,	186,	186,	118,	0,	118,	118,
+	118,	118,	118,	118,	118,	0,	0,	118,
+	118,	118,	0,	118,	118,	0,	118,	118,
+	118,	118,	118,	0,	0,	0,	118,	0,
+	118,	118,	118,	118,	118,	118,	118,	118,
+	118,	118,	118,	118,	0,	118,	118,	287,
+	118,	118,	118,	118,	118,	0,	0,	0,
+	118,	0,	118,	118,	118,	118,	118,	118,
+	118,	118,	118,	118,	118,	118,	0,	118,
+	118,	287,	118,	118,	118,	118,	118,	0,
+	0,	0,	118,	0,	118,	118,	118,	118,
+	118,	118,	118,	118,	118,	118,	118,	118,
+	0,	118,	118,	287,	118,	118,	118,	118,
+	118,	0,	0,	0,	118,	0,	118,	118,
+	118,	118,	118,	118,	118,	118,	118,	118,
+	118,	118,	0,	118,	118,	287,	118,	118,
+	118,	118,	190,	0,	0,	190,	190,	190,
+	190,	190,	190,	190,	190,	190,	190,	190,
+	190,	190,	190,	190,	190,	190,	118,	190,
+	190,	0,	118,	0,	118,	118,	118,	118,
+	118,	118,	118,	118,	118,	118,	118,	118,
+	0,	118,	118,	287,	118,	118,	118,	118,
+	282,	0,	0,	282,	0,	282,	282,	282,
+	0,	282,	282,	282,	282,	282,	282,	282,
+	282,	282,	282,	282,	114,	282,	282,	282,
+	282,	281,	0,	0,	281,	0,	281,	281,
+	281,	0,	281,	281,	281,	281,	281,	281,
+	281,	281,	281,	281,	281,	115,	281,	281,
+	281,	281,	281,	281,	281,	281,	281,	281,
+	281,	281,	281,	281,	281,	281,	281,	281,
+	281,	281,	281,	281,	281,	281,	282,	282,
+	282,	282,	282,	282,	282,	282,	282,	282,
+	282,	282,	282,	282,	282,	282,	282,	282,
+	282,	282,	324,	0,	324,	324,	324,	324,
+	324,	324,	324,	324,	324,	324,	324,	324,
+	324,	324,	324,	0,	324,	324,	98,	0,
+	98,	0,	98,	0,	98,	98,	0,	98,
+	98,	0,	98,	0,	98,	98,	98,	0,
+	98,	98,	0,	98,	98,	0,	98,	0,
+	98,	98,	98,	0,	98,	98,	0,	98,
+	98,	0,	98,	0,	98,	98,	98,	0,
+	98,	98,	0,	98,	98,	0,	98,	0,
+	98,	98,	98,	0,	98,	98,	0,	98,
+	98,	0,	98,	0,	98,	98,	98,	0,
+	98,	98,	0,	98,	98,	0,	98,	0,
+	98,	98,	98,	0,	98,	98,	0,	98,
+	98,	0,	98,	0,	98,	98,	98,	0,
+	98,	98,	0,	98,	98,	0,	98,	0,
+	98,	98,	98,	0,	98,	98,	0,	98,
+	98,	0,	98,	0,	98,	98,	98,	0,
+	98,	98,	0,	98,	98,	0,	98,	0,
+	98,	98,	98,	0,	98,	98,	0,	98,
+	98,	0,	98,	0,	98,	98,	98,	0,
+	98,	98,	0,	98,	98,	0,	98,	0,
+	98,	98,	98,	0,	98,	98,	0,	98,
+	98,	0,	98,	0,	98,	98,	98,	0,
+	98,	98,	0,	98,	98,	0,	98,	0,
+	98,	98,	98,	0,	98,	98,	0,	98,
+	98,	0,	98,	0,	98,	98,	98,	0,
+	98,	98,	0,	98,	98,	0,	98,	0,
+	98,	98,	98,	0,	98,	98,	0,	98,
+	98,	0,	98,	0,	98,	98,	98,	0,
+	98,	98,	0,	98,	98,	0,	98,	0,
+	98,	98,	98,	0,	98,	98,	0,	98,
+	98,	0,	98,	0,	98,	98,	98,	0,
+	98,	98,	0,	98,	98,	0,	98,	0,
+	98,	98,	98,	0,	98,	98,	0,	98,
+	98,	0,	98,	0,	98,	98,	98,	0,
+	98,	98,	0,	98,	98,	0,	98,	0,
+	98,	98,	98,	0,	98,	98,	0,	98,
+	98,	0,	98,	0,	98,	98,	98,	0,
+	98,	98,	0,	98,	98,	0,	98,	0,
+	98,	98,	98,	0,	98,	98,	0,	98,
+	98,	0,	98,	0,	98,	98,	98,	0,
+	98,	98,	0,	98,	98,	0,	98,	0,
+	98,	98,	98,	0,	98,	98,	0,	98,
+	98,	0,	98,	0,	98,	98,	98,	0,
+	98,	98,	0,	98,	98,	0,	98,	0,
+	98,	98,	98,	0,	98,	98,	0,	98,
+	98,	0,	98,	0,	98,	98,	98,	0,
+	98,	98,	0,	98,	98,	0,	121,	0,
+	121,	98,	121,	0,	121,	121,	0,	121,
+	121,	0,	98,	0,	98,	121,	98,	0,
+	98,	98,	0,	98,	98,	307,	0,	307,
+	0,	98,	0,	0,	307,	0,	307,	307,
+	171,	0,	171,	0,	307,	0,	0,	171,
+	0,	171,	171,	172,	0,	172,	0,	171,
+	0,	0,	172,	0,	172,	172,	173,	0,
+	173,	0,	172,	0,	0,	173,	0,	173,
+	173,	174,	0,	174,	0,	173,	0,	0,
+	174,	0,	174,	174,	101,	0,	101,	0,
+	174,	0,	0,	101,	0,	101,	101,	102,
+	0,	102,	0,	101,	0,	0,	102,	0,
+	102,	102,	103,	0,	103,	0,	102,	0,
+	0,	103,	0,	103,	103,	104,	0,	104,
+	0,	103,	0,	0,	104,	0,	104,	104,
+	105,	0,	105,	0,	104,	0,	0,	105,
+	0,	105,	105,	444,	0,	444,	0,	105,
+	0,	0,	444,	0,	444,	444,	0,	0,
+	0,	0,	444,	0,	0,	0,	0,	0,
 	0,	0,	0,	0,	0,	0,	0,	0,
 	0,	0,	0,	0,	0,	0,	0,	0,
 	0,	0,	0,	0,	0,	0,	0,	0,
@@ -7730,466 +8006,399 @@ const int yyparser_t::yydnxt[3003] = {
 	0,	0,	0,	0,	0,	0,	0,	0,
 	0,	0,	0,	0,	0,	0,	0,	0,
 	0,	0,	0,	0,	0,	0,	0,	0,
-	0,	0,	0
+	0,	0,	0,	0,	0,	0,	0
 };
 
-const int yyparser_t::yydchk[3003] = {
-570,	418,	418,	418,	324,	569,	569,	569,
-	348,	569,	569,	569,	569,	569,	569,	569,
-	569,	569,	569,	386,	332,	569,	569,	569,
-	493,	569,	569,	331,	493,	493,	493,	493,
-	546,	546,	546,	386,	505,	546,	546,	505,
-	569,	505,	569,	569,	569,	569,	348,	569,
-	569,	434,	434,	434,	569,	546,	488,	488,
-	488,	436,	546,	569,	505,	436,	569,	436,
-	569,	505,	569,	505,	569,	330,	569,	569,
-	569,	568,	568,	568,	568,	546,	568,	568,
-	568,	385,	568,	568,	568,	568,	568,	568,
-	568,	568,	357,	335,	564,	357,	568,	568,
-	568,	385,	568,	568,	564,	564,	564,	564,
-	506,	506,	506,	487,	487,	487,	506,	564,
-	564,	564,	564,	568,	568,	568,	568,	506,
-	384,	360,	497,	495,	488,	506,	564,	495,
-	487,	335,	564,	564,	564,	564,	564,	564,
-	495,	329,	495,	433,	433,	433,	495,	568,
-	568,	568,	384,	568,	567,	567,	567,	567,
-	381,	567,	567,	567,	381,	567,	567,	567,
-	567,	567,	567,	567,	567,	432,	432,	432,
-	497,	567,	567,	567,	497,	567,	567,	358,
-	536,	536,	536,	545,	360,	497,	503,	497,
-	503,	545,	358,	497,	536,	503,	567,	567,
-	567,	567,	566,	566,	566,	536,	566,	382,
-	536,	503,	435,	364,	383,	503,	435,	536,
-	435,	382,	566,	566,	566,	566,	503,	566,
-	565,	566,	567,	567,	567,	376,	567,	364,
-	566,	545,	491,	566,	566,	545,	383,	566,
-	491,	376,	566,	502,	566,	502,	545,	377,
-	545,	491,	502,	377,	545,	566,	565,	328,
-	545,	565,	327,	380,	566,	566,	502,	379,
-	565,	566,	502,	565,	380,	565,	566,	565,
-	379,	424,	565,	502,	565,	565,	565,	565,
-	565,	565,	565,	563,	424,	565,	565,	565,
-	344,	344,	496,	378,	501,	424,	501,	563,
-	563,	563,	563,	501,	378,	535,	350,	491,
-	375,	535,	563,	563,	563,	563,	535,	501,
-	350,	535,	535,	501,	375,	504,	535,	562,
-	504,	563,	504,	535,	501,	563,	563,	563,
-	563,	563,	563,	562,	562,	562,	562,	374,
-	496,	486,	486,	326,	496,	504,	562,	562,
-	562,	562,	504,	374,	504,	496,	426,	496,
-	431,	431,	431,	496,	426,	562,	325,	561,
-	486,	562,	562,	562,	562,	562,	562,	561,
-	561,	561,	561,	372,	474,	534,	342,	474,
-	342,	534,	561,	561,	561,	561,	534,	372,
-	369,	534,	534,	474,	486,	355,	534,	560,
-	474,	561,	355,	534,	369,	561,	561,	561,
-	561,	561,	561,	560,	560,	560,	560,	323,
-	366,	533,	430,	430,	430,	533,	560,	560,
-	560,	560,	533,	426,	366,	533,	533,	472,
-	472,	472,	533,	559,	373,	560,	322,	533,
-	373,	560,	560,	560,	560,	560,	560,	559,
-	559,	559,	559,	558,	368,	532,	321,	558,
-	368,	532,	559,	559,	559,	559,	532,	558,
-	558,	532,	532,	320,	490,	500,	532,	500,
-	558,	559,	490,	532,	500,	559,	559,	559,
-	559,	559,	559,	490,	349,	472,	558,	531,
-	500,	558,	319,	531,	500,	558,	558,	349,
-	531,	371,	558,	531,	531,	500,	370,	318,
-	531,	558,	371,	557,	558,	531,	558,	370,
-	558,	361,	558,	557,	557,	557,	557,	489,
-	317,	556,	556,	556,	556,	361,	557,	557,
-	557,	557,	468,	316,	556,	556,	556,	556,
-	315,	490,	468,	468,	468,	438,	438,	438,
-	438,	557,	557,	557,	557,	557,	557,	556,
-	556,	556,	556,	556,	556,	555,	555,	555,
-	555,	314,	489,	554,	554,	554,	554,	354,
-	555,	555,	555,	555,	425,	489,	554,	554,
-	554,	554,	425,	354,	498,	351,	489,	498,
-	339,	498,	313,	555,	555,	555,	555,	555,
-	555,	554,	554,	554,	554,	554,	554,	553,
-	553,	553,	351,	553,	498,	485,	485,	553,
-	339,	498,	312,	498,	499,	365,	499,	553,
-	553,	553,	553,	499,	553,	553,	365,	553,
-	552,	552,	552,	552,	485,	311,	552,	499,
-	484,	484,	552,	499,	310,	423,	552,	309,
-	552,	425,	552,	423,	499,	552,	551,	551,
-	551,	551,	550,	550,	550,	550,	308,	484,
-	485,	429,	429,	429,	551,	450,	367,	551,
-	550,	307,	367,	550,	551,	450,	450,	450,
-	550,	549,	549,	549,	549,	363,	544,	353,
-	306,	551,	475,	484,	544,	550,	363,	549,
-	551,	475,	549,	353,	550,	475,	551,	549,
-	475,	305,	550,	543,	548,	548,	548,	548,
-	304,	543,	423,	362,	549,	547,	547,	547,
-	547,	542,	548,	549,	362,	548,	473,	542,
-	347,	549,	548,	547,	544,	473,	547,	541,
-	544,	473,	540,	547,	473,	541,	303,	548,
-	540,	544,	408,	544,	347,	302,	548,	544,
-	547,	543,	359,	544,	548,	543,	359,	547,
-	483,	483,	352,	539,	538,	547,	543,	542,
-	543,	539,	538,	542,	543,	481,	352,	481,
-	543,	301,	481,	408,	542,	541,	542,	483,
-	540,	541,	542,	408,	540,	537,	542,	481,
-	300,	299,	541,	537,	541,	540,	298,	540,
-	541,	356,	494,	540,	541,	356,	494,	540,
-	346,	539,	538,	483,	346,	539,	538,	494,
-	297,	494,	482,	482,	419,	494,	539,	538,
-	539,	538,	419,	343,	539,	538,	407,	417,
-	539,	538,	530,	537,	343,	417,	530,	537,
-	529,	482,	296,	530,	529,	295,	530,	530,
-	537,	529,	537,	530,	529,	529,	537,	528,
-	530,	529,	537,	528,	416,	527,	529,	407,
-	528,	527,	416,	528,	528,	482,	527,	407,
-	528,	527,	527,	526,	294,	528,	527,	526,
-	413,	525,	341,	527,	526,	525,	413,	526,
-	526,	419,	525,	341,	526,	525,	525,	524,
-	293,	526,	525,	524,	417,	523,	345,	525,
-	524,	523,	345,	524,	524,	292,	523,	291,
-	524,	523,	523,	522,	290,	524,	523,	522,
-	412,	521,	340,	523,	522,	521,	412,	522,
-	522,	416,	521,	340,	522,	521,	521,	520,
-	289,	522,	521,	520,	411,	519,	336,	521,
-	520,	519,	411,	520,	520,	413,	519,	336,
-	520,	519,	519,	518,	288,	520,	519,	518,
-	409,	517,	334,	519,	518,	517,	409,	518,
-	518,	287,	517,	286,	518,	517,	517,	516,
-	285,	518,	517,	516,	284,	515,	333,	517,
-	516,	515,	283,	516,	516,	412,	515,	282,
-	516,	515,	515,	514,	281,	516,	515,	514,
-	334,	513,	280,	515,	514,	513,	279,	514,
-	514,	411,	513,	278,	514,	513,	513,	512,
-	277,	514,	513,	512,	333,	511,	276,	513,
-	512,	511,	275,	512,	512,	409,	511,	274,
-	512,	511,	511,	510,	273,	512,	511,	510,
-	272,	509,	271,	511,	510,	509,	270,	510,
-	510,	269,	509,	268,	510,	509,	509,	508,
-	492,	510,	509,	508,	492,	507,	267,	509,
-	508,	507,	266,	508,	508,	492,	507,	492,
-	508,	507,	507,	492,	422,	508,	507,	480,
-	480,	338,	479,	507,	479,	337,	478,	479,
-	478,	265,	477,	478,	477,	338,	476,	477,
-	476,	337,	471,	476,	479,	471,	480,	470,
-	478,	264,	469,	263,	477,	469,	470,	422,
-	476,	471,	470,	262,	467,	470,	471,	467,
-	465,	469,	261,	465,	260,	259,	469,	466,
-	422,	463,	480,	467,	463,	258,	466,	465,
-	467,	464,	466,	462,	465,	466,	464,	464,
-	463,	461,	462,	464,	257,	463,	462,	460,
-	461,	462,	256,	255,	461,	254,	460,	461,
-	253,	459,	460,	458,	252,	460,	459,	459,
-	406,	456,	458,	459,	456,	457,	458,	251,
-	250,	458,	457,	457,	455,	249,	454,	457,
-	456,	454,	248,	455,	453,	456,	453,	455,
-	452,	453,	455,	452,	451,	454,	247,	451,
-	421,	406,	454,	449,	246,	447,	453,	452,
-	447,	406,	449,	451,	452,	448,	449,	444,
-	451,	449,	448,	448,	447,	446,	444,	448,
-	446,	447,	444,	445,	420,	444,	445,	245,
-	443,	244,	442,	421,	446,	442,	243,	443,
-	242,	446,	445,	443,	441,	440,	443,	445,
-	440,	442,	439,	441,	421,	241,	442,	441,
-	405,	439,	441,	404,	440,	439,	437,	420,
-	439,	440,	403,	437,	437,	428,	428,	428,
-	437,	427,	427,	427,	415,	415,	415,	402,
-	420,	414,	414,	414,	410,	410,	410,	394,
-	401,	405,	400,	399,	404,	398,	397,	396,
-	240,	405,	239,	403,	404,	390,	390,	390,
-	395,	393,	238,	403,	392,	391,	237,	236,
-	402,	389,	389,	389,	388,	388,	388,	235,
-	402,	401,	394,	400,	399,	234,	398,	397,
-	396,	401,	233,	400,	399,	232,	398,	397,
-	396,	395,	393,	394,	231,	392,	391,	230,
-	229,	395,	393,	228,	227,	392,	391,	387,
-	387,	387,	226,	225,	224,	223,	222,	221,
-	220,	219,	218,	217,	216,	215,	214,	213,
-	212,	211,	210,	209,	208,	207,	206,	205,
-	204,	203,	202,	201,	200,	199,	198,	197,
-	196,	195,	194,	193,	192,	191,	190,	189,
-	188,	187,	186,	185,	184,	183,	182,	181,
-	180,	179,	178,	177,	176,	175,	174,	173,
-	172,	171,	170,	169,	168,	167,	166,	666,
-	666,	666,	666,	666,	666,	666,	666,	666,
-	666,	666,	666,	666,	666,	666,	666,	666,
-	666,	666,	666,	666,	666,	666,	666,	666,
-	666,	665,	574,	573,	589,	665,	589,	665,
-	665,	665,	665,	665,	665,	665,	572,	665,
-	571,	665,	589,	665,	665,	589,	665,	665,
-	665,	665,	665,	664,	638,	664,	664,	664,
-	638,	664,	664,	576,	664,	638,	664,	575,
-	664,	638,	576,	664,	664,	638,	575,	664,
-	663,	663,	663,	663,	663,	663,	663,	663,
-	663,	663,	663,	663,	663,	663,	663,	663,
-	663,	663,	663,	663,	663,	663,	663,	663,
-	663,	663,	662,	662,	662,	662,	662,	662,
-	662,	662,	662,	662,	662,	662,	662,	662,
-	581,	661,	581,	662,	662,	661,	662,	661,
-	661,	661,	661,	661,	661,	661,	581,	661,
-	661,	581,	661,	661,	661,	661,	661,	661,
-	661,	661,	661,	660,	660,	660,	660,	660,
-	660,	660,	660,	660,	660,	660,	660,	660,
-	660,	660,	660,	660,	660,	660,	660,	660,
-	660,	660,	660,	660,	660,	659,	659,	659,
-	659,	659,	659,	659,	659,	659,	659,	659,
-	659,	659,	659,	659,	659,	659,	659,	659,
-	659,	659,	659,	659,	659,	659,	659,	658,
-	658,	658,	658,	658,	658,	658,	658,	658,
-	658,	658,	658,	658,	658,	658,	658,	658,
-	658,	658,	658,	658,	658,	658,	658,	658,
-	658,	657,	657,	657,	657,	657,	657,	657,
-	657,	657,	657,	657,	657,	657,	657,	657,
-	657,	657,	657,	657,	657,	657,	657,	657,
-	657,	657,	657,	656,	656,	656,	656,	656,
-	656,	656,	656,	656,	656,	656,	656,	656,
-	656,	656,	656,	656,	656,	656,	656,	656,
-	656,	656,	656,	656,	656,	655,	655,	655,
-	655,	655,	655,	655,	655,	655,	655,	655,
-	655,	655,	655,	655,	655,	655,	655,	655,
-	655,	655,	655,	655,	655,	655,	655,	654,
-	654,	654,	654,	654,	654,	654,	654,	654,
-	654,	654,	654,	654,	654,	654,	654,	654,
-	654,	654,	654,	654,	654,	654,	654,	654,
-	654,	653,	653,	653,	653,	653,	653,	653,
-	653,	653,	653,	653,	653,	653,	653,	653,
-	653,	653,	653,	653,	653,	653,	653,	653,
-	653,	653,	653,	652,	652,	652,	652,	652,
-	652,	652,	652,	652,	652,	652,	652,	652,
-	652,	652,	652,	652,	652,	652,	652,	652,
-	652,	652,	652,	652,	651,	651,	651,	651,
-	651,	651,	651,	651,	651,	651,	651,	651,
-	651,	651,	651,	651,	651,	651,	651,	651,
-	651,	651,	651,	651,	651,	650,	650,	650,
-	650,	650,	650,	650,	650,	650,	650,	650,
-	650,	650,	650,	650,	650,	650,	650,	650,
-	650,	650,	650,	650,	650,	650,	649,	649,
-	649,	649,	649,	649,	649,	649,	649,	649,
-	649,	649,	649,	649,	649,	649,	649,	649,
-	649,	649,	649,	649,	649,	649,	649,	648,
-	648,	648,	648,	648,	648,	648,	648,	648,
-	648,	648,	648,	648,	648,	648,	648,	648,
-	648,	648,	648,	648,	648,	648,	648,	648,
-	647,	647,	647,	647,	647,	647,	647,	647,
-	647,	647,	647,	647,	647,	647,	647,	647,
-	647,	647,	647,	647,	647,	647,	647,	647,
-	647,	646,	646,	646,	646,	646,	646,	646,
-	646,	646,	646,	646,	646,	646,	646,	646,
-	646,	646,	646,	646,	646,	646,	645,	645,
-	645,	645,	645,	645,	645,	645,	645,	645,
-	645,	645,	645,	645,	645,	645,	645,	645,
-	645,	645,	645,	645,	645,	645,	645,	645,
-	644,	644,	644,	644,	644,	644,	644,	644,
-	644,	644,	644,	644,	644,	644,	644,	644,
-	644,	644,	644,	644,	644,	644,	644,	644,
-	644,	644,	643,	643,	643,	643,	643,	643,
-	643,	643,	643,	643,	643,	643,	643,	643,
-	643,	643,	643,	643,	643,	643,	643,	643,
-	643,	643,	643,	643,	642,	642,	642,	642,
-	642,	642,	642,	642,	642,	642,	642,	642,
-	642,	642,	642,	642,	642,	642,	642,	642,
-	642,	642,	642,	641,	641,	641,	641,	641,
-	641,	641,	641,	641,	641,	641,	641,	641,
-	641,	641,	641,	641,	641,	641,	641,	641,
-	641,	641,	641,	641,	640,	640,	640,	640,
-	640,	640,	640,	640,	640,	640,	640,	640,
-	640,	640,	640,	640,	640,	640,	640,	640,
-	640,	640,	640,	640,	640,	639,	639,	639,
-	639,	639,	639,	639,	639,	639,	639,	639,
-	639,	639,	639,	639,	639,	639,	639,	639,
-	639,	639,	639,	639,	639,	639,	639,	637,
-	637,	637,	637,	637,	637,	637,	637,	637,
-	637,	637,	637,	637,	637,	637,	637,	637,
-	637,	637,	637,	636,	636,	636,	636,	636,
-	636,	636,	636,	636,	636,	636,	636,	636,
-	636,	636,	636,	636,	636,	636,	636,	635,
-	635,	635,	635,	635,	635,	635,	635,	635,
-	635,	635,	635,	635,	635,	635,	635,	635,
-	635,	635,	635,	634,	634,	634,	634,	634,
-	634,	634,	634,	634,	634,	634,	634,	634,
-	634,	634,	634,	634,	634,	634,	634,	633,
-	633,	633,	633,	633,	633,	633,	633,	633,
-	633,	633,	633,	633,	633,	633,	633,	633,
-	633,	633,	633,	632,	632,	632,	632,	632,
-	632,	632,	632,	632,	632,	632,	632,	632,
-	632,	632,	632,	632,	632,	632,	632,	631,
-	631,	631,	631,	631,	631,	631,	631,	631,
-	631,	631,	631,	631,	631,	631,	631,	631,
-	631,	631,	631,	630,	630,	630,	630,	630,
-	630,	630,	630,	630,	630,	630,	629,	630,
-	629,	630,	629,	629,	629,	629,	629,	629,
-	580,	629,	580,	629,	629,	629,	628,	629,
-	628,	628,	628,	628,	628,	628,	580,	628,
-	579,	580,	579,	628,	628,	628,	627,	628,
-	627,	627,	627,	627,	627,	627,	579,	627,
-	578,	579,	578,	627,	627,	627,	626,	627,
-	626,	626,	626,	626,	626,	626,	578,	626,
-	577,	578,	577,	626,	626,	626,	625,	626,
-	625,	625,	625,	625,	625,	625,	577,	625,
-	625,	577,	625,	625,	625,	625,	624,	625,
-	624,	624,	624,	624,	624,	624,	624,	624,
-	624,	624,	624,	624,	624,	624,	623,	624,
-	623,	623,	623,	623,	623,	623,	623,	623,
-	623,	623,	623,	623,	623,	623,	622,	623,
-	622,	622,	622,	622,	622,	622,	622,	622,
-	622,	622,	622,	622,	622,	622,	621,	622,
-	621,	621,	621,	621,	621,	621,	621,	621,
-	621,	621,	621,	621,	621,	621,	620,	621,
-	620,	620,	620,	620,	620,	620,	620,	620,
-	620,	620,	620,	620,	620,	620,	619,	620,
-	619,	619,	619,	619,	619,	619,	619,	619,
-	619,	619,	619,	619,	619,	619,	618,	619,
-	618,	618,	618,	618,	618,	618,	618,	618,
-	618,	618,	618,	618,	618,	618,	617,	618,
-	617,	617,	617,	617,	617,	617,	617,	617,
-	617,	617,	617,	617,	617,	617,	616,	617,
-	616,	616,	616,	616,	616,	616,	616,	616,
-	616,	616,	616,	616,	616,	616,	615,	616,
-	615,	615,	615,	615,	615,	615,	615,	615,
-	615,	615,	615,	615,	615,	615,	614,	615,
-	614,	614,	614,	614,	614,	614,	614,	614,
-	614,	614,	614,	614,	614,	614,	613,	614,
-	613,	613,	613,	613,	613,	613,	613,	613,
-	613,	613,	613,	613,	613,	613,	612,	613,
-	612,	612,	612,	612,	612,	612,	612,	612,
-	612,	612,	612,	612,	612,	612,	611,	612,
-	611,	611,	611,	611,	611,	611,	611,	611,
-	611,	611,	611,	611,	611,	611,	610,	611,
-	610,	610,	610,	610,	610,	610,	610,	610,
-	610,	610,	610,	610,	610,	610,	609,	610,
-	609,	609,	609,	609,	609,	609,	609,	609,
-	609,	609,	609,	609,	609,	609,	608,	609,
-	608,	608,	608,	608,	608,	608,	608,	608,
-	608,	608,	608,	608,	608,	608,	607,	608,
-	607,	607,	607,	607,	607,	607,	607,	607,
-	607,	607,	607,	607,	607,	607,	606,	607,
+const unsigned short yyparser_t::yydchk[2519] = {
+523,	384,	384,	384,	279,	522,	522,	522,
+	327,	522,	522,	522,	522,	522,	522,	522,
+	522,	522,	522,	284,	302,	522,	522,	522,
+	327,	522,	522,	439,	439,	439,	458,	501,
+	302,	501,	458,	458,	458,	458,	501,	501,
+	522,	325,	522,	522,	522,	522,	283,	522,
+	522,	282,	501,	457,	522,	369,	501,	457,
+	457,	457,	369,	522,	281,	457,	522,	501,
+	522,	501,	522,	325,	522,	369,	522,	522,
+	522,	521,	521,	521,	521,	326,	521,	521,
+	521,	321,	521,	521,	521,	521,	521,	521,
+	521,	521,	321,	322,	516,	326,	521,	521,
+	521,	439,	521,	521,	516,	516,	516,	516,
+	494,	494,	494,	322,	312,	493,	494,	516,
+	516,	516,	516,	521,	521,	521,	521,	494,
+	493,	493,	493,	493,	312,	494,	493,	381,
+	381,	381,	516,	516,	516,	516,	516,	516,
+	456,	371,	371,	371,	456,	456,	456,	521,
+	521,	521,	456,	521,	520,	520,	520,	520,
+	280,	520,	520,	520,	323,	520,	520,	520,
+	520,	520,	520,	520,	520,	440,	440,	440,
+	278,	520,	520,	520,	367,	520,	520,	367,
+	492,	387,	367,	510,	492,	492,	492,	492,
+	364,	510,	440,	277,	387,	364,	520,	520,
+	520,	520,	519,	519,	519,	387,	519,	491,
+	364,	317,	317,	491,	491,	491,	491,	500,
+	323,	500,	519,	519,	519,	519,	500,	500,
+	518,	519,	520,	520,	520,	292,	520,	292,
+	519,	510,	500,	519,	519,	510,	500,	519,
+	389,	389,	519,	492,	519,	389,	510,	500,
+	510,	500,	314,	314,	510,	519,	518,	428,
+	510,	518,	428,	318,	519,	519,	428,	428,
+	518,	519,	491,	518,	304,	518,	519,	518,
+	318,	304,	518,	479,	518,	518,	518,	518,
+	518,	518,	518,	489,	517,	518,	518,	518,
+	517,	442,	512,	512,	512,	429,	512,	442,
+	517,	517,	512,	429,	276,	429,	488,	429,
+	442,	517,	512,	512,	512,	512,	438,	512,
+	512,	432,	512,	316,	489,	432,	489,	517,
+	489,	479,	517,	489,	432,	479,	517,	517,
+	316,	432,	275,	517,	295,	489,	479,	488,
+	479,	488,	517,	488,	479,	517,	488,	517,
+	295,	517,	320,	517,	515,	515,	515,	515,
+	488,	438,	514,	514,	514,	514,	442,	515,
+	515,	515,	515,	274,	438,	514,	514,	514,
+	514,	385,	385,	319,	461,	438,	385,	461,
+	461,	273,	515,	515,	515,	515,	515,	515,
+	514,	514,	514,	514,	514,	514,	513,	513,
+	513,	513,	272,	315,	461,	319,	320,	509,
+	508,	513,	513,	513,	513,	509,	508,	490,
+	315,	436,	305,	490,	490,	490,	490,	461,
+	271,	436,	313,	313,	513,	513,	513,	513,
+	513,	513,	511,	511,	511,	511,	436,	507,
+	511,	388,	270,	437,	511,	507,	437,	388,
+	511,	303,	511,	436,	511,	509,	508,	511,
+	506,	509,	508,	505,	303,	324,	506,	300,
+	437,	505,	509,	508,	509,	508,	305,	437,
+	509,	508,	490,	269,	509,	508,	455,	487,
+	504,	503,	455,	455,	455,	507,	504,	503,
+	455,	507,	393,	393,	393,	450,	450,	450,
+	450,	502,	507,	324,	507,	300,	506,	502,
+	507,	505,	506,	441,	507,	505,	388,	268,
+	487,	441,	487,	506,	487,	506,	505,	487,
+	505,	506,	441,	267,	505,	506,	504,	503,
+	505,	487,	504,	503,	331,	331,	331,	451,
+	451,	451,	451,	504,	503,	504,	503,	502,
+	393,	504,	503,	502,	450,	504,	503,	391,
+	499,	294,	499,	391,	502,	391,	502,	499,
+	499,	451,	502,	454,	311,	311,	502,	454,
+	454,	454,	498,	499,	498,	454,	294,	499,
+	441,	498,	498,	390,	497,	297,	497,	390,
+	499,	390,	499,	497,	497,	498,	496,	266,
+	496,	498,	495,	495,	495,	496,	496,	497,
+	486,	485,	498,	497,	498,	297,	495,	307,
+	434,	496,	265,	368,	497,	496,	497,	495,
+	434,	368,	495,	484,	483,	368,	496,	420,
+	496,	495,	420,	307,	482,	434,	420,	420,
+	308,	486,	485,	486,	485,	486,	485,	481,
+	486,	485,	434,	431,	477,	308,	431,	480,
+	478,	306,	486,	485,	484,	483,	484,	483,
+	484,	483,	306,	484,	483,	482,	299,	482,
+	431,	482,	298,	476,	482,	484,	483,	431,
+	481,	475,	481,	299,	481,	264,	482,	481,
+	480,	478,	480,	478,	480,	478,	298,	480,
+	478,	481,	477,	474,	473,	366,	477,	263,
+	366,	480,	478,	366,	476,	262,	476,	477,
+	476,	477,	475,	476,	475,	477,	475,	472,
+	471,	475,	382,	382,	386,	476,	301,	382,
+	470,	301,	386,	475,	474,	473,	474,	473,
+	474,	473,	383,	474,	473,	453,	469,	261,
+	383,	453,	453,	453,	468,	474,	473,	453,
+	472,	471,	472,	471,	472,	471,	380,	472,
+	471,	470,	467,	470,	380,	470,	417,	260,
+	470,	472,	471,	466,	417,	296,	417,	469,
+	417,	469,	470,	469,	465,	468,	469,	468,
+	296,	468,	378,	378,	468,	464,	460,	378,
+	469,	386,	460,	467,	259,	467,	468,	467,
+	463,	462,	467,	460,	466,	460,	466,	383,
+	466,	460,	289,	466,	467,	465,	289,	465,
+	288,	465,	375,	375,	465,	466,	464,	375,
+	464,	357,	464,	380,	357,	464,	465,	357,
+	258,	463,	462,	463,	462,	463,	462,	464,
+	463,	462,	459,	452,	310,	310,	459,	452,
+	452,	452,	463,	462,	257,	452,	288,	459,
+	256,	459,	330,	330,	330,	459,	449,	449,
+	449,	449,	448,	448,	448,	448,	447,	447,
+	447,	447,	446,	446,	446,	446,	445,	445,
+	445,	445,	444,	309,	309,	443,	444,	444,
+	444,	443,	430,	435,	444,	379,	430,	255,
+	435,	287,	443,	379,	443,	430,	419,	433,
+	443,	419,	430,	427,	433,	419,	419,	427,
+	254,	356,	253,	435,	356,	449,	427,	356,
+	426,	448,	435,	427,	426,	447,	425,	433,
+	424,	446,	425,	426,	424,	445,	433,	287,
+	426,	425,	252,	424,	363,	423,	425,	422,
+	424,	423,	363,	422,	418,	421,	363,	418,
+	423,	421,	422,	418,	418,	423,	416,	422,
+	421,	415,	379,	251,	416,	421,	416,	415,
+	416,	415,	414,	415,	250,	413,	291,	291,
+	414,	249,	414,	413,	414,	413,	412,	413,
+	411,	412,	248,	411,	410,	412,	412,	411,
+	411,	409,	410,	408,	410,	409,	410,	407,
+	247,	408,	407,	408,	409,	408,	407,	407,
+	406,	409,	290,	246,	405,	404,	406,	405,
+	406,	404,	406,	405,	405,	377,	403,	290,
+	404,	402,	245,	377,	403,	404,	403,	402,
+	403,	402,	401,	402,	400,	401,	293,	400,
+	399,	401,	401,	400,	400,	398,	399,	397,
+	399,	398,	399,	370,	244,	397,	396,	397,
+	398,	397,	396,	395,	360,	398,	395,	394,
+	359,	396,	395,	395,	243,	394,	396,	394,
+	376,	394,	392,	392,	392,	392,	376,	374,
+	373,	372,	353,	365,	365,	374,	373,	372,
+	365,	362,	377,	242,	361,	352,	370,	362,
+	350,	293,	361,	362,	286,	370,	361,	360,
+	285,	358,	355,	359,	345,	355,	360,	358,
+	355,	354,	359,	358,	354,	351,	349,	354,
+	241,	348,	343,	351,	349,	353,	348,	351,
+	349,	347,	342,	341,	353,	240,	347,	335,
+	352,	348,	286,	350,	239,	376,	285,	352,
+	238,	347,	350,	346,	374,	373,	372,	345,
+	237,	346,	344,	333,	340,	346,	345,	344,
+	333,	339,	340,	236,	339,	343,	340,	339,
+	235,	234,	344,	333,	343,	342,	341,	233,
+	338,	232,	335,	338,	342,	341,	338,	337,
+	336,	335,	337,	336,	334,	337,	336,	334,
+	332,	231,	334,	329,	329,	329,	332,	328,
+	328,	328,	332,	230,	229,	228,	227,	226,
+	225,	224,	223,	222,	221,	220,	219,	218,
+	217,	216,	215,	214,	213,	212,	211,	210,
+	209,	208,	207,	206,	205,	204,	203,	202,
+	201,	200,	199,	198,	197,	196,	195,	194,
+	193,	192,	191,	190,	189,	188,	187,	186,
+	185,	184,	183,	182,	181,	180,	179,	178,
+	177,	176,	175,	174,	173,	172,	171,	170,
+	169,	168,	167,	166,	165,	164,	163,	162,
+	161,	160,	159,	158,	157,	156,	155,	154,
+	153,	152,	151,	150,	149,	148,	147,	146,
+	145,	144,	143,	142,	141,	140,	139,	138,
+	137,	136,	135,	134,	133,	132,	131,	130,
+	129,	606,	606,	606,	606,	606,	606,	606,
 	606,	606,	606,	606,	606,	606,	606,	606,
-	606,	606,	606,	606,	606,	606,	605,	606,
-	605,	605,	605,	605,	605,	605,	605,	605,
-	605,	605,	605,	605,	605,	605,	604,	605,
-	604,	604,	604,	604,	604,	604,	604,	604,
-	604,	604,	604,	604,	604,	604,	603,	604,
+	606,	606,	606,	606,	606,	606,	606,	606,
+	606,	606,	606,	605,	528,	605,	541,	605,
+	541,	605,	605,	605,	605,	605,	605,	605,
+	527,	527,	605,	605,	605,	541,	605,	605,
+	605,	605,	605,	605,	605,	604,	604,	582,
+	534,	604,	534,	582,	526,	526,	604,	604,
+	582,	582,	604,	604,	604,	582,	604,	534,
+	604,	604,	603,	603,	603,	603,	603,	603,
+	603,	603,	603,	603,	603,	603,	603,	603,
 	603,	603,	603,	603,	603,	603,	603,	603,
-	603,	603,	603,	603,	603,	603,	602,	603,
+	603,	603,	603,	603,	602,	533,	602,	533,
 	602,	602,	602,	602,	602,	602,	602,	602,
-	602,	602,	602,	602,	602,	602,	601,	602,
-	601,	601,	601,	601,	601,	601,	601,	601,
-	601,	601,	601,	601,	601,	601,	600,	601,
+	602,	525,	525,	602,	533,	602,	602,	602,
+	602,	602,	602,	602,	602,	602,	601,	532,
+	601,	532,	601,	529,	524,	524,	601,	601,
+	601,	601,	529,	529,	601,	601,	532,	600,
+	601,	601,	601,	600,	600,	600,	600,	600,
+	600,	600,	600,	600,	600,	600,	600,	600,
 	600,	600,	600,	600,	600,	600,	600,	600,
-	600,	600,	600,	600,	600,	600,	599,	600,
+	600,	599,	531,	599,	531,	599,	599,	599,
 	599,	599,	599,	599,	599,	599,	599,	599,
-	599,	599,	599,	599,	599,	599,	598,	599,
+	599,	531,	599,	599,	599,	599,	599,	599,
+	599,	599,	599,	598,	598,	598,	598,	598,
 	598,	598,	598,	598,	598,	598,	598,	598,
-	598,	597,	598,	597,	598,	597,	597,	597,
+	598,	598,	598,	598,	598,	598,	598,	598,
+	598,	598,	598,	598,	598,	597,	597,	597,
+	597,	597,	597,	597,	597,	597,	597,	597,
 	597,	597,	597,	597,	597,	597,	597,	597,
-	597,	596,	597,	596,	596,	596,	596,	596,
+	597,	597,	597,	597,	597,	597,	597,	596,
+	530,	596,	530,	596,	596,	596,	596,	596,
+	596,	596,	596,	596,	596,	596,	596,	530,
 	596,	596,	596,	596,	596,	596,	596,	596,
-	596,	595,	596,	595,	595,	595,	595,	595,
-	595,	595,	595,	595,	594,	595,	594,	595,
-	595,	595,	595,	594,	594,	594,	594,	593,
-	594,	593,	594,	594,	594,	594,	593,	593,
-	593,	593,	592,	593,	592,	593,	593,	593,
-	593,	592,	592,	592,	592,	591,	592,	591,
-	592,	592,	592,	592,	591,	591,	591,	591,
-	590,	591,	590,	591,	591,	591,	591,	590,
-	590,	590,	590,	588,	590,	588,	590,	590,
-	590,	590,	588,	588,	588,	588,	587,	588,
-	587,	588,	588,	588,	588,	587,	587,	587,
-	587,	586,	587,	586,	587,	587,	587,	587,
-	586,	586,	586,	586,	585,	586,	585,	586,
-	586,	586,	586,	585,	585,	585,	585,	584,
-	585,	584,	585,	585,	585,	585,	584,	584,
-	584,	584,	583,	584,	583,	584,	584,	584,
-	584,	583,	583,	583,	583,	582,	583,	582,
-	583,	583,	583,	583,	582,	582,	582,	582,
-	582,	582,	582,	582,	582,	582,	582,	570,
-	570,	570,	570,	570,	570,	570,	570,	570,
-	570,	570,	570,	570,	570,	570,	570,	570,
-	570,	570,	570,	570,	570,	570,	570,	570,
-	570,	570,	570,	570,	570,	570,	570,	570,
-	570,	570,	570,	570,	570,	570,	570,	570,
-	570,	570,	570,	570,	570,	570,	570,	570,
-	570,	570,	570,	570,	570,	570,	570,	570,
-	570,	570,	570,	570,	570,	570,	570,	570,
-	570,	570,	570,	570,	570,	570,	570,	570,
-	570,	570,	570
+	596,	595,	595,	595,	595,	595,	595,	595,
+	595,	595,	595,	595,	595,	595,	595,	595,
+	595,	595,	595,	595,	595,	595,	595,	595,
+	595,	595,	595,	594,	594,	594,	594,	594,
+	594,	594,	594,	594,	594,	594,	594,	594,
+	594,	594,	594,	594,	594,	594,	594,	594,
+	594,	594,	594,	594,	594,	593,	593,	593,
+	593,	593,	593,	593,	593,	593,	593,	593,
+	593,	593,	593,	593,	593,	593,	593,	593,
+	593,	593,	593,	593,	593,	593,	593,	592,
+	592,	592,	592,	592,	592,	592,	592,	592,
+	592,	592,	592,	592,	592,	592,	592,	592,
+	591,	592,	592,	592,	591,	591,	591,	591,
+	591,	591,	591,	591,	591,	591,	591,	591,
+	591,	591,	591,	591,	591,	591,	591,	591,
+	591,	591,	590,	590,	590,	590,	590,	590,
+	590,	590,	590,	590,	590,	590,	590,	590,
+	590,	590,	590,	590,	590,	590,	590,	590,
+	590,	590,	590,	590,	589,	589,	589,	589,
+	589,	589,	589,	589,	589,	589,	589,	589,
+	589,	589,	589,	589,	589,	589,	589,	589,
+	589,	589,	589,	589,	589,	589,	588,	588,
+	588,	588,	588,	588,	588,	588,	588,	588,
+	588,	588,	588,	588,	588,	588,	588,	588,
+	588,	588,	588,	588,	588,	588,	588,	588,
+	587,	587,	587,	587,	587,	587,	587,	587,
+	587,	587,	587,	587,	587,	587,	587,	587,
+	587,	587,	587,	587,	587,	587,	587,	587,
+	587,	587,	586,	586,	586,	586,	586,	586,
+	586,	586,	586,	586,	586,	586,	586,	586,
+	586,	586,	586,	586,	586,	586,	585,	586,
+	586,	585,	585,	585,	585,	585,	585,	585,
+	585,	585,	585,	585,	585,	585,	585,	585,
+	585,	585,	585,	585,	585,	585,	585,	585,
+	584,	584,	584,	584,	584,	584,	584,	584,
+	584,	584,	584,	584,	584,	584,	584,	584,
+	584,	584,	584,	584,	584,	584,	584,	584,
+	584,	583,	583,	583,	583,	583,	583,	583,
+	583,	583,	583,	583,	583,	583,	583,	583,
+	583,	583,	583,	583,	583,	583,	583,	583,
+	583,	583,	581,	581,	581,	581,	581,	581,
+	581,	581,	581,	581,	581,	581,	581,	581,
+	581,	581,	581,	581,	581,	581,	580,	580,
+	580,	580,	580,	580,	580,	580,	580,	580,
+	580,	580,	580,	580,	580,	580,	580,	580,
+	580,	580,	579,	579,	579,	579,	579,	579,
+	579,	579,	579,	579,	579,	579,	579,	579,
+	579,	579,	579,	579,	579,	579,	578,	578,
+	578,	578,	578,	578,	578,	578,	578,	578,
+	578,	578,	577,	578,	577,	578,	577,	577,
+	577,	577,	577,	577,	577,	577,	576,	577,
+	576,	577,	576,	576,	576,	576,	576,	576,
+	576,	576,	575,	576,	575,	576,	575,	575,
+	575,	575,	575,	575,	575,	575,	574,	575,
+	574,	575,	574,	574,	574,	574,	574,	574,
+	574,	574,	573,	574,	573,	574,	573,	573,
+	573,	573,	573,	573,	573,	573,	572,	573,
+	572,	573,	572,	572,	572,	572,	572,	572,
+	572,	572,	571,	572,	571,	572,	571,	571,
+	571,	571,	571,	571,	571,	571,	570,	571,
+	570,	571,	570,	570,	570,	570,	570,	570,
+	570,	570,	569,	570,	569,	570,	569,	569,
+	569,	569,	569,	569,	569,	569,	568,	569,
+	568,	569,	568,	568,	568,	568,	568,	568,
+	568,	568,	567,	568,	567,	568,	567,	567,
+	567,	567,	567,	567,	567,	567,	566,	567,
+	566,	567,	566,	566,	566,	566,	566,	566,
+	566,	566,	565,	566,	565,	566,	565,	565,
+	565,	565,	565,	565,	565,	565,	564,	565,
+	564,	565,	564,	564,	564,	564,	564,	564,
+	564,	564,	563,	564,	563,	564,	563,	563,
+	563,	563,	563,	563,	563,	563,	562,	563,
+	562,	563,	562,	562,	562,	562,	562,	562,
+	562,	562,	561,	562,	561,	562,	561,	561,
+	561,	561,	561,	561,	561,	561,	560,	561,
+	560,	561,	560,	560,	560,	560,	560,	560,
+	560,	560,	559,	560,	559,	560,	559,	559,
+	559,	559,	559,	559,	559,	559,	558,	559,
+	558,	559,	558,	558,	558,	558,	558,	558,
+	558,	558,	557,	558,	557,	558,	557,	557,
+	557,	557,	557,	557,	557,	557,	556,	557,
+	556,	557,	556,	556,	556,	556,	556,	556,
+	556,	556,	555,	556,	555,	556,	555,	555,
+	555,	555,	555,	555,	555,	555,	554,	555,
+	554,	555,	554,	554,	554,	554,	554,	554,
+	554,	554,	553,	554,	553,	554,	553,	553,
+	553,	553,	553,	553,	553,	553,	552,	553,
+	552,	553,	552,	552,	552,	552,	552,	552,
+	552,	552,	551,	552,	551,	552,	551,	551,
+	551,	551,	551,	551,	551,	551,	550,	551,
+	550,	551,	550,	550,	550,	550,	550,	550,
+	550,	550,	549,	550,	549,	550,	549,	549,
+	549,	549,	549,	549,	549,	549,	548,	549,
+	548,	549,	548,	548,	548,	548,	548,	548,
+	548,	548,	547,	548,	547,	548,	547,	547,
+	547,	547,	547,	547,	547,	546,	547,	546,
+	547,	547,	546,	546,	546,	546,	546,	546,
+	545,	546,	545,	546,	546,	545,	545,	545,
+	545,	545,	545,	544,	545,	544,	545,	545,
+	544,	544,	544,	544,	544,	544,	543,	544,
+	543,	544,	544,	543,	543,	543,	543,	543,
+	543,	542,	543,	542,	543,	543,	542,	542,
+	542,	542,	542,	542,	540,	542,	540,	542,
+	542,	540,	540,	540,	540,	540,	540,	539,
+	540,	539,	540,	540,	539,	539,	539,	539,
+	539,	539,	538,	539,	538,	539,	539,	538,
+	538,	538,	538,	538,	538,	537,	538,	537,
+	538,	538,	537,	537,	537,	537,	537,	537,
+	536,	537,	536,	537,	537,	536,	536,	536,
+	536,	536,	536,	535,	536,	535,	536,	536,
+	535,	535,	535,	535,	535,	535,	535,	535,
+	535,	535,	535,	523,	523,	523,	523,	523,
+	523,	523,	523,	523,	523,	523,	523,	523,
+	523,	523,	523,	523,	523,	523,	523,	523,
+	523,	523,	523,	523,	523,	523,	523,	523,
+	523,	523,	523,	523,	523,	523,	523,	523,
+	523,	523,	523,	523,	523,	523,	523,	523,
+	523,	523,	523,	523,	523,	523,	523,	523,
+	523,	523,	523,	523,	523,	523,	523,	523,
+	523,	523,	523,	523,	523,	523,	523,	523,
+	523,	523,	523,	523,	523,	523,	523
 };
 
-const int yyparser_t::yydaccpt[570] = {
--1,	100,	46,	58,	112,	114,	118,	111,
-	119,	120,	113,	110,	1,	2,	117,	117,
-	117,	48,	109,	4,	106,	106,	53,	52,
-	55,	51,	51,	54,	56,	47,	59,	50,
-	17,	93,	93,	92,	0,	91,	90,	65,
-	64,	67,	66,	105,	103,	3,	105,	81,
-	80,	79,	78,	77,	76,	75,	74,	73,
-	72,	71,	70,	83,	82,	99,	89,	88,
-	97,	98,	102,	101,	96,	95,	85,	69,
-	90,	87,	86,	86,	46,	94,	94,	90,
-	69,	12,	10,	12,	6,	24,	23,	35,
-	34,	26,	25,	21,	28,	27,	22,	107,
-	108,	120,	33,	40,	45,	44,	39,	38,
-	30,	42,	43,	37,	36,	60,	32,	-1,
-	60,	41,	14,	60,	13,	31,	49,	120,
-	49,	19,	63,	63,	15,	15,	20,	49,
-	18,	-1,	-1,	-1,	-1,	104,	57,	-1,
-	-1,	7,	9,	-1,	-1,	-1,	-1,	94,
-	-1,	-1,	-1,	-1,	120,	11,	11,	8,
-	-1,	-1,	90,	116,	112,	115,	111,	5,
-	120,	120,	120,	117,	60,	-1,	16,	-1,
-	-1,	-1,	93,	-1,	-1,	93,	-1,	-1,
-	-1,	-1,	-1,	120,	-1,	-1,	-1,	-1,
+const signed char yyparser_t::yydaccpt[523] = {
+-1,	80,	69,	70,	71,	72,	73,	74,
+	75,	76,	77,	78,	79,	90,	81,	110,
+	113,	10,	105,	3,	111,	12,	103,	114,
+	95,	107,	22,	99,	108,	89,	88,	97,
+	98,	102,	101,	4,	96,	85,	27,	82,
+	83,	87,	28,	86,	100,	94,	26,	50,
+	23,	59,	25,	56,	35,	34,	54,	51,
+	55,	112,	2,	1,	52,	120,	119,	53,
+	118,	48,	109,	106,	21,	66,	117,	67,
+	64,	65,	0,	6,	46,	91,	92,	58,
+	93,	24,	17,	47,	120,	39,	37,	44,
+	30,	31,	45,	40,	32,	41,	43,	42,
+	29,	36,	60,	-1,	62,	20,	49,	15,
+	18,	19,	-1,	-1,	94,	-1,	-1,	118,
+	87,	14,	-1,	-1,	93,	8,	11,	13,
+	38,	5,	116,	112,	111,	115,	120,	-1,
+	120,	68,	-1,	-1,	-1,	-1,	120,	-1,
 	-1,	-1,	-1,	-1,	-1,	-1,	-1,	-1,
 	-1,	-1,	-1,	-1,	-1,	-1,	-1,	-1,
-	-1,	-1,	-1,	-1,	120,	-1,	-1,	-1,
-	-1,	94,	-1,	-1,	-1,	-1,	-1,	-1,
+	-1,	-1,	60,	120,	60,	60,	60,	60,
+	60,	60,	60,	60,	60,	60,	60,	-1,
+	60,	60,	60,	-1,	-1,	-1,	-1,	-1,
 	-1,	-1,	-1,	-1,	-1,	-1,	-1,	-1,
-	-1,	120,	-1,	-1,	-1,	120,	-1,	-1,
-	68,	-1,	16,	-1,	-1,	-1,	120,	120,
+	-1,	-1,	-1,	54,	-1,	-1,	-1,	-1,
+	120,	-1,	117,	-1,	120,	-1,	-1,	-1,
+	120,	16,	-1,	-1,	120,	-1,	-1,	-1,
 	-1,	-1,	-1,	-1,	-1,	-1,	-1,	-1,
-	54,	-1,	-1,	120,	-1,	-1,	-1,	-1,
+	-1,	-1,	-1,	-1,	-1,	120,	-1,	-1,
+	-1,	-1,	117,	94,	-1,	-1,	-1,	-1,
 	-1,	-1,	-1,	-1,	-1,	-1,	-1,	-1,
-	-1,	-1,	60,	60,	60,	-1,	-1,	-1,
-	-1,	-1,	-1,	-1,	60,	60,	60,	60,
-	60,	-1,	-1,	-1,	60,	60,	117,	-1,
-	-1,	-1,	-1,	120,	117,	-1,	-1,	-1,
-	60,	60,	-1,	60,	-1,	60,	60,	-1,
 	-1,	-1,	-1,	-1,	-1,	-1,	-1,	-1,
-	60,	60,	63,	63,	60,	-1,	-1,	60,
-	60,	60,	60,	60,	-1,	60,	60,	60,
-	60,	-1,	117,	-1,	-1,	120,	-1,	-1,
-	60,	60,	60,	84,	60,	60,	-1,	60,
-	-1,	60,	60,	-1,	-1,	-1,	60,	117,
-	61,	94,	60,	120,	60,	-1,	120,	-1,
-	-1,	60,	60,	60,	49,	60,	60,	60,
-	60,	60,	60,	60,	60,	60,	60,	60,
+	-1,	-1,	-1,	-1,	-1,	-1,	-1,	-1,
+	-1,	-1,	-1,	-1,	-1,	-1,	-1,	120,
+	-1,	-1,	-1,	-1,	-1,	-1,	-1,	93,
+	93,	120,	-1,	117,	-1,	-1,	-1,	-1,
+	-1,	-1,	-1,	-1,	-1,	-1,	-1,	-1,
+	120,	-1,	60,	-1,	-1,	-1,	117,	61,
+	120,	84,	-1,	60,	120,	-1,	94,	-1,
+	120,	60,	60,	49,	60,	60,	60,	60,
 	60,	60,	60,	60,	60,	60,	60,	11,
-	11,	-1,	-1,	87,	-1,	-1,	-1,	60,
+	60,	60,	60,	60,	-1,	11,	-1,	-1,
+	-1,	-1,	90,	-1,	60,	60,	60,	60,
 	60,	60,	60,	60,	60,	60,	60,	60,
 	60,	60,	60,	60,	60,	60,	60,	60,
-	60,	-1,	-1,	-1,	-1,	-1,	118,	118,
-	-1,	-1,	103,	-1,	60,	60,	60,	-1,
-	120,	118,	-1,	-1,	-1,	-1,	-1,	-1,
-	-1,	-1,	-1,	-1,	-1,	62,	57,	60,
 	60,	60,	60,	60,	60,	60,	60,	60,
-	63,	60,	-1,	60,	60,	60,	60,	60,
-	60,	63,	60,	63,	60,	60,	60,	60,
-	63,	60,	60,	60,	-1,	60,	60,	60,
-	-1,	60,	60,	60,	60,	60,	60,	60,
-	-1,	60,	-1,	-1,	-1,	-1,	-1,	-1,
-	104,	120,	-1,	-1,	29,	94,	60,	60,
-	60,	60,	11,	11,	11,	11,	11,	11,
-	11,	11,	-1,	60,	60,	60,	60,	60,
 	60,	60,	60,	60,	60,	60,	60,	60,
+	60,	60,	60,	118,	-1,	-1,	-1,	60,
+	-1,	-1,	60,	-1,	-1,	-1,	60,	-1,
+	103,	60,	-1,	120,	118,	60,	-1,	-1,
+	57,	-1,	60,	60,	60,	60,	60,	60,
+	60,	60,	60,	60,	60,	14,	60,	60,
 	60,	60,	60,	60,	60,	60,	60,	60,
-	60,	60,	60,	60,	14,	60,	60,	60,
-	-1,	60,	60,	60,	60,	60,	60,	60,
-	60,	60,	-1,	11,	11,	11,	7,	11,
-	-1,	-1,	-1,	-1,	90,	-1,	-1,	-1,
-	-1,	-1,	-1,	-1,	-1,	120,	-1,	-1,
-	-1,	93
+	60,	60,	60,	60,	60,	60,	60,	60,
+	60,	60,	60,	60,	60,	60,	60,	9,
+	60,	11,	11,	11,	11,	11,	120,	104,
+	-1,	-1,	-1,	33,	63,	-1,	-1,	-1,
+	-1,	-1,	-1,	7,	63,	63,	63,	63,
+	63,	63,	94,	60,	60,	-1,	60,	60,
+	60,	60,	60,	60,	60,	60,	60,	60,
+	60,	60,	60,	60,	60,	60,	60,	60,
+	60,	60,	60,	60,	60,	60,	60,	60,
+	60,	60,	-1,	-1,	-1,	117,	-1,	-1,
+	11,	11,	11,	11,	11,	11,	60,	60,
+	60,	60,	60,	60,	60,	60,	60,	-1,
+	-1,	-1,	-1,	90,	-1,	-1,	120,	-1,
+	-1,	-1,	120
 };
 
 // token map: token ID --> token index in token ID table
 // in fact, it acts like inverse table of token ID table
-const int yyparser_t::yyptmap[295] = {
+const unsigned char yyparser_t::yyptmap[295] = {
 0,	2,	2,	2,	2,	2,	2,	2,
 	2,	2,	44,	2,	2,	2,	2,	2,
 	2,	2,	2,	2,	2,	2,	2,	2,
@@ -8230,7 +8439,7 @@ const int yyparser_t::yyptmap[295] = {
 };
 /*
 // token ID table, containing token IDs
-const int yyparser_t::yyptid[59] = {
+const unsigned short yyparser_t::yyptid[59] = {
 0,	256,	257,	258,	259,	260,	261,	262,
 	263,	264,	265,	266,	267,	268,	269,	270,
 	271,	272,	273,	274,	275,	276,	277,	278,
@@ -8242,7 +8451,7 @@ const int yyparser_t::yyptid[59] = {
 };
 */
 // prnum table, its element is number of symbols in right part of corresponding grammar rule
-const int yyparser_t::yyprnum[147] = {
+const unsigned char yyparser_t::yyprnum[147] = {
 2,	10,	0,	0,	0,	0,	1,	0,
 	2,	0,	1,	1,	1,	1,	1,	2,
 	2,	1,	3,	4,	3,	1,	1,	1,
@@ -8265,7 +8474,7 @@ const int yyparser_t::yyprnum[147] = {
 };
 
 // plid table, its element is the index of left part of corresponding grammar rule in token ID table
-const int yyparser_t::yyplid[147] = {
+const unsigned char yyparser_t::yyplid[147] = {
 28,	26,	31,	33,	36,	35,	35,	29,
 	30,	30,	37,	37,	37,	37,	37,	37,
 	37,	37,	39,	39,	39,	42,	42,	42,
@@ -8288,7 +8497,7 @@ const int yyparser_t::yyplid[147] = {
 };
 
 // parse action table
-const int yyparser_t::yypact[599] = {
+const unsigned short yyparser_t::yypact[599] = {
 212,	37,	77,	67,	35,	90,	14,	13,
 	43,	32,	23,	73,	118,	24,	118,	215,
 	357,	171,	125,	176,	32,	33,	34,	357,
@@ -8369,7 +8578,7 @@ const int yyparser_t::yypact[599] = {
 // base array for parse action table
 // which is used to determine the base location of the entries
 // for each state stored in the yypack table
-const int yyparser_t::yypabase[209] = {
+const short yyparser_t::yypabase[209] = {
 0,	0,	0,	0,	0,	-4,	0,	0,
 	0,	0,	0,	0,	0,	0,	0,	0,
 	3,	0,	0,	0,	0,	0,	7,	45,
@@ -8399,7 +8608,7 @@ const int yyparser_t::yypabase[209] = {
 	0
 };
 
-const int yyparser_t::yypgoto[35] = {
+const unsigned short yyparser_t::yypgoto[35] = {
 51,	91,	55,	55,	357,	50,	49,	51,
 	91,	55,	55,	357,	50,	99,	51,	51,
 	55,	55,	357,	124,	50,	139,	136,	51,
@@ -8407,7 +8616,7 @@ const int yyparser_t::yypgoto[35] = {
 	170,	160,	172
 };
 
-const int yyparser_t::yypgbase[209] = {
+const signed char yyparser_t::yypgbase[209] = {
 0,	0,	0,	0,	0,	0,	0,	0,
 	0,	0,	0,	0,	0,	0,	0,	0,
 	0,	0,	0,	0,	0,	0,	0,	0,
@@ -8605,7 +8814,7 @@ const by_te_t yyparser_t::yyvbmap[1672] = {
 	0,	0,	2,	0,	0,	16,	0,	0,
 	17,	0,	0,	0,	0,	0,	0,	0,
 	19,	0,	4,	0,	0,	0,	0,	0,
-	19,	0,	38,	96,	16,	0,	0,	4,
+	19,	0,	38,	96,	16,	1,	0,	4,
 	0,	0,	0,	0,	0,	0,	0,	4,
 	19,	0,	38,	96,	16,	1,	0,	4,
 	10,	48,	145,	16,	0,	0,	208,	0,
@@ -8649,7 +8858,7 @@ const by_te_t yyparser_t::yyvbmap[1672] = {
 	19,	0,	4,	0,	0,	1,	0,	4
 };
 
-const int yyparser_t::yyparv[209] = {
+const unsigned short yyparser_t::yyparv[209] = {
 357,	217,	4,	219,	210,	357,	25,	218,
 	220,	221,	222,	223,	224,	26,	27,	227,
 	357,	231,	232,	233,	234,	357,	357,	357,
@@ -8680,7 +8889,7 @@ const int yyparser_t::yyparv[209] = {
 };
 
 
-const int yyparser_t::yyparn[209] = {
+const unsigned char yyparser_t::yyparn[209] = {
 32,	0,	0,	0,	0,	32,	0,	0,
 	0,	0,	0,	0,	0,	0,	0,	0,
 	32,	0,	0,	0,	0,	32,	32,	32,
@@ -8710,7 +8919,7 @@ const int yyparser_t::yyparn[209] = {
 	0
 };
 
-const int yyparser_t::yypcv[113] = {
+const unsigned short yyparser_t::yypcv[113] = {
 357,	357,	357,	357,	357,	357,	357,	144,
 	357,	357,	357,	357,	357,	357,	357,	357,
 	357,	357,	357,	357,	357,	357,	357,	357,
@@ -8728,7 +8937,7 @@ const int yyparser_t::yypcv[113] = {
 	178
 };
 
-const int yyparser_t::yypcn[113] = {
+const unsigned char yyparser_t::yypcn[113] = {
 32,	32,	32,	32,	32,	32,	32,	1,
 	32,	32,	32,	32,	32,	32,	32,	32,
 	32,	32,	32,	32,	32,	32,	32,	32,
@@ -8747,7 +8956,7 @@ const int yyparser_t::yypcn[113] = {
 };
 
 
-const int yyparser_t::yypgrv[209] = {
+const unsigned short yyparser_t::yypgrv[209] = {
 357,	357,	357,	5,	357,	357,	357,	357,
 	357,	357,	357,	357,	357,	357,	357,	357,
 	30,	357,	357,	357,	357,	357,	39,	357,
@@ -8777,7 +8986,7 @@ const int yyparser_t::yypgrv[209] = {
 	357
 };
 
-const int yyparser_t::yypgrn[209] = {
+const unsigned char yyparser_t::yypgrn[209] = {
 32,	32,	32,	0,	32,	32,	32,	32,
 	32,	32,	32,	32,	32,	32,	32,	32,
 	2,	32,	32,	32,	32,	32,	0,	32,
@@ -8865,6 +9074,10 @@ int yylexstr(char *strbuffer, int size) {
 int yylexcstr(const char *strbuffer, int size) {
 	return getTheParser().yylexinit__(strbuffer, size)? 0: -1;
 }
+// initializing memory-mapped file buffer before parsing or patter-matching
+int yylexmmap(const char *pchFile) {
+	return getTheParser().yylexinit__(pchFile)? 0: -1;
+}
 
 // generated scanner, can be replaced
 int yylex(lexer_ns::lexer_t& lexer, lexer_ns::dtable_t &dtbl,
@@ -8874,6 +9087,13 @@ int yylex(lexer_ns::lexer_t& lexer, lexer_ns::dtable_t &dtbl,
 	return getTheParser().yylex__(lexer, dtbl, grammar, ptbl, dmap, gsetup);
 } 
 
+// scanning tokens in one call
+int yylex_batch(yytoken_t *out, int max, lexer_ns::lexer_t& lexer, lexer_ns::dtable_t &dtbl,
+	parser_ns::grammar_t &grammar, parser_ns::ptable_t &ptbl,
+	dmmap_t &dmap, gsetting_t &gsetup) {
+	return getTheParser().yylex_batch__(out, max, lexer, dtbl, grammar, ptbl, dmap, gsetup);
+}
+
 // assign new scanner and return the old one 
 yylex_t yysetlex(yylex_t plex) {
 	
@@ -8892,7 +9112,7 @@ int yyparse(lexer_ns::lexer_t& lexer, lexer_ns::dtable_t &dtbl,
 }
 } // namspace
 
-#line 3224 "meta/ulyac.upg"
+#line 3183 "meta/ulyac.upg"
 
 
 int debug_yyparse(lexer_ns::lexer_t &lexer, lexer_ns::dtable_t &dtbl,
@@ -8904,6 +9124,6 @@ int debug_yyparse(lexer_ns::lexer_t &lexer, lexer_ns::dtable_t &dtbl,
 	return nRet;
 }
 
-#line 8907 "gcode/ulyac.cpp"
+#line 9127 "gcode/ulyac.cpp"
 
 
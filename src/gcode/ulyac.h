@@ -2,8 +2,8 @@
 A parser program in C++, generated by Upgen 0.5.4.
 ******************************************************************************/
 
-#ifndef CLASS_yyPARSE_T_FILE_ULYAC_1528898923_H__
-#define CLASS_yyPARSE_T_FILE_ULYAC_1528898923_H__
+#ifndef CLASS_yyPARSE_T_FILE_ULYAC_1792296728_H__
+#define CLASS_yyPARSE_T_FILE_ULYAC_1792296728_H__
 
 #line 1 "meta/ulyac.upg"
 
@@ -132,12 +132,34 @@ int yylexfile(const char* pchFile, bool iMod = false);
 int yylexstr(char *strbuffer, int size);
 // initializing const string buffer before parsing or patter-matching
 int yylexcstr(const char *strbuffer, int size);
+// initializing memory-mapped file buffer before parsing or patter-matching
+int yylexmmap(const char *pchFile);
 
 // generated scanner, can be replaced
 int yylex(lexer_ns::lexer_t& lexer, lexer_ns::dtable_t &dtbl,
 	parser_ns::grammar_t &grammar, parser_ns::ptable_t &ptbl,
 	dmmap_t &dmap, gsetting_t &gsetup);
 
+// token recorded by yylex_batch
+struct yytoken_t {
+	// value returned by action
+	int id;
+	// index of matched rule
+	int rule;
+	// offset of text from start of input
+	long offset;
+	int length;
+	// text in input buffer, not NULL-terminated; NULL if input is read
+	// from file by pieces, or given by chunks
+	const char *text;
+};
+// scanning at most @max tokens into @out, return count of them, 0 at end of
+// input, or error code if none is scanned; text of tokens is valid until
+// next call
+int yylex_batch(yytoken_t *out, int max, lexer_ns::lexer_t& lexer, lexer_ns::dtable_t &dtbl,
+	parser_ns::grammar_t &grammar, parser_ns::ptable_t &ptbl,
+	dmmap_t &dmap, gsetting_t &gsetup);
+
 
 // generated parser, it should not be replaced
 int yyparse(lexer_ns::lexer_t& lexer, lexer_ns::dtable_t &dtbl,
@@ -41,14 +41,17 @@ using std::ostream;
 using std::sort;
 #include <queue>
 using std::queue;
+#include <unordered_map>
+using std::unordered_map;
 
 #include "./dgraph.h"
 #include "../common/setsplitter.h"
-using common_ns::superset_t;
+using common_ns::subset_t;
 using common_ns::vsubset_t;
 
 #include "../common/unifind.h"
 using common_ns::unifind_t;
+#include "../common/profiler.h"
 
 namespace lexer_ns {
 
@@ -58,7 +61,120 @@ namespace lexer_ns {
 #define IS_DENSE_STATE(t, x)					(x * 2 >= t)
 #define IS_COMPRESSION_GOOD(t, x, m)			(IS_DENSE_STATE(t, x) && IS_DENSE_STATE(x, m))
 
-// fill data(compressed next/check/base/default array) into transition tables
+// test if an entry of next array is used
+static inline bool testUsed(const vector<unsigned int> &a_vnUsed, int a_nIdx) {
+	
+	unsigned int nWord = (unsigned int)a_nIdx / 32;
+	return nWord < a_vnUsed.size() && (a_vnUsed[nWord] >> (a_nIdx % 32)) & 1u;
+}
+
+// mark an entry of next array as used
+static inline void setUsed(vector<unsigned int> &a_vnUsed, int a_nIdx) {
+	
+	unsigned int nWord = (unsigned int)a_nIdx / 32;
+	if(nWord >= a_vnUsed.size()) {
+		a_vnUsed.resize(nWord + 1, 0u);
+	}
+	a_vnUsed[nWord] |= 1u << (a_nIdx % 32);
+}
+
+// get usage of 32 entries of next array starting at @a_nIdx
+static inline unsigned int getUsed32(const vector<unsigned int> &a_vnUsed, int a_nIdx) {
+	
+	unsigned int nWord = (unsigned int)a_nIdx / 32, nShift = (unsigned int)a_nIdx % 32;
+	unsigned int nBits = (nWord < a_vnUsed.size())? a_vnUsed[nWord] >> nShift: 0u;
+	if(nShift && nWord + 1 < a_vnUsed.size()) {
+		nBits |= a_vnUsed[nWord + 1] << (32 - nShift);
+	}
+	return nBits;
+}
+
+// place a row of transitions into next/check arrays by first-fit,
+// @a_vnUsed is bitmap of entries of next array holding a transition,
+// @a_nEmptyCheck is check value of empty entries appended to the arrays
+int dgraph_t::packRow(const vint_t &a_vnRow, int a_nState, int a_nEmptyCheck,
+		vector<unsigned int> &a_vnUsed, int &a_nCur) {
+	
+	table_t& tNext = m_dTbl.m_tNext;
+	table_t& tCheck = m_dTbl.m_tCheck;
+	const int nLabels = (int)a_vnRow.size();
+	
+	// columns of valid transitions, only they can collide with used entries
+	vint_t vnCols;
+	int k;
+	for(k = 0; k < nLabels; ++k) {
+		
+		if(a_vnRow[k] != INVALID_STATE) {
+			vnCols.push_back(k);
+		}
+	}
+	
+	int nLow = vnCols.empty()? nLabels - 1: vnCols.front();
+	int nHigh = vnCols.empty()? nLabels: vnCols.back() + 1;
+	
+	// try 32 bases at a time, entries beyond the end of next array
+	// are free, so the first fitting base is never past the end
+	int j = (a_nCur > nLow)? a_nCur: nLow;
+	while(j < (int)tNext.size()) {
+		
+		unsigned int nFree = ~0u;
+		for(k = 0; k < (int)vnCols.size() && nFree; ++k) {
+			
+			nFree &= ~getUsed32(a_vnUsed, j + vnCols[k] - nLow);
+		}
+		
+		if(nFree) {
+			
+			while( ! (nFree & 1u)) {
+				
+				nFree >>= 1;
+				++j;
+			}
+			break;
+		}
+		j += 32;
+	}
+	
+	while((int)tNext.size() < nLow) {
+		
+		tNext.push_back(INVALID_STATE);
+		tCheck.push_back(m_dTbl.m_nDefaultState);
+	}
+	int m = nLow;
+	for(k = j; k < (int)tNext.size() && m < nHigh; ++k, ++m) {
+		
+		if(a_vnRow[m] != INVALID_STATE) {
+			
+			assert(_EQ(tNext[k], INVALID_STATE));
+			tNext[k] = a_vnRow[m];
+			tCheck[k] = a_nState;
+			setUsed(a_vnUsed, k);
+		}
+	}
+	for(; m < nHigh; ++m) {
+		
+		tNext.push_back(a_vnRow[m]);
+		if(a_vnRow[m] != INVALID_STATE) {
+			
+			tCheck.push_back(a_nState);
+			setUsed(a_vnUsed, (int)tNext.size() - 1);
+		}
+		else {
+			
+			tCheck.push_back(a_nEmptyCheck);
+		}
+	}
+	
+	while(a_nCur < (int)tNext.size() && testUsed(a_vnUsed, a_nCur)) {
+		
+		++a_nCur;
+	}
+	
+	return j - nLow;
+}
+
+// fill data(compressed next/check/base/default array) into transition tables,
+// rows are placed in order of decreasing number of transitions
 void dgraph_t::fillTransitions(void) {
 	
 	// filter states whose tranistion target are less than 2,
@@ -78,7 +194,6 @@ void dgraph_t::fillTransitions(void) {
 	// sort states so that states are arranged in non-increasing order
 	rearrangeStates(dgnode_less_t(), nBase, (int)m_vpNodes.size());
 	
-	int nLabels = m_dTbl.getLabelCount();
 	int i;
 	table_t& tNext = m_dTbl.m_tNext;
 	table_t& tCheck = m_dTbl.m_tCheck;
@@ -98,151 +213,29 @@ void dgraph_t::fillTransitions(void) {
 	}
 	assert(nBase < (int)m_vpNodes.size());
 	
+	// occupancy bitmap of entries of next array
+	vector<unsigned int> vnUsed;
+	for(i = 0; i < (int)tNext.size(); ++i) {
+		
+		if(tNext[i] != INVALID_STATE) {
+			setUsed(vnUsed, i);
+		}
+	}
+	
 	int nEnd = (int)m_vpNodes.size();
 	int nCur = (int)tNext.size();
 	for(i = nEnd - 1; i >= nBase; --i) {
 		
-		int nLow = 0, nHigh = nLabels - 1;
-		while(nLow < nHigh && _EQ((*m_vpNodes[i]->m_pvnLabels)[nLow], INVALID_STATE)) {
-			
-			++nLow;
-		}
-		
-		while(nHigh > nLow && _EQ((*m_vpNodes[i]->m_pvnLabels)[nHigh], INVALID_STATE)) {
-			
-			--nHigh;
-		}
-		
-		++nHigh;
-		
-		assert(nHigh > nLow);
-		
-		int j = (nCur > nLow)? nCur: nLow;
-		for(; /*j < ((int)tNext.size()) - (nHigh - nLow)*/; ++j) {
-			
-			int k = nLow;
-			for(; k < nHigh; ++k) {
-				
-				int idx = j + k - nLow;
-				if(idx < (int)tNext.size()
-						&& tNext[idx] != INVALID_STATE
-						&& (*m_vpNodes[i]->m_pvnLabels)[k] != INVALID_STATE) {
-					
-					break;
-				}
-			}
-			
-			if(_EQ(k, nHigh) || j >= (int)tNext.size()) {
-				
-				break;
-			}
-		}
-	
-		tBase[i] = j - nLow;
+		tBase[i] = packRow(*m_vpNodes[i]->m_pvnLabels, i, nInvalidTarget, vnUsed, nCur);
 		tDefault[i] = m_vpNodes[i]->m_nDefault;
-		
-		while((int)tNext.size() < nLow) {
-			
-			tNext.push_back(INVALID_STATE);
-			//tCheck.push_back(i);
-			tCheck.push_back(nInvalidTarget);
-		}
-		int m = nLow;
-		for(int k = j; k < (int)tNext.size() && m < nHigh; ++k, ++m) {
-			
-			if((*m_vpNodes[i]->m_pvnLabels)[m] != INVALID_STATE) {
-				
-				assert(_EQ(tNext[k], INVALID_STATE));
-				tNext[k] = (*m_vpNodes[i]->m_pvnLabels)[m];
-				tCheck[k] = i;
-			}
-		}
-		for(; m < nHigh; ++m) {
-			
-			tNext.push_back((*m_vpNodes[i]->m_pvnLabels)[m]);
-			if((*m_vpNodes[i]->m_pvnLabels)[m] != INVALID_STATE) {
-				
-				tCheck.push_back(i);
-			}
-			else {
-			
-				tCheck.push_back(nInvalidTarget);
-			}
-		}
-
-		while(nCur < (int)tNext.size() && tNext[nCur] != INVALID_STATE) {
-			
-			++nCur;
-		}
 	}
 	
-	if(m_vpvGenNodes.size() > 0) {
-		
-		nLabels = (int)m_vpvGenNodes[0]->size();
-		// compression generated states
+	// compression generated states
+	for(i = ((int)m_vpvGenNodes.size()) - 1; i >= 0; --i) {
 		
-		for(i = ((int)m_vpvGenNodes.size()) - 1; i >= 0; --i) {
-			
-			int nState = nInvalidTarget + 1 + i;
-			int nLow = 0, nHigh = nLabels - 1;
-			while(nLow < nHigh && _EQ((*m_vpvGenNodes[i])[nLow], INVALID_STATE)) {
-				
-				++nLow;
-			}
-			
-			while(nHigh > nLow && _EQ((*m_vpvGenNodes[i])[nHigh], INVALID_STATE)) {
-				
-				--nHigh;
-			}
-			
-			++nHigh;
-			
-			assert(nHigh > nLow);
-			
-			int j = (nCur > nLow)?nCur: nLow;
-			for(; /*j < ((int)tNext.size()) - (nHigh - nLow)*/; ++j) {
-				
-				int k = nLow;
-				for(; k < nHigh; ++k) {
-					
-					int idx = j + k - nLow;
-					if(idx < (int)tNext.size()
-							&& tNext[idx] != INVALID_STATE
-							&& (*m_vpvGenNodes[i])[k] != INVALID_STATE) {
-						
-						break;
-					}
-				}
-				if(_EQ(k, nHigh) || j >= (int)tNext.size()) {
-					
-					break;
-				}
-			}
-
-			tBase[nState] = j - nLow;
-			tDefault[nState] = INVALID_STATE;
-			
-			int m = nLow;
-			for(int k = j; k < (int)tNext.size() && m < nHigh; ++k, ++m) {
-				
-				if((*m_vpvGenNodes[i])[m] != INVALID_STATE) {
-					
-					assert(_EQ(tNext[k], INVALID_STATE));
-					tNext[k] = (*m_vpvGenNodes[i])[m];
-					tCheck[k] = nState;
-				}
-			}
-			for(; m < nHigh; ++m) {
-				
-				tNext.push_back((*m_vpvGenNodes[i])[m]);
-				tCheck.push_back(nState);
-			}
-
-			while(nCur < (int)tNext.size() && tNext[nCur] != INVALID_STATE) {
-				
-				++nCur;
-			}
-		}
+		int nState = nInvalidTarget + 1 + i;
+		tBase[nState] = packRow(*m_vpvGenNodes[i], nState, nState, vnUsed, nCur);
+		tDefault[nState] = INVALID_STATE;
 	}
 	
 	// add special invalid target
@@ -404,109 +397,207 @@ void dgraph_t::updateAfterRearrange(void) {
 }
 
 // minimization of DFA
+// Hopcroft's partition refinement over compact labels(see @m_tCharMap):
+// states are first partitioned by accepted rule and action, a virtual dead
+// state stands for all missing transitions, then blocks are refined with
+// splitters taken from a worklist until the partition is stable
 void dgraph_t::minimize(void) {
 	
-	superset_t stateSets(FIRST_STATE, (int)m_vpNodes.size());
-	vsubset_t vsStates;
-	int i;
-
-	i2si_map_t rule2Stats;
-	for(i = FIRST_STATE; i < (int)m_vpNodes.size(); ++i) {
+	int nStates = (int)m_vpNodes.size();
+	int nLabels = m_dTbl.getLabelCount();
+	if(nStates - FIRST_STATE < 2 || nLabels <= 0) {
+		
+		return;
+	}
+	
+	// virtual dead state, which is the target of all missing transitions
+	int nDead = nStates;
+	int nTotal = nStates + 1;
+	int i, j, k;
+	
+	// transitions on compact labels
+	const vint_t& vnMap = m_dTbl.m_tCharMap;
+	vint_t vnNext(nTotal * nLabels, nDead);
+	for(i = FIRST_STATE; i < nStates; ++i) {
 		
-		if(m_vpNodes[i]->getRule() != INVALID_RULE) {
+		vgarc_t& arc = *(m_vpNodes[i]->m_poutArc);
+		for(j = 0; j < (int)arc.size(); ++j) {
 			
-			i2si_it_t it = rule2Stats.find(m_vpNodes[i]->getRule());
-			if(it != rule2Stats.end()) {
+			ustring ustr;
+			arc[j]->getCharSet().getSetChars(ustr);
+			for(k = 0; k < (int)ustr.size(); ++k) {
 				
-				it->second->insert(i);
+				vnNext[i * nLabels + vnMap[(unsigned char)ustr[k]]] = arc[j]->m_ntoState;
 			}
-			else {
+		}
+	}
+	
+	// inverse transitions, computed only once:
+	// sources of (target, label) are in
+	// vnInvSrc[vnInvIdx[target * nLabels + label], vnInvIdx[target * nLabels + label + 1])
+	vint_t vnInvIdx(nTotal * nLabels + 1, 0);
+	for(i = FIRST_STATE; i < nStates; ++i) {
+		
+		for(j = 0; j < nLabels; ++j) {
+			
+			++vnInvIdx[vnNext[i * nLabels + j] * nLabels + j + 1];
+		}
+	}
+	for(i = 1; i < (int)vnInvIdx.size(); ++i) {
+		
+		vnInvIdx[i] += vnInvIdx[i - 1];
+	}
+	vint_t vnInvSrc(vnInvIdx.back());
+	{
+		vint_t vnFill(vnInvIdx.begin(), vnInvIdx.end() - 1);
+		for(i = FIRST_STATE; i < nStates; ++i) {
+			
+			for(j = 0; j < nLabels; ++j) {
 				
-				sint_t *psi = new sint_t;
-				psi->insert(i);
-				rule2Stats.insert(
-						i2si_pair_t(m_vpNodes[i]->getRule(), psi));
+				vnInvSrc[vnFill[vnNext[i * nLabels + j] * nLabels + j]++] = i;
 			}
 		}
 	}
 	
-	for(i2si_it_t it = rule2Stats.begin(); it != rule2Stats.end(); ++it) {
-		
-		assert(it->second);
-		stateSets.split(*it->second);
-		delete it->second;
+	// partition: elements of block b are vnElems[vnFirst[b], vnEnd[b]),
+	// marked elements of a block are kept at its front
+	vint_t vnElems, vnLoc(nTotal), vnBlock(nTotal);
+	vint_t vnFirst, vnEnd, vnMarked;
+	vint_t vnWork;
+	vbool_t vbInWork;
+	
+	// initial partition: by accepted rule and action, dead state by itself
+	map<i2i_pair_t, int> key2Block;
+	for(i = FIRST_STATE; i < nStates; ++i) {
+		
+		i2i_pair_t key(m_vpNodes[i]->getRule(), m_vpNodes[i]->getAction());
+		pair<map<i2i_pair_t, int>::iterator, bool> ret = 
+			key2Block.insert(pair<i2i_pair_t, int>(key, (int)vnFirst.size()));
+		if(ret.second) {
+			
+			vnFirst.push_back(0);
+		}
+		vnBlock[i] = ret.first->second;
+		++vnFirst[vnBlock[i]];
 	}
-	rule2Stats.clear();
+	vnBlock[nDead] = (int)vnFirst.size();
+	vnFirst.push_back(1);
 	
-	vint_t& vnMap = m_dTbl.m_tCharMap;
-	int nLabels = m_dTbl.getLabelCount();
-	assert(nLabels > 0);
-	bool *pbFlags = new bool[nLabels];
-	sint_t **psiStats = new sint_t*[nLabels];
-	memset(psiStats, 0, sizeof(sint_t*) * nLabels);
+	// counts to offsets
+	for(i = 0, j = 0; i < (int)vnFirst.size(); ++i) {
+		
+		k = vnFirst[i];
+		vnFirst[i] = j;
+		j += k;
+		vnEnd.push_back(j);
+	}
+	vnElems.resize(j);
+	{
+		vint_t vnFill(vnFirst);
+		for(i = FIRST_STATE; i < nTotal; ++i) {
+			
+			vnLoc[i] = vnFill[vnBlock[i]]++;
+			vnElems[vnLoc[i]] = i;
+		}
+	}
+	vnMarked.resize(vnFirst.size(), 0);
+	for(i = 0; i < (int)vnFirst.size(); ++i) {
+		
+		vnWork.push_back(i);
+		vbInWork.push_back(true);
+	}
 	
-	bool bChanged = true;
-	while(bChanged) {
+	vint_t vnSplitter, vnTouched;
+	while( ! vnWork.empty()) {
 		
-		bChanged = false;
+		int nSplitter = vnWork.back();
+		vnWork.pop_back();
+		vbInWork[nSplitter] = false;
 		
-		stateSets.getSubsets(vsStates);
-		for(i = ((int)vsStates.size()) - 1; i >= 0; --i) { // sets of states
-
-			for(int j = ((int)vsStates[i]->size()) - 1; j >= 0; --j) { // set of states
+		// splitter itself may be split below, so take a snapshot of it
+		vnSplitter.assign(vnElems.begin() + vnFirst[nSplitter],
+				vnElems.begin() + vnEnd[nSplitter]);
+		
+		for(int c = 0; c < nLabels; ++c) {
+			
+			// mark all states entering splitter on label c;
+			// every state has exactly one target on c, so it is marked at most once
+			for(i = 0; i < (int)vnSplitter.size(); ++i) {
 				
-				dgraph_node_t *pNode = m_vpNodes[(*vsStates[i])[j]];
-				for(int k = 0; k < (int)pNode->getInArcCount(); ++k) { // set of arcs
-
-					dgraph_arc_t* parc = pNode->getInArc(k);
-					ustring ustr;
-					parc->getCharSet().getSetChars(ustr);
-					memset(pbFlags, 0, sizeof(bool) * nLabels);
-					for(int m = 0; m < (int)ustr.size(); ++m) {
-						
-						pbFlags[vnMap[(unsigned char)ustr[m]]] = true;
-					}
-					for(int m = 0; m < nLabels; ++m) {
+				int nIdx = vnSplitter[i] * nLabels + c;
+				for(j = vnInvIdx[nIdx]; j < vnInvIdx[nIdx + 1]; ++j) {
+					
+					int s = vnInvSrc[j];
+					int b = vnBlock[s];
+					int nPos = vnFirst[b] + vnMarked[b];
+					int t = vnElems[nPos];
+					
+					vnElems[vnLoc[s]] = t;
+					vnLoc[t] = vnLoc[s];
+					vnElems[nPos] = s;
+					vnLoc[s] = nPos;
+					
+					if(_EQ(vnMarked[b]++, 0)) {
 						
-						if(pbFlags[m]) {
-							
-							if(psiStats[m]) {
-								
-								psiStats[m]->insert(parc->m_nfromState);
-							}
-							else {
-								psiStats[m] = new sint_t;
-								psiStats[m]->insert(parc->m_nfromState);
-							}
-						}
+						vnTouched.push_back(b);
 					}
 				}
 			}
 			
-			for(int m = 0; m < nLabels; ++m) {
+			// split touched blocks into marked and unmarked parts
+			for(i = 0; i < (int)vnTouched.size(); ++i) {
 				
-				if(psiStats[m]) {
+				int b = vnTouched[i];
+				int nMarked = vnMarked[b];
+				vnMarked[b] = 0;
+				if(_EQ(nMarked, vnEnd[b] - vnFirst[b])) {
 					
-					if(stateSets.split(*psiStats[m])) {
-						
-						bChanged = true;
-					}
-					delete psiStats[m];
-					psiStats[m] = nullptr;
+					continue;
+				}
+				
+				int nb = (int)vnFirst.size();
+				vnFirst.push_back(vnFirst[b]);
+				vnEnd.push_back(vnFirst[b] + nMarked);
+				vnMarked.push_back(0);
+				vnFirst[b] += nMarked;
+				for(j = vnFirst[nb]; j < vnEnd[nb]; ++j) {
+					
+					vnBlock[vnElems[j]] = nb;
+				}
+				
+				// it is enough to refine with the smaller part,
+				// unless original block is still waiting
+				if(vbInWork[b] || nMarked <= vnEnd[b] - vnFirst[b]) {
+					
+					vnWork.push_back(nb);
+					vbInWork.push_back(true);
+				}
+				else {
+					
+					vnWork.push_back(b);
+					vbInWork[b] = true;
+					vbInWork.push_back(false);
 				}
 			}
+			vnTouched.clear();
 		}
-
-		for(i = 0; i < (int)vsStates.size(); ++i) {
+	}
+	
+	// collect undistinguishable sets of states, ordered by their least state
+	vsubset_t vsStates;
+	for(i = FIRST_STATE; i < nStates; ++i) {
+		
+		int b = vnBlock[i];
+		if(vnMarked[b] > 0) {
 			
-			delete vsStates[i];
+			continue;
 		}
-		vsStates.clear();
+		// state @i is the least one of its block
+		vnMarked[b] = 1;
+		subset_t *pss = new subset_t(vnElems.begin() + vnFirst[b], vnElems.begin() + vnEnd[b]);
+		sort(pss->begin(), pss->end());
+		vsStates.push_back(pss);
 	}
-	delete[] pbFlags;
-	delete[] psiStats;
-	
-	stateSets.getSubsets(vsStates);
 
 	// merge states, update transition labels
 	if(m_vpNodes.size() - FIRST_STATE > vsStates.size()) {
@@ -619,26 +710,36 @@ void dgraph_t::compress(void) {
 	
 	unifind_t identStates(nStates);
 	
-	// find identical states
+	// find identical states, only states with the same hash value of
+	// transitions are compared; each state is merged into the first one
+	// identical to it, so classes are the same as comparing all pairs
+	unordered_map<size_t, vint_t> mapRowHash;
 	for(i = 0; i < nStates; ++i) {
 		
-		for(int j = i + 1; j < nStates; ++j) {
+		const vint_t &vnRow = *vgn[i]->m_pvnLabels;
+		size_t nHash = 0;
+		for(int k = 0; k < nLabels; ++k) {
 			
-			int k = 0;
-			for(; k < nLabels; ++k) {
-				
-				if((*vgn[i]->m_pvnLabels)[k] != (*vgn[j]->m_pvnLabels)[k]) {
-					
-					break;
-				}
-			}
+			nHash = nHash * 31 + (size_t)(vnRow[k] - INVALID_STATE);
+		}
+		
+		vint_t &vnSame = mapRowHash[nHash];
+		int j = 0;
+		for(; j < (int)vnSame.size(); ++j) {
 			
-			if(_EQ(k, nLabels)) {
+			if(_EQ(*vgn[vnSame[j]]->m_pvnLabels, vnRow)) {
 				
-				identStates.merge(i, j);
+				identStates.merge(vnSame[j], i);
+				break;
 			}
 		}
+		
+		if(_EQ(j, (int)vnSame.size())) {
+			
+			vnSame.push_back(i);
+		}
 	}
+	mapRowHash.clear();
 
 	identStates.getClasses(vvi);
 	
@@ -669,6 +770,9 @@ void dgraph_t::compress(void) {
 	for(i = 0; i < nStates; ++i) {
 		vsi[i] = nullptr;
 	}
+	// transitions of each group, WILD_STATE where states of the group differ,
+	// so a state is compared against a whole group at once
+	vpvint_t vpvGroupRows(nStates, nullptr);
 	// find differences between states, and partition into groups of states, 
 	// states in each group have few different transitions
 	for(i = (int)vnDiff.size() - 1; i > 0; --i) {
@@ -690,20 +794,22 @@ void dgraph_t::compress(void) {
 		
 		int nPrev = INVALID_INDEX;
 		int nDiff = (nLabels + 1) * (nLabels + 1);
+		// a state joins no group unless difference is less than the bound,
+		// so candidates reaching it need not be counted to the end
+		int nBound = 0;
+		while(nBound < nDiff && IN_GROUP(nLabels, nodi.m_nLabels, nBound)) {
+			
+			++nBound;
+		}
+		nDiff = nBound;
 		for(; j < i; ++j) {
 			
 			int m = 0;
 			int step = 1;
+			const vint_t *pvnRow = vgn[vnDiff[j]]->m_pvnLabels;
 			if(!vsi[vnDiff[j]]) {
 				
 				step = (int)sqrt(nLabels + 1);
-				for(int k = 0; k < nLabels; ++k) {
-					
-					if((*nodi.m_pvnLabels)[k] != (*vgn[vnDiff[j]]->m_pvnLabels)[k]) {
-						
-						m += step;
-					}
-				}
 			}
 			else {
 				
@@ -711,25 +817,16 @@ void dgraph_t::compress(void) {
 				if(!step) {
 					step = 1;
 				}
+				// a label counts if any state of the group differs on it
+				pvnRow = vpvGroupRows[vnDiff[j]];
+			}
+			
+			// stop as soon as it is no better than the best one so far
+			for(int k = 0; k < nLabels && m < nDiff; ++k) {
 				
-				for(int k = 0; k < nLabels; ++k) {
+				if((*nodi.m_pvnLabels)[k] != (*pvnRow)[k]) {
 					
-					if((*nodi.m_pvnLabels)[k] != (*vgn[vnDiff[j]]->m_pvnLabels)[k]) {
-						
-						m += step;
-					}
-					else {
-						
-						for(sint_cit_t cit = vsi[vnDiff[j]]->begin();
-							cit != vsi[vnDiff[j]]->end(); ++cit) {
-							
-							if((*nodi.m_pvnLabels)[k] != (*vgn[*cit]->m_pvnLabels)[k]) {
-								
-								m += step;
-								break;
-							}
-						}
-					}
+					m += step;
 				}
 			}
 
@@ -751,11 +848,30 @@ void dgraph_t::compress(void) {
 			if(!vsi[nPrev]) {
 				
 				vsi[nPrev] = new sint_t;
+				vpvGroupRows[nPrev] = new vint_t(*vgn[nPrev]->m_pvnLabels);
 			}
 			vsi[nPrev]->insert(vnDiff[i]);
+			
+			vint_t &vnGroupRow = *vpvGroupRows[nPrev];
+			for(int k = 0; k < nLabels; ++k) {
+				
+				if((*nodi.m_pvnLabels)[k] != (*vgn[nPrev]->m_pvnLabels)[k]) {
+					
+					vnGroupRow[k] = WILD_STATE;
+				}
+			}
 		}
 	}
 	
+	for(i = 0; i < (int)vpvGroupRows.size(); ++i) {
+		
+		if(vpvGroupRows[i]) {
+			
+			delete vpvGroupRows[i];
+		}
+	}
+	vpvGroupRows.clear();
+	
 	for(i = nStates - 1; i >= 0; --i) {
 		
 		if(vvi[i]) {
@@ -1069,22 +1185,52 @@ void dgraph_t::compress(void) {
 }
 
 // convert graph representation to table representation
-void dgraph_t::toDTables(void) {
+void dgraph_t::toDTables(gsetting_t &gsetup) {
 
-////	if(m_vpNodes.size() < MIN_SIZE_TO_MINIMIZE || m_vpNodes.size() > MAX_SIZE_TO_MINIMIZE) {
-//		
-//		minimize();
-////	}
+	if(gsetup.m_bMinimize) {
+		
+		_PROFILE_PHASE("minimize");
+		_PROFILE_COUNT("states before", m_vpNodes.size() - FIRST_STATE);
+		minimize();
+		_PROFILE_COUNT("states after", m_vpNodes.size() - FIRST_STATE);
+	}
 
+	_PROFILE_PHASE("dfa tables");
 	m_dTbl.m_nDefaultState = (int)m_vpNodes.size();
+	_PROFILE_COUNT("full entries", (m_vpNodes.size() - FIRST_STATE) * m_dTbl.getLabelCount());
 	
 	transformRep();
 	
-	compress();
+	// rows of a full transition table are not compressed
+	if(LEX_TABLE_COMB == gsetup.m_nLexTable) {
+		
+		compress();
+	}
 
 	fillTransitions();
 
 	fillAccepts();
+	_PROFILE_COUNT("next/check entries", m_dTbl.m_tNext.size());
+	
+	if(gsetup.m_posDetail && LEX_TABLE_COMB == gsetup.m_nLexTable) {
+		// report how densely transitions are packed into next/check arrays
+		const table_t& tNext = m_dTbl.m_tNext;
+		int nUsed = 0;
+		for(int i = 0; i < (int)tNext.size(); ++i) {
+			
+			if(tNext[i] != INVALID_STATE) {
+				++nUsed;
+			}
+		}
+		
+		ostream &os = *(ostream*)gsetup.m_posDetail;
+		os << "---------------------- DFA Tables -----------------------------" << std::endl << std::endl;
+		os << "states: " << m_dTbl.m_nDefaultState - FIRST_STATE
+		   << ", generated states: " << m_vpvGenNodes.size() << std::endl
+		   << "next/check entries: " << tNext.size() << ", used: " << nUsed
+		   << ", fill ratio: " << (tNext.empty()? 0: nUsed * 100 / (int)tNext.size()) << "%"
+		   << std::endl << std::endl;
+	}
 
 }
 
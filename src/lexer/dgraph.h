@@ -30,6 +30,7 @@ using std::string;
 #include <algorithm>
 using std::sort;
 
+#include "../main/upgmain.h"
 #include "../common/types.h"
 #include "../common/uset.h"
 using common_ns::charset_t;
@@ -62,6 +63,9 @@ private:
 	// make it easier to compress table
 	void transformRep(void);
 	
+	// place a row of transitions into next/check arrays, return its base
+	int packRow(const vint_t &a_vnRow, int a_nState, int a_nEmptyCheck,
+			vector<unsigned int> &a_vnUsed, int &a_nCur);
 	void fillTransitions(void);
 	void fillAccepts(void);
 	// rearrange states before compression
@@ -117,7 +121,7 @@ public:
 	void compress(void);
 	
 	// convert graph representation to table representation
-	void toDTables(void);
+	void toDTables(gsetting_t &gsetup);
 	
 	void clear(void);
 	
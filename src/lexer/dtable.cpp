@@ -267,6 +267,52 @@ void dtable_t::addAdditionChars(void) {
 	m_tMeta.push_back(m_nMetaCount);
 }
 
+int dtable_t::getNextState(int a_nState, int a_nLabel) const {
+	
+	int s = a_nState;
+	while(s < m_nDefaultState && m_tCheck[m_tBase[s] + a_nLabel] != s) {
+		s = m_tDefault[s];
+	}
+	
+	if(s > m_nDefaultState) {
+		
+		int k = m_tBase[s] + m_tMeta[a_nLabel];
+		return m_tCheck[k] == s ? m_tNext[k] : INVALID_STATE;
+	}
+	return m_tNext[m_tBase[s] + a_nLabel];
+}
+
+int dtable_t::getFullTable(vint_t &a_vnFull, bool a_bPremul) const {
+	
+	int nLabels = 0;
+	for(int i = 0; i < (int)m_tCharMap.size(); ++i) {
+		
+		if(m_tCharMap[i] >= nLabels) {
+			nLabels = m_tCharMap[i] + 1;
+		}
+	}
+	
+	int nStride = nLabels + 1;
+	a_vnFull.assign(m_nDefaultState * nStride, INVALID_STATE);
+	for(int s = 0; s < m_nDefaultState; ++s) {
+		
+		int *pnRow = &a_vnFull[s * nStride];
+		if(s >= FIRST_STATE && ! m_tNext.empty()) {
+			
+			for(int d = 0; d < nLabels; ++d) {
+				
+				pnRow[d] = getNextState(s, d);
+				if(a_bPremul) {
+					pnRow[d] *= nStride;
+				}
+			}
+		}
+		pnRow[nLabels] = m_tAccept[s] - INVALID_RULE;
+	}
+	
+	return nStride;
+}
+
 ostream& operator<<(ostream& os, const dtable_t &src) {
 
 	int i, j, nLine;
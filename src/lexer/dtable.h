@@ -372,6 +372,15 @@ public:
 	inline int getDefaultState(void) const {
 		return m_nDefaultState;
 	}
+	// next state of @a_nState on transition label @a_nLabel, it is looked up
+	// through base/check/default chains in the same way as generated scanners
+	int getNextState(int a_nState, int a_nLabel) const;
+	// build dense transition table of all states, one row for each state,
+	// with a column for each transition label and a last column for the
+	// accepted rule offset by -INVALID_RULE, so that no entry is negative;
+	// if @a_bPremul is true, target states are multiplied by the row size,
+	// return the row size
+	int getFullTable(vint_t &a_vnFull, bool a_bPremul) const;
 	inline int getEOFRuleBase(void) const {
 		return m_nSCEOFRuleBase;
 	}
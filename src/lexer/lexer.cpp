@@ -25,12 +25,17 @@
 using std::ostream;
 #include <queue>
 using std::queue;
+#include <algorithm>
+using std::sort;
+#include <thread>
+#include <atomic>
 
 #include "./lexer.h"
 
 #include "../common/common.h"
 #include "../common/strhelper.h"
 #include "../common/reporter.h"
+#include "../common/profiler.h"
 #include "../common/uset.h"
 using common_ns::iset_t;
 
@@ -90,6 +95,7 @@ void lexer_t::clearup(void) {
 	m_rLeaves.clear();
 	m_rInners.clear();
 	m_rTrees.clear();
+	m_visFollowPos.clear();
 	
 	m_charMap.clear();
 	m_scMgr.clear();
@@ -98,6 +104,8 @@ void lexer_t::clearup(void) {
 	m_vnLaNodes.clear();
 	m_tree2Rule.clear();
 	m_sc2EOFRule.clear();
+	m_vcsClasses.clear();
+	m_ucClassReps.clear();
 }
 
 // copy recursively from the tree rooted at @a_pSrc to the tree rooted at @a_pDest
@@ -125,6 +133,15 @@ void lexer_t::recursiveCopy(renode_t*& a_pDest, renode_t *a_pSrc) {
 		a_pDest = addStarNode(pLeft);
 		break;
 		
+	case renode_t::REPEAT:
+		
+		recursiveCopy(pLeft, a_pSrc->getChild());
+		assert(pLeft);
+		a_pDest = addRepeatNode(pLeft, a_pSrc->getRepeat()->m_nCount,
+				a_pSrc->getRepeat()->m_nLower, a_pSrc->getRepeat()->m_bStar);
+		a_pDest->setNullable(a_pSrc->getNullable());
+		break;
+		
 	case renode_t::CONCAT:
 		
 		recursiveCopy(pLeft, a_pSrc->getLeft());
@@ -154,12 +171,119 @@ void lexer_t::recursiveCopy(renode_t*& a_pDest, renode_t *a_pSrc) {
 	}
 }
 
+renode_t* lexer_t::addRepeatNode(renode_t *a_pChild, int a_nCount, int a_nLower, bool a_bStar) {
+	
+	assert(a_pChild);
+	if(a_nCount <= 1 && ! a_bStar) {
+		
+		if(a_nLower <= 0) {
+			a_pChild->setNullable(true);
+		}
+		return a_pChild;
+	}
+	
+	rerepeat_t *pRep = new rerepeat_t;
+	pRep->m_nCount = a_nCount;
+	pRep->m_nLower = a_nLower;
+	pRep->m_bStar = a_bStar;
+	pRep->m_bNullable = a_pChild->getNullable();
+	recursiveGetPositions(a_pChild, pRep->m_vnPos);
+	pRep->m_nSpan = (int)pRep->m_vnPos.size();
+	pRep->m_nBase = (int)m_rLeaves.size();
+	
+	for(int i = 0; i < pRep->m_nSpan; ++i) {
+		
+		pRep->m_vRanks.push_back(pair<int, int>(pRep->m_vnPos[i], i));
+	}
+	sort(pRep->m_vRanks.begin(), pRep->m_vRanks.end());
+	
+	// reserve positions of instances other than the first, they share its leaves
+	for(int k = 1; k < a_nCount; ++k) {
+		
+		for(int i = 0; i < pRep->m_nSpan; ++i) {
+			
+			m_rLeaves.push_back(m_rLeaves[pRep->m_vnPos[i]]);
+		}
+	}
+	if(m_bIsLookahead) {
+		
+		m_nCurLaNodes += (a_nCount - 1) * pRep->m_nSpan;
+	}
+	
+	renode_t* pnode = new renode_t(a_pChild, pRep, m_rInners.size());
+	m_rInners.push_back(pnode);
+	
+	return pnode;
+}
 
 // calculate FollowPos set of all nodes of the forest
 void lexer_t::calcFollowPos(void) {
 
+	m_visFollowPos.assign(m_rLeaves.size(), iset_t());
 	for(int i = 0; i < (int)m_rTrees.size(); ++i) {
-		recursiveCalcFollowPos(m_rTrees[i]->getRoot(), m_rLeaves);
+		recursiveCalcFollowPos(m_rTrees[i]->getRoot(), m_visFollowPos);
+	}
+}
+
+// partition bytes into equivalence classes by charsets of all leaves,
+// so that subset construction is done for each class instead of each byte
+void lexer_t::calcByteClasses(void) {
+	
+	const int nBytes = 256;
+	// map from byte to class ID
+	vint_t vnByteClass(nBytes, 0);
+	
+	vint_t vnSize(1, nBytes);
+	vint_t vnCount, vnNew;
+	for(int i = 0; i < (int)m_rLeaves.size(); ++i) {
+		
+		// positions of repeated instances share leaves
+		if(nullptr == m_rLeaves[i] || m_rLeaves[i]->getID() != i
+				|| m_rLeaves[i]->getEOF() || nullptr == m_rLeaves[i]->getCharSet()) {
+			continue;
+		}
+		const charset_t &cs = *m_rLeaves[i]->getCharSet();
+		
+		// count bytes of each class in the charset
+		vnCount.assign(vnSize.size(), 0);
+		for(int c = 0; c < nBytes; ++c) {
+			if(cs.test((unsigned char)c)) {
+				++vnCount[vnByteClass[c]];
+			}
+		}
+		
+		// split classes which are partly in the charset
+		const int nClasses = (int)vnSize.size();
+		vnNew.assign(nClasses, INVALID_INDEX);
+		for(int k = 0; k < nClasses; ++k) {
+			if(vnCount[k] > 0 && vnCount[k] < vnSize[k]) {
+				vnNew[k] = (int)vnSize.size();
+				vnSize[k] -= vnCount[k];
+				vnSize.push_back(vnCount[k]);
+			}
+		}
+		for(int c = 0; c < nBytes; ++c) {
+			
+			const int nClass = vnByteClass[c];
+			if(cs.test((unsigned char)c) && vnNew[nClass] != INVALID_INDEX) {
+				vnByteClass[c] = vnNew[nClass];
+			}
+		}
+	}
+	
+	// number classes in order of their least bytes
+	vnNew.assign(vnSize.size(), INVALID_INDEX);
+	m_vcsClasses.clear();
+	m_ucClassReps.clear();
+	for(int c = 0; c < nBytes; ++c) {
+		
+		int &nClass = vnNew[vnByteClass[c]];
+		if(_EQ(nClass, INVALID_INDEX)) {
+			nClass = (int)m_vcsClasses.size();
+			m_vcsClasses.push_back(charset_t());
+			m_ucClassReps.push_back((uchar)c);
+		}
+		m_vcsClasses[nClass].set((unsigned char)c);
 	}
 }
 
@@ -325,11 +449,16 @@ bool lexer_t::retrees2DGraph(int a_nSC, dgraph_t &a_dGrp, dstate_set_t& dset) {
 		}
 
 		ustring ucLabels;
-		pDState->m_ptransLabel->getSetChars(ucLabels);
 		
-		// compute out-going node for DFA graph
+		// compute out-going node for DFA graph,
+		// all bytes of an equivalence class lead to the same node
 		dstate_set_t priNext;
-		for(i = 0; i < (int)ucLabels.size(); ++i) {
+		for(i = 0; i < (int)m_vcsClasses.size(); ++i) {
+			
+			const unsigned char cRep = (unsigned char)m_ucClassReps[i];
+			if( ! pDState->m_ptransLabel->test(cRep)) {
+				continue;
+			}
 			
 			dstate_info_t* priNew = new dstate_info_t(INVALID_STATE,
 					new iset_t, nullptr);
@@ -337,9 +466,9 @@ bool lexer_t::retrees2DGraph(int a_nSC, dgraph_t &a_dGrp, dstate_set_t& dset) {
 			for(iset_t::const_iterator cit = pDState->m_psubSet->begin();
 					cit != pDState->m_psubSet->end(); ++cit) {
 
-				if(m_rLeaves[*cit]->getCharSet()->test((unsigned char)ucLabels[i])) {
+				if(m_rLeaves[*cit]->getCharSet()->test(cRep)) {
 					
-					priNew->m_psubSet->merge(m_rLeaves[*cit]->followPos());
+					priNew->m_psubSet->merge(m_visFollowPos[*cit]);
 				}
 			}
 			
@@ -352,18 +481,23 @@ bool lexer_t::retrees2DGraph(int a_nSC, dgraph_t &a_dGrp, dstate_set_t& dset) {
 				pair < dstate_it_t, bool > ret = priNext.insert(priNew);
 				if(!ret.second) {
 					
-					(*ret.first)->m_ptransLabel->set((unsigned char)ucLabels[i]);
+					(*(*ret.first)->m_ptransLabel) |= m_vcsClasses[i];
 					
 					delete priNew;
 				}
 				else {
 					
-					priNew->m_ptransLabel = new charset_t((unsigned char)ucLabels[i]);
+					priNew->m_ptransLabel = new charset_t(m_vcsClasses[i]);
 				}
 			}			
 		}
 	
-		for(dstate_it_t it = priNext.begin(); it != priNext.end(); ++it) {
+		// visit next states in order of their subsets, so that
+		// numbering of DFA states doesn't depend on hash values
+		vector<dstate_info_t*> vpNext(priNext.begin(), priNext.end());
+		sort(vpNext.begin(), vpNext.end(), dstate_less_t());
+		
+		for(vector<dstate_info_t*>::iterator it = vpNext.begin(); it != vpNext.end(); ++it) {
 			
 			// update char map information
 			assert(*it && (*it)->m_ptransLabel);
@@ -405,7 +539,18 @@ bool lexer_t::retrees2DGraph(int a_nSC, dgraph_t &a_dGrp, dstate_set_t& dset) {
 	
 	m_sc2EOFRule.push_back(nscEOFRule);
 	
-	for(i = 0; i < (int)vtIdx.size(); ++i)	{
+	releaseTrees(a_nSC);
+	
+	return true;
+}
+
+// release RE trees of a start-condition, which are not referenced by any other one
+void lexer_t::releaseTrees(int a_nSC) {
+	
+	vint_t vtIdx;
+	m_scMgr.getTrees(a_nSC, vtIdx);
+	
+	for(int i = 0; i < (int)vtIdx.size(); ++i)	{
 		
 		if(_EQ(0, m_rTrees[vtIdx[i]]->decRef())) {
 			
@@ -414,7 +559,300 @@ bool lexer_t::retrees2DGraph(int a_nSC, dgraph_t &a_dGrp, dstate_set_t& dset) {
 			m_rTrees[vtIdx[i]] = nullptr;
 		}
 	}
+}
+
+// build DFA of a start-condition apart from the shared DFA graph; it only reads
+// RE forest, so DFAs of different start-conditions can be built concurrently
+void lexer_t::buildSCDFA(int a_nSC, scdfa_t &a_dfa) const {
+	
+	vint_t vtIdx;
+	
+	assert(a_nSC >= 0 && a_nSC < (int)m_scMgr.size());
+	m_scMgr.getTrees(a_nSC, vtIdx);
+	
+	a_dfa.m_vStates.clear();
+	a_dfa.m_nFull = a_dfa.m_nNoHat = -1;
+	if(vtIdx.size() == 0) {
+		// useless start-condition
+		return;
+	}
+	
+	int i = 0, nHat = 0;
+	iset_t *pisetFull = new iset_t;
+	iset_t *pisetNohat = new iset_t;
+	
+	// identify start state for both DFAs
+	for(i = 0; i < (int)vtIdx.size(); ++i)	{
+
+		assert(m_rTrees[vtIdx[i]]);
+		pisetFull->merge(m_rTrees[vtIdx[i]]->getRoot()->firstPos());
+		
+		if(m_rTrees[vtIdx[i]]->getBOL()) {
+			++nHat;
+		}
+		else {
+			pisetNohat->merge(m_rTrees[vtIdx[i]]->getRoot()->firstPos());
+		}
+	}
+	
+	// local states are found by their subsets
+	dstate_set_t dset;
+	queue<int> quDState;
+	scstate_t state;
+	state.m_nRule = INVALID_RULE;
+	state.m_nAction = INVALID_ACTION;
+	state.m_nEOFRule = INVALID_RULE;
+	
+	state.m_pInfo = new dstate_info_t(0, pisetFull, new charset_t);
+	dset.insert(state.m_pInfo);
+	a_dfa.m_vStates.push_back(state);
+	quDState.push(0);
+	a_dfa.m_nFull = 0;
+	
+	if(_EQ(0, nHat)) {// no DFA with hat need to create
+		
+		a_dfa.m_nNoHat = a_dfa.m_nFull;
+		delete pisetNohat;
+	}
+	else if(_EQ((int)vtIdx.size(), nHat)) {// DFA with hat is equal to full DFA
+		
+		delete pisetNohat;
+	}
+	else {
+		
+		dstate_info_t *pDState = new dstate_info_t(1, pisetNohat, new charset_t);
+		pair<dstate_it_t, bool > ret = dset.insert(pDState);
+		if(ret.second) {
+			
+			state.m_pInfo = pDState;
+			a_dfa.m_vStates.push_back(state);
+			quDState.push(1);
+		}
+		else {
+			
+			delete pDState;
+		}
+		a_dfa.m_nNoHat = (*ret.first)->m_nID;
+	}
+	
+	// breadth-first search to create DFA states
+	ustring ucLabels;
+	while( ! quDState.empty()) {
+		
+		const int nState = quDState.front();
+		quDState.pop();
+		dstate_info_t *pDState = a_dfa.m_vStates[nState].m_pInfo;
+		int nRule = INVALID_RULE, nAction = INVALID_ACTION, nEOFRule = INVALID_RULE;
+		
+		for(iset_t::const_iterator cit = pDState->m_psubSet->begin();
+					cit != pDState->m_psubSet->end(); ++cit) {
+			
+			assert(*cit >= 0 && *cit < (int)m_rLeaves.size());
+			renode_t *prNode = m_rLeaves[*cit];
+			const int nLeafRule = tree2Rule(prNode->getTreeID());
+			
+			if(prNode->getEOF()) {
+				
+				if(_EQ(INVALID_RULE, nEOFRule) || nLeafRule < nEOFRule) {
+					nEOFRule = nLeafRule;
+				}
+			}
+			else {
+				
+				(*pDState->m_ptransLabel) |= (*prNode->getCharSet());
+				
+				if(prNode->getEOR()) {// current state is accept state
+					
+					if(_EQ(INVALID_RULE, nRule) || nLeafRule < nRule) {
+						nRule = nLeafRule;
+					}
+					if(_EQ(INVALID_ACTION, nAction) || prNode->getActionIndex() < nAction) {
+						nAction = prNode->getActionIndex();
+					}
+				}
+			}
+		}
+		a_dfa.m_vStates[nState].m_nRule = nRule;
+		a_dfa.m_vStates[nState].m_nAction = nAction;
+		a_dfa.m_vStates[nState].m_nEOFRule = nEOFRule;
+		
+		// compute out-going states, same as retrees2DGraph does
+		dstate_set_t priNext;
+		for(i = 0; i < (int)m_vcsClasses.size(); ++i) {
+			
+			const unsigned char cRep = (unsigned char)m_ucClassReps[i];
+			if( ! pDState->m_ptransLabel->test(cRep)) {
+				continue;
+			}
+			
+			dstate_info_t* priNew = new dstate_info_t(INVALID_STATE,
+					new iset_t, nullptr);
+			
+			for(iset_t::const_iterator cit = pDState->m_psubSet->begin();
+					cit != pDState->m_psubSet->end(); ++cit) {
+
+				if(m_rLeaves[*cit]->getCharSet()->test(cRep)) {
+					
+					priNew->m_psubSet->merge(m_visFollowPos[*cit]);
+				}
+			}
+			
+			if(priNew->m_psubSet->size() == 0) {
+				
+				delete priNew;
+			}
+			else {
+				
+				pair < dstate_it_t, bool > ret = priNext.insert(priNew);
+				if(!ret.second) {
+					
+					(*(*ret.first)->m_ptransLabel) |= m_vcsClasses[i];
+					
+					delete priNew;
+				}
+				else {
+					
+					priNew->m_ptransLabel = new charset_t(m_vcsClasses[i]);
+				}
+			}			
+		}
+		
+		vector<dstate_info_t*> vpNext(priNext.begin(), priNext.end());
+		sort(vpNext.begin(), vpNext.end(), dstate_less_t());
+		
+		for(vector<dstate_info_t*>::iterator it = vpNext.begin(); it != vpNext.end(); ++it) {
+			
+			const charset_t csLabel = *(*it)->m_ptransLabel;
+			
+			pair < dstate_it_t, bool > ret = dset.insert(*it);
+			if(ret.second) {
+				
+				// find new state
+				(*it)->m_nID = (int)a_dfa.m_vStates.size();
+				(*it)->m_ptransLabel->reset();
+				state.m_pInfo = *it;
+				a_dfa.m_vStates.push_back(state);
+				quDState.push((*it)->m_nID);
+			}
+			else {
+				
+				delete *it;
+			}
+			a_dfa.m_vStates[nState].m_vArcs.push_back(pair<charset_t, int>(csLabel, (*ret.first)->m_nID));
+		}
+	}
+}
+
+// merge DFA of a start-condition into DFA graph, in the same order as
+// retrees2DGraph would create states; states already in @dset are shared
+bool lexer_t::mergeSCDFA(int a_nSC, scdfa_t &a_dfa, dgraph_t &a_dGrp, dstate_set_t& dset) {
+	
+	if(a_dfa.m_vStates.empty()) {
+		// useless start-condition
+		return false;
+	}
+	
+	int nscEOFRule = INVALID_RULE;
+	// map from local state to state of DFA graph
+	vint_t vnGlobal(a_dfa.m_vStates.size(), INVALID_STATE);
+	// local states not merged into @dset, to be freed
+	vint_t vnShared;
+	queue<int> quDState;
+	
+	int i, nStarts[2] = {a_dfa.m_nFull, a_dfa.m_nNoHat};
+	for(i = 0; i < 2; ++i) {
+		
+		const int nLocal = nStarts[i];
+		if(nLocal < 0 || vnGlobal[nLocal] != INVALID_STATE) {
+			continue;
+		}
+		
+		pair<dstate_it_t, bool > ret = dset.insert(a_dfa.m_vStates[nLocal].m_pInfo);
+		if(ret.second) {
+			
+			(*ret.first)->m_nID = a_dGrp.getNextState();
+			a_dGrp.newNode();
+			quDState.push(nLocal);
+		}
+		else {
+			
+			vnShared.push_back(nLocal);
+		}
+		vnGlobal[nLocal] = (*ret.first)->m_nID;
+	}
+	a_dGrp.addStartIndex(m_scMgr.getName(a_nSC), vnGlobal[a_dfa.m_nFull],
+			a_dfa.m_nNoHat < 0? INVALID_STATE: vnGlobal[a_dfa.m_nNoHat]);
+	
+	// breadth-first search to add new states to DFA graph
+	ustring ucLabels;
+	while( ! quDState.empty()) {
+		
+		const scstate_t &state = a_dfa.m_vStates[quDState.front()];
+		quDState.pop();
+		dgraph_node_t *pgNode = a_dGrp.getNode(state.m_pInfo->m_nID);
+		
+		if(state.m_nEOFRule != INVALID_RULE
+				&& (_EQ(INVALID_RULE, nscEOFRule) || state.m_nEOFRule < nscEOFRule)) {
+			// keep track of EOF-Rule for each start-condition
+			if(INVALID_RULE != nscEOFRule) {
+				a_dGrp.getDTable().decRuleRef(nscEOFRule);
+			}
+			nscEOFRule = state.m_nEOFRule;
+			a_dGrp.getDTable().addRuleRef(nscEOFRule);
+		}
+		if(state.m_nRule != INVALID_RULE) {
+			
+			pgNode->setRule(state.m_nRule);
+			a_dGrp.getDTable().addRuleRef(state.m_nRule);
+			pgNode->setAction(state.m_nAction);
+		}
+		
+		for(i = 0; i < (int)state.m_vArcs.size(); ++i) {
+			
+			// update char map information
+			state.m_vArcs[i].first.getSetChars(ucLabels);
+			m_charMap.addGroup(ucLabels);
+			
+			dgraph_arc_t *parc = a_dGrp.newArc(pgNode->getID(), INVALID_STATE, state.m_vArcs[i].first);
+			pgNode->addOutArc(parc);
+			
+			const int nLocal = state.m_vArcs[i].second;
+			if(_EQ(vnGlobal[nLocal], INVALID_STATE)) {
+				
+				pair < dstate_it_t, bool > ret = dset.insert(a_dfa.m_vStates[nLocal].m_pInfo);
+				if(ret.second) {
+					
+					// find new state, add new graph node
+					(*ret.first)->m_nID = a_dGrp.getNextState();
+					a_dGrp.newNode();
+					quDState.push(nLocal);
+				}
+				else {
+					
+					vnShared.push_back(nLocal);
+				}
+				vnGlobal[nLocal] = (*ret.first)->m_nID;
+			}
+			
+			parc->setToState(vnGlobal[nLocal]);
+			a_dGrp.getNode(vnGlobal[nLocal])->addInArc(parc);
+		}
+	}
+	
+	// free states which are not reachable from new states, or are shared
+	for(i = 0; i < (int)a_dfa.m_vStates.size(); ++i) {
+		
+		if(_EQ(vnGlobal[i], INVALID_STATE)) {
+			delete a_dfa.m_vStates[i].m_pInfo;
+		}
+	}
+	for(i = 0; i < (int)vnShared.size(); ++i) {
+		
+		delete a_dfa.m_vStates[vnShared[i]].m_pInfo;
+	}
+	a_dfa.m_vStates.clear();
 	
+	m_sc2EOFRule.push_back(nscEOFRule);
 	return true;
 }
 
@@ -425,23 +863,71 @@ void lexer_t::retrees2DTables(dtable_t &a_dTbl, gsetting_t &gsetup) {
 	
 	// first compute all followpos sets
 	calcFollowPos();
+	// and byte equivalence classes of all leaves
+	calcByteClasses();
 	
 	// next, convert REs to DFA graphs
 	int i;
-	for(i = 0; i < (int)m_scMgr.size(); ++i) {
+	const int nSCs = (int)m_scMgr.size();
+	common_ns::profiler_t *pProfiler = common_ns::profiler_t::getProfiler();
+	if(pProfiler) {
+		pProfiler->beginPhase("dfa");
+	}
+	if(gsetup.m_nThreads > 1 && nSCs > 1) {
+		
+		// build DFA of each start-condition on worker threads,
+		// then merge them in order of start-conditions
+		vector<scdfa_t> vDFAs(nSCs);
+		std::atomic<int> nNextSC(0);
+		vector<std::thread> vWorkers;
+		for(i = 0; i < gsetup.m_nThreads && i < nSCs; ++i) {
+			
+			vWorkers.push_back(std::thread([this, &vDFAs, &nNextSC, nSCs]() {
+				for(int nSC = nNextSC++; nSC < nSCs; nSC = nNextSC++) {
+					buildSCDFA(nSC, vDFAs[nSC]);
+				}
+			}));
+		}
+		for(i = 0; i < (int)vWorkers.size(); ++i) {
+			vWorkers[i].join();
+		}
 		
-		if(!retrees2DGraph(i, dg, dset)) {
+		for(i = 0; i < nSCs; ++i) {
 			
-			string strMsg = "Start-condition ";
-			strMsg += m_scMgr.getName(i);
-			strMsg += " is not referenced.";
-			_WARNING(strMsg);
+			if(!mergeSCDFA(i, vDFAs[i], dg, dset)) {
+				
+				string strMsg = "Start-condition ";
+				strMsg += m_scMgr.getName(i);
+				strMsg += " is not referenced.";
+				_WARNING(strMsg);
+			}
+		}
+		
+		for(i = 0; i < nSCs; ++i) {
+			releaseTrees(i);
+		}
+	}
+	else {
+		
+		for(i = 0; i < nSCs; ++i) {
+			
+			if(!retrees2DGraph(i, dg, dset)) {
+				
+				string strMsg = "Start-condition ";
+				strMsg += m_scMgr.getName(i);
+				strMsg += " is not referenced.";
+				_WARNING(strMsg);
+			}
 		}
 	}
 	
 	for(dstate_it_t it = dset.begin(); it != dset.end(); ++it) {
 		delete (*it);
 	}
+	if(pProfiler) {
+		pProfiler->addCount("states", dg.getStateCount() - FIRST_STATE);
+		pProfiler->endPhase();
+	}
 	
 	// compute charset
 	vustr_t vustr;
@@ -458,7 +944,7 @@ void lexer_t::retrees2DTables(dtable_t &a_dTbl, gsetting_t &gsetup) {
 	}
 
 	// convert DFA graphs to DFA tables
-	dg.toDTables();
+	dg.toDTables(gsetup);
 	// update DFAs and report warning about redundant information if there is any
 	assert(nullptr != gsetup.m_posLog);
 	a_dTbl.updateRules(m_sc2EOFRule, *(ostream*)gsetup.m_posLog);
@@ -32,6 +32,12 @@ using std::ostream;
 
 #include <set>
 using std::set;
+#include <unordered_set>
+using std::unordered_set;
+#include <vector>
+using std::vector;
+#include <utility>
+using std::pair;
 
 #include <functional>
 using std::binary_function;
@@ -54,6 +60,8 @@ namespace lexer_ns {
 class dstate_info_t {
 
 	friend class lexer_t;
+	friend class dstate_hash_t;
+	friend class dstate_equal_t;
 	
 	int m_nID;
 	iset_t *m_psubSet;
@@ -95,10 +103,53 @@ public:
 	}
 };
 
-typedef set < dstate_info_t*, dstate_less_t > dstate_set_t;
+// hash function of DFA states, using precomputed hash of their subsets
+class dstate_hash_t {
+	
+public:
+	inline size_t operator () (const dstate_info_t* a_pState) const {
+		assert(a_pState && a_pState->m_psubSet);
+		return a_pState->m_psubSet->hash();
+	}
+};
+
+class dstate_equal_t {
+	
+public:
+	inline bool operator () (const dstate_info_t* a_pLeft, const dstate_info_t* a_pRight) const {
+		assert(a_pLeft && a_pRight);
+		return *a_pLeft->m_psubSet == *a_pRight->m_psubSet;
+	}
+};
+
+typedef unordered_set < dstate_info_t*, dstate_hash_t, dstate_equal_t > dstate_set_t;
 typedef dstate_set_t::iterator dstate_it_t;
 typedef dstate_set_t::const_iterator dstate_cit_t;
 
+// DFA state of a start-condition, built apart from the shared DFA graph
+struct scstate_t {
+	
+	// subset of positions
+	dstate_info_t *m_pInfo;
+	// least rule and action of accepted leaves
+	int m_nRule;
+	int m_nAction;
+	// least rule of EOF leaves
+	int m_nEOFRule;
+	// out-going arcs: label and index of target state
+	vector< pair<charset_t, int> > m_vArcs;
+};
+
+// DFA of a start-condition, states are indexed from 0 in order of discovery
+struct scdfa_t {
+	
+	vector<scstate_t> m_vStates;
+	// start states of full DFA and of DFA without hat(^),
+	// the latter is -1 if all REs have a leading hat(^)
+	int m_nFull;
+	int m_nNoHat;
+};
+
 class lexer_t {
 
 private:
@@ -106,9 +157,13 @@ private:
 	// flag indicating if lexer is scanning lookahead nodes
 	bool m_bIsLookahead;
 	
+	// leaves indexed by positions, positions of repeated instances refer to
+	// leaves of instance 0
 	rnpool_t m_rLeaves;
 	rnpool_t m_rInners;
 	rtpool_t m_rTrees;
+	// FollowPos sets indexed by positions
+	vector<iset_t> m_visFollowPos;
 	
 	charmap_t m_charMap;
 	sc_mgr_t m_scMgr;
@@ -124,6 +179,12 @@ private:
 	
 	// map from tree ID to rule ID
 	vint_t m_tree2Rule;
+	
+	// byte equivalence classes: bytes of a class are contained by exactly the same leaves
+	// bytes of each class
+	vector<charset_t> m_vcsClasses;
+	// least byte of each class, representing the class
+	ustring m_ucClassReps;
 
 private:
 	
@@ -134,8 +195,18 @@ private:
 	void recursiveCopy(renode_t*& a_pDest, renode_t *a_pSrc);
 	// calculate FollowPos set of all nodes of the forest
 	void calcFollowPos(void);
+	// partition bytes into equivalence classes by charsets of all leaves
+	void calcByteClasses(void);
 	// convert RE trees associated with specific start-condition to DFA graph
 	bool retrees2DGraph(int a_nSC, dgraph_t &a_dGrp, dstate_set_t& dset);
+	// release RE trees of a start-condition, which are not referenced by any other one
+	void releaseTrees(int a_nSC);
+	// build DFA of a start-condition apart from the shared DFA graph; it only reads
+	// RE forest, so DFAs of different start-conditions can be built concurrently
+	void buildSCDFA(int a_nSC, scdfa_t &a_dfa) const;
+	// merge DFA of a start-condition into DFA graph, in the same order as
+	// retrees2DGraph would create states; states already in @dset are shared
+	bool mergeSCDFA(int a_nSC, scdfa_t &a_dfa, dgraph_t &a_dGrp, dstate_set_t& dset);
 
 	friend ostream& operator<<(ostream& os, const lexer_t &src);
 	
@@ -220,6 +291,10 @@ public:
 		return pnode;		
 	}
 	
+	// repeat @a_pChild @a_nCount times, instances from @a_nLower on are optional,
+	// and the last one repeats itself if @a_bStar
+	renode_t* addRepeatNode(renode_t *a_pChild, int a_nCount, int a_nLower, bool a_bStar);
+	
 	inline renode_t* addUnionNode(renode_t *a_pLeft, renode_t *a_pRight) {
 		
 		assert(a_pLeft && a_pRight);
@@ -277,7 +352,7 @@ public:
 	}
 	
 	// get ID of the rule corresponding to @a_nTreeID
-	inline int tree2Rule(int a_nTreeID) {
+	inline int tree2Rule(int a_nTreeID) const {
 	
 		assert(a_nTreeID >= 0 && a_nTreeID < (int)m_tree2Rule.size());
 		
@@ -23,6 +23,11 @@
 using std::string;
 #include <stack>
 using std::stack;
+#include <deque>
+using std::deque;
+#include <algorithm>
+using std::lower_bound;
+using std::sort;
 using std::pair;
 
 #include "../common/common.h"
@@ -59,42 +64,100 @@ inline static void setActionIndex(renode_t *a_pNode, void *a_pActionIndex) {
 	}		
 }
 
-inline static void resetFollowPos(renode_t *a_pNode, void *pv) {
+// instance of a repeated subtree that a node lies in,
+// linked to the instance enclosing it
+struct reinst_t {
 	
-	a_pNode->followPos().clear();
+	const rerepeat_t *m_pRepeat;
+	int m_nInst;
+	const reinst_t *m_pOuter;
+};
+
+// map position of instance 0 of all enclosing repeats to its actual position
+inline static int mapPos(int a_nPos, const reinst_t *a_pInst) {
+	
+	for(; a_pInst; a_pInst = a_pInst->m_pOuter) {
+		
+		a_nPos = a_pInst->m_pRepeat->shiftPos(a_nPos, a_pInst->m_nInst);
+	}
+	return a_nPos;
 }
 
-inline static void calcFPos(renode_t *a_pNode, void *pv) {
+// merge positions of @a_isSrc mapped by @a_pInst into @a_isDest
+static void mergeMapped(const iset_t &a_isSrc, const reinst_t *a_pInst, iset_t &a_isDest) {
 	
-	rnpool_t *pnp = (rnpool_t*) pv;
+	if(nullptr == a_pInst) {
+		
+		a_isDest.merge(a_isSrc);
+		return;
+	}
 	
-	switch(a_pNode->getType()) {
+	vint_t vnPos;
+	for(iset_t::const_iterator cit = a_isSrc.begin(); cit != a_isSrc.end(); ++cit) {
+		
+		vnPos.push_back(mapPos(*cit, a_pInst));
+	}
+	sort(vnPos.begin(), vnPos.end());
 	
-	case renode_t::STAR:    {
+	iset_t isPos;
+	for(int i = 0; i < (int)vnPos.size(); ++i) {
 		
-	    	for(iset_t::iterator it = a_pNode->lastPos().begin(); it != a_pNode->lastPos().end(); ++it) {
-	    		
-	    		((*pnp)[*it])->followPos().merge(a_pNode->firstPos());
-	        }
-	    }
+		isPos.insert(vnPos[i]);
+	}
+	a_isDest.merge(isPos);
+}
 
-	    break;
-	    
-	case renode_t::CONCAT:    {
+// add positions of @a_isFirst to FollowPos sets of positions of @a_isLast,
+// @a_isFirst is mapped already
+static void addFollowPos(const iset_t &a_isLast, const reinst_t *a_pInst,
+		const iset_t &a_isFirst, vector<iset_t> &a_visFollow) {
+	
+	for(iset_t::const_iterator cit = a_isLast.begin(); cit != a_isLast.end(); ++cit) {
 		
-	        assert(a_pNode->getLeft() && a_pNode->getRight());
+		a_visFollow[mapPos(*cit, a_pInst)].merge(a_isFirst);
+	}
+}
+
+int rerepeat_t::shiftPos(int a_nPos, int a_nInst) const {
 	
-	        for(iset_t::iterator it = a_pNode->getLeft()->lastPos().begin(); 
-	        	it != a_pNode->getLeft()->lastPos().end(); ++it) {
-	           
-	        	((*pnp)[*it])->followPos().merge(a_pNode->getRight()->firstPos());
-	        }
-	    }
+	if(_EQ(0, a_nInst)) {
+		
+		return a_nPos;
+	}
 	
-		break;
+	vector< pair<int, int> >::const_iterator cit = lower_bound(m_vRanks.begin(),
+			m_vRanks.end(), pair<int, int>(a_nPos, 0));
+	assert(cit != m_vRanks.end() && _EQ(cit->first, a_nPos));
+	
+	return m_nBase + (a_nInst - 1) * m_nSpan + cit->second;
+}
+
+renode_t::renode_t(renode_t *a_pChild, rerepeat_t *a_pRepeat, int a_nID)
+: m_nType(REPEAT)
+, m_nID(a_nID)
+, m_pChild(a_pChild)
+, m_pRepeat(a_pRepeat) {
+	
+	assert(a_pChild && a_pRepeat && a_pRepeat->m_nCount > 1);
+	
+	// r{m,n} is taken as r{m} followed by n - m of r?
+	int k;
+	m_bNullable = a_pRepeat->isOptional(0);
+	for(k = 0; k < a_pRepeat->m_nCount; ++k) {
 		
-	default:
-		;// do nothing
+		reinst_t inst = {a_pRepeat, k, nullptr};
+		mergeMapped(a_pChild->m_isFirstPos, &inst, m_isFirstPos);
+		if( ! a_pRepeat->isOptional(k)) {
+			break;
+		}
+	}
+	for(k = a_pRepeat->m_nCount - 1; k >= 0; --k) {
+		
+		reinst_t inst = {a_pRepeat, k, nullptr};
+		mergeMapped(a_pChild->m_isLastPos, &inst, m_isLastPos);
+		if( ! a_pRepeat->isOptional(k)) {
+			break;
+		}
 	}
 }
 
@@ -127,20 +190,23 @@ static void outputNode(renode_t *a_pNode, void *pv) {
 				*pstr += ',';
 				*pstr += strhelper_t::fromUint((unsigned char)ustr[i], 10);
 			}
-			*pstr += "; follow:";						
-			for(iset_t::const_iterator cit = a_pNode->followPos().begin();
-				cit != a_pNode->followPos().end(); ++cit) {
-				
-				*pstr += ' ';
-				*pstr += strhelper_t::fromInt(*cit);
-			}	
 			*pstr += ']';
 			
 		}
 		break;
-	case renode_t::STAR: {
+	case renode_t::STAR:
+	case renode_t::REPEAT: {
 		
-			*pstr += "[*; first:";
+			if(_EQ(renode_t::STAR, a_pNode->getType())) {
+				
+				*pstr += "[*; first:";
+			}
+			else {
+				
+				*pstr += "[{";
+				*pstr += strhelper_t::fromInt(a_pNode->getRepeat()->m_nCount);
+				*pstr += a_pNode->getRepeat()->m_bStar? ",}; first:": "}; first:";
+			}
 			
 			for(iset_t::const_iterator cit = a_pNode->firstPos().begin();
 				cit != a_pNode->firstPos().end(); ++cit) {
@@ -221,9 +287,10 @@ void treePreordTravel(renode_t* a_pRoot, renode_visitor_t a_vFunc, void *pv) {
 		while(renode_t::CHARSET != a_pRoot->getType()) {
 			
 			renode_t *p = a_pRoot;
-			if(_EQ(renode_t::STAR, a_pRoot->getType())) {
+			if(_EQ(renode_t::STAR, a_pRoot->getType())
+					|| _EQ(renode_t::REPEAT, a_pRoot->getType())) {
 			
-				// STAR node
+				// STAR or REPEAT node
 				a_pRoot = a_pRoot->getChild();
 			}			
 			else {
@@ -267,7 +334,8 @@ void treeInordTravel(renode_t* a_pRoot, renode_visitor_t a_vFunc, void *pv) {
 					a_vFunc(rb.first, pv);				
 					break;
 				}	
-			case renode_t::STAR: {
+			case renode_t::STAR:
+			case renode_t::REPEAT: {
 				
 					stNode.top().second = true;
 					stNode.push(rb_pair_t(rb.first->getChild(), false));
@@ -311,14 +379,121 @@ void recursiveUpdateActionIndex(renode_t *a_pNode, int a_nActionIndex) {
 	treePreordTravel(a_pNode, setActionIndex, (void*)&a_nActionIndex);
 }
 
-void recursiveClearFollowPos(renode_t *a_pNode) {
+void recursiveGetPositions(renode_t *a_pNode, vint_t &a_vnPos) {
+	
+	switch(a_pNode->getType()) {
 	
-	treePreordTravel(a_pNode, resetFollowPos, nullptr);
+	case renode_t::CHARSET:
+		
+		a_vnPos.push_back(a_pNode->getID());
+		break;
+		
+	case renode_t::STAR:
+		
+		recursiveGetPositions(a_pNode->getChild(), a_vnPos);
+		break;
+		
+	case renode_t::REPEAT: {
+		
+			// positions of instance 0, then those of other instances
+			const rerepeat_t *pRep = a_pNode->getRepeat();
+			a_vnPos.insert(a_vnPos.end(), pRep->m_vnPos.begin(), pRep->m_vnPos.end());
+			for(int i = 0; i < (pRep->m_nCount - 1) * pRep->m_nSpan; ++i) {
+				
+				a_vnPos.push_back(pRep->m_nBase + i);
+			}
+		}
+		break;
+		
+	default:
+		
+		recursiveGetPositions(a_pNode->getLeft(), a_vnPos);
+		recursiveGetPositions(a_pNode->getRight(), a_vnPos);
+	}
 }
 
-void recursiveCalcFollowPos(renode_t* a_pRoot, rnpool_t& a_rpLeaves) {
+// FollowPos sets are computed for each instance of repeated subtrees as if
+// they were copied, positions of the subtree are mapped to those of the instance
+void recursiveCalcFollowPos(renode_t* a_pRoot, vector<iset_t> &a_visFollow) {
 	
-	treePreordTravel(a_pRoot, calcFPos, (void*)&a_rpLeaves);
+	typedef pair<renode_t*, const reinst_t*> ri_pair_t;
+	
+	// instances are kept until all their nodes are visited
+	deque<reinst_t> dqInst;
+	stack<ri_pair_t> stNode;
+	
+	stNode.push(ri_pair_t(a_pRoot, nullptr));
+	while( ! stNode.empty()) {
+		
+		renode_t *pNode = stNode.top().first;
+		const reinst_t *pInst = stNode.top().second;
+		stNode.pop();
+		
+		switch(pNode->getType()) {
+		
+		case renode_t::STAR: {
+			
+				iset_t isFirst;
+				mergeMapped(pNode->getChild()->firstPos(), pInst, isFirst);
+				addFollowPos(pNode->getChild()->lastPos(), pInst, isFirst, a_visFollow);
+				
+				stNode.push(ri_pair_t(pNode->getChild(), pInst));
+			}
+			break;
+			
+		case renode_t::CONCAT: {
+			
+				iset_t isFirst;
+				mergeMapped(pNode->getRight()->firstPos(), pInst, isFirst);
+				addFollowPos(pNode->getLeft()->lastPos(), pInst, isFirst, a_visFollow);
+				
+				stNode.push(ri_pair_t(pNode->getRight(), pInst));
+				stNode.push(ri_pair_t(pNode->getLeft(), pInst));
+			}
+			break;
+			
+		case renode_t::UNION:
+			
+			stNode.push(ri_pair_t(pNode->getRight(), pInst));
+			stNode.push(ri_pair_t(pNode->getLeft(), pInst));
+			break;
+			
+		case renode_t::REPEAT: {
+			
+				const rerepeat_t *pRep = pNode->getRepeat();
+				renode_t *pChild = pNode->getChild();
+				
+				for(int k = 0; k < pRep->m_nCount; ++k) {
+					
+					reinst_t inst = {pRep, k, pInst};
+					dqInst.push_back(inst);
+					
+					// instance k is followed by the next one, and by those after it
+					// as long as the ones between are optional
+					iset_t isFirst;
+					for(int j = k + 1; j < pRep->m_nCount; ++j) {
+						
+						reinst_t next = {pRep, j, pInst};
+						mergeMapped(pChild->firstPos(), &next, isFirst);
+						if( ! pRep->isOptional(j)) {
+							break;
+						}
+					}
+					if(pRep->m_bStar && _EQ(k, pRep->m_nCount - 1)) {
+						
+						mergeMapped(pChild->firstPos(), &dqInst.back(), isFirst);
+					}
+					addFollowPos(pChild->lastPos(), &dqInst.back(), isFirst, a_visFollow);
+					
+					stNode.push(ri_pair_t(pChild, &dqInst.back()));
+				}
+			}
+			break;
+			
+		default:
+			;// do nothing
+		}
+	}
 }
 
 void retree_t::clear(void) {
@@ -24,8 +24,11 @@
 
 #include <vector>
 using std::vector;
+#include <utility>
+using std::pair;
 
 #include "../common/common.h"
+#include "../common/types.h"
 #include "../common/uset.h"
 using common_ns::charset_t;
 using common_ns::iset_t;
@@ -34,6 +37,35 @@ using common_ns::iset_t;
 
 namespace lexer_ns {
 
+// instances of a subtree repeated by r{m,n}, r{m,} or r+; instance 0 is the
+// subtree itself, no node is created for others, instead positions of instance k
+// are numbered from m_nBase + (k - 1) * m_nSpan in order of positions of the subtree,
+// just as copies of the subtree would be
+struct rerepeat_t {
+	
+	// number of instances
+	int m_nCount;
+	// instances from m_nLower on are optional
+	int m_nLower;
+	// the last instance repeats itself
+	bool m_bStar;
+	// the subtree is nullable
+	bool m_bNullable;
+	int m_nBase;
+	int m_nSpan;
+	// positions of the subtree in order, and their ranks sorted by positions
+	vint_t m_vnPos;
+	vector< pair<int, int> > m_vRanks;
+	
+	inline bool isOptional(int a_nInst) const {
+		
+		return m_bNullable || a_nInst >= m_nLower;
+	}
+	
+	// position in instance @a_nInst corresponding to @a_nPos of the subtree
+	int shiftPos(int a_nPos, int a_nInst) const;
+};
+
 // node of regular expression tree
 class renode_t {
 
@@ -42,7 +74,8 @@ public:
 		CHARSET,
 		STAR,
 		CONCAT,
-		UNION
+		UNION,
+		REPEAT
 	};
 	
 private:
@@ -53,7 +86,6 @@ private:
 	bool m_bNullable;
 	iset_t m_isFirstPos;
 	iset_t m_isLastPos;
-	iset_t m_isFollowPos;
 	
 	union{
 		
@@ -70,9 +102,10 @@ private:
 			};
 		};
 		
-		// when m_nType == STAR
+		// when m_nType == STAR or m_nType == REPEAT
 		struct {
 			renode_t *m_pChild;
+			rerepeat_t *m_pRepeat;
 		};
 		
 		// when m_nType == CONCAT or m_nType == UNION
@@ -107,13 +140,17 @@ public:
 	: m_nType(STAR)
 	, m_nID(a_nID)
 	, m_bNullable(true)
-	, m_pChild(a_pChild) {
+	, m_pChild(a_pChild)
+	, m_pRepeat(nullptr) {
 	
 		m_isFirstPos.merge(a_pChild->m_isFirstPos);
 		m_isLastPos.merge(a_pChild->m_isLastPos);
 		
 	}
 	
+	// REPEAT node, it takes ownership of @a_pRepeat
+	renode_t(renode_t *a_pChild, rerepeat_t *a_pRepeat, int a_nID);
+	
 	inline renode_t(renode_t *a_pLeft, renode_t *a_pRight, node_type_t a_nType, int a_nID)
 	: m_nType(a_nType)
 	, m_nID(a_nID)
@@ -238,11 +275,6 @@ public:
 		return m_isLastPos;
 	}
 	
-	inline iset_t& followPos(void) {
-		
-		return m_isFollowPos;
-	}
-	
 	inline node_type_t getType(void) const {
 		
 		return m_nType;
@@ -261,10 +293,16 @@ public:
 	
 	inline renode_t* getChild(void) const {
 		
-		assert(_EQ(STAR, m_nType));
+		assert(_EQ(STAR, m_nType) || _EQ(REPEAT, m_nType));
 		return m_pChild;
 	}
 	
+	inline const rerepeat_t* getRepeat(void) const {
+		
+		assert(_EQ(REPEAT, m_nType));
+		return m_pRepeat;
+	}
+	
 	inline renode_t* getLeft(void) const {
 		
 		assert(_EQ(CONCAT, m_nType) || _EQ(UNION, m_nType));
@@ -282,6 +320,10 @@ public:
 			
 			delete m_pCharSet;
 		}
+		else if(_EQ(REPEAT, m_nType)) {
+			
+			delete m_pRepeat;
+		}
 	}
 
 };
@@ -397,10 +439,10 @@ void recusiveUpdateLookahead(renode_t *a_pNode, bool a_bFlag);
 void recursiveUpdateTreeID(renode_t *a_pNode, int a_nTreeID);
 // update code index of all leaf nodes of the tree
 void recursiveUpdateActionIndex(renode_t *a_pNode, int a_nActionIndex);
-// clear FollowPos set of all nodes of the subtee
-void recursiveClearFollowPos(renode_t *a_pNode);
-// calculate FollowPos set of all nodes of the tree
-void recursiveCalcFollowPos(renode_t* a_pRoot, rnpool_t& a_rpLeaves);
+// get positions of the tree in order, including those of repeated instances
+void recursiveGetPositions(renode_t *a_pNode, vint_t &a_vnPos);
+// calculate FollowPos sets of all positions of the tree, indexed by positions
+void recursiveCalcFollowPos(renode_t* a_pRoot, vector<iset_t> &a_visFollow);
 
 }
 
@@ -43,6 +43,8 @@ using common_ns::strhelper_t;
 using common_ns::filehelper_t;
 #include "../common/reporter.h"
 using common_ns::reporter_factory_t;
+#include "../common/profiler.h"
+using common_ns::profiler_t;
 #include "./mreporter.h"
 
 #include "../coder/metakeys.h"
@@ -76,6 +78,56 @@ enum {
 // only used by flex
 typedef void* yyscan_t;
 
+// profile_report_t: profiles generation as phase `total' while it lives,
+// then writes the report in JSON to its file and in text to log stream
+class profile_report_t {
+	
+private:
+	
+	profiler_t m_profiler;
+	ofstream *m_pofsJSON;
+	ostream *m_posText;
+	
+	profile_report_t(const profile_report_t&);
+	profile_report_t& operator=(const profile_report_t&);
+	
+public:
+	
+	profile_report_t(void)
+	: m_pofsJSON(nullptr)
+	, m_posText(nullptr) {
+	}
+	~profile_report_t(void) {
+		
+		if(m_pofsJSON) {
+			
+			m_profiler.endPhase();
+			profiler_t::setProfiler(nullptr);
+			
+			m_profiler.reportJSON(*m_pofsJSON);
+			m_pofsJSON->close();
+			delete m_pofsJSON;
+			m_profiler.reportText(*m_posText);
+		}
+	}
+	
+	bool start(const string &a_strFile, ostream *a_posText) {
+		
+		assert(nullptr == m_pofsJSON && a_posText);
+		m_pofsJSON = new ofstream(a_strFile.c_str());
+		if( ! (*m_pofsJSON)) {
+			delete m_pofsJSON;
+			m_pofsJSON = nullptr;
+			return false;
+		}
+		m_posText = a_posText;
+		
+		profiler_t::setProfiler(&m_profiler);
+		m_profiler.beginPhase("total");
+		return true;
+	}
+};
+
 // entry function to parse script file, this function is originally generated with the help of Flex & Bison
 // @lexer: container that contains all the stuff needed in the process of scanning
 // @dtbl: DFA tables to be created
@@ -125,23 +177,44 @@ void usage(ostream &os) {
 Usage: upgen [OPTIONS] FILENAME\n\
 \n\
 Options and associated arguments\n\
+-b DIR              cache compiled language SPECs in directory DIR, so that\n\
+                    each SPEC is compiled once instead of on each run\n\
 -c                  enable column information computation, \n\
                     to take effect, -l must be set\n\
 -d                  generate diagnosis information for scanner\n\
 -D                  generate diagnosis information for parser\n\
+-e ENGINE           method computing LALR lookaheads: prop(default), \n\
+                    lr1, dp, or check to verify all methods agree\n\
+-f                  emit full transition table of scanner, uncompressed\n\
+-F                  like -f, with states pre-multiplied by size of rows\n\
+-g FILENAME         profile generation: wall time, peak memory and counts\n\
+                    of each phase are written to FILENAME in JSON, and\n\
+                    to standard error as text\n\
 -H                  generate declaration file(e.g. .h file for C or C++)\n\
 -i                  patterns match input text case-insensitively\n\
+-j THREADS          build DFAs of start-conditions on THREADS threads\n\
+-k                  pack parse tables with default reductions and gotos,\n\
+                    and merged rows, instead of bitmap-guarded tables\n\
 -l                  enable locations computation\n\
 -L                  generate `#line\' (or likewise) directives\n\
 -m                  do not generate scanner\n\
+-n                  do not minimize DFA of scanner\n\
 -o FILENAME         specify name of generated file\n\
 -p                  do not generate parser\n\
 -P PREFIX           name prefix, the default is yy\n\
+-r                  generate reentrant scanner and parser (C++), all states\n\
+                    are held in parser objects created by yycreate()\n\
 -s SPEC             specify programming language in which program is generated\n\
+                    SPEC:table (default) or SPEC:direct selects how the\n\
+                    scanner is emitted, as compressed tables or as code\n\
 -S                  enable default action in pattern-matching\n\
 -t                  output generated program to stdout\n\
+-u                  generate push scanner and parser (C++), input is fed\n\
+                    by yylexchunk() and tokens by yypush()\n\
 -v                  report details on LALR grammar\n\
 -V                  show version information\n\
+-w KB               warn if full transition table is larger than KB\n\
+                    kilobytes, the default is 1024\n\
 -\?, -h              show help message\n\
 \n\
 Examples:\n\
@@ -155,6 +228,8 @@ If we want the program in Object Pascal, we use:\n\
 \n\
 	upgen -o dcalc.pas -s pas dcalc.upg\n\
 Both C++ and Object Pascal are built-in target languages.\n\
+A faster but larger scanner, one block of code for each DFA state, is\n\
+generated by `-s c++:direct\' or `-s pas:direct\'.\n\
 If we have a JAVA language SPEC, say `upgen-java-spec.xml\', and want to\n\
 generate the program in JAVA, then we use the following command instead:\n\
 \n\
@@ -209,17 +284,23 @@ bool analyze(const char *a_pchFile,
 	// parse script file
 	// in the process, regular expression trees and grammar object are constructed,
 	// and also user actions are extracted from the script file
-	bool bret = (0 == debug_yyparse(lexer, dtbl, grmmr, ptbl, dmap, gsetup));
+	bool bret;
+	{
+		_PROFILE_PHASE("parse script");
+		bret = (0 == debug_yyparse(lexer, dtbl, grmmr, ptbl, dmap, gsetup));
+	}
 	
 	if(bret) {
 		
 		if( ! gsetup.m_bNoScanner) {
 			
+			_PROFILE_PHASE("scanner");
 			// convert from regular expression trees to DFA tables
 			lexer.retrees2DTables(dtbl, gsetup);
 		}
 		
 		if( ! gsetup.m_bNoParser) {
+			_PROFILE_PHASE("parser");
 			// convert from grammar object to LALR tables
 			grmmr.gram2PTable(ptbl, gsetup);
 		}
@@ -249,16 +330,22 @@ bool analyze(lexer_t &lexer, dtable_t &dtbl,
 	// parse script file
 	// in the process, regular expression trees and grammar object are constructed,
 	// and also user actions are extracted from the script file
-	bool bret = (0 == debug_yyparse(lexer, dtbl, grmmr, ptbl, dmap, gsetup));
+	bool bret;
+	{
+		_PROFILE_PHASE("parse script");
+		bret = (0 == debug_yyparse(lexer, dtbl, grmmr, ptbl, dmap, gsetup));
+	}
 	
 	if(bret) {
 		
 		if( ! gsetup.m_bNoScanner) {
+			_PROFILE_PHASE("scanner");
 			// convert from regular expression trees to DFA tables
 			lexer.retrees2DTables(dtbl, gsetup);
 		}
 		
 		if( ! gsetup.m_bNoParser) {
+			_PROFILE_PHASE("parser");
 			// convert from grammar object to LALR tables
 			grmmr.gram2PTable(ptbl, gsetup);
 		}
@@ -274,7 +361,7 @@ int upgmain(int argc, char **argv) {
 	
 	reporter_factory_t::setReporter(mreporter_t::getOne(""));
 	
-	if(!chdlr.process(argc, argv, "acdDhHilLmopPsStvV?", "0000000000202200000")) {
+	if(!chdlr.process(argc, argv, "abcdDefFghHijklLmnopPrsStuvVw?", "020002002000200000202020000020")) {
 		// failed to process command line
 		usage(cerr);
 		return - 1;
@@ -391,6 +478,79 @@ int upgmain(int argc, char **argv) {
 		}
 		gsetup.m_bNoScanner = true;
 	}
+	if(chdlr.getOption('n', str)) {
+		// no argument permitted for option 'n': disable DFA minimization
+		if(!str.empty()) {
+			
+			_ERROR("invalid argument with `-n\'.", ECMD(4));
+			usage(cerr);
+			return -1;
+		}
+		gsetup.m_bMinimize = false;
+	}
+	if(chdlr.getOption('f', str) || chdlr.getOption('F', str)) {
+		// no argument permitted for option 'f' or 'F': emit full transition table
+		if(!str.empty()) {
+			
+			_ERROR("invalid argument with `-f\' or `-F\'.", ECMD(4));
+			usage(cerr);
+			return -1;
+		}
+		gsetup.m_nLexTable = chdlr.hasOption('F')? LEX_TABLE_PREMUL : LEX_TABLE_FULL;
+	}
+	if(chdlr.getOption('w', str)) {
+		// size of full transition table in KB, above which a warning is issued
+		unsigned int nKBytes = 0;
+		if( ! strhelper_t::toNum(str, nKBytes)) {
+			
+			_ERROR("invalid option `-w\', size in KB expected.", ECMD(23));
+			usage(cerr);
+			return -1;
+		}
+		gsetup.m_nFullTableWarn = (int)nKBytes;
+	}
+	if(chdlr.getOption('e', str)) {
+		// name of method computing LALR lookaheads
+		if(str == "prop") {
+			gsetup.m_nLALREngine = LALR_ENGINE_PROPAGATE;
+		}
+		else if(str == "lr1") {
+			gsetup.m_nLALREngine = LALR_ENGINE_LR1MERGE;
+		}
+		else if(str == "dp") {
+			gsetup.m_nLALREngine = LALR_ENGINE_DEREMER;
+		}
+		else if(str == "check") {
+			gsetup.m_nLALREngine = LALR_ENGINE_CHECK;
+		}
+		else {
+			
+			_ERROR("invalid option `-e', prop, lr1, dp or check expected.", ECMD(21));
+			usage(cerr);
+			return -1;
+		}
+	}
+	if(chdlr.getOption('j', str)) {
+		// number of threads building DFAs of start-conditions
+		unsigned int nThreads = 0;
+		if( ! strhelper_t::toNum(str, nThreads) || _EQ(nThreads, 0u)) {
+			
+			_ERROR("invalid option `-j\', positive number of threads expected.", ECMD(22));
+			usage(cerr);
+			return -1;
+		}
+		gsetup.m_nThreads = (int)nThreads;
+	}
+	if(chdlr.getOption('k', str)) {
+		// no argument permitted for option 'k': pack parse tables by merging rows
+		if(!str.empty()) {
+			
+			_ERROR("invalid argument with `-k\'.", ECMD(4));
+			usage(cerr);
+			return -1;
+		}
+		gsetup.m_nParseTable = PARSE_TABLE_MERGE;
+	}
 	if(chdlr.getOption('p', str)) {
 		// no argument permitted for option 'm': disable parsing program generation
 		if(!str.empty()) {
@@ -401,6 +561,26 @@ int upgmain(int argc, char **argv) {
 		}
 		gsetup.m_bNoParser = true;
 	}
+	if(chdlr.getOption('r', str)) {
+		// no argument permitted for option 'r': generate reentrant program
+		if(!str.empty()) {
+			
+			_ERROR("invalid argument with `-r'.", ECMD(4));
+			usage(cerr);
+			return -1;
+		}
+		gsetup.m_bReentrant = true;
+	}
+	if(chdlr.getOption('u', str)) {
+		// no argument permitted for option 'u': generate push scanner and parser
+		if(!str.empty()) {
+			
+			_ERROR("invalid argument with `-u'.", ECMD(4));
+			usage(cerr);
+			return -1;
+		}
+		gsetup.m_bPushMode = true;
+	}
 
 	if(chdlr.getOption('S', str)) {
 		// no argument permitted for option 'S': enable default action in pattern-matching
@@ -432,6 +612,28 @@ int upgmain(int argc, char **argv) {
 			usage(cerr);
 			return -1;
 		}
+		
+		// SPEC may be followed by the way scanner is emitted, such as `c++:direct'
+		string::size_type pos = strSpec.rfind(':');
+		if(pos != string::npos) {
+			
+			str = strhelper_t::toUpper(strSpec.substr(pos + 1));
+			if(str == "DIRECT" || str == "TABLE") {
+				
+				gsetup.m_bLexDirect = (str == "DIRECT");
+				strSpec.erase(pos);
+			}
+		}
+	}
+	if(gsetup.m_bLexDirect && gsetup.m_nLexTable != LEX_TABLE_COMB) {
+		// direct-coded scanner needs no transition table
+		_WARNING("option `-f\' or `-F\' is ignored by direct-coded scanner.");
+		gsetup.m_nLexTable = LEX_TABLE_COMB;
+	}
+	if(gsetup.m_bLexDirect && gsetup.m_bPushMode) {
+		// direct-coded scanner can not be suspended inside a token
+		_WARNING("push mode requires table-driven scanner, `:direct' is ignored.");
+		gsetup.m_bLexDirect = false;
 	}
 	
 	// try to get name of script file
@@ -523,6 +725,45 @@ int upgmain(int argc, char **argv) {
 		gsetup.m_posDetail = ofs;
 	}
 	
+	profile_report_t profReport;
+	if(chdlr.getOption('g', str)) {
+		
+		if(str.empty()) {
+			
+			_ERROR("invalid option `-g\', file name expected.", ECMD(24));
+			usage(cerr);
+			return -1;
+		}
+		if( ! profReport.start(str, (ostream*)gsetup.m_posLog)) {
+			
+			string strMsg = "failed to create profile file `";
+			strMsg += str;
+			strMsg += "\'.";
+			_ERROR(strMsg, ECMD(24));
+			return -1;
+		}
+	}
+	
+	if(chdlr.getOption('b', str)) {
+		
+		if(str.empty()) {
+			
+			_ERROR("invalid option `-b\', directory expected.", ECMD(25));
+			usage(cerr);
+			return -1;
+		}
+		if( ! filehelper_t::isAccessible(str)) {
+			
+			string strMsg = "failed to access SPEC cache directory `";
+			strMsg += str;
+			strMsg += "\'.";
+			_ERROR(strMsg, ECMD(25));
+			return -1;
+		}
+		gsetup.m_pchSpecCache = new char[str.size() + 1];
+		strcpy(gsetup.m_pchSpecCache, str.c_str());
+	}
+	
 	lexer_t lexer;
 	dtable_t dfa;
 	dmmap_t dmap;
@@ -615,6 +856,7 @@ int upgmain(int argc, char **argv) {
 	strSpec = strhelper_t::toUpper(strSpec);
 	
 	// now get ready to generate code
+	_PROFILE_PHASE("coder");
 	coder_t coder(dfa, lalr, dmap, gsetup);
 	char* pSPEC = nullptr;
 	int nSPECSize;
@@ -717,10 +959,20 @@ _gsetting_t::_gsetting_t(void) {
 	m_bDefaultAction = false;
 	m_bEnableDeclare = false;
 	m_bEnableLineNo = false;
+	m_bMinimize = true;
+	m_bLexDirect = false;
+	m_bReentrant = false;
+	m_bPushMode = false;
+	m_nLexTable = LEX_TABLE_COMB;
+	m_nFullTableWarn = 1024;
+	m_nLALREngine = LALR_ENGINE_PROPAGATE;
+	m_nParseTable = PARSE_TABLE_NICE;
+	m_nThreads = 1;
 	m_posLog = &cerr;
 	m_posDetail = nullptr;
 	m_pchLangName = nullptr;
 	m_pchNamePrefix = nullptr;
+	m_pchSpecCache = nullptr;
 }
 
 _gsetting_t::~_gsetting_t(void) {
@@ -732,6 +984,9 @@ _gsetting_t::~_gsetting_t(void) {
 	if(m_pchNamePrefix) {
 		delete[] m_pchNamePrefix;
 	}
+	if(m_pchSpecCache) {
+		delete[] m_pchSpecCache;
+	}
 	
 	if(m_posDetail) {
 		ofstream *pfos = (ofstream*)m_posDetail;
@@ -855,10 +1110,20 @@ std::ostream& operator<<(std::ostream& os, const _gsetting_t &gsetup) {
        << "m_bDefaultAction: " << (gsetup.m_bDefaultAction? "true" : "false") << std::endl
        << "m_bEnableDeclare: " << (gsetup.m_bEnableDeclare? "true" : "false") << std::endl
        << "m_bEnableLineNo: " << (gsetup.m_bEnableLineNo? "true" : "false") << std::endl
+       << "m_bMinimize: " << (gsetup.m_bMinimize? "true" : "false") << std::endl
+       << "m_bLexDirect: " << (gsetup.m_bLexDirect? "true" : "false") << std::endl
+       << "m_bReentrant: " << (gsetup.m_bReentrant? "true" : "false") << std::endl
+       << "m_bPushMode: " << (gsetup.m_bPushMode? "true" : "false") << std::endl
+       << "m_nLexTable: " << gsetup.m_nLexTable << std::endl
+       << "m_nFullTableWarn: " << gsetup.m_nFullTableWarn << std::endl
+       << "m_nLALREngine: " << gsetup.m_nLALREngine << std::endl
+       << "m_nParseTable: " << gsetup.m_nParseTable << std::endl
+       << "m_nThreads: " << gsetup.m_nThreads << std::endl
        << "m_nParseDLevel: " << gsetup.m_nParseDLevel << std::endl
        << "m_nLexDLevel: " << gsetup.m_nLexDLevel << std::endl
        << "m_pchLangName: " << (gsetup.m_pchLangName? gsetup.m_pchLangName : "null") << std::endl
-       << "m_pchNamePrefix: " << (gsetup.m_pchNamePrefix? gsetup.m_pchNamePrefix : "null") << std::endl;
+       << "m_pchNamePrefix: " << (gsetup.m_pchNamePrefix? gsetup.m_pchNamePrefix : "null") << std::endl
+       << "m_pchSpecCache: " << (gsetup.m_pchSpecCache? gsetup.m_pchSpecCache : "null") << std::endl;
     return os;
 
 }
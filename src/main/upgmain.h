@@ -36,6 +36,38 @@
 
 #include <ostream>
 
+// methods computing LALR(1) lookaheads
+enum lalr_engine_t {
+	// propagation of spontaneous lookaheads on LR(0) itemsets(default)
+	LALR_ENGINE_PROPAGATE = 0,
+	// canonical LR(1) itemsets merged by their cores
+	LALR_ENGINE_LR1MERGE,
+	// DeRemer and Pennello's relations on LR(0) itemsets
+	LALR_ENGINE_DEREMER,
+	// run all engines above, and verify that they agree
+	LALR_ENGINE_CHECK
+};
+
+// layouts of DFA transition table of scanner
+enum lex_table_t {
+	// next/check/base/default arrays with compressed rows(default)
+	LEX_TABLE_COMB = 0,
+	// dense table of [state][label]
+	LEX_TABLE_FULL,
+	// dense table of [state][label], states are pre-multiplied by size of rows
+	LEX_TABLE_PREMUL
+};
+
+// packing schemes of parse tables
+enum parse_table_t {
+	// uniform rows and columns stripped in rounds of "nice", rest in
+	// sparse tables guarded by a bitmap of valid cells(default)
+	PARSE_TABLE_NICE = 0,
+	// default reduction per state, default goto per non-terminal, and
+	// identical rows merged in comb tables with check arrays
+	PARSE_TABLE_MERGE
+};
+
 // global setting for upgen
 typedef struct _gsetting_t {
 private:
@@ -103,6 +135,39 @@ public:
     // @m_bEnableLineNo:  flag indicating whether
     //		generate #line directives or not
 	bool m_bEnableLineNo;
+	// @m_bMinimize: flag indicating whether or not
+	//		DFA is minimized before it is converted to tables
+	// option: -n
+	bool m_bMinimize;
+	// @m_bLexDirect: flag indicating whether or not scanner is emitted as
+	//		direct code, one block of code for each state, instead of tables
+	// option: -s SPEC:direct
+	bool m_bLexDirect;
+	// @m_bReentrant: flag indicating whether or not generated program
+	//		keeps all its states in parser objects instead of a global one
+	// option: -r
+	bool m_bReentrant;
+	// @m_bPushMode: flag indicating whether or not generated scanner takes
+	//		input in chunks and parser takes tokens pushed by caller
+	// option: -u
+	bool m_bPushMode;
+	// @m_nLexTable: layout of DFA transition table of scanner, see lex_table_t
+	// option: -f, -F
+	int m_nLexTable;
+	// @m_nFullTableWarn: size in KB of full transition table,
+	//		above which a warning is issued
+	// option: -w
+	int m_nFullTableWarn;
+	// @m_nLALREngine: method computing LALR(1) lookaheads, see lalr_engine_t
+	// option: -e
+	int m_nLALREngine;
+	// @m_nParseTable: packing scheme of parse tables, see parse_table_t
+	// option: -k
+	int m_nParseTable;
+	// @m_nThreads: number of threads building DFAs of start-conditions,
+	//		DFAs are built one by one if it is less than 2
+	// option: -j
+	int m_nThreads;
     // @m_nParseDLevel: debug level for parsing program, if it is zero,
     //		then no any debug information about parsing is produced
 	int m_nParseDLevel;
@@ -121,6 +186,11 @@ public:
 	
 	// name prefix
 	char *m_pchNamePrefix;
+	
+	// @m_pchSpecCache: directory where compiled language SPECs are cached,
+	//		SPECs are compiled on each run if it is nullptr
+	// option: -b
+	char *m_pchSpecCache;
 
 
 public:
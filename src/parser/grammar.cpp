@@ -38,6 +38,7 @@ using std::endl;
 
 #include "../common/common.h"
 #include "../common/reporter.h"
+#include "../common/profiler.h"
 
 #include "../common/uset.h"
 using common_ns::iset_t;
@@ -46,6 +47,7 @@ using common_ns::strhelper_t;
 
 #include <queue>
 using std::queue;
+#include <climits>
 
 #include "../common/uniqueue.h"
 using common_ns::uniqueue_t;
@@ -491,6 +493,8 @@ void grammar_t::addTokens(const vstr_t & a_vstrSName, const vint_t &a_vnTokenID)
 	assert(_EQ(s, m_nTypeBase));
 }
 
+static void digraph(const vector<vint_t> &a_vvnRel, vector<unsigned int> &a_vnSet, int a_nWords);
+
 // compute nullable flag, FirstSet,
 // and RLS set(RLS: Rules using the symbol as Left Symbol) for each symbol
 void grammar_t::calcSymbSets(bool a_bClear) {
@@ -501,9 +505,6 @@ void grammar_t::calcSymbSets(bool a_bClear) {
 			symbol_t *psym = m_vsSymbol[i];
 			psym->setNullable(false);
 			if( ! psym->isToken()) {
-				if(psym->m_pFirstSet) {
-					psym->m_pFirstSet->clear();
-				}
 				if(psym->m_pRLSSet) {
 					psym->m_pRLSSet->clear();
 				}
@@ -511,58 +512,69 @@ void grammar_t::calcSymbSets(bool a_bClear) {
 		}
 	}
 	
-	bool bChanged = true;
-	while(bChanged) {
-		bChanged = false;
-		for(i = 0; i < (int)m_vrRule.size(); ++i) {
-			assert(m_vrRule[i]);
-			assert(m_vrRule[i]->getLeft() >= m_nTypeBase);
-			if( ! m_vsSymbol[m_vrRule[i]->getLeft()]->isNullable()) {
-				int j = 0;
-				for(; j < m_vrRule[i]->getRightSize(); ++j) {
-					if( ! m_vsSymbol[m_vrRule[i]->getRightSymbol(j)]->isNullable()) {
-						break;
-					}
-				}
-				if(_EQ(j, m_vrRule[i]->getRightSize())) {
-					
-					m_vsSymbol[m_vrRule[i]->getLeft()]->setNullable(true);
-					bChanged = true;
-				}
+	// nullable: count symbols not known as nullable on right side of each rule,
+	// left symbol turns nullable when the count of any of its rules drops to 0
+	vint_t vnCount(m_vrRule.size());
+	vector<vint_t> vvnUses(m_vstrSName.size());
+	vint_t vnNullable;
+	for(i = 0; i < (int)m_vstrSName.size(); ++i) {
+		if(m_vsSymbol[i]->isNullable()) {
+			vnNullable.push_back(i);
+		}
+	}
+	for(i = 0; i < (int)m_vrRule.size(); ++i) {
+		assert(m_vrRule[i]);
+		assert(m_vrRule[i]->getLeft() >= m_nTypeBase);
+		vnCount[i] = m_vrRule[i]->getRightSize();
+		for(j = 0; j < m_vrRule[i]->getRightSize(); ++j) {
+			vvnUses[m_vrRule[i]->getRightSymbol(j)].push_back(i);
+		}
+		symbol_t *psym = m_vsSymbol[m_vrRule[i]->getLeft()];
+		if(_EQ(vnCount[i], 0) && ! psym->isNullable()) {
+			psym->setNullable(true);
+			vnNullable.push_back(m_vrRule[i]->getLeft());
+		}
+	}
+	while( ! vnNullable.empty()) {
+		int n = vnNullable.back();
+		vnNullable.pop_back();
+		for(j = 0; j < (int)vvnUses[n].size(); ++j) {
+			const int r = vvnUses[n][j];
+			symbol_t *psym = m_vsSymbol[m_vrRule[r]->getLeft()];
+			if(_EQ(--vnCount[r], 0) && ! psym->isNullable()) {
+				psym->setNullable(true);
+				vnNullable.push_back(m_vrRule[r]->getLeft());
 			}
 		}
 	}
 
-	bChanged = true;
-	while(bChanged) {
+	// FIRST: tokens leading rules of a variable initialize its set,
+	// then FIRST(A) includes FIRST(B) if A -> ... B ... with nullable
+	// symbols before B, which is solved over strongly connected components
+	const int nVars = (int)m_vstrSName.size() - m_nTypeBase;
+	m_nFirstWords = (m_nTypeBase + 31) / 32;
+	m_vnFirstBits.assign(nVars * m_nFirstWords, 0);
+	vector<vint_t> vvnRel(nVars);
+	for(i = 0; i < (int)m_vrRule.size(); ++i) {
+		prod_t *pr = m_vrRule[i];
+		const int n = pr->getLeft() - m_nTypeBase;
 		
-		bChanged = false;
-		for(i = 0; i < (int)m_vrRule.size(); ++i) {
-			prod_t *pr = m_vrRule[i];
-			int n = pr->getLeft();
-			assert(n >= m_nTypeBase);
-			
-			if( ! m_vsSymbol[n]->m_pFirstSet) {
-				m_vsSymbol[n]->m_pFirstSet = new iset_t;
+		for(j = 0; j < pr->getRightSize(); ++j) {
+			const int nSymb = pr->getRightSymbol(j);
+			if(m_vsSymbol[nSymb]->isToken()) {
+				assert(nSymb < m_nTypeBase);
+				m_vnFirstBits[n * m_nFirstWords + nSymb / 32] |= 1u << (nSymb % 32);
+				break;
 			}
-			
-			j = 0;
-			for(; j < pr->getRightSize(); ++j) {
-				if(m_vsSymbol[pr->getRightSymbol(j)]->isToken()) {
-					
-					bChanged = m_vsSymbol[n]->m_pFirstSet->insert(pr->getRightSymbol(j)) || bChanged;
- 				}
-				else if(m_vsSymbol[pr->getRightSymbol(j)]->m_pFirstSet) {
-					unsigned int oldSize = m_vsSymbol[n]->m_pFirstSet->size();
-					m_vsSymbol[n]->m_pFirstSet->merge(*m_vsSymbol[pr->getRightSymbol(j)]->m_pFirstSet);
-					bChanged = (m_vsSymbol[n]->m_pFirstSet->size() > oldSize) || bChanged;
-				}
-				if( ! m_vsSymbol[pr->getRightSymbol(j)]->isNullable()) {
-					break;
-				}
+			if(nSymb - m_nTypeBase != n) {
+				vvnRel[n].push_back(nSymb - m_nTypeBase);
+			}
+			if( ! m_vsSymbol[nSymb]->isNullable()) {
+				break;
 			}
 		}
 	}
+	digraph(vvnRel, m_vnFirstBits, m_nFirstWords);
 	
 	for(i = 0; i < (int)m_vrRule.size(); ++i) {
 		prod_t *pr = m_vrRule[i];
@@ -743,7 +755,7 @@ void grammar_t::adjust(ptable_t & a_ptbl, gsetting_t &gsetup) {
 			
 			siULSymb.insert(i);
 			if( m_vsSymbol[i]->m_pRCSSet) {
-				for(sint_cit_t cit = m_vsSymbol[i]->m_pRCSSet->begin();
+				for(iset_t::const_iterator cit = m_vsSymbol[i]->m_pRCSSet->begin();
 					cit != m_vsSymbol[i]->m_pRCSSet->end(); ++cit) {
 					
 					siULRule.insert(*cit);
@@ -935,6 +947,23 @@ void grammar_t::getLR1ItemLookaheads(sint_t& si,
                                      int nRule,
                                      int nDot,
                                      const sint_t &seeThroughLa) const {
+    if(getLR1ItemFirst(si, nRule, nDot)) {
+        si.insert(seeThroughLa.begin(), seeThroughLa.end());
+    }
+}
+
+void grammar_t::getLR1ItemLookaheads(sint_t& si,
+                                     int nRule,
+                                     int nDot,
+                                     const lasi_t &seeThroughLa) const {
+    if(getLR1ItemFirst(si, nRule, nDot)) {
+        si.insert(seeThroughLa.begin(), seeThroughLa.end());
+    }
+}
+
+// add FIRST of the symbols after @nDot to @si,
+// return true if all of them are nullable
+bool grammar_t::getLR1ItemFirst(sint_t& si, int nRule, int nDot) const {
     const prod_t* ppr = m_vrRule[nRule];
 
     int i = nDot + 1;
@@ -943,17 +972,19 @@ void grammar_t::getLR1ItemLookaheads(sint_t& si,
             si.insert(ppr->getRightSymbol(i));
             break;
         } else {
-            iset_t* firstSet = m_vsSymbol[ppr->getRightSymbol(i)]->m_pFirstSet;
-            si.insert(firstSet->begin(),firstSet->end());
+            const unsigned int *pnFirst = getFirstBits(ppr->getRightSymbol(i));
+            for(int w = 0; w < m_nFirstWords; w++) {
+                for(unsigned int nWord = pnFirst[w]; nWord != 0; nWord &= nWord - 1) {
+                    si.insert(w * 32 + __builtin_ctz(nWord));
+                }
+            }
             if( ! m_vsSymbol[ppr->getRightSymbol(i)]->isNullable()) {
                 break;
             }
         }
     }
 
-    if(_EQ(i, ppr->getRightSize())) {
-        si.insert(seeThroughLa.begin(), seeThroughLa.end());
-    }
+    return _EQ(i, ppr->getRightSize());
 }
 
 // compute LR(0) closure
@@ -992,6 +1023,7 @@ void grammar_t::calcLR0Closure(const lri_pair_t &a_lrp, sint_t &a_cls) const {
 // compute LR(0) kernel itemsets
 void grammar_t::calcLR0Items(pgraph_t &a_pgrp) {
 
+    _PROFILE_PHASE("lr0");
     lrps2i_map_t lrs2Node;
 
     queue<int> quNodeIndex;
@@ -999,9 +1031,9 @@ void grammar_t::calcLR0Items(pgraph_t &a_pgrp) {
     // create start node(state)
     pgnode_t *pgNode = a_pgrp.addEmptyNode();
     lalr_item_t lalrItem(m_nAcceptRule, 0);
-    pgarc_t *plrArc = new pgarc_t(INVALID_STATE,
-                                  pgNode->getID(),
-                                  m_nAcceptSymbol);
+    pgarc_t *plrArc = a_pgrp.newArc(INVALID_STATE,
+                                    pgNode->getID(),
+                                    m_nAcceptSymbol);
     plrArc->insertItem(lalrItem, END_SYMBOL_INDEX);
 
     pgNode->addInArc(plrArc);
@@ -1046,9 +1078,9 @@ void grammar_t::calcLR0Items(pgraph_t &a_pgrp) {
                     } else {
 
                         // add new arc
-                        plrArc = new pgarc_t(pgNode->getID(),
-                                             (int)vlrPairs.size(),
-                                             nCurSymb);
+                        plrArc = a_pgrp.newArc(pgNode->getID(),
+                                               (int)vlrPairs.size(),
+                                               nCurSymb);
 
                         plrArc->insertItem(lalrItem, sint_t());
                         pgNode->addOutArc(plrArc);
@@ -1056,7 +1088,7 @@ void grammar_t::calcLR0Items(pgraph_t &a_pgrp) {
 
                         symb2TNodeIdx.insert(i2i_pair_t(nCurSymb, (int)vlrPairs.size()));
 
-                        lrpair_set_t *plrset = new lrpair_set_t;
+                        lrpair_set_t *plrset = a_pgrp.newItemSet();
                         plrset->insert(lalrItem);
                         vlrPairs.push_back(plrset);
                     }
@@ -1086,14 +1118,14 @@ void grammar_t::calcLR0Items(pgraph_t &a_pgrp) {
                             varcTemp[citOld->second]->insertItem(lalrItem, sint_t());
                         } else {
 
-                            plrArc = new pgarc_t(pgNode->getID(), (int)vlrPairs.size(), nDotSymID);
+                            plrArc = a_pgrp.newArc(pgNode->getID(), (int)vlrPairs.size(), nDotSymID);
                             plrArc->insertItem(lalrItem, sint_t());
                             pgNode->addOutArc(plrArc);
                             varcTemp.push_back(plrArc);
 
                             symb2TNodeIdx.insert(i2i_pair_t(nDotSymID, (int)vlrPairs.size()));
 
-                            lrpair_set_t *plrset = new lrpair_set_t;
+                            lrpair_set_t *plrset = a_pgrp.newItemSet();
                             plrset->insert(lalrItem);
                             vlrPairs.push_back(plrset);
                         }
@@ -1121,9 +1153,8 @@ void grammar_t::calcLR0Items(pgraph_t &a_pgrp) {
             } else {
                 assert(pairRet.first->second >= 0
                        && pairRet.first->second < a_pgrp.getNextNodeID());
+                // the duplicated item set is left to the arena
                 pgn = a_pgrp.fromID(pairRet.first->second);
-
-                delete vlrPairs[(*itArc)->m_ntoState];
             }
 
             assert(pgn != nullptr);
@@ -1132,27 +1163,39 @@ void grammar_t::calcLR0Items(pgraph_t &a_pgrp) {
             a_pgrp.addArc(*itArc);
         }
     }
+    _PROFILE_COUNT("states", a_pgrp.getValidNodeCount());
 }
 
-static sint_t* addLookaheadsToClosure(lr1_closure_t &closure,
+// closure maps and lookahead sets come from the arena of @closure
+template<class S>
+static lasi_t* addLookaheadsToClosure(lr1_closure_t &closure,
                            int nCurSymb,
                            const lri_pair_t &lri,
-                           const sint_t &si) {
+                           const S &si,
+                           bool *pbChanged = nullptr) {
 
+    arena_t *parena = closure.get_allocator().getArena();
     std::pair<lr1_closure_it_t, bool> retInsertClos =
-            closure.insert(std::make_pair(nCurSymb, nullptr));
+            closure.insert(lr1_closure_t::value_type(nCurSymb, nullptr));
     if(retInsertClos.second) {
-        retInsertClos.first->second = new lr2si_map_t();
+        retInsertClos.first->second = parena->create<lr2si_map_t>(
+                    std::less<lri_pair_t>(), lr2si_map_t::allocator_type(parena));
     }
     lr2si_map_t *curSymLaMap = retInsertClos.first->second;
 
     std::pair<lr2si_it_t, bool> retInsertItem =
-            curSymLaMap->insert(std::make_pair(lri, nullptr));
+            curSymLaMap->insert(lr2si_pair_t(lri, nullptr));
     if(retInsertItem.second) {
-        retInsertItem.first->second = new sint_t();
+        retInsertItem.first->second = parena->create<lasi_t>(
+                    std::less<int>(), lasi_t::allocator_type(parena));
     }
 
+    const size_t nOldSize = retInsertItem.first->second->size();
     retInsertItem.first->second->insert(si.begin(), si.end());
+    if(pbChanged) {
+        *pbChanged = retInsertItem.second
+                || retInsertItem.first->second->size() != nOldSize;
+    }
 
     return retInsertItem.first->second;
 }
@@ -1162,6 +1205,7 @@ static sint_t* addLookaheadsToClosure(lr1_closure_t &closure,
 // @node: Parser graph node, which represents LR(0) kernel items
 // @closure: output closures; it is a map:
 //      symbol ID -> (map: LR(0) item -> lookaheads)
+//      a closure already computed for smaller lookaheads is updated in place
 void grammar_t::calcLR1Closure(const pgnode_t &node, lr1_closure_t &closure) const {
 
     // copy LR(1) kernel items to closure
@@ -1194,9 +1238,8 @@ void grammar_t::calcLR1Closure(const pgnode_t &node, lr1_closure_t &closure) con
                 continue;
             }
 
-            sint_t siMarkRule;
             queue<lri_pair_t> qItem;
-            queue<const sint_t*> qLookaheads;
+            queue<const lasi_t*> qLookaheads;
 
             qItem.push(citemIt->first);
             qLookaheads.push(citemIt->second);
@@ -1206,7 +1249,7 @@ void grammar_t::calcLR1Closure(const pgnode_t &node, lr1_closure_t &closure) con
                 lri_pair_t curItem = qItem.front();
                 qItem.pop();
 
-                const sint_t* psi = qLookaheads.front();
+                const lasi_t* psi = qLookaheads.front();
                 qLookaheads.pop();
                 assert(psi != nullptr);
 
@@ -1224,12 +1267,16 @@ void grammar_t::calcLR1Closure(const pgnode_t &node, lr1_closure_t &closure) con
                     const int rID = *citRule;
                     if(m_vrRule[rID]->getRightSize() > 0) {
                         const int sym = m_vrRule[rID]->getRightSymbol(0);
+                        bool bChanged = false;
                         psi = addLookaheadsToClosure(closure,
                                                sym,
                                                lri_pair_t(rID, 1),
-                                               si);
+                                               si,
+                                               &bChanged);
 
-                        if(m_vsSymbol[sym]->isType() && siMarkRule.insert(rID).second) {
+                        // expand the item again whenever its lookaheads grow,
+                        // so that they reach a fixed point
+                        if(m_vsSymbol[sym]->isType() && bChanged) {
                             qItem.push(lri_pair_t(rID, 0));
                             qLookaheads.push(psi);
                         }
@@ -1242,122 +1289,130 @@ void grammar_t::calcLR1Closure(const pgnode_t &node, lr1_closure_t &closure) con
 //    // TBD:> compute full closure
 }
 
-static void freeLR1Closure(lr1_closure_t &lr1Closure) {
-    for(lr1_closure_it_t closIt = lr1Closure.begin();
-        closIt != lr1Closure.end();
-        closIt++) {
-
-        lr2si_map_t *closItem = closIt->second;
-        for(lr2si_it_t itemIt = closItem->begin();
-            itemIt != closItem->end();
-            itemIt++) {
-            if(itemIt->second) {
-                delete itemIt->second;
-            }
-        }
-
-        delete closIt->second;
-    }
-}
-
 // compute spontaneous lookaheads
 void grammar_t::calcLookaheads(pgraph_t &a_pgrp) const {
     if(a_pgrp.getValidNodeCount() <= 0) {
         return;
     }
 
+    _PROFILE_PHASE("lookaheads");
     lalr_item_t lalrItem(m_nAcceptRule, 0);
     pgnode_t *pgNode = a_pgrp.fromID(FIRST_STATE);
     assert(pgNode->getInArcCount() > 0);
     (*pgNode->inArcBegin())->insertItem(lalrItem, END_SYMBOL_INDEX);
 
-    bool bChanged = true;
-    while(bChanged) {
-        bChanged = false;
-
-        sint_t siMark;
-        queue< int > qNodeIndex;
-        qNodeIndex.push(FIRST_STATE);
-        siMark.insert(FIRST_STATE);
-
-        while(!qNodeIndex.empty()) {
-            pgNode = a_pgrp.fromID(qNodeIndex.front());
-            qNodeIndex.pop();
-
-            lr1_closure_t lr1Closure;
-            calcLR1Closure(*pgNode, lr1Closure);
+    // closure cache, one per node; lookaheads only ever grow, so a cached
+    // closure is brought up to date by re-running calcLR1Closure on top of it.
+    // The cache lives in its own arena and is dropped in one go on return.
+    const int nNodes = a_pgrp.getNodeTotalCount();
+    arena_t arenaClosure;
+    vector<lr1_closure_t*> vpClosure(nNodes, nullptr);
 
+    // dirty-node worklist, seeded with every reachable node in BFS order
+    vector<bool> vbQueued(nNodes, false);
+    queue< int > qNodeIndex;
+    {
+        queue< int > qReach;
+        qReach.push(FIRST_STATE);
+        vbQueued[FIRST_STATE] = true;
+        while(!qReach.empty()) {
+            pgNode = a_pgrp.fromID(qReach.front());
+            qNodeIndex.push(qReach.front());
+            qReach.pop();
             for(pgnode_t::arc_it_t itArc = pgNode->outArcBegin();
                 itArc != pgNode->outArcEnd();
                 ++itArc) {
-
-                int nCurSymb = (*itArc)->m_nSymbol;
-                lr2si_map_t* closureItem = lr1Closure[nCurSymb];
-                assert(closureItem != nullptr);
-
-                if( (*itArc)->insertItems(*closureItem)) {
-                    bChanged = true;
-                }
-
                 const int outStt = (*itArc)->m_ntoState;
-                if(siMark.insert(outStt).second) {
-                    qNodeIndex.push(outStt);
+                if( !vbQueued[outStt]) {
+                    vbQueued[outStt] = true;
+                    qReach.push(outStt);
                 }
             }
+        }
+    }
 
-//            { // for debugging
-//                std::cout << "State: " << pgNode->getID() << std::endl;
-//                for(lr1_closure_cit_t cit = lr1Closure.begin();
-//                    cit != lr1Closure.end();
-//                    cit++) {
-//                    std::cout << "\tSymbol:" << m_vstrSName[cit->first]
-//                              << ", to State ";
-//                    for(pgnode_t::arc_it_t itArc = pgNode->outArcBegin();
-//                        itArc != pgNode->outArcEnd();
-//                        itArc++) {
-//                        if((*itArc)->m_nSymbol == cit->first) {
-//                            std::cout << (*itArc)-> m_ntoState;
-//                            break;
-//                        }
-//                    }
-//                    std::cout << std::endl;
-//                    std::cout << "\tItems:" << std::endl;
-//                    lr2si_map_t *plrMap = cit->second;
-//                    for(lr2si_cit_t cit2 = plrMap->begin();
-//                        cit2 != plrMap->end();
-//                        cit2++) {
-
-//                        int nRule = cit2->first.m_nRule;
-//                        int nDot = cit2->first.m_nDot;
-//                        sint_t *siLa = cit2->second;
-
-//                        const prod_t *pr = m_vrRule[nRule];
-//                        std::cout << "\t\t" << m_vstrSName[pr->getLeft()] << " -> ";
-//                        for(int i = 0; i < nDot - 1; i++) {
-//                            std::cout << m_vstrSName[pr->getRightSymbol(i)] << " ";
-//                        }
-//                        std::cout << ". ";
-//                        for(int i = nDot - 1; i < pr->getRightSize(); i++) {
-//                            std::cout << m_vstrSName[pr->getRightSymbol(i)] << " ";
-//                        }
-
-//                        std::cout << "[";
-//                        for(sint_cit_t citLa = siLa->begin();
-//                            citLa != siLa->end();
-//                            citLa++) {
-//                            std::cout << m_vstrSName[*citLa] << " ";
-//                        }
-//                        std::cout << "]";
-
-//                        std::cout << std::endl;
+    long nVisits = 0;
+    while(!qNodeIndex.empty()) {
+        const int nNode = qNodeIndex.front();
+        qNodeIndex.pop();
+        vbQueued[nNode] = false;
+        ++nVisits;
+        pgNode = a_pgrp.fromID(nNode);
+
+        if(vpClosure[nNode] == nullptr) {
+            vpClosure[nNode] = arenaClosure.create<lr1_closure_t>(
+                        std::less<int>(), lr1_closure_t::allocator_type(&arenaClosure));
+        }
+        lr1_closure_t &lr1Closure = *vpClosure[nNode];
+        calcLR1Closure(*pgNode, lr1Closure);
+
+        for(pgnode_t::arc_it_t itArc = pgNode->outArcBegin();
+            itArc != pgNode->outArcEnd();
+            ++itArc) {
+
+            int nCurSymb = (*itArc)->m_nSymbol;
+            lr2si_map_t* closureItem = lr1Closure[nCurSymb];
+            assert(closureItem != nullptr);
+
+            // the successor's kernel grew: its cached closure is stale
+            const int outStt = (*itArc)->m_ntoState;
+            if( (*itArc)->insertItems(*closureItem) && !vbQueued[outStt]) {
+                vbQueued[outStt] = true;
+                qNodeIndex.push(outStt);
+            }
+        }
+
+//        { // for debugging
+//            std::cout << "State: " << pgNode->getID() << std::endl;
+//            for(lr1_closure_cit_t cit = lr1Closure.begin();
+//                cit != lr1Closure.end();
+//                cit++) {
+//                std::cout << "\tSymbol:" << m_vstrSName[cit->first]
+//                          << ", to State ";
+//                for(pgnode_t::arc_it_t itArc = pgNode->outArcBegin();
+//                    itArc != pgNode->outArcEnd();
+//                    itArc++) {
+//                    if((*itArc)->m_nSymbol == cit->first) {
+//                        std::cout << (*itArc)-> m_ntoState;
+//                        break;
 //                    }
 //                }
 //                std::cout << std::endl;
-//            }
+//                std::cout << "\tItems:" << std::endl;
+//                lr2si_map_t *plrMap = cit->second;
+//                for(lr2si_cit_t cit2 = plrMap->begin();
+//                    cit2 != plrMap->end();
+//                    cit2++) {
+
+//                    int nRule = cit2->first.m_nRule;
+//                    int nDot = cit2->first.m_nDot;
+//                    sint_t *siLa = cit2->second;
+
+//                    const prod_t *pr = m_vrRule[nRule];
+//                    std::cout << "\t\t" << m_vstrSName[pr->getLeft()] << " -> ";
+//                    for(int i = 0; i < nDot - 1; i++) {
+//                        std::cout << m_vstrSName[pr->getRightSymbol(i)] << " ";
+//                    }
+//                    std::cout << ". ";
+//                    for(int i = nDot - 1; i < pr->getRightSize(); i++) {
+//                        std::cout << m_vstrSName[pr->getRightSymbol(i)] << " ";
+//                    }
 
-            freeLR1Closure(lr1Closure);
-        }
+//                    std::cout << "[";
+//                    for(sint_cit_t citLa = siLa->begin();
+//                        citLa != siLa->end();
+//                        citLa++) {
+//                        std::cout << m_vstrSName[*citLa] << " ";
+//                    }
+//                    std::cout << "]";
+
+//                    std::cout << std::endl;
+//                }
+//            }
+//            std::cout << std::endl;
+//        }
     }
+    _PROFILE_COUNT("node visits", nVisits);
 }
 
 // compute reductions
@@ -1389,12 +1444,13 @@ void grammar_t::calcReductions(pgraph_t &a_pgrp) const {
                 }
 
 
-                sint_t siMarkRule;
+                // lookaheads of non-kernel items expanded so far
+                map<int, sint_t> rule2La;
                 queue<lri_pair_t> qItem;
                 queue<sint_t> qLookaheads;
 
                 qItem.push(citemIt->first);
-                qLookaheads.push(*citemIt->second);
+                qLookaheads.push(sint_t(citemIt->second->begin(), citemIt->second->end()));
 
                 while(!qItem.empty()) {
                     // find empty production,
@@ -1419,9 +1475,17 @@ void grammar_t::calcReductions(pgraph_t &a_pgrp) const {
                         if(m_vrRule[rID]->getRightSize() > 0) {
                             const int sym = m_vrRule[rID]->getRightSymbol(0);
 
-                            if(m_vsSymbol[sym]->isType() && siMarkRule.insert(rID).second) {
-                                qItem.push(lri_pair_t(rID, 0));
-                                qLookaheads.push(si);
+                            if(m_vsSymbol[sym]->isType()) {
+                                // expand the item again whenever its lookaheads grow
+                                pair<map<int, sint_t>::iterator, bool> retInsert =
+                                        rule2La.insert(std::make_pair(rID, sint_t()));
+                                sint_t &siRule = retInsert.first->second;
+                                const size_t nOldSize = siRule.size();
+                                siRule.insert(si.begin(), si.end());
+                                if(retInsert.second || siRule.size() != nOldSize) {
+                                    qItem.push(lri_pair_t(rID, 0));
+                                    qLookaheads.push(siRule);
+                                }
                             }
                         } else {
                             node.addRRule(rID, si);
@@ -1604,11 +1668,18 @@ void grammar_t::calcLR1Items2(LALRGraph &lalrGraph) {
     }
 }
 
+// convert from grammar object to parse graph,
+// by building canonical LR(1) itemsets and merging them by their LR(0) cores
 void grammar_t::gram2PGraph2(pgraph_t &a_pgrp) {
     if(!isValid()) {
         return ;
     }
 
+    // LR(0) automaton fixes state numbering, so that all engines
+    // produce identical parse tables
+    calcLR0Items(a_pgrp);
+
+    _PROFILE_PHASE("lookaheads");
     LALRGraph lalrGraph;
 
     // calculate LR(1) Items
@@ -1617,72 +1688,279 @@ void grammar_t::gram2PGraph2(pgraph_t &a_pgrp) {
     // merge LR(1) Items into LALR Items group by Core Items
     lalrGraph.kernelMerge();
 
-    // convert LALRGraph to pgraph_t
-    for(int i = 0; i < lalrGraph.getNodeCount(); i++) {
-        pgnode_t *pgNode = a_pgrp.addEmptyNode();
+    // both automata share LR(0) cores, so walk them together from start state
+    // to map LALR nodes onto parse graph states
+    vint_t vnLR2PState(lalrGraph.getNodeCount(), INVALID_STATE);
+    queue<int> quNodeIndex;
+    vnLR2PState[0] = FIRST_STATE;
+    quNodeIndex.push(0);
+    while(!quNodeIndex.empty()) {
+        const int lrID = quNodeIndex.front();
+        quNodeIndex.pop();
 
-#define TO_PSTATE(x) (FIRST_STATE + (x))
+        LALRGraphNode& lrNode = lalrGraph.getNode(lrID);
+        pgnode_t *pgNode = a_pgrp.fromID(vnLR2PState[lrID]);
 
-        const int pstateID = TO_PSTATE(i);
-        assert(pgNode->getID() == pstateID);
+        for(LALRGraphNode::arc_cit_t citArc = lrNode.beginArcs();
+            citArc != lrNode.endArcs();
+            citArc++) {
 
-        std::map<int, lr2si_map_t*> symb2LrLaMap;
+            pgnode_t::arc_cit_t citPArc = pgNode->outArcBegin();
+            for(; citPArc != pgNode->outArcEnd(); ++citPArc) {
+                if(_EQ((*citPArc)->m_nSymbol, citArc->mSymbol)) {
+                    break;
+                }
+            }
+            assert(citPArc != pgNode->outArcEnd());
 
+            if(_EQ(vnLR2PState[citArc->mToState], INVALID_STATE)) {
+                vnLR2PState[citArc->mToState] = (*citPArc)->m_ntoState;
+                quNodeIndex.push(citArc->mToState);
+            }
+            assert(_EQ(vnLR2PState[citArc->mToState], (*citPArc)->m_ntoState));
+        }
+    }
+
+    // copy lookaheads and reductions into parse graph
+    for(int i = 0; i < lalrGraph.getNodeCount(); i++) {
+        assert(vnLR2PState[i] != INVALID_STATE);
+
+        pgnode_t *pgNode = a_pgrp.fromID(vnLR2PState[i]);
         LALRGraphNode& lrNode = lalrGraph.getNode(i);
 
-        for(LALRGraphNode::arc_cit_t citArc = lrNode.beginArcs();
-            citArc != lrNode.endArcs();
-            citArc++) {
-            symb2LrLaMap[citArc->mSymbol] = new lr2si_map_t();
+        i2arc_map_t symb2Arc;
+        for(pgnode_t::arc_it_t itArc = pgNode->outArcBegin();
+            itArc != pgNode->outArcEnd();
+            ++itArc) {
+            symb2Arc[(*itArc)->m_nSymbol] = *itArc;
         }
 
-        // convert reduction rules
         for(LALRGraphNode::item_cit_t citItem = lrNode.beginItems();
             citItem != lrNode.endItems();
             citItem++) {
             prod_t *ppr = m_vrRule[citItem->first.mRuleID];
             if(ppr->getRightSize() <= citItem->first.mDotPos) {
-                for(sint_t::const_iterator citSym = citItem->second.begin();
-                    citSym != citItem->second.end();
-                    citSym++) {
-                    pgNode->addRRule(citItem->first.mRuleID, *citSym);
+                // convert reduction rules
+                pgNode->addRRule(citItem->first.mRuleID, citItem->second);
+            } else {
+                int nCurSymb = ppr->getRightSymbol(citItem->first.mDotPos);
+                assert(symb2Arc.find(nCurSymb) != symb2Arc.end());
+                symb2Arc[nCurSymb]->insertItem(citItem->first.mRuleID,
+                                               citItem->first.mDotPos + 1,
+                                               citItem->second);
+            }
+        }
+    }
+}
+
+// compute a set-valued function F over relation R(DeRemer and Pennello's Digraph),
+// such that F(x) = F'(x) U {F(y) | x R y}, where F'(x) is initial value of F(x)
+// @a_vvnRel: relation, successors of x are @a_vvnRel[x]
+// @a_vnSet: bit sets of F, @a_nWords words per x
+static void digraph(const vector<vint_t> &a_vvnRel, vector<unsigned int> &a_vnSet, int a_nWords) {
+
+    const int nCount = (int)a_vvnRel.size();
+    vint_t vnDepth(nCount, 0);
+    vint_t vnStack;
+    // explicit call stack: (x, index of next successor) and depth of x when pushed
+    vector<i2i_pair_t> vCalls;
+    vint_t vnCallDepth;
+
+    for(int x = 0; x < nCount; x++) {
+        if(vnDepth[x] != 0) {
+            continue;
+        }
+
+        vnStack.push_back(x);
+        vnDepth[x] = (int)vnStack.size();
+        vCalls.push_back(i2i_pair_t(x, 0));
+        vnCallDepth.push_back(vnDepth[x]);
+
+        while(!vCalls.empty()) {
+            const int u = vCalls.back().first;
+            const int k = vCalls.back().second;
+
+            if(k < (int)a_vvnRel[u].size()) {
+                vCalls.back().second++;
+                const int v = a_vvnRel[u][k];
+                if(_EQ(vnDepth[v], 0)) {
+                    // traverse v first
+                    vnStack.push_back(v);
+                    vnDepth[v] = (int)vnStack.size();
+                    vCalls.push_back(i2i_pair_t(v, 0));
+                    vnCallDepth.push_back(vnDepth[v]);
+                    continue;
+                }
+                if(vnDepth[v] < vnDepth[u]) {
+                    vnDepth[u] = vnDepth[v];
                 }
+                for(int w = 0; w < a_nWords; w++) {
+                    a_vnSet[u * a_nWords + w] |= a_vnSet[v * a_nWords + w];
+                }
+                continue;
             }
 
+            // all successors of u are done
+            if(_EQ(vnDepth[u], vnCallDepth.back())) {
+                // u is root of a strongly connected component
+                int t;
+                do {
+                    t = vnStack.back();
+                    vnStack.pop_back();
+                    vnDepth[t] = INT_MAX;
+                    if(t != u) {
+                        for(int w = 0; w < a_nWords; w++) {
+                            a_vnSet[t * a_nWords + w] = a_vnSet[u * a_nWords + w];
+                        }
+                    }
+                } while(t != u);
+            }
 
-            if(citItem->first.mDotPos < ppr->getRightSize()) {
-                int nCurSymb = ppr->getRightSymbol(citItem->first.mDotPos);
-                lr2si_map_t* plrMap = symb2LrLaMap[nCurSymb];
-                assert(plrMap != nullptr);
-                lri_pair_t lri(citItem->first.mRuleID, citItem->first.mDotPos + 1);
-                sint_t *psi = new sint_t(citItem->second);
-                plrMap->insert(std::make_pair(lri, psi));
+            vCalls.pop_back();
+            vnCallDepth.pop_back();
+            if(!vCalls.empty()) {
+                const int p = vCalls.back().first;
+                if(vnDepth[u] < vnDepth[p]) {
+                    vnDepth[p] = vnDepth[u];
+                }
+                for(int w = 0; w < a_nWords; w++) {
+                    a_vnSet[p * a_nWords + w] |= a_vnSet[u * a_nWords + w];
+                }
             }
         }
+    }
+}
 
-        // convert arcs
-        for(LALRGraphNode::arc_cit_t citArc = lrNode.beginArcs();
-            citArc != lrNode.endArcs();
-            citArc++) {
+// compute LALR(1) lookaheads with DeRemer and Pennello's relations
+// (reads, includes and lookback) on LR(0) parse graph
+void grammar_t::calcDPLookaheads(pgraph_t &a_pgrp) const {
+    if(a_pgrp.getValidNodeCount() <= 0) {
+        return;
+    }
+
+    _PROFILE_PHASE("lookaheads");
+    const int nStates = a_pgrp.getNodeTotalCount();
+    const int nWords = (m_nTypeBase + 31) / 32;
+
+    // nonterminal transitions (p, A); transition 0 is a virtual one
+    // (start state, accept symbol), whose follow set is {$end}
+    vint_t vnFrom, vnTo;
+    vector<i2i_map_t> vGoto(nStates), vTrans(nStates);
+
+    vnFrom.push_back(FIRST_STATE);
+    vnTo.push_back(INVALID_STATE);
+    for(int i = FIRST_STATE; i < nStates; i++) {
+        pgnode_t *pgNode = a_pgrp.fromID(i);
+        for(pgnode_t::arc_cit_t citArc = pgNode->outArcBegin();
+            citArc != pgNode->outArcEnd();
+            ++citArc) {
+            vGoto[i][(*citArc)->m_nSymbol] = (*citArc)->m_ntoState;
+            if(isType((*citArc)->m_nSymbol)) {
+                vTrans[i][(*citArc)->m_nSymbol] = (int)vnFrom.size();
+                vnFrom.push_back(i);
+                vnTo.push_back((*citArc)->m_ntoState);
+            }
+        }
+    }
+
+    const int nTrans = (int)vnFrom.size();
+    vector<unsigned int> vnSet(nTrans * nWords, 0);
+    vector<vint_t> vvnReads(nTrans), vvnIncludes(nTrans);
+
+    // direct reads and reads relation
+    vnSet[0 * nWords + END_SYMBOL_INDEX / 32] |= 1u << (END_SYMBOL_INDEX % 32);
+    for(int t = 1; t < nTrans; t++) {
+        for(i2i_cit_t cit = vGoto[vnTo[t]].begin(); cit != vGoto[vnTo[t]].end(); cit++) {
+            if(isToken(cit->first)) {
+                vnSet[t * nWords + cit->first / 32] |= 1u << (cit->first % 32);
+            } else if(m_vsSymbol[cit->first]->isNullable()) {
+                vvnReads[t].push_back(vTrans[vnTo[t]][cit->first]);
+            }
+        }
+    }
+
+    digraph(vvnReads, vnSet, nWords);
+
+    // includes and lookback relations
+    // lookback: (state, rule) -> transitions
+    map<i2i_pair_t, vint_t> lookback;
+    for(int t = 0; t < nTrans; t++) {
+        int nLeft = m_nAcceptSymbol;
+        if(t > 0) {
+            // symbol of transition t
+            for(i2i_cit_t cit = vTrans[vnFrom[t]].begin(); cit != vTrans[vnFrom[t]].end(); cit++) {
+                if(_EQ(cit->second, t)) {
+                    nLeft = cit->first;
+                    break;
+                }
+            }
+        }
+        if( ! m_vsSymbol[nLeft]->m_pRLSSet) {
+            continue;
+        }
+
+        for(iset_t::const_iterator citRule = m_vsSymbol[nLeft]->m_pRLSSet->begin();
+            citRule != m_vsSymbol[nLeft]->m_pRLSSet->end();
+            ++citRule) {
+            const prod_t *ppr = m_vrRule[*citRule];
+
+            // smallest position from which rest of the rule is nullable
+            int nNullable = ppr->getRightSize();
+            while(nNullable > 0
+                  && m_vsSymbol[ppr->getRightSymbol(nNullable - 1)]->isNullable()) {
+                nNullable--;
+            }
 
-            pgarc_t *parc = new pgarc_t(pstateID,
-                                        TO_PSTATE(citArc->mToState),
-                                        citArc->mSymbol);
-            lr2si_map_t* plrMap = symb2LrLaMap[citArc->mSymbol];
-            parc->insertItems(*plrMap);
+            int q = vnFrom[t];
+            for(int i = 0; i < ppr->getRightSize(); i++) {
+                const int sym = ppr->getRightSymbol(i);
+                if(isType(sym) && i + 1 >= nNullable) {
+                    vvnIncludes[vTrans[q][sym]].push_back(t);
+                }
+                assert(vGoto[q].find(sym) != vGoto[q].end());
+                q = vGoto[q][sym];
+            }
+            lookback[i2i_pair_t(q, *citRule)].push_back(t);
+        }
+    }
 
-            a_pgrp.addArc(parc);
-            pgNode->addOutArc(parc);
+    digraph(vvnIncludes, vnSet, nWords);
+
+    // lookaheads of each reduction is union of follow sets of its lookback transitions
+    vector<unsigned int> vnLa(nWords);
+    for(map<i2i_pair_t, vint_t>::const_iterator cit = lookback.begin();
+        cit != lookback.end();
+        cit++) {
+        std::fill(vnLa.begin(), vnLa.end(), 0);
+        for(int i = 0; i < (int)cit->second.size(); i++) {
+            for(int w = 0; w < nWords; w++) {
+                vnLa[w] |= vnSet[cit->second[i] * nWords + w];
+            }
         }
 
-        for(std::map<int, lr2si_map_t*>::iterator lrIt = symb2LrLaMap.begin();
-            lrIt != symb2LrLaMap.end();
-            lrIt++) {
-            delete lrIt->second;
+        pgnode_t *pgNode = a_pgrp.fromID(cit->first.first);
+        for(int tok = 0; tok < m_nTypeBase; tok++) {
+            if(vnLa[tok / 32] & (1u << (tok % 32))) {
+                pgNode->addRRule(cit->first.second, tok);
+            }
         }
     }
 }
 
+// convert from grammar object to parse graph,
+// lookaheads are computed by DeRemer and Pennello's method
+void grammar_t::gram2PGraph3(pgraph_t &a_pgrp) {
+    if(!isValid()) {
+        return ;
+    }
+
+    // construct LR(0) kernel itemsets
+    calcLR0Items(a_pgrp);
+
+    // compute lookaheads for each reduction of each state
+    calcDPLookaheads(a_pgrp);
+}
+
 // initialize before conversion from grammar object to parse-tables
 void grammar_t::initPTable(ptable_t & a_ptbl) {
 
@@ -1815,7 +2093,39 @@ void grammar_t::gram2PTable(ptable_t & a_ptbl, gsetting_t &gsetup) {
 	// initialize before conversion from grammar object to parse-tables
 	initPTable(a_ptbl);
 	// convert from grammar object to parse-graph object
-    gram2PGraph(grp);
+	switch(gsetup.m_nLALREngine) {
+	case LALR_ENGINE_LR1MERGE:
+		gram2PGraph2(grp);
+		break;
+	case LALR_ENGINE_DEREMER:
+		gram2PGraph3(grp);
+		break;
+	default:
+		gram2PGraph(grp);
+		break;
+	}
+	
+	if(_EQ(gsetup.m_nLALREngine, LALR_ENGINE_CHECK)) {
+		// build parse-graphs with other engines, tables are derived from
+		// parse-graphs deterministically, so comparing graphs is enough
+		pgraph_t grpLR1(*this, a_ptbl), grpDP(*this, a_ptbl);
+		gram2PGraph2(grpLR1);
+		gram2PGraph3(grpDP);
+		
+		const char *pchNames[2] = {"lr1", "dp"};
+		const pgraph_t *pgrps[2] = {&grpLR1, &grpDP};
+		for(int i = 0; i < 2; ++i) {
+			int nState = grp.compare(*pgrps[i]);
+			if(nState != INVALID_STATE) {
+				string strMsg = "LALR engines `prop\' and `";
+				strMsg += pchNames[i];
+				strMsg += "\' disagree at state ";
+				strMsg += strhelper_t::fromInt(nState);
+				strMsg += ".";
+				_ERROR(strMsg, EOTH(101));
+			}
+		}
+	}
 
 	// convert from parse-graph object to parse-tables
 	grp.grp2PTbl(gsetup);	
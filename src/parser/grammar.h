@@ -86,6 +86,11 @@ private:
 	// name of useless symbols
 	vstr_t m_vstrULSymb;
 	
+	// FIRST sets of variables as bit sets over tokens,
+	// @m_nFirstWords words for each variable from @m_nTypeBase on
+	vector<unsigned int> m_vnFirstBits;
+	int m_nFirstWords;
+	
 private:
 	
 	// temporary variables, only use during parsing
@@ -106,6 +111,11 @@ private:
 	// compute nullable flag, FirstSet,
 	// and RLS set(RLS: Rules using the symbol as Left Symbol) for each symbol
 	void calcSymbSets(bool a_bClear);
+	// FIRST set of variable @a_nSymb, words of bit set over tokens
+	inline const unsigned int* getFirstBits(int a_nSymb) const {
+		assert(a_nSymb >= m_nTypeBase);
+		return &m_vnFirstBits[(a_nSymb - m_nTypeBase) * m_nFirstWords];
+	}
 	// compute RCS set(RCS: rules which contain the symbol)
 	// for each symbol
 	void calcRCSSet(void);
@@ -124,6 +134,11 @@ private:
     //          add it to @si
     void getLR1ItemLookaheads(sint_t& si, int nRule, int nDot,
                               const sint_t &seeThroughLa) const;
+    void getLR1ItemLookaheads(sint_t& si, int nRule, int nDot,
+                              const lasi_t &seeThroughLa) const;
+    // add FIRST of the symbols after @nDot to @si,
+    // return true if all of them are nullable
+    bool getLR1ItemFirst(sint_t& si, int nRule, int nDot) const;
 
     // compute LR(0) closure
     // @a_lrp: LR(0) kernel item
@@ -133,6 +148,7 @@ private:
     // @node: Parser graph node, which represents LR(0) kernel items
     // @closure: output closures; it is a map:
     //      symbol ID -> (map: LR(0) item -> lookaheads)
+    //      a closure already computed for smaller lookaheads is updated in place
     void calcLR1Closure(const pgnode_t &node, lr1_closure_t &closure) const;
     // compute spontaneous lookaheads
     void calcLookaheads(pgraph_t &a_pgrp) const;
@@ -149,10 +165,15 @@ private:
     void calcLR1Closure2(LALRGraphNode &curNode);
     // calculate LR(1) Items
     void calcLR1Items2(LALRGraph &lalrGraph);
-    // merge LR(1) Items into LALR Items group by Core Items
-    // convert from grammar object to parse graph
+    // convert from grammar object to parse graph,
+    // by merging LR(1) Items into LALR Items group by Core Items
     void gram2PGraph2(pgraph_t &a_pgrp);
 
+    // compute lookaheads by DeRemer and Pennello's relations
+    void calcDPLookaheads(pgraph_t &a_pgrp) const;
+    // convert from grammar object to parse graph, by DeRemer and Pennello's method
+    void gram2PGraph3(pgraph_t &a_pgrp);
+
     // initialize before conversion from grammar object to parse-tables
     void initPTable(ptable_t & a_ptbl);
 	
@@ -186,6 +207,7 @@ public:
 	, m_nTypeBase(INVALID_INDEX)
 	, m_nMaxTID(UNDEFINED_SYMBOL_ID)
 	, m_nMidRuleNum(INVALID_INDEX)
+	, m_nFirstWords(0)
 	, mt_nLastRuleIdx(INVALID_INDEX)
 	, mt_nFakeTypes(1) {
 		
@@ -206,6 +206,10 @@ public:
                 if(! equalComparer(cita->first, citb->first)) {
                     return lessComparer(cita->first, citb->first);
                 }
+                // CRC codes may collide, so lookaheads must be compared too
+                if(cita->second != citb->second) {
+                    return cita->second < citb->second;
+                }
             }
             return cita == aKI.mItems.end() && citb != bKI.mItems.end();
         }
@@ -422,6 +426,10 @@ public:
                 if(! equalComparer(cita->first, citb->first)) {
                     return lessComparer(cita->first, citb->first);
                 }
+                // CRC codes may collide, so lookaheads must be compared too
+                if(cita->second != citb->second) {
+                    return cita->second < citb->second;
+                }
             }
             return cita == aNode->mItems.end() && citb != bNode->mItems.end();
         }
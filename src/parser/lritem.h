@@ -25,6 +25,9 @@
 #include "./defines.h"
 #include "../common/common.h"
 #include "../common/types.h"
+#include "../common/arena.h"
+using common_ns::arena_t;
+using common_ns::arena_alloc_t;
 
 #include <functional>
 using std::binary_function;
@@ -87,7 +90,7 @@ public:
 typedef lri_pair_t lalr_item_t;
 typedef vector<lalr_item_t> vlaitem_t;
 
-typedef set< lri_pair_t > lrpair_set_t;
+typedef set< lri_pair_t, std::less<lri_pair_t>, arena_alloc_t<lri_pair_t> > lrpair_set_t;
 typedef lrpair_set_t::iterator lrps_it_t;
 typedef lrpair_set_t::const_iterator lrps_cit_t;
 
@@ -99,8 +102,12 @@ public:
 	}
 };
 
-typedef map< lri_pair_t, sint_t* > lr2si_map_t;
-typedef pair< lri_pair_t, sint_t* > lr2si_pair_t;
+// lookahead set; its nodes come from the arena of the parse graph
+typedef set< int, std::less<int>, arena_alloc_t<int> > lasi_t;
+
+typedef map< lri_pair_t, lasi_t*, std::less<lri_pair_t>,
+		arena_alloc_t< pair<const lri_pair_t, lasi_t*> > > lr2si_map_t;
+typedef pair< lri_pair_t, lasi_t* > lr2si_pair_t;
 typedef lr2si_map_t::iterator lr2si_it_t;
 typedef lr2si_map_t::const_iterator lr2si_cit_t;
 
@@ -116,7 +123,8 @@ typedef pair<int, lrpair_set_t* > i2lrps_pair_t;
 typedef i2lrps_map_t::iterator i2lrps_it_t;
 typedef i2lrps_map_t::const_iterator i2lrps_cit_t;
 
-typedef map<int, lr2si_map_t* > lr1_closure_t;
+typedef map<int, lr2si_map_t*, std::less<int>,
+		arena_alloc_t< pair<const int, lr2si_map_t*> > > lr1_closure_t;
 typedef lr1_closure_t::iterator lr1_closure_it_t;
 typedef lr1_closure_t::const_iterator lr1_closure_cit_t;
 
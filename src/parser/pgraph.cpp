@@ -35,9 +35,12 @@ using std::endl;
 
 #include <algorithm>
 using std::sort;
+#include <set>
+using std::set;
 
 #include "../common/unifind.h"
 using common_ns::unifind_t;
+#include "../common/profiler.h"
 
 #include "../main/upgmain.h"
 #include "./pgraph.h"
@@ -63,10 +66,9 @@ void pgraph_t::clear(void) {
 	}
 	m_vpNodes.clear();
 	
-	for(i = 0; i < (int)m_ioArcs.size(); ++i) {
-		delete m_ioArcs[i];
-	}
+	// arcs and their items are all in the arena
 	m_ioArcs.clear();
+	m_arena.release();
 	
 	for(i = 0; i < FIRST_STATE; ++i) {			
 		m_vpNodes.push_back(nullptr);
@@ -729,6 +731,320 @@ void pgraph_t::toGotoTable(vftbl_t &a_ftGoto) {
 	}
 }
 
+// pick the most frequent value of @a_vnVal other than @a_nSkip,
+// the smallest one wins a tie; return @a_nSkip if there is none
+static int mostFrequent(const vint_t &a_vnVal, int a_nSkip) {
+	
+	i2i_map_t mapCount;
+	int nBest = a_nSkip, nBestCount = 0;
+	for(int i = 0; i < (int)a_vnVal.size(); ++i) {
+		
+		if(_EQ(a_vnVal[i], a_nSkip)) {
+			continue;
+		}
+		int nCount = ++mapCount[a_vnVal[i]];
+		if(nCount > nBestCount || (_EQ(nCount, nBestCount) && a_vnVal[i] < nBest)) {
+			nBest = a_vnVal[i];
+			nBestCount = nCount;
+		}
+	}
+	return nBest;
+}
+
+// put a sparse row, pairs of (column, value), into next/check tables,
+// at the first base with no collision that is not used by any other row;
+// cells of a row are valid where check equals their column
+static int packRow(const vint_t &a_vnRow, int a_nEmpty,
+		table_t &a_tNext, table_t &a_tCheck, sint_t &a_siBases, int &a_nCur) {
+	
+	assert(a_vnRow.size() > 0 && _EQ(a_vnRow.size() % 2, 0u));
+	const int nLow = a_vnRow[0];
+	int nBase = (a_nCur > nLow)? a_nCur - nLow : 0;
+	for(;; ++nBase) {
+		
+		if(a_siBases.count(nBase)) {
+			continue;
+		}
+		int k = 0;
+		for(; k < (int)a_vnRow.size(); k += 2) {
+			
+			int idx = nBase + a_vnRow[k];
+			if(idx < (int)a_tCheck.size() && a_tCheck[idx] != a_nEmpty) {
+				break;
+			}
+		}
+		if(_EQ(k, (int)a_vnRow.size())) {
+			break;
+		}
+	}
+	
+	a_siBases.insert(nBase);
+	for(int k = 0; k < (int)a_vnRow.size(); k += 2) {
+		
+		int idx = nBase + a_vnRow[k];
+		if(idx >= (int)a_tCheck.size()) {
+			a_tCheck.resize(idx + 1, a_nEmpty);
+			a_tNext.resize(idx + 1, 0);
+		}
+		a_tCheck[idx] = a_vnRow[k];
+		a_tNext[idx] = a_vnRow[k + 1];
+	}
+	while(a_nCur < (int)a_tCheck.size() && a_tCheck[a_nCur] != a_nEmpty) {
+		++a_nCur;
+	}
+	return nBase;
+}
+
+// pack parse tables with default actions and gotos, merging identical rows;
+// this is the scheme of Bison, except errors are never deferred:
+// an action row keeps only cells differing from the default action of the
+// state, which is the most frequent one of its reductions and error;
+// a goto column keeps only cells differing from the most frequent target;
+// rows left identical share one base in next/check tables.
+void pgraph_t::mergeRows(vftbl_t &a_ftAct, vftbl_t &a_ftGoto) {
+	
+	int i, j;
+	int nRows = m_refPTbl.m_nEState;
+	int nRuleBase = nRows + 1;
+	int nTokens = m_refGrammar.getTokenCount();
+	int nTypes = m_refGrammar.getTypeCount();
+	int nErrVal = m_refPTbl.m_nERule;
+	
+	table_t& tNext = m_refPTbl.m_tParse;
+	table_t& tCheck = m_refPTbl.m_tCheck;
+	table_t& tBase = m_refPTbl.m_tBase;
+	table_t& tDefAct = m_refPTbl.m_tDefAct;
+	
+	tBase.resize(nRows, INVALID_INDEX);
+	tDefAct.resize(nRows, nErrVal);
+	
+	// a check never equals a column, if it is the number of columns
+	map<vint_t, int> mapRows;
+	sint_t siBases;
+	vint_t vnVal, vnRow, vnDef;
+	int nCur = 0;
+	for(i = FIRST_STATE; i < nRows; ++i) {
+		
+		assert(a_ftAct[i]);
+		const frow_t &row = *a_ftAct[i];
+		vnVal.assign(nTokens, nErrVal);
+		sint_t siAct;
+		for(j = 0; j < nTokens; ++j) {
+			
+			switch(row[j].m_nCellType) {
+			case FT_CELL_SHIFT:
+				vnVal[j] = row[j].m_nState;
+				siAct.insert(vnVal[j]);
+				break;
+			case FT_CELL_REDUCE:
+				vnVal[j] = row[j].m_nProd + nRuleBase;
+				siAct.insert(vnVal[j]);
+				break;
+			default:
+				break;
+			}
+		}
+		
+		vnRow.clear();
+		if(_EQ(siAct.size(), 1u) && *siAct.begin() >= nRuleBase) {
+			// a single reduction takes error cells too, and is done
+			// without lookahead, as yyget_defrule() of the other scheme
+			tDefAct[i] = *siAct.begin();
+		}
+		else {
+			// otherwise error cells are kept, so errors are detected in
+			// the same state as before; default is the most frequent one
+			// of reductions and error, shifts are always in the row
+			vnDef.clear();
+			for(j = 0; j < nTokens; ++j) {
+				if(vnVal[j] >= nRuleBase) {
+					vnDef.push_back(vnVal[j]);
+				}
+			}
+			tDefAct[i] = mostFrequent(vnDef, INVALID_STATE);
+			for(j = 0; j < nTokens; ++j) {
+				if(vnVal[j] != tDefAct[i]) {
+					vnRow.push_back(j);
+					vnRow.push_back(vnVal[j]);
+				}
+			}
+		}
+		
+		if( ! vnRow.empty()) {
+			pair<map<vint_t, int>::iterator, bool> pairRet =
+					mapRows.insert(std::make_pair(vnRow, 0));
+			if(pairRet.second) {
+				pairRet.first->second = packRow(vnRow, nTokens, tNext, tCheck, siBases, nCur);
+			}
+			tBase[i] = pairRet.first->second;
+		}
+		
+		delete a_ftAct[i];
+		a_ftAct[i] = nullptr;
+	}
+	
+	// states with default action only are given a base past all entries,
+	// where the table is padded with empty cells for a whole row
+	m_refPTbl.m_nDefOnlyBase = (int)tCheck.size();
+	for(i = 0; i < nRows; ++i) {
+		if(_EQ(tBase[i], INVALID_INDEX)) {
+			tBase[i] = m_refPTbl.m_nDefOnlyBase;
+		}
+	}
+	tCheck.resize(tCheck.size() + nTokens, nTokens);
+	tNext.resize(tCheck.size(), 0);
+	
+	// goto table is packed by columns: base per non-terminal, check is state
+	table_t& tGoto = m_refPTbl.m_tGoto;
+	table_t& tGCheck = m_refPTbl.m_tGCheck;
+	table_t& tGBase = m_refPTbl.m_tGBase;
+	table_t& tDefGoto = m_refPTbl.m_tDefGoto;
+	
+	tGBase.resize(nTypes, INVALID_INDEX);
+	tDefGoto.resize(nTypes, 0);
+	
+	// gather columns, pairs of (state, target), in one pass over rows
+	vector<vint_t> vvCols(nTypes);
+	for(i = FIRST_STATE; i < nRows; ++i) {
+		
+		assert(a_ftGoto[i]);
+		const frow_t &row = *a_ftGoto[i];
+		for(j = 0; j < nTypes; ++j) {
+			if(_EQ(row[j].m_nCellType, FT_CELL_GOTO)) {
+				vvCols[j].push_back(i);
+				vvCols[j].push_back(row[j].m_nGoto);
+			}
+		}
+		delete a_ftGoto[i];
+		a_ftGoto[i] = nullptr;
+	}
+	
+	mapRows.clear();
+	siBases.clear();
+	nCur = 0;
+	for(j = 0; j < nTypes; ++j) {
+		
+		const vint_t &vnCol = vvCols[j];
+		vnVal.clear();
+		for(i = 1; i < (int)vnCol.size(); i += 2) {
+			vnVal.push_back(vnCol[i]);
+		}
+		tDefGoto[j] = mostFrequent(vnVal, INVALID_STATE);
+		
+		vnRow.clear();
+		for(i = 0; i < (int)vnCol.size(); i += 2) {
+			if(vnCol[i + 1] != tDefGoto[j]) {
+				vnRow.push_back(vnCol[i]);
+				vnRow.push_back(vnCol[i + 1]);
+			}
+		}
+		
+		if( ! vnRow.empty()) {
+			pair<map<vint_t, int>::iterator, bool> pairRet =
+					mapRows.insert(std::make_pair(vnRow, 0));
+			if(pairRet.second) {
+				pairRet.first->second = packRow(vnRow, nRows, tGoto, tGCheck, siBases, nCur);
+			}
+			tGBase[j] = pairRet.first->second;
+		}
+	}
+	
+	int nGDefOnly = (int)tGCheck.size();
+	for(j = 0; j < nTypes; ++j) {
+		if(_EQ(tGBase[j], INVALID_INDEX)) {
+			tGBase[j] = nGDefOnly;
+		}
+	}
+	tGCheck.resize(tGCheck.size() + nRows, nRows);
+	tGoto.resize(tGCheck.size(), 0);
+}
+
+// count entries of packed parse tables: action, goto, and the others
+// which are bitmap and uniform rows/columns of scheme "nice"
+void pgraph_t::countTableSizes(int a_nPackScheme, int &a_nAct, int &a_nGoto, int &a_nOther) const {
+	
+	const ptable_t &tbl = m_refPTbl;
+	a_nAct = (int)(tbl.m_tParse.size() + tbl.m_tBase.size());
+	a_nGoto = (int)(tbl.m_tGoto.size() + tbl.m_tGBase.size());
+	a_nOther = 0;
+	if(_EQ(a_nPackScheme, PARSE_TABLE_MERGE)) {
+		
+		a_nAct += (int)(tbl.m_tCheck.size() + tbl.m_tDefAct.size());
+		a_nGoto += (int)(tbl.m_tGCheck.size() + tbl.m_tDefGoto.size());
+	}
+	else {
+		
+		a_nOther = (int)(tbl.m_bitValid.getBVect().size()
+				+ tbl.m_tActRowVal.size() + tbl.m_tActRowNice.size()
+				+ tbl.m_tColVal.size() + tbl.m_tColNice.size()
+				+ tbl.m_tGotoRowVal.size() + tbl.m_tGotoRowNice.size());
+	}
+}
+
+// report sizes of parse tables before and after packing, in entries
+void pgraph_t::reportTableSizes(int a_nPackScheme, ostream &oss) const {
+	
+	const int nStates = m_refPTbl.m_nEState - FIRST_STATE;
+	const int nTokens = m_refGrammar.getTokenCount();
+	const int nTypes = m_refGrammar.getTypeCount();
+	
+	int nAct, nGoto, nOther;
+	countTableSizes(a_nPackScheme, nAct, nGoto, nOther);
+	
+	oss << endl;
+	oss << "---------------------- Parse Tables -----------------------------" << endl << endl;
+	oss << "full tables: " << nStates << " states x (" << nTokens << " tokens + "
+		<< nTypes << " non-terminals) = " << nStates * (nTokens + nTypes) << " entries" << endl;
+	oss << "packed tables("
+		<< (_EQ(a_nPackScheme, PARSE_TABLE_MERGE)? "merged rows" : "nice") << "): "
+		<< nAct + nGoto + nOther << " entries, action " << nAct << ", goto " << nGoto;
+	if(nOther > 0) {
+		oss << ", bitmap and uniform rows/columns " << nOther;
+	}
+	oss << endl << endl;
+}
+
+// compare transitions and reductions with another parse-graph,
+// return ID of the first different state, or INVALID_STATE if identical
+int pgraph_t::compare(const pgraph_t &a_other) const {
+	
+	const int nCount = (int)m_vpNodes.size();
+	if(nCount != (int)a_other.m_vpNodes.size()) {
+		return (nCount < (int)a_other.m_vpNodes.size())? nCount: (int)a_other.m_vpNodes.size();
+	}
+	
+	for(int i = FIRST_STATE; i < nCount; ++i) {
+		
+		const pgnode_t *pNode = m_vpNodes[i], *pOther = a_other.m_vpNodes[i];
+		
+		// transitions: (symbol, target state)
+		set<i2i_pair_t> setArcs, setOtherArcs;
+		for(pgnode_t::arc_cit_t cit = pNode->outArcBegin(); cit != pNode->outArcEnd(); ++cit) {
+			setArcs.insert(i2i_pair_t((*cit)->m_nSymbol, (*cit)->m_ntoState));
+		}
+		for(pgnode_t::arc_cit_t cit = pOther->outArcBegin(); cit != pOther->outArcEnd(); ++cit) {
+			setOtherArcs.insert(i2i_pair_t((*cit)->m_nSymbol, (*cit)->m_ntoState));
+		}
+		if(setArcs != setOtherArcs) {
+			return i;
+		}
+		
+		// reductions: lookahead --> rules
+		if(pNode->getReduceCount() != pOther->getReduceCount()) {
+			return i;
+		}
+		for(i2si_cit_t cit = pNode->reduceBegin(), citOther = pOther->reduceBegin();
+			cit != pNode->reduceEnd();
+			++cit, ++citOther) {
+			
+			if(cit->first != citOther->first || *cit->second != *citOther->second) {
+				return i;
+			}
+		}
+	}
+	return INVALID_STATE;
+}
+
 // convert parse-graph to parse-table, report conflicts if any
 void pgraph_t::grp2PTbl(gsetting_t &gsetup) {
 	
@@ -770,11 +1086,32 @@ void pgraph_t::grp2PTbl(gsetting_t &gsetup) {
 	
 	clear();
 	
-	compress(vtAct, vtGoto);
-	
-	toActTable(vtAct);
+	_PROFILE_PHASE("parse tables");
+	_PROFILE_COUNT("full entries", (long)(m_refPTbl.m_nEState - FIRST_STATE)
+			* (m_refGrammar.getTokenCount() + m_refGrammar.getTypeCount()));
+	if(_EQ(gsetup.m_nParseTable, PARSE_TABLE_MERGE)) {
+		
+		mergeRows(vtAct, vtGoto);
+	}
+	else {
+		
+		compress(vtAct, vtGoto);
+		
+		toActTable(vtAct);
 
-	toGotoTable(vtGoto);
+		toGotoTable(vtGoto);
+	}
+	
+	if(common_ns::profiler_t::getProfiler()) {
+		
+		int nAct, nGoto, nOther;
+		countTableSizes(gsetup.m_nParseTable, nAct, nGoto, nOther);
+		_PROFILE_COUNT("packed entries", nAct + nGoto + nOther);
+	}
+	if(gsetup.m_posDetail) {
+		
+		reportTableSizes(gsetup.m_nParseTable, *(ostream*)gsetup.m_posDetail);
+	}
 }
 
 // report conflicts(shift/reduce, reduce/reduce)
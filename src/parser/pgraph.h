@@ -64,14 +64,26 @@ public:
 	
 public:
 	
-	inline pgarc_t(int a_nfromState,
+	// an arc lives in the arena of its parse graph, and so do its items
+	inline pgarc_t(arena_t &a_arena,
+			int a_nfromState,
 			int a_ntoState = INVALID_INDEX,
 			int a_nSymbol = INVALID_INDEX)
 	: m_nfromState(a_nfromState)
 	, m_ntoState(a_ntoState)
-	, m_nSymbol(a_nSymbol) {
+	, m_nSymbol(a_nSymbol)
+	, m_lrp2Lookaheads(std::less<lri_pair_t>(), lr2si_map_t::allocator_type(&a_arena)) {
 
 	}
+
+private:
+
+	inline lasi_t* newLookaheads(void) {
+		arena_t *parena = m_lrp2Lookaheads.get_allocator().getArena();
+		return parena->create<lasi_t>(std::less<int>(), lasi_t::allocator_type(parena));
+	}
+
+public:
 	
 	inline bool insertItem(int a_nProd, int a_nDot, int a_nLookahead) {
 		return insertItem(lri_pair_t(a_nProd, a_nDot), a_nLookahead);
@@ -79,7 +91,7 @@ public:
 	inline bool insertItem(const lri_pair_t &a_lrp, int a_nLookahead) {
 		pair<lr2si_it_t, bool> pairRet = m_lrp2Lookaheads.insert(lr2si_pair_t(a_lrp, nullptr));
 		if(pairRet.second) {
-			pairRet.first->second = new sint_t;
+			pairRet.first->second = newLookaheads();
 		}
 		return pairRet.first->second->insert(a_nLookahead).second;
 	}
@@ -87,22 +99,35 @@ public:
 		return insertItem(lri_pair_t(a_nProd, a_nDot), a_siLa);
 	}
 	inline bool insertItem(const lri_pair_t &a_lrp, const sint_t &a_siLa) {
+		return mergeItem(a_lrp, a_siLa);
+	}
+	inline bool insertItem(const lri_pair_t &a_lrp, const lasi_t &a_siLa) {
+		return mergeItem(a_lrp, a_siLa);
+	}
+
+private:
+
+	template<class S>
+	inline bool mergeItem(const lri_pair_t &a_lrp, const S &a_siLa) {
 		pair<lr2si_it_t, bool> pairRet = m_lrp2Lookaheads.insert(lr2si_pair_t(a_lrp, nullptr));
 		if(pairRet.second) {
-			pairRet.first->second = new sint_t;
+			pairRet.first->second = newLookaheads();
 		}
 		unsigned int nOldSize = pairRet.first->second->size();
 		pairRet.first->second->insert(a_siLa.begin(), a_siLa.end());
 		return pairRet.first->second->size() > nOldSize;
 	}
 
+public:
+
     bool insertItems(const lr2si_map_t& lrMap) {
         bool bret = false;
         for(lr2si_cit_t cit = lrMap.begin(); cit != lrMap.end(); cit++) {
             std::pair<lr2si_it_t, bool> ret =
-                    m_lrp2Lookaheads.insert(std::make_pair(cit->first, nullptr));
+                    m_lrp2Lookaheads.insert(lr2si_pair_t(cit->first, nullptr));
             if(ret.second) {
-                ret.first->second = new sint_t(*cit->second);
+                ret.first->second = newLookaheads();
+                ret.first->second->insert(cit->second->begin(), cit->second->end());
                 bret = true;
             } else {
                 lr2si_map_t::size_type sz = ret.first->second->size();
@@ -213,8 +238,9 @@ public:
 		pairRet.first->second->insert(a_siRRule.begin(), a_siRRule.end());
 	}
 
-    void addRRule(int a_nRule, const sint_t &a_siLa) {
-        for(sint_cit_t cit = a_siLa.begin();
+    template<class S>
+    void addRRule(int a_nRule, const S &a_siLa) {
+        for(typename S::const_iterator cit = a_siLa.begin();
             cit != a_siLa.end();
             cit++) {
             addRRule(a_nRule, *cit);
@@ -282,6 +308,8 @@ public:
 
 private:
 	
+	// arena holding arcs, LR(0) item sets and lookahead sets
+	arena_t m_arena;
 	// graph nodes
 	vpgnode_t m_vpNodes;
 	// graph arcs
@@ -294,6 +322,9 @@ private:
 public:
 	// convert parse-graph to parse-table
 	void grp2PTbl(gsetting_t &gsetup);
+	// compare transitions and reductions with another parse-graph,
+	// return ID of the first different state, or INVALID_STATE if identical
+	int compare(const pgraph_t &a_other) const;
 	
 private:
 	// create full tables(action and goto table), that is, not compressed;
@@ -307,6 +338,12 @@ private:
 	void toActTable(vftbl_t &a_ftAct);
 	// fill goto table using sparse matrix compression algorithm
 	void toGotoTable(vftbl_t &a_ftGoto);
+	// pack parse tables with default actions and gotos, merging identical rows
+	void mergeRows(vftbl_t &a_ftAct, vftbl_t &a_ftGoto);
+	// count entries of packed parse tables
+	void countTableSizes(int a_nPackScheme, int &a_nAct, int &a_nGoto, int &a_nOther) const;
+	// report sizes of parse tables before and after packing
+	void reportTableSizes(int a_nPackScheme, ostream &oss) const;
 	
 public:
 	
@@ -335,6 +372,20 @@ public:
 	inline void addArc(pgarc_t *a_pArc) {
 		m_ioArcs.push_back(a_pArc);
 	}
+	// allocate an arc in the arena; it is freed by clear()
+	inline pgarc_t* newArc(int a_nfromState,
+			int a_ntoState = INVALID_INDEX,
+			int a_nSymbol = INVALID_INDEX) {
+		return m_arena.create<pgarc_t>(m_arena, a_nfromState, a_ntoState, a_nSymbol);
+	}
+	// allocate an empty LR(0) item set in the arena
+	inline lrpair_set_t* newItemSet(void) {
+		return m_arena.create<lrpair_set_t>(std::less<lri_pair_t>(),
+						lrpair_set_t::allocator_type(&m_arena));
+	}
+	inline arena_t& getArena(void) {
+		return m_arena;
+	}
 	
 	inline pgnode_t* addEmptyNode(void) {
 		
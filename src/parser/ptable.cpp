@@ -60,6 +60,12 @@ void ptable_t::clear(void) {
 	m_tGoto.clear();
 	m_tGBase.clear();
 	
+	m_tCheck.clear();
+	m_tGCheck.clear();
+	m_tDefAct.clear();
+	m_tDefGoto.clear();
+	m_nDefOnlyBase = 0;
+	
 	m_ruleMgr.clear();
 	m_pCurAction = nullptr;
 	
@@ -97,6 +97,16 @@ private:
 	table_t m_tGoto;
 	table_t m_tGBase;
 	
+	// tables of merged rows(option -k), where @m_tBase is indexed by state,
+	// @m_tGBase by non-terminal, and a cell is valid if its check matches
+	table_t m_tCheck;
+	table_t m_tGCheck;
+	// default action of each state, default goto of each non-terminal
+	table_t m_tDefAct;
+	table_t m_tDefGoto;
+	// base shared by states having no entries besides default action
+	int m_nDefOnlyBase;
+	
 	// tables which are used to compress parse tables
 	// bit map indicating if cell(state, symbol) is valid or not
 	bitmap_t m_bitValid;
@@ -137,7 +147,8 @@ public:
 	, m_nEState(FIRST_STATE)
 	, m_nERule(INVALID_RULE)
 	, m_nTypeBase(0)
-	, m_nSymbNum(0)	{
+	, m_nSymbNum(0)
+	, m_nDefOnlyBase(0)	{
 		
 	}
 	
@@ -211,6 +222,23 @@ public:
 		return m_tGBase;
 	}
 	
+	// tables of merged rows
+	inline const table_t& getActionCheck(void) const {
+		return m_tCheck;
+	}
+	inline const table_t& getGotoCheck(void) const {
+		return m_tGCheck;
+	}
+	inline const table_t& getDefActions(void) const {
+		return m_tDefAct;
+	}
+	inline const table_t& getDefGotos(void) const {
+		return m_tDefGoto;
+	}
+	inline int getDefOnlyBase(void) const {
+		return m_nDefOnlyBase;
+	}
+	
 	inline void mapRule2Action(int a_nRule, int a_nActionIndex) {
 		m_ruleMgr.mapRule2Action(a_nRule, a_nActionIndex);
 	}
@@ -63,7 +63,6 @@ private:
 			
 			// for type
 			struct {
-				iset_t *m_pFirstSet;
 				// RLS: Rules using the symbol as Left Symbol
 				iset_t *m_pRLSSet;
 			};
@@ -97,7 +96,6 @@ private:
 	, m_nDstrctID(INVALID_INDEX)
 	, m_bNullable(false)
 	, m_bUsed(false)
-	, m_pFirstSet(nullptr)
 	, m_pRLSSet(nullptr)
 	, m_pRCSSet(nullptr) {
 		
@@ -113,10 +111,6 @@ public:
 		
 		if(!m_bIsToken) {
 			
-			if(m_pFirstSet) {
-				delete m_pFirstSet;
-				m_pFirstSet = nullptr;
-			}
 			if(m_pRLSSet) {
 				delete m_pRLSSet;
 				m_pRLSSet = nullptr;
@@ -201,14 +195,6 @@ public:
 		assert(m_bIsToken);
 		m_nAssoc = a_nAssoc;
 	}
-	inline iset_t* getFirstSet(void) {
-		assert( ! m_bIsToken);
-		return m_pFirstSet;
-	}
-	inline const iset_t* getFirstSet(void) const {
-		assert( ! m_bIsToken);
-		return m_pFirstSet;
-	}
 
 };
 
@@ -110,6 +110,57 @@ case ]]><Integer #0/><![[:]]><$UserDiscardActions/></Default>\n\
 	]]><$IntArray/></Case>\n\
 <Default><Integer #0/><![[,	]]><$IntArray/></Default>\n\
 	</Macro>\n\
+\n\
+	<Macro \"$IntType\">\n\
+<Case Equal\?\"uint8\"><![[unsigned char]]></Case>\n\
+<Case Equal\?\"int8\"><![[signed char]]></Case>\n\
+<Case Equal\?\"uint16\"><![[unsigned short]]></Case>\n\
+<Case Equal\?\"int16\"><![[short]]></Case>\n\
+<Default><![[int]]></Default>\n\
+	</Macro>\n\
+\n\
+	<Macro \"$LexDirectStates\">\n\
+<Case End><GoFirst/></Case>\n\
+<Default><![[\n\
+			yyds]]><Integer #0/><![[__:\n\
+				if(yytext == yytbuf__) {\n\
+					if(yylaleng >= yysize__ - 1) {\n\
+						renew_text__();\n\
+					}\n\
+					yytext[yylaleng] = (char)yycchar__;\n\
+				}\n\
+				++yylaleng;]]><$LexDirectAccept/><![[\n\
+				if(yybufmgr__.isimod() && (\'\\n\' == yycchar__ || END_OF_FILE == yycchar__)) {\n\
+					break;\n\
+				}\n\
+				yycchar__ = yybufmgr__.get();\n\
+			case ]]><Integer #0/><![[:\n\
+				switch(yydcmap[yycchar__]) {]]><$LexDirectArcs/></Default>\n\
+	</Macro>\n\
+\n\
+	<Macro \"$LexDirectAccept\">\n\
+<Case Equal\?-1><Skip #0/></Case>\n\
+<Default><![[\n\
+				yylrule__ = ]]><Integer #0/><![[;\n\
+				yyaccleng__ = yylaleng;]]></Default>\n\
+	</Macro>\n\
+\n\
+	<Macro \"$LexDirectArcs\">\n\
+<Case GroupFlag><Skip #0/><![[\n\
+				default:\n\
+					yylstate__ = LEX_ERROR_STATE;\n\
+				}\n\
+				break;]]><$LexDirectStates/></Case>\n\
+<Default><![[\n\
+				case ]]><Integer #0/><![[:]]><$LexDirectMore/></Default>\n\
+	</Macro>\n\
+\n\
+	<Macro \"$LexDirectMore\">\n\
+<Case Equal\?-2><Skip #0/><![[\n\
+					yylstate__ = ]]><Integer #0/><![[;\n\
+					goto yyds]]><Integer #0/><![[__;]]><$LexDirectArcs/></Case>\n\
+<Default><![[ case ]]><Integer #0/><![[:]]><$LexDirectMore/></Default>\n\
+	</Macro>\n\
 \n\
 	<Macro \"$QStrArray\">\n\
 <Case Last><![[\"]]><String #0/><![[\"]]><GoFirst/></Case>\n\
@@ -130,9 +181,9 @@ case ]]><Integer #0/><![[:]]><$UserDiscardActions/></Default>\n\
 	</Macro>\n\
 \n\
 	<Macro \"$SVNAME_LEFT\"><![[(yyval.]]><Text #0/><![[)]]></Macro>\n\
-	<Macro \"$SVNAME_RIGHT\"><![[(yys_sv__[]]><Text #0/><![[].]]><Text #1/><![[)]]></Macro>\n\
+	<Macro \"$SVNAME_RIGHT\"><![[(yystk__[]]><Text #0/><![[].sv.]]><Text #1/><![[)]]></Macro>\n\
 	<Macro \"$SVLOC_LEFT\"><![[(yyloc)]]></Macro>\n\
-	<Macro \"$SVLOC_RIGHT\"><![[(yys_loc__[]]><Text #0/><![[])]]></Macro>\n\
+	<Macro \"$SVLOC_RIGHT\"><![[(yystk__[]]><Text #0/><![[].loc)]]></Macro>\n\
 	<Macro \"$SVNAME_DSTRCT\"><![[(yydval.]]><Text #0/><![[)]]></Macro>\n\
 	<Macro \"$SVLOC_DSTRCT\"><![[(yydloc)]]></Macro>\n\
 \n\
@@ -140,6 +191,28 @@ case ]]><Integer #0/><![[:]]><$UserDiscardActions/></Default>\n\
 		<Case Has><Action #0/></Case>\n\
 		<Default><![[yy]]><Text #1/></Default>\n\
 	</Macro>\n\
+\n\
+	<Macro \"$ParserParam\">\n\
+	<Case Reentrant><![[yyparser_t *yyp]]></Case>\n\
+	</Macro>\n\
+\n\
+	<Macro \"$ParserParams\">\n\
+	<Case Reentrant><![[yyparser_t *yyp]]><$NextParams #0/></Case>\n\
+	<Default><$Params #0/></Default>\n\
+	</Macro>\n\
+\n\
+	<Macro \"$Params\">\n\
+	<Case Has><Action #0/></Case>\n\
+	</Macro>\n\
+\n\
+	<Macro \"$NextParams\">\n\
+	<Case Has><![[, ]]><Action #0/></Case>\n\
+	</Macro>\n\
+\n\
+	<Macro \"$ErrorReporter\">\n\
+	<Case Reentrant><![[yyerror__]]></Case>\n\
+	<Default><![[yyerror]]></Default>\n\
+	</Macro>\n\
 </Macros>\n\
 \n\
 <Program>\n\
@@ -155,6 +228,11 @@ case ]]><Integer #0/><![[:]]><$UserDiscardActions/></Default>\n\
 #include <errno.h>\n\
 #include <string.h>\n\
 #include <sys/stat.h>\n\
+#if !defined(_WIN32)\n\
+#include <sys/mman.h>\n\
+#include <fcntl.h>\n\
+#include <unistd.h>\n\
+#endif\n\
 // update 14/12/17\n\
 #include <vector>\n\
 #include <unordered_map>\n\
@@ -204,7 +282,9 @@ enum {]]>\n\
 INC_YYTEXT_SIZE = 4096,\n\
 END_OF_FILE = 256,\n\
 END_OF_ALLFILE = 257,\n\
-\n\
+]]><If PushMode><![[// input chunk runs out, but more chunks are coming\n\
+END_OF_CHUNK = 258,\n\
+]]></If><![[\n\
 // start-condition names\n\
 ]]><$ConstsDefine \"LexStartLabels\" \"LexStartIndexes\"/><![[\n\
 // number of DFA states of scanner\n\
@@ -226,7 +306,13 @@ LEX_EOFRULE_BASE = ]]><Integer \"LexEOFRuleBase\"/><![[,\n\
 // index of the rule that matches EOAF (end of all files, or end of input)\n\
 LEX_EOAF_RULE = ]]><Integer \"LexEOFARuleIndex\"/><![[,\n\
 \n\
-]]>\n\
+]]><If Has\?\"LexDFAFull\"><![[\n\
+// size of rows of full transition table, the last column holds accepted\n\
+// rules, which are offset by -LEX_ERROR_RULE\n\
+LEX_FULL_STRIDE = ]]><Integer \"LexFullStride\"/><![[,\n\
+LEX_FULL_ACCEPT = LEX_FULL_STRIDE - 1,\n\
+\n\
+]]></If>\n\
 </If>\n\
 <![[\n\
 // index of symbol `$end\' in symbol table\n\
@@ -245,9 +331,11 @@ PARSE_UNDEFSYMB_ID = ]]><Integer \"ParseUndefSymbID\"/><![[,\n\
 ]]>\n\
 \n\
 <If EnableParser>\n\
-<![[\n\
+<If ParseRowMerge><![[\n\
+// base of action table for states having default action only\n\
+PARSE_DEFONLY_BASE = ]]><Integer \"PActionDefBase\"/><![[,]]></If><Else><![[\n\
 // row size(in byte) of non-error bitmap of parse table\n\
-PARSE_BMAP_ROWSIZE = ]]><Integer \"ParseBMapRowSize\"/><![[,\n\
+PARSE_BMAP_ROWSIZE = ]]><Integer \"ParseBMapRowSize\"/><![[,]]></Else><![[\n\
 // base address of indexes of types (aka non-terminals or variables)\n\
 PARSE_TYPE_BASE = ]]><Integer \"ParseTypeBase\"/><![[,\n\
 // number of symbols in parser\n\
@@ -330,17 +418,70 @@ enum {\n\
 <If EnableScanner><![[\n\
 class bufbase_t;\n\
 typedef bufbase_t *YYPBUFFER;\n\
-]]><![[\n\
+]]>\n\
+	<If EnableLocation>\n\
+		<If EnableColumn><![[\n\
+// cycstack_t: stack of the last CYCSTACK_SIZE values, older ones are\n\
+// overwritten, so that its memory does not grow with the input;\n\
+// popping more than it keeps yields 0\n\
+class cycstack_t {\n\
+\n\
+public:\n\
+	enum {\n\
+		CYCSTACK_SIZE = 64\n\
+	};\n\
+\n\
+	cycstack_t(void) : bs(0), tp(0) {}\n\
+\n\
+	inline void push(int n) {\n\
+		tp = (tp + 1) % CYCSTACK_SIZE;\n\
+		el[tp] = n;\n\
+		if(tp == bs) {\n\
+			bs = (tp + 1) % CYCSTACK_SIZE;\n\
+		}\n\
+	}\n\
+	inline int pop(void) {\n\
+		if(tp == bs) {\n\
+			return 0;\n\
+		}\n\
+		int n = el[tp];\n\
+		tp = (tp + CYCSTACK_SIZE - 1) % CYCSTACK_SIZE;\n\
+		return n;\n\
+	}\n\
+	inline void clear(void) {\n\
+		tp = bs;\n\
+	}\n\
+\n\
+private:\n\
+	int el[CYCSTACK_SIZE];\n\
+	int bs;\n\
+	int tp;\n\
+};\n\
+]]>\n\
+		</If>\n\
+	</If><![[\n\
 class bufbase_t {\n\
 \n\
 public:\n\
 	virtual ~bufbase_t(void){}\n\
-	virtual int get(void) = 0;\n\
+	// chars before glim are read in place, only then is xget() called\n\
+	inline int get(void) {\n\
+		if(gptr + 1 < glim) {\n\
+			return (int)(*++gptr);\n\
+		}\n\
+		return xget();\n\
+	}\n\
 	virtual int peek(void) = 0;\n\
 	virtual int unget(void) = 0;\n\
 	virtual int unget(int num) = 0;\n\
 	virtual int put(char) = 0;\n\
-\n\
+	// start of next token if it can be referred in place, otherwise NULL\n\
+	virtual char* textptr(void) { return NULL; }\n\
+	// count of chars read from start of input\n\
+	virtual long tell(void) const { return (long)(gptr + 1 - pbase); }\n\
+]]><If PushMode><![[	// append input chunk, only buffer of chunks accepts it\n\
+	virtual bool append(const char*, int, int, bool) { return false; }\n\
+]]></If><![[\n\
 	inline void reset(void) {\n\
 		xreset();]]>\n\
 	<If EnableLocation>\n\
@@ -365,10 +506,14 @@ public:\n\
 	inline void setdata(void* pv) { pvoid = pv; }\n\
 protected:\n\
 	virtual void xreset(void) = 0;\n\
+	// read next char when it can not be read in place, and update glim\n\
+	virtual int xget(void) = 0;\n\
 \n\
 	by_te_t *pbase;\n\
 	by_te_t *gptr;\n\
 	by_te_t *gend;\n\
+	// limit of chars that can be read in place\n\
+	by_te_t *glim;\n\
 	bool eos;\n\
 	// interactive mode\n\
 	bool imod;\n\
@@ -381,35 +526,23 @@ protected:\n\
 	<If EnableLocation>\n\
 		<If EnableColumn><![[\n\
 public:\n\
-    // update 14/12/17\n\
-    inline void pushlsz(int nlsize) {\n\
-        stlsz.push_back(nlsize);\n\
-    }\n\
-    inline int poplsz(void) {\n\
-        if(stlsz.empty()) {\n\
-            return 0;\n\
-        }\n\
-        auto n = stlsz.back();\n\
-        stlsz.pop_back();\n\
-        return n;\n\
-    }\n\
-\n\
-    inline void pushtsz(int ntsize) {\n\
-        // update 14/12/17\n\
-        sttsz.push_back(ntsize);\n\
-    }\n\
-    inline int poptsz(void) {\n\
-        if(sttsz.empty()) {\n\
-            return 0;\n\
-        }\n\
-        auto n = sttsz.back();\n\
-        sttsz.pop_back();\n\
-        return n;\n\
-    }\n\
+	// sizes of lines and tabs read lately, so that columns can be\n\
+	// restored when newlines and tabs are put back\n\
+	inline void pushlsz(int nlsize) {\n\
+		stlsz.push(nlsize);\n\
+	}\n\
+	inline int poplsz(void) {\n\
+		return stlsz.pop();\n\
+	}\n\
+	inline void pushtsz(int ntsize) {\n\
+		sttsz.push(ntsize);\n\
+	}\n\
+	inline int poptsz(void) {\n\
+		return sttsz.pop();\n\
+	}\n\
 protected:\n\
-    // update 14/12/17\n\
-    std::vector<int> stlsz;\n\
-    std::vector<int> sttsz;\n\
+	cycstack_t stlsz;\n\
+	cycstack_t sttsz;\n\
 ]]>\n\
 		</If>\n\
 	</If><![[\n\
@@ -420,14 +553,29 @@ protected:\n\
 <![[\n\
 // function type for error-reporting\n\
 typedef void(*yyerror_t)(const char* msg]]><If Has\?\"FormalParams\"><![[, ]]><Action \"FormalParams\"/></If><![[);\n\
-\n\
+]]><If Reentrant><![[\n\
+// parser object, it holds everything of scanner and parser\n\
+class yyparser_t;\n\
+// create a parser object, it can be used in one thread while others are used\n\
+// in other threads\n\
+yyparser_t* yycreate(void);\n\
+// destroy parser object created by yycreate\n\
+void yydestroy(yyparser_t *yyp);\n\
+]]></If><![[\n\
 // assign new log stream\n\
-void yysetstream(FILE *poutput, FILE *plogger);\n\
+void yysetstream(]]><$ParserParam/><If Reentrant><![[, ]]></If><![[FILE *poutput, FILE *plogger);\n\
 // assign new error-reporter and return the old one\n\
-yyerror_t yyseterror(yyerror_t);\n\
+yyerror_t yyseterror(]]><$ParserParam/><If Reentrant><![[, ]]></If><![[yyerror_t);\n\
 // reset all (both scanner and parser, if they are available)\n\
-void yyclearall(void);\n\
-]]>\n\
+void yyclearall(]]><If Reentrant><![[yyparser_t *yyp]]></If><Else><![[void]]></Else><![[);\n\
+]]><If PushMode><![[\n\
+// results of push mode: yypush accepts input or requires more tokens,\n\
+// and yylex requires more input chunks; others are error codes\n\
+enum {\n\
+	YYPUSH_ACCEPT =	0,\n\
+	YYPUSH_MORE =	-6,\n\
+};\n\
+]]></If>\n\
 <If EnableParser>\n\
 <If Has\?\"LTypeName\">\n\
 <![[\n\
@@ -460,52 +608,84 @@ struct yystype_t {\n\
 typedef ]]><$TypeName \"STypeName\" \"stype_t\"/><![[ xstype_t;\n\
 typedef ]]><$TypeName \"LTypeName\" \"ltype_t\"/><![[ xltype_t;\n\
 // function type for scanning\n\
-typedef int (*yylex_t)(]]><If Has\?\"FormalParams\"><Action \"FormalParams\"/></If><![[);\n\
+typedef int (*yylex_t)(]]><$ParserParams \"FormalParams\"/><![[);\n\
 \n\
 // assign new scanner and return the old one\n\
-yylex_t yysetlex(yylex_t);\n\
-]]>\n\
+yylex_t yysetlex(]]><$ParserParam/><If Reentrant><![[, ]]></If><![[yylex_t);\n\
+]]><If Reentrant><![[// semantic value and location of current token, assigned by scanner\n\
+xstype_t* yygetlval(yyparser_t *yyp);\n\
+xltype_t* yygetlloc(yyparser_t *yyp);\n\
+]]></If>\n\
 </If>\n\
 \n\
 <If EnableScanner><![[\n\
 // initializing file buffer before parsing or patter-matching\n\
-int yylexfile(const char* pchFile, bool iMod = false);\n\
+int yylexfile(]]><$ParserParam/><If Reentrant><![[, ]]></If><![[const char* pchFile, bool iMod = false);\n\
 // initializing string buffer before parsing or patter-matching\n\
-int yylexstr(char *strbuffer, int size);\n\
+int yylexstr(]]><$ParserParam/><If Reentrant><![[, ]]></If><![[char *strbuffer, int size);\n\
 // initializing const string buffer before parsing or patter-matching\n\
-int yylexcstr(const char *strbuffer, int size);\n\
-\n\
+int yylexcstr(]]><$ParserParam/><If Reentrant><![[, ]]></If><![[const char *strbuffer, int size);\n\
+// initializing memory-mapped file buffer before parsing or patter-matching\n\
+int yylexmmap(]]><$ParserParam/><If Reentrant><![[, ]]></If><![[const char *pchFile);\n\
+]]><If PushMode><![[// appending input chunk before pattern-matching, the last chunk is marked\n\
+// by blast, and yylex returns YYPUSH_MORE when all chunks are consumed\n\
+int yylexchunk(]]><$ParserParam/><If Reentrant><![[, ]]></If><![[const char *pchunk, int size, bool blast = false);\n\
+]]></If><![[\n\
 // generated scanner, can be replaced\n\
-int yylex(]]><If Has\?\"FormalParams\"><Action \"FormalParams\"/></If><![[);\n\
+int yylex(]]><$ParserParams \"FormalParams\"/><![[);\n\
+\n\
+// token recorded by yylex_batch\n\
+struct yytoken_t {\n\
+	// value returned by action\n\
+	int id;\n\
+	// index of matched rule\n\
+	int rule;\n\
+	// offset of text from start of input\n\
+	long offset;\n\
+	int length;\n\
+	// text in input buffer, not NULL-terminated; NULL if input is read\n\
+	// from file by pieces, or given by chunks\n\
+	const char *text;\n\
+};\n\
+// scanning at most @max tokens into @out, return count of them, 0 at end of\n\
+// input, or error code if none is scanned; text of tokens is valid until\n\
+// next call\n\
+int yylex_batch(]]><$ParserParam/><If Reentrant><![[, ]]></If><![[yytoken_t *out, int max]]><$NextParams \"FormalParams\"/><![[);\n\
 \n\
 ]]></If><If EnableParser><![[\n\
 // generated parser, it should not be replaced\n\
-int yyparse(]]><If Has\?\"FormalParams\"><Action \"FormalParams\"/></If><![[);\n\
-]]>\n\
+int yyparse(]]><$ParserParams \"FormalParams\"/><![[);\n\
+]]><If PushMode><![[// pushing one token with its semantic value and location (both can be\n\
+// NULL) to parser, return YYPUSH_MORE when next token is required\n\
+int yypush(]]><$ParserParam/><If Reentrant><![[, ]]></If><![[int tok, const xstype_t *pval, const xltype_t *ploc]]><$NextParams \"FormalParams\"/><![[);\n\
+]]></If>\n\
 </If>\n\
 \n\
 <Declare/>\n\
-<If EnableParser><![[\n\
+<If EnableParser><If Reentrant><![[\n\
+// semantic value and location are held in parser objects, see yygetlval\n\
+]]></If><Else><![[\n\
 extern xstype_t yylval;\n\
 extern xltype_t yylloc;\n\
-]]></If>\n\
+]]></Else></If>\n\
 <If EnableDeclare><![[\n\
 } // namespace\n\
 #endif\n\
 ]]></If>\n\
 \n\
 <Define/>\n\
-<If EnableParser><![[\n\
+<If EnableParser><If Reentrant><![[\n\
+]]></If><Else><![[\n\
 xstype_t yylval;\n\
 xltype_t yylloc;\n\
 \n\
-]]></If>\n\
+]]></Else></If>\n\
 <![[\n\
 // program abort due to out of memory\n\
 inline static void exit_on_oom(void) {\n\
 	exit(-1);\n\
 }\n\
-static char stext__[24] = \"unprintable-char{\";\n\
+static ]]><If Reentrant><![[thread_local ]]></If><![[char stext__[24] = \"unprintable-char{\";\n\
 inline static const char* sym_text__(const char* ps) {\n\
 	\n\
 	by_te_t b = (by_te_t)*ps, i = 17, t;\n\
@@ -530,10 +710,12 @@ static void yyemit_error__(const char *s]]><If Has\?\"FormalParams\"><![[, ]]><A
 \n\
 class yyparser_t {\n\
 \n\
-    friend void yysetstream(FILE *poutput, FILE *plogger);\n\
-    friend yyerror_t yyseterror(yyerror_t);\n\
-    ]]><If EnableParser><![[friend yylex_t yysetlex(yylex_t);\n\
-]]></If>\n\
+    friend void yysetstream(]]><$ParserParam/><If Reentrant><![[, ]]></If><![[FILE *poutput, FILE *plogger);\n\
+    friend yyerror_t yyseterror(]]><$ParserParam/><If Reentrant><![[, ]]></If><![[yyerror_t);\n\
+    ]]><If EnableParser><![[friend yylex_t yysetlex(]]><$ParserParam/><If Reentrant><![[, ]]></If><![[yylex_t);\n\
+]]><If Reentrant><![[    friend xstype_t* yygetlval(yyparser_t *yyp);\n\
+    friend xltype_t* yygetlloc(yyparser_t *yyp);\n\
+]]></If></If>\n\
 <If EnableScanner><![[\n\
 private:\n\
 \n\
@@ -558,9 +740,10 @@ private:\n\
 			inline void init(void) {\n\
 \n\
 				gptr = pbase = &buf[BUF_FULL_SIZE - 1];\n\
-				gend = &buf[0];\n\
+				gend = glim = &buf[0];\n\
 				eos = false;\n\
 				bpeeked = false;\n\
+				nfilled = 0;\n\
 			}\n\
 \n\
 		public:\n\
@@ -591,7 +774,7 @@ private:\n\
 				init();\n\
 			}\n\
 \n\
-			virtual int get(void) {\n\
+			virtual int xget(void) {\n\
 \n\
 				if(gptr == gend) {\n\
 \n\
@@ -607,6 +790,8 @@ private:\n\
 				}\n\
 \n\
 				bpeeked = false;\n\
+				// chars up to gend or end of ring, whichever comes first\n\
+				glim = (gend >= gptr)\? gend : buf + BUF_FULL_SIZE;\n\
 \n\
 				return iseof()\? END_OF_FILE: (int)(*gptr);\n\
 			}\n\
@@ -625,7 +810,9 @@ private:\n\
 					fill(p);\n\
 				}\n\
 \n\
-				bpeeked = true;\n\
+				// set only if nothing is filled, so that get() does not fill again,\n\
+				// chars read in place leave it as it is\n\
+				bpeeked = (p == gend);\n\
 \n\
 				return (p == gend)\? END_OF_FILE: (int)(*p);\n\
 			}\n\
@@ -701,13 +888,26 @@ private:\n\
 				if(ncnt > vacents) {\n\
 					pbase = buf + ((gend - buf) + 1) % BUF_FULL_SIZE;\n\
 				}\n\
+				nfilled += ncnt;\n\
 				return ncnt;\n\
 			}\n\
+\n\
+		public:\n\
+\n\
+			// chars filled so far, less those not read yet\n\
+			virtual long tell(void) const {\n\
+\n\
+				if(gptr == gend) {\n\
+					return nfilled;\n\
+				}\n\
+				return nfilled - ((gend - gptr) + BUF_FULL_SIZE - 1) % BUF_FULL_SIZE;\n\
+			}\n\
 \n\
 		private:\n\
 \n\
 			bool bpeeked;\n\
 			FILE *pfile;\n\
+			long nfilled;\n\
 			by_te_t buf[BUF_FULL_SIZE];\n\
 		};\n\
 \n\
@@ -760,9 +960,10 @@ private:\n\
 			virtual void xreset(void) {\n\
 \n\
 				gptr = pbase - 1;\n\
+				glim = gend;\n\
 				eos = false;\n\
 			}\n\
-			virtual int get(void) {\n\
+			virtual int xget(void) {\n\
 \n\
 				if(gptr == gend) {\n\
 					eos = true;\n\
@@ -810,12 +1011,302 @@ private:\n\
 \n\
 				return oldc;\n\
 			}\n\
+\n\
+			virtual char* textptr(void) {\n\
+				return (char*)((gptr == gend)\? gend : gptr + 1);\n\
+			}\n\
 \n\
 		private:\n\
 			bool bowner;\n\
 		};\n\
 \n\
 	private:\n\
+\n\
+		// whole file mapped into memory, read linearly without refilling,\n\
+		// so matched text can be referred in place instead of being copied\n\
+		class mmapbuf_t: public bufbase_t {\n\
+\n\
+			friend class bufmgr_t;\n\
+		public:\n\
+\n\
+			// nSize is length of file, one more zero byte follows the mapping\n\
+			mmapbuf_t(by_te_t *pchMap, size_t nSize)\n\
+			: nmap(nSize + 1) {\n\
+\n\
+				pbase = pchMap;\n\
+				gend = pbase + nSize;\n\
+				xreset();\n\
+				imod = false;\n\
+				line = 1;\n\
+				col = 1;\n\
+				tab = 4;\n\
+				pvoid = NULL;\n\
+			}\n\
+\n\
+			virtual ~mmapbuf_t(void) {\n\
+#if !defined(_WIN32)\n\
+				munmap(pbase, nmap);\n\
+#else\n\
+				delete [] pbase;\n\
+#endif\n\
+			}\n\
+\n\
+		public:\n\
+\n\
+			virtual void xreset(void) {\n\
+\n\
+				gptr = pbase - 1;\n\
+				glim = gend;\n\
+				eos = false;\n\
+			}\n\
+			virtual int xget(void) {\n\
+\n\
+				if(gptr == gend) {\n\
+					eos = true;\n\
+					return END_OF_ALLFILE;\n\
+				}\n\
+				++gptr;\n\
+\n\
+				return (gptr == gend)\? END_OF_FILE : (int)(*gptr);\n\
+			}\n\
+\n\
+			virtual int peek(void) {\n\
+\n\
+				return (gptr == gend) \? (eos \? END_OF_ALLFILE: END_OF_FILE) : \n\
+					(int)(*(gptr + 1));\n\
+			}\n\
+			virtual int unget(void) {\n\
+				if(eos || (pbase - 1 == gptr)) {\n\
+					return END_OF_FILE;\n\
+				}\n\
+				return (int)(*gptr--);\n\
+			}\n\
+			virtual int unget(int num) {\n\
+\n\
+				if(eos || (pbase - 1 == gptr)) {\n\
+					return 0;\n\
+				}\n\
+				if(gptr - pbase + 1 < num) {\n\
+					num = (int)(gptr - pbase + 1);\n\
+				}\n\
+				gptr -= num;\n\
+\n\
+				return num;\n\
+			}\n\
+\n\
+			virtual int put(char c) {\n\
+\n\
+				if(eos || (pbase - 1 == gptr)) {\n\
+					return END_OF_FILE;\n\
+				}\n\
+\n\
+				int oldc = (int)(*gptr);\n\
+\n\
+				*gptr-- = (by_te_t)c;\n\
+\n\
+				return oldc;\n\
+			}\n\
+\n\
+			virtual char* textptr(void) {\n\
+				return (char*)((gptr == gend)\? gend : gptr + 1);\n\
+			}\n\
+\n\
+			// map file @pchFile privately, return NULL on failure\n\
+			static mmapbuf_t* create(const char *pchFile) {\n\
+\n\
+				by_te_t *pmap;\n\
+				size_t nsize;\n\
+#if !defined(_WIN32)\n\
+				struct stat st;\n\
+				int fd = open(pchFile, O_RDONLY);\n\
+				if(fd < 0) {\n\
+					return NULL;\n\
+				}\n\
+				if(fstat(fd, &st) != 0) {\n\
+					close(fd);\n\
+					return NULL;\n\
+				}\n\
+				nsize = (size_t)st.st_size;\n\
+				// reserve one more zero byte, then map the file over it,\n\
+				// pages are copied on write only, for NULL-terminating yytext\n\
+				void *p = mmap(NULL, nsize + 1, PROT_READ | PROT_WRITE,\n\
+						MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);\n\
+				if(MAP_FAILED == p) {\n\
+					close(fd);\n\
+					return NULL;\n\
+				}\n\
+				if(nsize > 0 && MAP_FAILED == mmap(p, nsize, PROT_READ | PROT_WRITE,\n\
+						MAP_PRIVATE | MAP_FIXED, fd, 0)) {\n\
+					munmap(p, nsize + 1);\n\
+					close(fd);\n\
+					return NULL;\n\
+				}\n\
+				close(fd);\n\
+				pmap = (by_te_t*)p;\n\
+#else\n\
+				FILE *pfile = fopen(pchFile, \"rb\");\n\
+				if( !pfile) {\n\
+					return NULL;\n\
+				}\n\
+				fseek(pfile, 0, SEEK_END);\n\
+				nsize = (size_t)ftell(pfile);\n\
+				fseek(pfile, 0, SEEK_SET);\n\
+				MYNEWS(pmap, by_te_t, nsize + 1);\n\
+				nsize = fread(pmap, 1, nsize, pfile);\n\
+				pmap[nsize] = \'\\0\';\n\
+				fclose(pfile);\n\
+#endif\n\
+				mmapbuf_t *pbuf;\n\
+				MYNEW(pbuf, mmapbuf_t(pmap, nsize));\n\
+				return pbuf;\n\
+			}\n\
+\n\
+		private:\n\
+			size_t nmap;\n\
+		};\n\
+]]><If PushMode><![[\n\
+	private:\n\
+\n\
+		// input given chunk by chunk, get() returns END_OF_CHUNK when it runs\n\
+		// out of input before the last chunk arrives\n\
+		class pushbuf_t: public bufbase_t {\n\
+\n\
+			friend class bufmgr_t;\n\
+		public:\n\
+\n\
+			pushbuf_t(void)\n\
+			: blast(false)\n\
+			, ncap(BUF_FULL_SIZE)\n\
+			, ndropped(0) {\n\
+\n\
+				MYNEWS(pbase, by_te_t, ncap);\n\
+				pbase[0] = \'\\0\';\n\
+				gend = pbase;\n\
+				xreset();\n\
+				imod = false;\n\
+				line = 1;\n\
+				col = 1;\n\
+				tab = 4;\n\
+				pvoid = NULL;\n\
+			}\n\
+\n\
+			virtual ~pushbuf_t(void) {\n\
+				delete [] pbase;\n\
+			}\n\
+\n\
+		public:\n\
+\n\
+			virtual void xreset(void) {\n\
+\n\
+				gptr = pbase - 1;\n\
+				glim = gend;\n\
+				eos = false;\n\
+			}\n\
+			virtual int xget(void) {\n\
+\n\
+				if(gptr == gend) {\n\
+					eos = true;\n\
+					return END_OF_ALLFILE;\n\
+				}\n\
+				if(gptr + 1 == gend && !blast) {\n\
+					return END_OF_CHUNK;\n\
+				}\n\
+				++gptr;\n\
+\n\
+				return (gptr == gend)\? END_OF_FILE : (int)(*gptr);\n\
+			}\n\
+\n\
+			virtual int peek(void) {\n\
+\n\
+				if(gptr + 1 == gend && !blast) {\n\
+					return END_OF_CHUNK;\n\
+				}\n\
+				return (gptr == gend) \? (eos \? END_OF_ALLFILE: END_OF_FILE) : \n\
+					(int)(*(gptr + 1));\n\
+			}\n\
+			virtual int unget(void) {\n\
+				if(eos || (pbase - 1 == gptr)) {\n\
+					return END_OF_FILE;\n\
+				}\n\
+				return (int)(*gptr--);\n\
+			}\n\
+			virtual int unget(int num) {\n\
+\n\
+				if(eos || (pbase - 1 == gptr)) {\n\
+					return 0;\n\
+				}\n\
+				int n = gptr - pbase + 1;\n\
+				if(n > num) {\n\
+					n = num;\n\
+				}\n\
+				gptr -= n;\n\
+\n\
+				return n;\n\
+			}\n\
+\n\
+			virtual int put(char c) {\n\
+\n\
+				if(eos || (pbase - 1 == gptr)) {\n\
+					return END_OF_FILE;\n\
+				}\n\
+\n\
+				int oldc = (int)(*gptr);\n\
+\n\
+				*gptr-- = (by_te_t)c;\n\
+\n\
+				return oldc;\n\
+			}\n\
+\n\
+			// input consumed is dropped except last @nKeep chars,\n\
+			// which may be given back\n\
+			virtual bool append(const char *pchBuf, int nSize, int nKeep, bool bLast) {\n\
+\n\
+				by_te_t *pkeep = gptr + 1 - nKeep;\n\
+				if(pkeep < pbase) {\n\
+					pkeep = pbase;\n\
+				}\n\
+				ndropped += pkeep - pbase;\n\
+				int nget = gptr - pkeep;\n\
+				int nlen = gend - pkeep;\n\
+\n\
+				if(nlen + nSize + 1 > ncap) {\n\
+					by_te_t *p;\n\
+					while(nlen + nSize + 1 > ncap) {\n\
+						ncap *= 2;\n\
+					}\n\
+					MYNEWS(p, by_te_t, ncap);\n\
+					memcpy(p, pkeep, nlen);\n\
+					delete [] pbase;\n\
+					pbase = p;\n\
+				}\n\
+				else if(pkeep > pbase) {\n\
+					memmove(pbase, pkeep, nlen);\n\
+				}\n\
+				gptr = pbase + nget;\n\
+				gend = pbase + nlen;\n\
+				if(nSize > 0) {\n\
+					memcpy(gend, pchBuf, nSize);\n\
+					gend += nSize;\n\
+				}\n\
+				*gend = \'\\0\';\n\
+				glim = gend;\n\
+				blast = bLast;\n\
+\n\
+				return true;\n\
+			}\n\
+\n\
+			virtual long tell(void) const {\n\
+				return ndropped + (long)(gptr + 1 - pbase);\n\
+			}\n\
+\n\
+		private:\n\
+			bool blast;\n\
+			int ncap;\n\
+			// chars dropped from head of buffer\n\
+			long ndropped;\n\
+		};\n\
+]]></If><![[\n\
+	private:\n\
 \n\
 		struct link_t {\n\
 \n\
@@ -830,13 +1321,17 @@ private:\n\
 	public:\n\
 \n\
 		bufmgr_t(void)\n\
-		: phead(NULL) {\n\
+		: phead(NULL)\n\
+		, ptop(NULL)\n\
+		, pretired(NULL)\n\
+		, bdefer(false) {\n\
 \n\
 			MYNEW(pstdin, filebuf_t);\n\
 			MYNEW(pavail, link_t(pstdin, NULL));\n\
 		}\n\
 		~bufmgr_t(void) {\n\
 \n\
+			purge();\n\
 			while(pavail) {\n\
 \n\
 				link_t *p = pavail->plink;\n\
@@ -851,7 +1346,7 @@ private:\n\
 	public:\n\
 \n\
 		inline int get(void) {\n\
-			return phead\? phead->pxbuf->get(): END_OF_ALLFILE;\n\
+			return ptop\? ptop->get(): END_OF_ALLFILE;\n\
 		}\n\
 		inline int peek(void) {\n\
 			return phead\? phead->pxbuf->peek(): END_OF_ALLFILE;\n\
@@ -872,7 +1367,7 @@ private:\n\
 			return phead\? phead->pxbuf->iseos(): true;\n\
 		}\n\
 		inline bool isimod(void) const {\n\
-			return phead\? phead->pxbuf->isimod(): false;\n\
+			return ptop\? ptop->isimod(): false;\n\
 		}\n\
 		inline int getlineno(void) const {\n\
 			 return phead\? phead->pxbuf->getlineno(): 0;\n\
@@ -902,7 +1397,16 @@ private:\n\
 			if(phead) {\n\
 				phead->pxbuf->reset();\n\
 			}\n\
-		}]]>\n\
+		}\n\
+		inline char* textptr(void) {\n\
+			return phead\? phead->pxbuf->textptr(): NULL;\n\
+		}\n\
+		inline long tell(void) const {\n\
+			return phead\? phead->pxbuf->tell(): 0;\n\
+		}]]><If PushMode><![[\n\
+		inline bool append(const char *pchBuf, int nSize, int nKeep, bool bLast) {\n\
+			return phead\? phead->pxbuf->append(pchBuf, nSize, nKeep, bLast): false;\n\
+		}]]></If>\n\
 	<If EnableLocation>\n\
 		<If EnableColumn><![[\n\
 		inline void pushlsz(int nlsize) {\n\
@@ -971,6 +1475,24 @@ private:\n\
 \n\
 			return p;\n\
 		}\n\
+		inline bufbase_t* newmmap(const char * pchFile) {\n\
+\n\
+			mmapbuf_t *p = mmapbuf_t::create(pchFile);\n\
+			if( !p) {\n\
+				return NULL;\n\
+			}\n\
+			MYNEW(pavail->plink, link_t(p, pavail->plink));\n\
+\n\
+			return p;\n\
+		}]]><If PushMode><![[\n\
+		inline bufbase_t* newpushbuf(void) {\n\
+\n\
+			pushbuf_t *p;\n\
+			MYNEW(p, pushbuf_t);\n\
+			MYNEW(pavail->plink, link_t(p, pavail->plink));\n\
+\n\
+			return p;\n\
+		}]]></If><![[\n\
 		\n\
 		inline bufbase_t* switchto(bufbase_t* pbuf) {\n\
 \n\
@@ -983,6 +1505,7 @@ private:\n\
 				p->plink = phead;\n\
 				phead = p;\n\
 			}\n\
+			ptop = phead\? phead->pxbuf : NULL;\n\
 			\n\
 			return pold;\n\
 		}\n\
@@ -996,6 +1519,7 @@ private:\n\
 			link_t *p = phead;\n\
 			bufbase_t* pbuf = p->pxbuf;\n\
 			phead = phead->plink;\n\
+			ptop = phead\? phead->pxbuf : NULL;\n\
 			\n\
 			delete p;\n\
 			\n\
@@ -1016,13 +1540,36 @@ private:\n\
 					link_t *q = p->plink;\n\
 					p->plink = q->plink;\n\
 \n\
-					delete pxb;\n\
-					delete q;\n\
+					if(bdefer) {\n\
+						q->plink = pretired;\n\
+						pretired = q;\n\
+					}\n\
+					else {\n\
+						delete pxb;\n\
+						delete q;\n\
+					}\n\
 				}\n\
 			}\n\
 		}\n\
+\n\
+		// buffers destroyed while deferring are kept until purged,\n\
+		// so text referred in place is still valid\n\
+		inline void defer(bool bd) {\n\
+			bdefer = bd;\n\
+		}\n\
+		void purge(void) {\n\
+\n\
+			while(pretired) {\n\
+				link_t *p = pretired;\n\
+				pretired = p->plink;\n\
+				delete p->pxbuf;\n\
+				delete p;\n\
+			}\n\
+		}\n\
 		\n\
 		void destroyall(void) {\n\
+\n\
+			purge();\n\
 \n\
 			while(pavail->plink) {\n\
 				link_t *p = pavail->plink;\n\
@@ -1034,6 +1581,7 @@ private:\n\
 			}\n\
 			\n\
 			phead = NULL;\n\
+			ptop = NULL;\n\
 		}\n\
 \n\
 	private:\n\
@@ -1067,60 +1615,68 @@ private:\n\
 \n\
 		// working buffer stack\n\
 		link_t *phead;\n\
+		// buffer on top of working stack, cached for get() and isimod(),\n\
+		// which are called for each char scanned\n\
+		bufbase_t *ptop;\n\
 		// available buffer stack\n\
 		link_t *pavail;\n\
+		// buffers destroyed but not deleted yet\n\
+		link_t *pretired;\n\
+		bool bdefer;\n\
 		// stdin buffer\n\
 		bufbase_t *pstdin;\n\
 	};\n\
 \n\
 ]]></If><![[\n\
+    // stack on contiguous storage, which is reserved once and reused,\n\
+    // popped elements are left to be overwritten by following pushes\n\
     template<class ElemType, int INIT_SIZE = 4096>\n\
     class sstack_t {\n\
     public:\n\
-        inline sstack_t(void) {\n\
-\n\
+        inline sstack_t(void)\n\
+        : mTop(0) {\n\
+            mStk.resize(INIT_SIZE);\n\
         }\n\
 \n\
-        inline void push(void) {\n\
-            mStk.push_back(ElemType());\n\
+        inline ElemType& push(void) {\n\
+            if(mTop == (int)mStk.size()) {\n\
+                mStk.resize(mStk.size() * 2 + 1);\n\
+            }\n\
+            return mStk[mTop++];\n\
         }\n\
         inline void push(const ElemType &e) {\n\
-            mStk.push_back(e);\n\
+            push() = e;\n\
         }\n\
         inline ElemType& top(void) {\n\
-            return mStk.back();\n\
+            return mStk[mTop - 1];\n\
         }\n\
         inline const ElemType& top(void) const {\n\
-            return mStk.back();\n\
+            return mStk[mTop - 1];\n\
         }\n\
         inline void pop(int n) {\n\
-            while(n > 0 && !mStk.empty()) {\n\
-                mStk.pop_back();\n\
-                n--;\n\
-            }\n\
+            mTop = (n < mTop)\? mTop - n : 0;\n\
         }\n\
         inline ElemType& operator[](int down) {\n\
-            const auto sz = (int) mStk.size();\n\
-            return mStk[sz - 1 - down];\n\
+            return mStk[mTop - 1 - down];\n\
         }\n\
         inline const ElemType& operator[](int down) const {\n\
-            const auto sz = (int) mStk.size();\n\
-            return mStk[sz - 1 - down];\n\
+            return mStk[mTop - 1 - down];\n\
         }\n\
 \n\
         inline bool empty(void) const {\n\
-            return mStk.empty();\n\
+            return mTop == 0;\n\
         }\n\
 \n\
         inline int count(void) const {\n\
-            return (int)mStk.size();\n\
+            return mTop;\n\
         }\n\
 \n\
         inline void clear(void) {\n\
-            mStk.clear();\n\
+            mTop = 0;\n\
         }\n\
     private:\n\
         std::vector<ElemType> mStk;\n\
+        int mTop;\n\
     };\n\
 ]]><If EnableScanner><![[\n\
 \n\
@@ -1128,15 +1684,93 @@ private:\n\
 \n\
 	inline void renew_text__(void) {\n\
 \n\
-		MYRENEW(yytext, char, INC_YYTEXT_SIZE + yysize__, yysize__);\n\
+		bool bown = (yytext == yytbuf__);\n\
+		MYRENEW(yytbuf__, char, INC_YYTEXT_SIZE + yysize__, yysize__);\n\
 		yysize__ += INC_YYTEXT_SIZE;\n\
-		yytext[yysize__ - 1] = \'\\0\';\n\
+		yytbuf__[yysize__ - 1] = \'\\0\';\n\
+		if(bown) {\n\
+			yytext = yytbuf__;\n\
+		}\n\
+	}\n\
+\n\
+	// put back the char overwritten by terminating NULL of in-place yytext\n\
+	inline void yyunhold__(void) {\n\
+		if(yyhold_ptr__) {\n\
+			*yyhold_ptr__ = yyhold_char__;\n\
+			yyhold_ptr__ = NULL;\n\
+		}\n\
+	}\n\
+\n\
+	// terminate yytext at @n, the char there is held if yytext is in place\n\
+	inline void yyend_text__(int n) {\n\
+		if(yytext != yytbuf__) {\n\
+			yyunhold__();\n\
+			yyhold_ptr__ = yytext + n;\n\
+			yyhold_char__ = *yyhold_ptr__;\n\
+		}\n\
+		yytext[n] = \'\\0\';\n\
+	}\n\
+\n\
+	// set up yytext for next token: refer to the input in place if current\n\
+	// buffer allows it, otherwise copy matched chars into own text buffer\n\
+	inline void yynew_text__(bool bmore) {\n\
+		yyunhold__();\n\
+		char *p = yybufmgr__.textptr();\n\
+		if(!bmore) {\n\
+			if(p) {\n\
+				yytext = p;\n\
+			}\n\
+			else {\n\
+				yytext = yytbuf__;\n\
+				yytext[0] = \'\\0\';\n\
+			}\n\
+		}\n\
+		else if(yytext != yytbuf__ && yytext + yylaleng != p) {\n\
+			// text to be appended is not adjacent any more\n\
+			yyown_text__();\n\
+		}\n\
+	}\n\
+\n\
+	// copy in-place yytext into own text buffer\n\
+	inline void yyown_text__(void) {\n\
+		if(yytext != yytbuf__) {\n\
+			yyunhold__();\n\
+			while(yylaleng >= yysize__ - 1) {\n\
+				renew_text__();\n\
+			}\n\
+			memcpy(yytbuf__, yytext, yylaleng);\n\
+			yytext = yytbuf__;\n\
+			yytext[yylaleng] = \'\\0\';\n\
+		}\n\
+	}\n\
+\n\
+	inline void yyreset_text__(void) {\n\
+		yyunhold__();\n\
+		yytext = yytbuf__;\n\
+		if(yytext) {\n\
+			yytext[0] = \'\\0\';\n\
+		}\n\
 	}\n\
 \n\
 	inline bool yylex_is_running__(void) const {\n\
 		return yyecode__ == YYE_ALIVE;\n\
 	}\n\
+]]><If Has\?\"LexDFAFull\"><If LexFullPremul><![[	// states are offsets of their rows in full transition table\n\
 	inline int yyget_lexrule__(int s) const{\n\
+		return yydfull[s + LEX_FULL_ACCEPT] + LEX_ERROR_RULE;\n\
+	}\n\
+\n\
+	inline int yynext_lexstate__(int s, int c) const {\n\
+		return yydfull[s + yydcmap[c]];\n\
+	}\n\
+]]></If><Else><![[	inline int yyget_lexrule__(int s) const{\n\
+		return yydfull[s * LEX_FULL_STRIDE + LEX_FULL_ACCEPT] + LEX_ERROR_RULE;\n\
+	}\n\
+\n\
+	inline int yynext_lexstate__(int s, int c) const {\n\
+		return yydfull[s * LEX_FULL_STRIDE + yydcmap[c]];\n\
+	}\n\
+]]></Else></If><Else><![[	inline int yyget_lexrule__(int s) const{\n\
 		return yydaccpt[s];\n\
 	}\n\
 \n\
@@ -1155,9 +1789,20 @@ private:\n\
 			return yydnxt[ yydbase[s] + d];\n\
 		}\n\
 	}\n\
-]]></If><![[\n\
+]]></Else><![[]]></If><![[\n\
 	friend void yyemit_error__(const char *s]]><If Has\?\"FormalParams\"><![[, ]]><Action \"FormalParams\"/></If><![[);\n\
-]]><If EnableParser><![[\n\
+]]><If Reentrant><![[\n\
+	// report error by the error-reporter, to logger of this object by default\n\
+	void yyerror(const char *s]]><If Has\?\"FormalParams\"><![[, ]]><Action \"FormalParams\"/></If><![[) {\n\
+		if(yyerror__ == yyemit_error__) {\n\
+			if(yylogger)\n\
+				fprintf(yylogger, \"%s\\n\", s);\n\
+		}\n\
+		else if(yyerror__) {\n\
+			yyerror__(s]]><If Has\?\"ActualParams\"><![[, ]]><Action \"ActualParams\"/></If><![[);\n\
+		}\n\
+	}\n\
+]]></If><![[]]><If EnableParser><![[\n\
 private:\n\
 	// update 16/12/17\n\
     int YYSTOKEN(const std::string& lexeme) const {\n\
@@ -1186,10 +1831,13 @@ private:\n\
 		return yyecode__ > YYE_ACCEPT && s != PARSE_ACCEPT_STATE;\n\
 	}\n\
 	inline int yyget_defrule(int s) const {\n\
-		if(0 == yyparn[s] && is_valid_prule__(yyget_prule__(yyparv[s])) ) {\n\
+]]><If ParseRowMerge><![[		if(PARSE_DEFONLY_BASE == yypabase[s] && is_valid_prule__(yyget_prule__(yypdefact[s])) ) {\n\
+			return yyget_prule__(yypdefact[s]);\n\
+		}\n\
+]]></If><Else><![[		if(0 == yyparn[s] && is_valid_prule__(yyget_prule__(yyparv[s])) ) {\n\
 			return yyget_prule__(yyparv[s]);\n\
 		}\n\
-		return PERROR_RULE;\n\
+]]></Else><![[		return PERROR_RULE;\n\
 	}\n\
 	inline bool is_valid_pstate__(int s) const {\n\
 		return s < PARSE_ERROR_STATE;\n\
@@ -1208,7 +1856,15 @@ private:\n\
 		default:\n\
 			break;\n\
 		}]]></If><![[\n\
+	}]]><If ParseRowMerge><![[\n\
+	inline int yynext_pstate__(int s, int t) const {\n\
+		const int i = yypabase[s] + t;\n\
+		return (yypachk[i] == t)\? yypact[i] : yypdefact[s];\n\
 	}\n\
+	inline int yynext_goto__(int s, int t) const {\n\
+		const int i = yypgbase[t] + s;\n\
+		return (yypgchk[i] == s)\? yypgoto[i] : yypdefgoto[t];\n\
+	}]]></If><Else><![[\n\
 	inline int yynext_pstate__(int s, int t) const {\n\
 		if(yyvbmap[s * PARSE_BMAP_ROWSIZE + t / 8] & (1 << (t % 8))) {\n\
 			if(yyparn[s] < yypcn[t]) {\n\
@@ -1229,7 +1885,7 @@ private:\n\
 			return yypcv[PARSE_TYPE_BASE + t];\n\
 		}\n\
 		return yypgoto[yypgbase[s] + t];\n\
-	}\n\
+	}]]></Else><![[\n\
 ]]></If><![[\n\
 public:\n\
 \n\
@@ -1244,22 +1900,28 @@ public:\n\
 	, yyat_bol__(true)\n\
 	, yytext(NULL)\n\
 	, yyleng(0)\n\
-	, yylaleng(0)]]>\n\
+	, yylaleng(0)\n\
+	, yytbuf__(NULL)\n\
+	, yyhold_ptr__(NULL)\n\
+	, yyhold_char__(\'\\0\')\n\
+	, yyrule__(LEX_ERROR_RULE)]]><If PushMode><![[\n\
+	, yysuspended__(false)]]></If>\n\
 </If>\n\
 <If EnableParser><![[\n\
 	, yyerr_flag__(false)\n\
 	, yyltok(PARSE_UNDEFSYMB_ID)\n\
-	, yylexer(plex)]]>\n\
+	, yylexer(plex)]]><If PushMode><![[\n\
+	, yypushing__(false)]]></If>\n\
 </If><![[\n\
 	, yyoutput(stdout)\n\
 	, yylogger(stderr)\n\
-	, yyerror(yyemit_error__) {\n\
+	, ]]><$ErrorReporter/><![[(yyemit_error__) {\n\
 \n\
 	}\n\
     ~yyparser_t(void) {\n\
 ]]><If EnableScanner><![[\n\
-		if(yytext) {\n\
-			delete[] yytext;\n\
+		if(yytbuf__) {\n\
+			delete[] yytbuf__;\n\
 		}\n\
 ]]></If><![[\n\
 	}\n\
@@ -1273,13 +1935,43 @@ public:\n\
 		\n\
 		yy_switch_buffer(pbuf);\n\
 \n\
-		if(!yytext) {\n\
+		if(!yytbuf__) {\n\
+			renew_text__();\n\
+		}\n\
+		return yy_has_buffer();\n\
+	}\n\
+\n\
+	inline bool yylexinit__(const char *pchFile) {\n\
+\n\
+		YYPBUFFER pbuf = yy_new_mmapbuf(pchFile);\n\
+		if( !pbuf ) {\n\
+			return false;\n\
+		}\n\
+		\n\
+		yy_switch_buffer(pbuf);\n\
+\n\
+		if(!yytbuf__) {\n\
 			renew_text__();\n\
 		}\n\
 		return yy_has_buffer();\n\
 	}\n\
 \n\
-	inline bool yylexinit__(const char *strbuffer, int size) {\n\
+	]]><If PushMode><![[// append input chunk to buffer of chunks, which is created at first\n\
+	inline bool yylexchunk__(const char *pchunk, int size, bool blast) {\n\
+\n\
+		if( ! yybufmgr__.append(pchunk, size, yylaleng, blast)) {\n\
+			YYPBUFFER pbuf = yybufmgr__.newpushbuf();\n\
+			yy_switch_buffer(pbuf);\n\
+			yybufmgr__.append(pchunk, size, 0, blast);\n\
+		}\n\
+\n\
+		if(!yytbuf__) {\n\
+			renew_text__();\n\
+		}\n\
+		return yy_has_buffer();\n\
+	}\n\
+\n\
+	]]></If><![[inline bool yylexinit__(const char *strbuffer, int size) {\n\
 \n\
 		YYPBUFFER pbuf = yy_new_cstrbuf(strbuffer, size);\n\
 \n\
@@ -1289,7 +1981,7 @@ public:\n\
 \n\
 		yy_switch_buffer(pbuf);\n\
 \n\
-		if(!yytext) {\n\
+		if(!yytbuf__) {\n\
 			renew_text__();\n\
 		}\n\
 		return yy_has_buffer();\n\
@@ -1305,7 +1997,7 @@ public:\n\
 \n\
 		yy_switch_buffer(pbuf);\n\
 \n\
-		if(!yytext) {\n\
+		if(!yytbuf__) {\n\
 			renew_text__();\n\
 		}\n\
 		return yy_has_buffer();\n\
@@ -1322,14 +2014,24 @@ public:\n\
 		bool yylast_at_bol__ = yyat_bol__;\n\
 		bool bwrap__ = false;\n\
 		]]>\n\
-	<$SingleAction \"LexVarDecl\"/><![[\n\
+	<$SingleAction \"LexVarDecl\"/><If PushMode><![[\n\
+		if(yysuspended__) {\n\
+			// go on with the token interrupted by end of last input chunk\n\
+			yysuspended__ = false;\n\
+			yylstate__ = yysus_state__;\n\
+			yylrule__ = yysus_rule__;\n\
+			yyaccleng__ = yysus_accleng__;\n\
+			yylast_at_bol__ = yysus_bol__;\n\
+			yyecode__ = YYE_ALIVE;\n\
+		}\n\
+		else {]]></If><![[\n\
 		yymore_flag__ = false;\n\
 		yyecode__ = YYE_ALIVE;\n\
 		]]>\n\
 	<$SingleAction \"LexVarInit\"/><![[\n\
 		yyleng = 0;\n\
 		yylaleng = 0;\n\
-		yytext[0] = \'\\0\';\n\
+		yynew_text__(false);\n\
 \n\
 		]]>\n\
 	<$CodeBlock \"LexInitAction\"/><![[\n\
@@ -1340,19 +2042,38 @@ public:\n\
 		else {\n\
 			yylstate__ = yydsc[yystart__ + 1];\n\
 		}\n\
-\n\
+]]><If PushMode><![[		}\n\
+]]></If><![[\n\
 		while(yylex_is_running__()) {\n\
 \n\
-			yycchar__ = yybufmgr__.get();\n\
+			yycchar__ = yybufmgr__.get();]]><If PushMode><![[\n\
+			if(END_OF_CHUNK == yycchar__) {\n\
+				// keep state of DFA, and wait for next input chunk\n\
+				yysuspended__ = true;\n\
+				yysus_state__ = yylstate__;\n\
+				yysus_rule__ = yylrule__;\n\
+				yysus_accleng__ = yyaccleng__;\n\
+				yysus_bol__ = yylast_at_bol__;\n\
+				return YYPUSH_MORE;\n\
+			}]]></If><If LexDirectCode><![[\n\
+			// each state takes the current char, then fetches the next one\n\
+			// and jumps to the next state, until no transition is available\n\
+			switch(yylstate__) {]]><$LexDirectStates \"LexDirectStates\"/><![[\n\
+			default:\n\
+				yylstate__ = LEX_ERROR_STATE;\n\
+				break;\n\
+			}\n\
+]]></If><Else><![[\n\
 			yylstate__ = yynext_lexstate__(yylstate__, yycchar__);\n\
 \n\
 			if(LEX_ERROR_STATE != yylstate__) {\n\
 \n\
-				if(yylaleng >= yysize__ - 1) {\n\
-					renew_text__();\n\
+				if(yytext == yytbuf__) {\n\
+					if(yylaleng >= yysize__ - 1) {\n\
+						renew_text__();\n\
+					}\n\
+					yytext[yylaleng] = (char)yycchar__;\n\
 				}\n\
-				yytext[yylaleng] = (char)yycchar__;\n\
-\n\
 				++yylaleng;\n\
 \n\
 				if(yyget_lexrule__(yylstate__) != LEX_ERROR_RULE) {\n\
@@ -1361,7 +2082,7 @@ public:\n\
 					yyaccleng__ = yylaleng;\n\
 				}\n\
 			}\n\
-\n\
+]]></Else><![[\n\
 			if(LEX_ERROR_STATE == yylstate__ || (yybufmgr__.isimod() \n\
 					&& (\'\\n\' == yycchar__ || END_OF_FILE == yycchar__))) {\n\
 				if(LEX_ERROR_RULE == yylrule__) {\n\
@@ -1379,11 +2100,13 @@ public:\n\
 						yybufmgr__.unget(yylaleng + 1 - yyaccleng__);\n\
 					}\n\
 					yylaleng = yyaccleng__;\n\
-					yytext[yylaleng] = \'\\0\';\n\
+					yyend_text__(yylaleng);\n\
 				]]>\n\
 	<If Has\?\"LexDFALookaheads\"><![[\n\
 					yyleng = yylaleng - yylad[yylrule__];\n\
 					if(yylaleng > yyleng) {\n\
+						// trailing context will be read again, keep it intact\n\
+						yyown_text__();\n\
 						yybufmgr__.unget(yylaleng - yyleng);\n\
 					}]]>\n\
 	</If>\n\
@@ -1426,22 +2149,36 @@ public:\n\
 				int nline = yyget_lineno();\n\
 				int ncol = yyget_colno() - 1;\n\
 				int nt = yyget_tabsize();\n\
-				int ts, yyt1__;\n\
-				for(yyt1__ = 0; yyt1__ < yyleng; ++yyt1__) {\n\
-					if(yytext[yyt1__] == \'\\t\') {\n\
-\n\
-						ts = nt - ncol % nt;\n\
-						yybufmgr__.pushtsz(ts);\n\
-						ncol += ts;\n\
-					}\n\
-					else if(yytext[yyt1__] == \'\\n\') {\n\
-						yybufmgr__.pushlsz(ncol + 1);\n\
-						ncol = 0;\n\
-						++nline;\n\
+				int ts;\n\
+				// find newlines by memchr, only lines with tabs are walked\n\
+				const char *yyt1__ = yytext, *yyt2__, *yyt3__;\n\
+				const char *yyt4__ = yytext + yyleng;\n\
+				while(yyt1__ < yyt4__) {\n\
+					yyt2__ = (const char*)memchr(yyt1__, \'\\n\', yyt4__ - yyt1__);\n\
+					yyt3__ = yyt2__\? yyt2__: yyt4__;\n\
+					if(memchr(yyt1__, \'\\t\', yyt3__ - yyt1__)) {\n\
+						for(; yyt1__ < yyt3__; ++yyt1__) {\n\
+							if(*yyt1__ == \'\\t\') {\n\
+\n\
+								ts = nt - ncol % nt;\n\
+								yybufmgr__.pushtsz(ts);\n\
+								ncol += ts;\n\
+							}\n\
+							else {\n\
+								++ncol;\n\
+							}\n\
+						}\n\
 					}\n\
 					else {\n\
-						++ncol;\n\
+						ncol += (int)(yyt3__ - yyt1__);\n\
+					}\n\
+					if( !yyt2__) {\n\
+						break;\n\
 					}\n\
+					yybufmgr__.pushlsz(ncol + 1);\n\
+					ncol = 0;\n\
+					++nline;\n\
+					yyt1__ = yyt2__ + 1;\n\
 				}]]><If EnableParser><![[\n\
                 yylloc.firstLine = yyget_lineno();\n\
                 yylloc.firstColumn = yyget_colno();\n\
@@ -1453,11 +2190,11 @@ public:\n\
 		</If>\n\
 		<Else><![[{\n\
 				int nline = yyget_lineno();\n\
-				int yyt1__;\n\
-				for(yyt1__ = 0; yyt1__ < yyleng; ++yyt1__) {\n\
-					if(yytext[yyt1__] == \'\\n\') {\n\
-						++nline;\n\
-					}\n\
+				const char *yyt1__ = yytext;\n\
+				const char *yyt2__ = yytext + yyleng;\n\
+				while((yyt1__ = (const char*)memchr(yyt1__, \'\\n\', yyt2__ - yyt1__)) != NULL) {\n\
+					++yyt1__;\n\
+					++nline;\n\
 				}]]><If EnableParser><![[\n\
                 yylloc.firstLine = yyget_lineno();\n\
                 yylloc.firstColumn = 0;\n\
@@ -1470,6 +2207,7 @@ public:\n\
 	</If><![[\n\
 				}\n\
 \n\
+		yyrule__ = yylrule__;\n\
 		bwrap__ = (yylrule__ >= LEX_EOFRULE_BASE\n\
 			&& yylrule__ < LEX_EOAF_RULE\n\
 			&& yywrap__(]]><If Has\?\"ActualParams\"><Action \"ActualParams\"/></If><![[));\n\
@@ -1489,10 +2227,12 @@ public:\n\
 			]]><If EnableDefaultAction><![[\n\
 				/* do nothing */]]></If>\n\
 			<Else><![[\n\
-					YYMSG_UNMATCHED[28] = yycchar__;\n\
+					]]><If Reentrant><![[char yycc[MAX_MSG_LENG];\n\
+					strcpy(yycc, YYMSG_UNMATCHED);\n\
+					yycc[28] = yycchar__;]]></If><Else><![[YYMSG_UNMATCHED[28] = yycchar__;]]></Else><![[\n\
 					yyecode__ = YYE_UNMATCHED;\n\
-					if(yyerror)\n\
-						yyerror(YYMSG_UNMATCHED]]><If Has\?\"ActualParams\"><![[, ]]><Action \"ActualParams\"/></If><![[);\n\
+					if(]]><$ErrorReporter/><![[)\n\
+						yyerror(]]><If Reentrant><![[yycc]]></If><Else><![[YYMSG_UNMATCHED]]></Else><If Has\?\"ActualParams\"><![[, ]]><Action \"ActualParams\"/></If><![[);\n\
 				]]></Else><![[\n\
 				break;\n\
 				}\n\
@@ -1514,10 +2254,11 @@ public:\n\
 						yyaccleng__ = 0;\n\
 						yylaleng = 0;\n\
 						yyleng = 0;\n\
-						yytext[yylaleng] = \'\\0\';\n\
+						yynew_text__(false);\n\
 					}\n\
 					else {\n\
 						yymore_flag__ = false;\n\
+						yynew_text__(true);\n\
 					}\n\
 				}\n\
 			}\n\
@@ -1525,22 +2266,77 @@ public:\n\
 \n\
 		return (yyecode__ == YYE_EOS)\? 0 : yyecode__;\n\
 	}\n\
+\n\
+	// scan tokens into @out until @max of them are recorded, or scanner\n\
+	// returns no token; text of token is referred in place if possible\n\
+	int yylex_batch__(yytoken_t *out, int max]]><If Has\?\"FormalParams\"><![[, ]]><Action \"FormalParams\"/></If><![[) {\n\
+\n\
+		int n = 0;\n\
+		int tok = 0;\n\
+\n\
+		// buffers of last call are not referred any more\n\
+		yybufmgr__.purge();\n\
+		yybufmgr__.defer(true);\n\
+		while(n < max) {\n\
+\n\
+			tok = yylex__(]]><If Has\?\"ActualParams\"><Action \"ActualParams\"/></If><![[);\n\
+			if(tok <= 0) {\n\
+				break;\n\
+			}\n\
+\n\
+			yytoken_t &t = out[n++];\n\
+			t.id = tok;\n\
+			t.rule = yyrule__;\n\
+			t.offset = yybufmgr__.tell() - yyleng;\n\
+			t.length = yyleng;\n\
+			t.text = (yytext == yytbuf__)\? NULL : yytext;\n\
+		}\n\
+		yybufmgr__.defer(false);\n\
+\n\
+		return (n > 0 || tok >= 0)\? n : tok;\n\
+	}\n\
 ]]></If><If EnableParser><![[\n\
 	int yyparse__(]]><If Has\?\"FormalParams\"><Action \"FormalParams\"/></If><![[) {\n\
 \n\
 		if( ! yylexer) {\n\
 			return YYE_ABORT;\n\
 		}\n\
+]]><If PushMode><![[\n\
+		int yyr__ = YYPUSH_MORE;\n\
+		while(YYPUSH_MORE == yyr__) {\n\
+			int yyptok__ = (yylexer)(]]><If Reentrant><![[this]]><If Has\?\"ActualParams\"><![[, ]]></If></If><If Has\?\"ActualParams\"><Action \"ActualParams\"/></If><![[);\n\
+			if(YYPUSH_MORE == yyptok__) {\n\
+				break;\n\
+			}\n\
+			yyr__ = yypush__(yyptok__]]><If Has\?\"ActualParams\"><![[, ]]><Action \"ActualParams\"/></If><![[);\n\
+		}\n\
+		return yyr__;\n\
+	}\n\
 \n\
+	// go on parsing with one more token, states of parser are kept in\n\
+	// members, and YYPUSH_MORE is returned when next token is required\n\
+	int yypush__(int yyptok]]><If Has\?\"FormalParams\"><![[, ]]><Action \"FormalParams\"/></If><![[) {\n\
+\n\
+		bool yyhas_tok__ = true;\n\
+		if( ! yypushing__) {\n\
+			yypushing__ = true;\n\
+			yyecode__ = YYE_ALIVE;\n\
+			yypstate__ = PARSE_START_STATE;\n\
+			yyprule__ = PERROR_RULE;\n\
+			yysidx__ = PARSE_UNDEFSYMB_INDEX;\n\
+			yytok__ = PARSE_UNDEFSYMB_ID;\n\
+\n\
+			yyltok = PARSE_UNDEFSYMB_ID;\n\
+			yyerr_flag__ = false;\n\
+]]><$SingleAction \"ParseVarInit\"/><![[\n\
+]]><$CodeBlock \"ParseInitAction\"/><![[\n\
+			yystk__.clear();\n\
+			yystk__.push().stt = yypstate__;\n\
+		}\n\
+]]></If><Else><![[\n\
 		yyecode__ = YYE_ALIVE;\n\
-		sstack_t<xstype_t> yys_sv__;\n\
 		xstype_t yyval;\n\
-]]><If EnableLocation><![[\n\
-		sstack_t<xltype_t> yys_loc__;\n\
-]]></If><![[\n\
 		xltype_t yyloc;\n\
-		sstack_t<int> yys_stt__;\n\
-		sstack_t<int> yys_symb__;\n\
 \n\
 		int yyrplen__;\n\
 		bool yyreducing__;\n\
@@ -1555,9 +2351,10 @@ public:\n\
 		yyerr_flag__ = false;\n\
 ]]><$SingleAction \"ParseVarInit\"/><![[\n\
 ]]><$CodeBlock \"ParseInitAction\"/><![[\n\
-		yys_stt__.push(yypstate__);\n\
-\n\
-		while( ! yys_stt__.empty() && yyparse_is_running__(yypstate__)) {\n\
+		yystk__.clear();\n\
+		yystk__.push().stt = yypstate__;\n\
+]]></Else><![[\n\
+		while( ! yystk__.empty() && yyparse_is_running__(yypstate__)) {\n\
 			yyprule__ = yyget_defrule(yypstate__);\n\
 			if(is_valid_prule__(yyprule__)) {\n\
 				yyreducing__ = true;\n\
@@ -1565,8 +2362,13 @@ public:\n\
 			else {\n\
 				if(PARSE_UNDEFSYMB_ID == yytok__) {\n\
 					if(PARSE_UNDEFSYMB_ID == yyltok) {\n\
-						yytok__ = (yylexer)(]]><If Has\?\"ActualParams\"><Action \"ActualParams\"/></If><![[);\n\
-					}\n\
+]]><If PushMode><![[						if( ! yyhas_tok__) {\n\
+							return YYPUSH_MORE;\n\
+						}\n\
+						yytok__ = yyptok;\n\
+						yyhas_tok__ = false;\n\
+]]></If><Else><![[						yytok__ = (yylexer)(]]><If Reentrant><![[this]]><If Has\?\"ActualParams\"><![[, ]]></If></If><If Has\?\"ActualParams\"><Action \"ActualParams\"/></If><![[);\n\
+]]></Else><![[					}\n\
 					else  {\n\
 						yytok__ = yyltok;\n\
 						yyltok = PARSE_UNDEFSYMB_ID;\n\
@@ -1579,7 +2381,7 @@ public:\n\
 if(yylogger)\n\
 	fprintf(yylogger, \"Next symbol is %s\\n\", sym_text__(yypsnam[yysidx__]));\n\
 ]]></If><![[\n\
-				yypstate__ = yynext_pstate__(yys_stt__.top(), yysidx__);\n\
+				yypstate__ = yynext_pstate__(yystk__.top().stt, yysidx__);\n\
 \n\
 				if(is_valid_pstate__(yypstate__)) {\n\
 \n\
@@ -1587,11 +2389,12 @@ if(yylogger)\n\
 if(yylogger)\n\
 	fprintf(yylogger, \"Shift %s, go to state %d\\n\", sym_text__(yypsnam[yysidx__]), yypstate__);\n\
 ]]></If><![[\n\
-					yys_symb__.push(yysidx__);\n\
-					yys_stt__.push(yypstate__);\n\
-                    yys_sv__.push(yylval);\n\
+					yyframe_t &yyf__ = yystk__.push();\n\
+					yyf__.stt = yypstate__;\n\
+					yyf__.symb = yysidx__;\n\
+					yyf__.sv = yylval;\n\
 ]]><If EnableLocation><![[\n\
-                    yys_loc__.push(yylloc);\n\
+					yyf__.loc = yylloc;\n\
 ]]></If><![[ \n\
 					yytok__ = PARSE_UNDEFSYMB_ID;\n\
 					yyreducing__ = false;\n\
@@ -1610,7 +2413,7 @@ if(yylogger)\n\
 \n\
 					if( ! yyerr_flag__ || PARSE_ENDSYMB_ID == yytok__) {\n\
 						if(! yyerr_flag__) {\n\
-							if(yyerror) {\n\
+							if(]]><$ErrorReporter/><![[) {\n\
 ]]><If EnableLocation><![[\n\
 char yycc[MAX_MSG_LENG];\n\
 sprintf(yycc, \"Error: syntax error at %d:%d.\", yylloc.firstLine, yylloc.firstColumn);\n\
@@ -1639,37 +2442,34 @@ if(yylogger)\n\
 					yytok__ = PARSE_ERRORSYMB_ID;\n\
 					yysidx__ = PARSE_ERRORSYMB_INDEX;\n\
 \n\
-					while(! yys_sv__.empty())  {\n\
-						yypstate__ = yynext_pstate__(yys_stt__.top(), yysidx__);\n\
+					while(yystk__.count() > 1)  {\n\
+						yypstate__ = yynext_pstate__(yystk__.top().stt, yysidx__);\n\
 						if(is_valid_pstate__(yypstate__)) {\n\
 							break;\n\
 						}\n\
 			]]><If ParseDebugMode><![[\n\
 if(yylogger) {\n\
 	fprintf(yylogger, \"Error recovery : Pop up %s from stack\\n\",\n\
-	sym_text__(yypsnam[yys_symb__.top()]));\n\
+	sym_text__(yypsnam[yystk__.top().symb]));\n\
 	fprintf(yylogger, \"Now state stack: \");			\n\
-	for(int yyt1__ = yyerr_flag__\? 1 : 0; yyt1__ < yys_stt__.count(); ++yyt1__) {\n\
-		fprintf(yylogger, \"%5d\", yys_stt__[yyt1__]);\n\
+	for(int yyt1__ = yyerr_flag__\? 1 : 0; yyt1__ < yystk__.count(); ++yyt1__) {\n\
+		fprintf(yylogger, \"%5d\", yystk__[yyt1__].stt);\n\
 	}\n\
 	fprintf(yylogger, \"\\n\");\n\
 	}]]></If><![[\n\
 ]]><If EnableLocation><![[\n\
-						yydiscard__(yys_sv__.top(), yys_loc__.top(), yys_symb__.top()]]>\n\
+						yydiscard__(yystk__.top().sv, yystk__.top().loc, yystk__.top().symb]]>\n\
 							<If Has\?\"ActualParams\"><![[, ]]><Action \"ActualParams\"/></If><![[);\n\
-						yys_loc__.pop(1);\n\
 ]]></If><Else><![[\n\
-                        yydiscard__(yys_sv__.top(), yylloc, yys_symb__.top()]]>\n\
+                        yydiscard__(yystk__.top().sv, yylloc, yystk__.top().symb]]>\n\
 							<If Has\?\"ActualParams\"><![[, ]]><Action \"ActualParams\"/></If><![[);\n\
 ]]></Else><![[\n\
 \n\
-						yys_symb__.pop(1);\n\
-						yys_sv__.pop(1);\n\
-						yys_stt__.pop(1);\n\
+						yystk__.pop(1);\n\
 					}\n\
 \n\
-					if( yys_sv__.empty()) {\n\
-						yys_stt__.pop(1);\n\
+					if(yystk__.count() == 1) {\n\
+						yystk__.pop(1);\n\
 					}\n\
 \n\
 					break;\n\
@@ -1677,12 +2477,12 @@ if(yylogger) {\n\
 \n\
 				if(is_valid_prule__(yyprule__) || YYE_ACCEPT == yyecode__) {\n\
 					yyrplen__ = yyprnum[yyprule__];\n\
-					yypstate__ = yynext_goto__(yys_stt__[yyrplen__], yyplid[yyprule__]);\n\
+					yypstate__ = yynext_goto__(yystk__[yyrplen__].stt, yyplid[yyprule__]);\n\
 ]]><If ParseDebugMode><![[\n\
 if(yylogger){\n\
 	fprintf(yylogger, \"Reduce action: \");\n\
 	for(int yyt2__ = yyrplen__ - 1; yyt2__ >= 0; --yyt2__) {\n\
-	int yyt1__ = yys_symb__[yyt2__];\n\
+	int yyt1__ = yystk__[yyt2__].symb;\n\
 		fprintf(yylogger, \"%s \", sym_text__(yypsnam[yyt1__]));\n\
 	}\n\
 	fprintf(yylogger, \"=> %s, go to state %d by rule at %d.\\n\",\n\
@@ -1690,48 +2490,49 @@ if(yylogger){\n\
 }]]></If><![[\n\
 \n\
 					if(YYE_ACCEPT != yyecode__) {\n\
-						yys_stt__.pop(yyrplen__);\n\
-						yys_symb__.pop(yyrplen__);\n\
-						yys_sv__.pop(yyrplen__);\n\
 ]]><If EnableLocation><![[\n\
-						if(!yys_loc__.empty()) {\n\
+						if(yystk__.count() > 1) {\n\
 							if(yyrplen__ == 0) {\n\
-								yyloc.firstLine = yyloc.lastLine = yys_loc__[0].lastLine;\n\
-								yyloc.firstColumn = yyloc.lastColumn = yys_loc__[0].lastColumn;\n\
+								yyloc.firstLine = yyloc.lastLine = yystk__[0].loc.lastLine;\n\
+								yyloc.firstColumn = yyloc.lastColumn = yystk__[0].loc.lastColumn;\n\
 							}\n\
 							else {\n\
-								yyloc.firstLine = yys_loc__[yyrplen__ - 1].firstLine;\n\
-								yyloc.lastLine = yys_loc__[0].lastLine;\n\
-								yyloc.firstColumn = yys_loc__[yyrplen__ - 1].firstColumn;\n\
-								yyloc.lastColumn = yys_loc__[0].lastColumn;\n\
+								yyloc.firstLine = yystk__[yyrplen__ - 1].loc.firstLine;\n\
+								yyloc.lastLine = yystk__[0].loc.lastLine;\n\
+								yyloc.firstColumn = yystk__[yyrplen__ - 1].loc.firstColumn;\n\
+								yyloc.lastColumn = yystk__[0].loc.lastColumn;\n\
 							}\n\
 						}\n\
-						yys_loc__.pop(yyrplen__);\n\
-						yys_loc__.push(yyloc);\n\
 ]]></If><![[\n\
-						yys_stt__.push(yypstate__);\n\
-						yys_symb__.push(yyplid[yyprule__] + PARSE_TYPE_BASE);\n\
-						yys_sv__.push(yyval);\n\
+						yystk__.pop(yyrplen__);\n\
+\n\
+						yyframe_t &yyf__ = yystk__.push();\n\
+						yyf__.stt = yypstate__;\n\
+						yyf__.symb = yyplid[yyprule__] + PARSE_TYPE_BASE;\n\
+						yyf__.sv = yyval;\n\
+]]><If EnableLocation><![[\n\
+						yyf__.loc = yyloc;\n\
+]]></If><![[\n\
 					}\n\
 				}\n\
 			}\n\
 		}\n\
 \n\
-		while( ! yys_sv__.empty()) {\n\
+		while(yystk__.count() > 1) {\n\
 ]]><If ParseDebugMode><![[\n\
 if(yylogger)\n\
-	fprintf(yylogger, \"Clearup : Pop up %s from stack\\n\", sym_text__(yypsnam[yys_symb__.top()]));\n\
+	fprintf(yylogger, \"Clearup : Pop up %s from stack\\n\", sym_text__(yypsnam[yystk__.top().symb]));\n\
 ]]></If>\n\
 <If EnableLocation><![[\n\
-			yydiscard__(yys_sv__.top(), yys_loc__.top(), yys_symb__.top()]]>\n\
+			yydiscard__(yystk__.top().sv, yystk__.top().loc, yystk__.top().symb]]>\n\
 				<If Has\?\"ActualParams\"><![[, ]]><Action \"ActualParams\"/></If><![[);\n\
 ]]></If><Else><![[\n\
-            yydiscard__(yys_sv__.top(), yylloc, yys_symb__.top()]]>\n\
+            yydiscard__(yystk__.top().sv, yylloc, yystk__.top().symb]]>\n\
 				<If Has\?\"ActualParams\"><![[, ]]><Action \"ActualParams\"/></If><![[);\n\
 ]]></Else><![[\n\
-			yys_sv__.pop(1);\n\
-			yys_symb__.pop(1);\n\
+			yystk__.pop(1);\n\
 		}\n\
+		yystk__.clear();\n\
 \n\
 		if(YYE_ACCEPT == yyecode__) {\n\
 \n\
@@ -1743,7 +2544,8 @@ if(yylogger)\n\
 				<If Has\?\"ActualParams\"><![[, ]]><Action \"ActualParams\"/></If><![[);\n\
 ]]></Else><![[\n\
 		}\n\
-]]><$CodeBlock \"ParseExitAction\"/><![[\n\
+]]><If PushMode><![[		yypushing__ = false;\n\
+]]></If><$CodeBlock \"ParseExitAction\"/><![[\n\
 		return (yyecode__ == YYE_EOS || yyecode__ == YYE_ACCEPT )\? 0: yyecode__;\n\
 	}\n\
 ]]></If><![[\n\
@@ -1757,15 +2559,16 @@ public:\n\
 		\n\
 		yyleng = 0;\n\
 		yylaleng = 0;\n\
-		if(yytext) {\n\
-			yytext[0] = \'\\0\';\n\
-		}\n\
+		yyreset_text__();]]><If PushMode><![[\n\
+		yysuspended__ = false;]]></If><![[\n\
 		yybufmgr__.destroyall();\n\
 ]]></If>\n\
 <If EnableParser><![[\n\
 		yyerr_flag__ = false;\n\
 		yyltok = PARSE_UNDEFSYMB_ID;\n\
-]]></If><![[\n\
+		yystk__.clear();\n\
+]]><If PushMode><![[		yypushing__ = false;\n\
+]]></If></If><![[\n\
 	}\n\
 \n\
 private:\n\
@@ -1860,7 +2663,16 @@ private:\n\
 		}\n\
 		return yybufmgr__.newbuf(strbuffer, size);\n\
 	}\n\
+	// yytext refers to the mapping in place for tokens from this buffer\n\
+	inline YYPBUFFER yy_new_mmapbuf(const char *strfile) {\n\
+		if( ! strfile) {\n\
+			return NULL;\n\
+		}\n\
+		return yybufmgr__.newmmap(strfile);\n\
+	}\n\
 	inline void yy_delete_buffer(void) {\n\
+		// yytext may refer to the buffer in place\n\
+		yyown_text__();\n\
 		yybufmgr__.destroytop();\n\
 	}\n\
 	inline void yy_switch_buffer(YYPBUFFER buf) {\n\
@@ -1874,9 +2686,8 @@ private:\n\
 		\n\
 		yyleng = 0;\n\
 		yylaleng = 0;\n\
-		if( yytext ) {\n\
-			yytext[0] = \'\\0\';\n\
-		}\n\
+		yyreset_text__();]]><If PushMode><![[\n\
+		yysuspended__ = false;]]></If><![[\n\
 \n\
 		yyscstk__.clear();\n\
 		yybufmgr__.reset();\n\
@@ -1889,22 +2700,25 @@ private:\n\
 	}\n\
 	inline int yyless(int n) {\n\
 \n\
+		// chars given back will be read again, keep them intact\n\
+		yyown_text__();\n\
 		if(n > 0 && n < yyleng) {\n\
 \n\
-			yytext[n] = \'\\0\';\n\
+			yyend_text__(n);\n\
 			n = yyleng - n;\n\
 			yyleng -= n;\n\
 			yylaleng = yyleng;\n\
 			return yybufmgr__.unget(n);\n\
 		}\n\
 		yylaleng = yyleng;\n\
-		yytext[yylaleng] = \'\\0\';\n\
+		yyend_text__(yylaleng);\n\
 \n\
 		return 0;\n\
 	}\n\
 \n\
 	inline int yyinput(void) {\n\
 \n\
+		yyunhold__();\n\
 		int c = yybufmgr__.get();]]>\n\
 	<If EnableLocation>\n\
 		<If EnableColumn><![[\n\
@@ -1929,6 +2743,7 @@ private:\n\
 		return c;\n\
 	}\n\
 	inline bool yyunput(char c) {\n\
+		yyunhold__();\n\
 		int oldc = yybufmgr__.put(c);]]>\n\
 	<If EnableLocation>\n\
 		<If EnableColumn><![[\n\
@@ -1952,6 +2767,7 @@ private:\n\
 		return oldc < END_OF_FILE;\n\
 	}\n\
 	inline bool yyunget(void) {\n\
+		yyunhold__();\n\
 		int oldc = yybufmgr__.unget();]]>\n\
 	<If EnableLocation>\n\
 		<If EnableColumn><![[\n\
@@ -2028,74 +2844,119 @@ private:\n\
 	char *yytext;\n\
 	int yyleng;\n\
 	int yylaleng;\n\
-\n\
+	// own text buffer, yytext refers to it unless it is in place\n\
+	char *yytbuf__;\n\
+	// char overwritten by terminating NULL of in-place yytext\n\
+	char *yyhold_ptr__;\n\
+	char yyhold_char__;\n\
+	// rule of token matched last\n\
+	int yyrule__;\n\
+]]><If PushMode><![[	// states of DFA kept when scanner waits for next input chunk\n\
+	bool yysuspended__;\n\
+	int yysus_state__;\n\
+	int yysus_rule__;\n\
+	int yysus_accleng__;\n\
+	bool yysus_bol__;\n\
+]]></If><![[\n\
 	]]></If><If EnableParser><![[\n\
+	// frame of parse stack: state, symbol, semantic value and location\n\
+	struct yyframe_t {\n\
+		int stt;\n\
+		int symb;\n\
+		xstype_t sv;\n\
+]]><If EnableLocation><![[		xltype_t loc;\n\
+]]></If><![[	};\n\
+\n\
 	bool yyerr_flag__;\n\
 	int yyltok;\n\
     yylex_t yylexer;\n\
-]]></If><![[\n\
+	// parse stack, its storage is kept and reused by following parses\n\
+	sstack_t<yyframe_t, 256> yystk__;\n\
+]]><If PushMode><![[	// states of parser kept between pushes of tokens\n\
+	bool yypushing__;\n\
+	xstype_t yyval;\n\
+	xltype_t yyloc;\n\
+	int yyrplen__;\n\
+	bool yyreducing__;\n\
+	int yypstate__;\n\
+	int yyprule__;\n\
+	int yysidx__;\n\
+	int yytok__;\n\
+	]]><$SingleAction \"ParseVarDecl\"/><![[\n\
+]]></If></If><![[\n\
 	FILE* yyoutput;\n\
 	FILE* yylogger;\n\
-    yyerror_t yyerror;\n\
-	\n\
+    yyerror_t ]]><$ErrorReporter/><![[;\n\
+]]><If Reentrant><If EnableParser><![[	// semantic value and location of current token\n\
+	xstype_t yylval;\n\
+	xltype_t yylloc;\n\
+]]></If></If><![[	\n\
 private:\n\
 	\n\
 ]]><If EnableScanner><![[\n\
 ///////////////////////////////////////////////////////////////////////////\n\
 	// lexical tables\n\
 	// start states of DFAs\n\
-	static const int yydsc[]]><Size \"LexStartStates\"/><![[];\n\
+	static const ]]><$IntType \"LexStartStatesType\"/><![[ yydsc[]]><Size \"LexStartStates\"/><![[];\n\
 \n\
 	// @yydcmap is a char map: char -> transition-label,\n\
 	// that is, chars are grouped, transition label is\n\
 	// representation of equivalent class of chars\n\
-	static const int yydcmap[]]><Size \"LexCharMap\"/><![[];\n\
+	static const ]]><$IntType \"LexCharMapType\"/><![[ yydcmap[]]><Size \"LexCharMap\"/><![[];\n\
 \n\
-	// @yydmeta is transition-label map: transition-label -> grouped-transition-label,\n\
+]]><If Has\?\"LexDFAFull\"><![[	// full transition table: [state][transition-label], and accepted rule\n\
+	// of each state in the last column, offset by -LEX_ERROR_RULE\n\
+	static const ]]><$IntType \"LexDFAFullType\"/><![[ yydfull[]]><Size \"LexDFAFull\"/><![[];\n\
+]]></If><Else><![[	// @yydmeta is transition-label map: transition-label -> grouped-transition-label,\n\
 	// that is, transition-label in @yydcmap are further grouped in order to save space\n\
-	static const int yydmeta[]]><Size \"LexMetaChars\"/><![[];\n\
+	static const ]]><$IntType \"LexMetaCharsType\"/><![[ yydmeta[]]><Size \"LexMetaChars\"/><![[];\n\
 \n\
 	// use next-check-base-default scheme to store DFAs\n\
 	// \n\
-	static const int yydbase[]]><Size \"LexDFABases\"/><![[];\n\
-	static const int yyddef[]]><Size \"LexDFADefaults\"/><![[];\n\
+	static const ]]><$IntType \"LexDFABasesType\"/><![[ yydbase[]]><Size \"LexDFABases\"/><![[];\n\
+	static const ]]><$IntType \"LexDFADefaultsType\"/><![[ yyddef[]]><Size \"LexDFADefaults\"/><![[];\n\
 	// next table is an indeed transition table\n\
-	static const int yydnxt[]]><Size \"LexDFANexts\"/><![[];\n\
-	static const int yydchk[]]><Size \"LexDFAChecks\"/><![[];\n\
-	static const int yydaccpt[]]><Size \"LexDFAAccepts\"/><![[];\n\
-	\n\
+	static const ]]><$IntType \"LexDFANextsType\"/><![[ yydnxt[]]><Size \"LexDFANexts\"/><![[];\n\
+	static const ]]><$IntType \"LexDFAChecksType\"/><![[ yydchk[]]><Size \"LexDFAChecks\"/><![[];\n\
+	static const ]]><$IntType \"LexDFAAcceptsType\"/><![[ yydaccpt[]]><Size \"LexDFAAccepts\"/><![[];\n\
+]]></Else><![[	\n\
 	static char YYMSG_UNMATCHED[];\n\
 ]]></If><If EnableParser><![[\n\
 ///////////////////////////////////////////////////////////////////////////////\n\
 	// LALR parse tables\n\
 	// token map: token ID --> token index in token ID table\n\
 	// in fact, it acts like inverse table of token ID table\n\
-	static const int yyptmap[]]><Size \"ParseTokenMap\"/><![[];\n\
+	static const ]]><$IntType \"ParseTokenMapType\"/><![[ yyptmap[]]><Size \"ParseTokenMap\"/><![[];\n\
 	// token ID table, which contains token IDs\n\
-	//static const int yyptid[]]><Size \"ParseTokenID\"/><![[];\n\
+	//static const ]]><$IntType \"ParseTokenIDType\"/><![[ yyptid[]]><Size \"ParseTokenID\"/><![[];\n\
 	// number of symbols in a grammar rule\n\
-	static const int yyprnum[]]><Size \"ParseRPNum\"/><![[];\n\
+	static const ]]><$IntType \"ParseRPNumType\"/><![[ yyprnum[]]><Size \"ParseRPNum\"/><![[];\n\
 	// index of left symbol in a grammar rule\n\
-	static const int yyplid[]]><Size \"ParseLPID\"/><![[];\n\
+	static const ]]><$IntType \"ParseLPIDType\"/><![[ yyplid[]]><Size \"ParseLPID\"/><![[];\n\
 	// parse action table\n\
-	static const int yypact[]]><Size \"ParseActEntries\"/><![[];\n\
+	static const ]]><$IntType \"ParseActEntriesType\"/><![[ yypact[]]><Size \"ParseActEntries\"/><![[];\n\
 \n\
 	// base array for parse action table\n\
 	// which is used to determine the base location of the entries\n\
 	// for each state stored in the yypack table\n\
-	static const int yypabase[]]><Size \"PActionBases\"/><![[];\n\
-	static const int yypgoto[]]><Size \"ParseGotos\"/><![[];\n\
-	static const int yypgbase[]]><Size \"PGotoBases\"/><![[];\n\
-\n\
+	static const ]]><$IntType \"PActionBasesType\"/><![[ yypabase[]]><Size \"PActionBases\"/><![[];\n\
+	static const ]]><$IntType \"ParseGotosType\"/><![[ yypgoto[]]><Size \"ParseGotos\"/><![[];\n\
+	static const ]]><$IntType \"PGotoBasesType\"/><![[ yypgbase[]]><Size \"PGotoBases\"/><![[];\n\
+]]><If ParseRowMerge><![[\n\
+	// check tables, and default action of each state and goto of each non-terminal\n\
+	static const ]]><$IntType \"PActionChecksType\"/><![[ yypachk[]]><Size \"PActionChecks\"/><![[];\n\
+	static const ]]><$IntType \"PGotoChecksType\"/><![[ yypgchk[]]><Size \"PGotoChecks\"/><![[];\n\
+	static const ]]><$IntType \"ParseDefRulesType\"/><![[ yypdefact[]]><Size \"ParseDefRules\"/><![[];\n\
+	static const ]]><$IntType \"ParseDefGotosType\"/><![[ yypdefgoto[]]><Size \"ParseDefGotos\"/><![[];]]></If><Else><![[\n\
 	// check table for parse action table\n\
 	static const by_te_t yyvbmap[]]><Size \"ParseValidBMap\"/><![[];\n\
-	static const int yyparv[]]><Size \"ParseActRowVal\"/><![[];\n\
-	static const int yyparn[]]><Size \"ParseActRowNice\"/><![[];\n\
+	static const ]]><$IntType \"ParseActRowValType\"/><![[ yyparv[]]><Size \"ParseActRowVal\"/><![[];\n\
+	static const ]]><$IntType \"ParseActRowNiceType\"/><![[ yyparn[]]><Size \"ParseActRowNice\"/><![[];\n\
 \n\
-	static const int yypcv[]]><Size \"ParseColVal\"/><![[];\n\
-	static const int yypcn[]]><Size \"ParseColNice\"/><![[];\n\
-	static const int yypgrv[]]><Size \"ParseGotoRowVal\"/><![[];\n\
-	static const int yypgrn[]]><Size \"ParseGotoRowNice\"/><![[];\n\
+	static const ]]><$IntType \"ParseColValType\"/><![[ yypcv[]]><Size \"ParseColVal\"/><![[];\n\
+	static const ]]><$IntType \"ParseColNiceType\"/><![[ yypcn[]]><Size \"ParseColNice\"/><![[];\n\
+	static const ]]><$IntType \"ParseGotoRowValType\"/><![[ yypgrv[]]><Size \"ParseGotoRowVal\"/><![[];\n\
+	static const ]]><$IntType \"ParseGotoRowNiceType\"/><![[ yypgrn[]]><Size \"ParseGotoRowNice\"/><![[];]]></Else><![[\n\
 	static const std::unordered_map<std::string, int> yyslexemID;\n\
 ]]></If><![[\n\
 ///////////////////////////////////////////////////////////////////////////////////\n\
@@ -2104,100 +2965,105 @@ private:\n\
 	// lookahead distant table, only available when there are some lookahead patterns\n\
 	// each pattern has its entry of the table\n\
 	]]><If Has\?\"LexDFALookaheads\"><![[\n\
-	static const int yylad[]]><Size \"LexDFALookaheads\"/><![[];]]></If>\n\
+	static const ]]><$IntType \"LexDFALookaheadsType\"/><![[ yylad[]]><Size \"LexDFALookaheads\"/><![[];]]></If>\n\
 	<If LexDebugMode><![[\n\
 	static const char* yydscnam[]]><Size \"LexStartLabels\"/><![[];\n\
-	static const int yydline[]]><Size \"LexRule2Lines\"/><![[];]]></If>\n\
+	static const ]]><$IntType \"LexRule2LinesType\"/><![[ yydline[]]><Size \"LexRule2Lines\"/><![[];]]></If>\n\
 </If><If EnableParser><If ParseDebugMode><![[\n\
 	static const char* yypsnam[]]><Size \"ParseSymName\"/><![[];\n\
-	static const int yyprpbase[]]><Size \"ParseRPBases\"/><![[];\n\
-	static const int yyprpidx[]]><Size \"ParseRPIndexes\"/><![[];\n\
-	static const int yypline[]]><Size \"ParseRule2Lines\"/><![[];]]></If><![[\n\
+	static const ]]><$IntType \"ParseRPBasesType\"/><![[ yyprpbase[]]><Size \"ParseRPBases\"/><![[];\n\
+	static const ]]><$IntType \"ParseRPIndexesType\"/><![[ yyprpidx[]]><Size \"ParseRPIndexes\"/><![[];\n\
+	static const ]]><$IntType \"ParseRule2LinesType\"/><![[ yypline[]]><Size \"ParseRule2Lines\"/><![[];]]></If><![[\n\
 ]]></If><![[\n\
 };\n\
 \n\
 ]]><If EnableScanner><![[\n\
 char yyparser_t::YYMSG_UNMATCHED[] = \"Error: unmatched character ` \\\'.\";\n\
 \n\
-const int yyparser_t::yydsc[]]><Size \"LexStartStates\"/><![[] = {\n\
+const ]]><$IntType \"LexStartStatesType\"/><![[ yyparser_t::yydsc[]]><Size \"LexStartStates\"/><![[] = {\n\
 ]]>\n\
 <$IntArray \"LexStartStates\"/>\n\
 <![[\n\
 };\n\
 \n\
-const int yyparser_t::yydcmap[]]><Size \"LexCharMap\"/><![[] = {\n\
+const ]]><$IntType \"LexCharMapType\"/><![[ yyparser_t::yydcmap[]]><Size \"LexCharMap\"/><![[] = {\n\
 ]]>\n\
 <$IntArray \"LexCharMap\"/>\n\
 <![[\n\
 };\n\
 \n\
-const int yyparser_t::yydmeta[]]><Size \"LexMetaChars\"/><![[] = {\n\
+]]><If Has\?\"LexDFAFull\"><![[const ]]><$IntType \"LexDFAFullType\"/><![[ yyparser_t::yydfull[]]><Size \"LexDFAFull\"/><![[] = {\n\
+]]>\n\
+<$IntArray \"LexDFAFull\"/>\n\
+<![[\n\
+};\n\
+]]></If><Else><![[const ]]><$IntType \"LexMetaCharsType\"/><![[ yyparser_t::yydmeta[]]><Size \"LexMetaChars\"/><![[] = {\n\
 ]]>\n\
 <$IntArray \"LexMetaChars\"/>\n\
 <![[\n\
 };\n\
 \n\
-const int yyparser_t::yydbase[]]><Size \"LexDFABases\"/><![[] = {\n\
+const ]]><$IntType \"LexDFABasesType\"/><![[ yyparser_t::yydbase[]]><Size \"LexDFABases\"/><![[] = {\n\
 ]]>\n\
 <$IntArray \"LexDFABases\"/>\n\
 <![[\n\
 };\n\
 \n\
-const int yyparser_t::yyddef[]]><Size \"LexDFADefaults\"/><![[] = {\n\
+const ]]><$IntType \"LexDFADefaultsType\"/><![[ yyparser_t::yyddef[]]><Size \"LexDFADefaults\"/><![[] = {\n\
 ]]>\n\
 <$IntArray \"LexDFADefaults\"/>\n\
 <![[\n\
 };\n\
 \n\
-const int yyparser_t::yydnxt[]]><Size \"LexDFANexts\"/><![[] = {\n\
+const ]]><$IntType \"LexDFANextsType\"/><![[ yyparser_t::yydnxt[]]><Size \"LexDFANexts\"/><![[] = {\n\
 ]]>\n\
 <$IntArray \"LexDFANexts\"/>\n\
 <![[\n\
 };\n\
 \n\
-const int yyparser_t::yydchk[]]><Size \"LexDFAChecks\"/><![[] = {\n\
+const ]]><$IntType \"LexDFAChecksType\"/><![[ yyparser_t::yydchk[]]><Size \"LexDFAChecks\"/><![[] = {\n\
 ]]>\n\
 <$IntArray \"LexDFAChecks\"/>\n\
 <![[\n\
 };\n\
 \n\
-const int yyparser_t::yydaccpt[]]><Size \"LexDFAAccepts\"/><![[] = {\n\
+const ]]><$IntType \"LexDFAAcceptsType\"/><![[ yyparser_t::yydaccpt[]]><Size \"LexDFAAccepts\"/><![[] = {\n\
 ]]>\n\
 <$IntArray \"LexDFAAccepts\"/>\n\
 <![[\n\
 };\n\
-]]></If><If EnableParser><![[\n\
+]]></Else><![[]]></If><If EnableParser><![[\n\
 // token map: token ID --> token index in token ID table\n\
 // in fact, it acts like inverse table of token ID table\n\
-const int yyparser_t::yyptmap[]]><Size \"ParseTokenMap\"/><![[] = {\n\
+const ]]><$IntType \"ParseTokenMapType\"/><![[ yyparser_t::yyptmap[]]><Size \"ParseTokenMap\"/><![[] = {\n\
 ]]>\n\
 <$IntArray \"ParseTokenMap\"/>\n\
 <![[\n\
 };\n\
 /*\n\
 // token ID table, containing token IDs\n\
-const int yyparser_t::yyptid[]]><Size \"ParseTokenID\"/><![[] = {\n\
+const ]]><$IntType \"ParseTokenIDType\"/><![[ yyparser_t::yyptid[]]><Size \"ParseTokenID\"/><![[] = {\n\
 ]]>\n\
 <$IntArray \"ParseTokenID\"/>\n\
 <![[\n\
 };\n\
 */\n\
 // prnum table, its element is number of symbols in right part of corresponding grammar rule\n\
-const int yyparser_t::yyprnum[]]><Size \"ParseRPNum\"/><![[] = {\n\
+const ]]><$IntType \"ParseRPNumType\"/><![[ yyparser_t::yyprnum[]]><Size \"ParseRPNum\"/><![[] = {\n\
 ]]>\n\
 <$IntArray \"ParseRPNum\"/>\n\
 <![[\n\
 };\n\
 \n\
 // plid table, its element is the index of left part of corresponding grammar rule in token ID table\n\
-const int yyparser_t::yyplid[]]><Size \"ParseLPID\"/><![[] = {\n\
+const ]]><$IntType \"ParseLPIDType\"/><![[ yyparser_t::yyplid[]]><Size \"ParseLPID\"/><![[] = {\n\
 ]]>\n\
 <$IntArray \"ParseLPID\"/>\n\
 <![[\n\
 };\n\
 \n\
 // parse action table\n\
-const int yyparser_t::yypact[]]><Size \"ParseActEntries\"/><![[] = {\n\
+const ]]><$IntType \"ParseActEntriesType\"/><![[ yyparser_t::yypact[]]><Size \"ParseActEntries\"/><![[] = {\n\
 ]]>\n\
 <$IntArray \"ParseActEntries\"/>\n\
 <![[\n\
@@ -2206,68 +3072,92 @@ const int yyparser_t::yypact[]]><Size \"ParseActEntries\"/><![[] = {\n\
 // base array for parse action table\n\
 // which is used to determine the base location of the entries\n\
 // for each state stored in the yypack table\n\
-const int yyparser_t::yypabase[]]><Size \"PActionBases\"/><![[] = {\n\
+const ]]><$IntType \"PActionBasesType\"/><![[ yyparser_t::yypabase[]]><Size \"PActionBases\"/><![[] = {\n\
 ]]>\n\
 <$IntArray \"PActionBases\"/>\n\
 <![[\n\
 };\n\
 \n\
-const int yyparser_t::yypgoto[]]><Size \"ParseGotos\"/><![[] = {\n\
+const ]]><$IntType \"ParseGotosType\"/><![[ yyparser_t::yypgoto[]]><Size \"ParseGotos\"/><![[] = {\n\
 ]]>\n\
 <$IntArray \"ParseGotos\"/>\n\
 <![[\n\
 };\n\
 \n\
-const int yyparser_t::yypgbase[]]><Size \"PGotoBases\"/><![[] = {\n\
+const ]]><$IntType \"PGotoBasesType\"/><![[ yyparser_t::yypgbase[]]><Size \"PGotoBases\"/><![[] = {\n\
 ]]>\n\
 <$IntArray \"PGotoBases\"/>\n\
 <![[\n\
 };\n\
+]]><If ParseRowMerge><![[\n\
+const ]]><$IntType \"PActionChecksType\"/><![[ yyparser_t::yypachk[]]><Size \"PActionChecks\"/><![[] = {\n\
+]]>\n\
+<$IntArray \"PActionChecks\"/>\n\
+<![[\n\
+};\n\
+\n\
+const ]]><$IntType \"PGotoChecksType\"/><![[ yyparser_t::yypgchk[]]><Size \"PGotoChecks\"/><![[] = {\n\
+]]>\n\
+<$IntArray \"PGotoChecks\"/>\n\
+<![[\n\
+};\n\
 \n\
+const ]]><$IntType \"ParseDefRulesType\"/><![[ yyparser_t::yypdefact[]]><Size \"ParseDefRules\"/><![[] = {\n\
+]]>\n\
+<$IntArray \"ParseDefRules\"/>\n\
+<![[\n\
+};\n\
+\n\
+const ]]><$IntType \"ParseDefGotosType\"/><![[ yyparser_t::yypdefgoto[]]><Size \"ParseDefGotos\"/><![[] = {\n\
+]]>\n\
+<$IntArray \"ParseDefGotos\"/>\n\
+<![[\n\
+};\n\
+]]></If><Else><![[\n\
 const by_te_t yyparser_t::yyvbmap[]]><Size \"ParseValidBMap\"/><![[] = {\n\
 ]]>\n\
 <$IntArray \"ParseValidBMap\"/>\n\
 <![[\n\
 };\n\
 \n\
-const int yyparser_t::yyparv[]]><Size \"ParseActRowVal\"/><![[] = {\n\
+const ]]><$IntType \"ParseActRowValType\"/><![[ yyparser_t::yyparv[]]><Size \"ParseActRowVal\"/><![[] = {\n\
 ]]>\n\
 <$IntArray \"ParseActRowVal\"/>\n\
 <![[\n\
 };\n\
 \n\
 \n\
-const int yyparser_t::yyparn[]]><Size \"ParseActRowNice\"/><![[] = {\n\
+const ]]><$IntType \"ParseActRowNiceType\"/><![[ yyparser_t::yyparn[]]><Size \"ParseActRowNice\"/><![[] = {\n\
 ]]>\n\
 <$IntArray \"ParseActRowNice\"/>\n\
 <![[\n\
 };\n\
 \n\
-const int yyparser_t::yypcv[]]><Size \"ParseColVal\"/><![[] = {\n\
+const ]]><$IntType \"ParseColValType\"/><![[ yyparser_t::yypcv[]]><Size \"ParseColVal\"/><![[] = {\n\
 ]]>\n\
 <$IntArray \"ParseColVal\"/>\n\
 <![[\n\
 };\n\
 \n\
-const int yyparser_t::yypcn[]]><Size \"ParseColNice\"/><![[] = {\n\
+const ]]><$IntType \"ParseColNiceType\"/><![[ yyparser_t::yypcn[]]><Size \"ParseColNice\"/><![[] = {\n\
 ]]>\n\
 <$IntArray \"ParseColNice\"/>\n\
 <![[\n\
 };\n\
 \n\
 \n\
-const int yyparser_t::yypgrv[]]><Size \"ParseGotoRowVal\"/><![[] = {\n\
+const ]]><$IntType \"ParseGotoRowValType\"/><![[ yyparser_t::yypgrv[]]><Size \"ParseGotoRowVal\"/><![[] = {\n\
 ]]>\n\
 <$IntArray \"ParseGotoRowVal\"/>\n\
 <![[\n\
 };\n\
 \n\
-const int yyparser_t::yypgrn[]]><Size \"ParseGotoRowNice\"/><![[] = {\n\
+const ]]><$IntType \"ParseGotoRowNiceType\"/><![[ yyparser_t::yypgrn[]]><Size \"ParseGotoRowNice\"/><![[] = {\n\
 ]]>\n\
 <$IntArray \"ParseGotoRowNice\"/>\n\
 <![[\n\
 };\n\
-\n\
+]]></Else><![[\n\
 const std::unordered_map<std::string, int> yyparser_t::yyslexemID{\n\
 ]]>\n\
 <$StrIntMapDefine \"ParseStrTokenNames\" \"ParseStrTokenValues\"/>\n\
@@ -2276,7 +3166,7 @@ const std::unordered_map<std::string, int> yyparser_t::yyslexemID{\n\
 ]]></If>\n\
 <If EnableScanner>\n\
 <If Has\?\"LexDFALookaheads\"><![[\n\
-const int yyparser_t::yylad[]]><Size \"LexDFALookaheads\"/><![[] = {\n\
+const ]]><$IntType \"LexDFALookaheadsType\"/><![[ yyparser_t::yylad[]]><Size \"LexDFALookaheads\"/><![[] = {\n\
 ]]><$IntArray \"LexDFALookaheads\"/><![[\n\
 };]]></If>\n\
 \n\
@@ -2285,7 +3175,7 @@ const char* yyparser_t::yydscnam[]]><Size \"LexStartLabels\"/><![[] = {\n\
 ]]><$QStrArray \"LexStartLabels\"/><![[\n\
 };\n\
 \n\
-const int yyparser_t::yydline[]]><Size \"LexRule2Lines\"/><![[] = {\n\
+const ]]><$IntType \"LexRule2LinesType\"/><![[ yyparser_t::yydline[]]><Size \"LexRule2Lines\"/><![[] = {\n\
 ]]><$IntArray \"LexRule2Lines\"/><![[\n\
 };]]></If></If>\n\
 <If EnableParser>\n\
@@ -2294,19 +3184,132 @@ const char* yyparser_t::yypsnam[]]><Size \"ParseSymName\"/><![[] = {\n\
 ]]><$QStrArray \"ParseSymName\"/><![[\n\
 };\n\
 \n\
-const int yyparser_t::yyprpbase[]]><Size \"ParseRPBases\"/><![[] = {\n\
+const ]]><$IntType \"ParseRPBasesType\"/><![[ yyparser_t::yyprpbase[]]><Size \"ParseRPBases\"/><![[] = {\n\
 ]]><$IntArray \"ParseRPBases\"/><![[\n\
 };\n\
 \n\
-const int yyparser_t::yyprpidx[]]><Size \"ParseRPIndexes\"/><![[] = {\n\
+const ]]><$IntType \"ParseRPIndexesType\"/><![[ yyparser_t::yyprpidx[]]><Size \"ParseRPIndexes\"/><![[] = {\n\
 ]]><$IntArray \"ParseRPIndexes\"/><![[\n\
 };\n\
 \n\
-const int yyparser_t::yypline[]]><Size \"ParseRule2Lines\"/><![[] = {\n\
+const ]]><$IntType \"ParseRule2LinesType\"/><![[ yyparser_t::yypline[]]><Size \"ParseRule2Lines\"/><![[] = {\n\
 ]]><$IntArray \"ParseRule2Lines\"/><![[\n\
 };]]></If></If>\n\
 \n\
-<![[\n\
+<If Reentrant><![[\n\
+\n\
+// create a parser object, everything changed by scanning and parsing is held\n\
+// in it, so that parser objects can be used in different threads at same time\n\
+yyparser_t* yycreate(void) {\n\
+\n\
+    yyparser_t *yyp;\n\
+    MYNEW(yyp, yyparser_t]]><If EnableParser><If EnableScanner><![[(yylex)]]></If></If><![[);\n\
+	return yyp;\n\
+}\n\
+\n\
+// destroy parser object created by yycreate\n\
+void yydestroy(yyparser_t *yyp) {\n\
+	delete yyp;\n\
+}\n\
+\n\
+// assign new log stream\n\
+void yysetstream(yyparser_t *yyp, FILE *poutput, FILE *plogger) {\n\
+\n\
+	yyp->yyoutput = poutput;\n\
+	yyp->yylogger = plogger;\n\
+}\n\
+\n\
+// default error-reporter, errors are reported to logger of parser object\n\
+void yyemit_error__(const char *s]]><If Has\?\"FormalParams\"><![[, ]]><Action \"FormalParams\"/></If><![[) {\n\
+}\n\
+\n\
+// assign new error-reporter and return the old one\n\
+yyerror_t yyseterror(yyparser_t *yyp, yyerror_t perror) {\n\
+\n\
+    yyerror_t pold = yyp->yyerror__;\n\
+	yyp->yyerror__ = perror;\n\
+\n\
+	return pold;\n\
+}\n\
+\n\
+// reset all (both scanner and parser, if they are available)\n\
+void yyclearall(yyparser_t *yyp) {\n\
+	yyp->yyclearall__();\n\
+}\n\
+]]>\n\
+<If EnableScanner><![[\n\
+\n\
+// initializing file buffer before parsing or patter-matching\n\
+int yylexfile(yyparser_t *yyp, const char* pchFile, bool iMod) {\n\
+	\n\
+	return yyp->yylexinit__(pchFile, iMod)\? 0: -1;\n\
+}\n\
+// initializing string buffer before parsing or patter-matching\n\
+int yylexstr(yyparser_t *yyp, char *strbuffer, int size) {\n\
+	return yyp->yylexinit__(strbuffer, size)\? 0: -1;\n\
+}\n\
+// initializing const string buffer before parsing or patter-matching\n\
+int yylexcstr(yyparser_t *yyp, const char *strbuffer, int size) {\n\
+	return yyp->yylexinit__(strbuffer, size)\? 0: -1;\n\
+}\n\
+// initializing memory-mapped file buffer before parsing or patter-matching\n\
+int yylexmmap(yyparser_t *yyp, const char *pchFile) {\n\
+	return yyp->yylexinit__(pchFile)\? 0: -1;\n\
+}\n\
+]]><If PushMode><![[// appending input chunk before pattern-matching\n\
+int yylexchunk(yyparser_t *yyp, const char *pchunk, int size, bool blast) {\n\
+	return yyp->yylexchunk__(pchunk, size, blast)\? 0: -1;\n\
+}\n\
+]]></If><![[\n\
+// generated scanner, can be replaced\n\
+int yylex(]]><$ParserParams \"FormalParams\"/><![[) {\n\
+\n\
+	return yyp->yylex__(]]><If Has\?\"ActualParams\"><Action \"ActualParams\"/></If><![[);\n\
+} \n\
+\n\
+// scanning tokens in one call\n\
+int yylex_batch(yyparser_t *yyp, yytoken_t *out, int max]]><$NextParams \"FormalParams\"/><![[) {\n\
+	return yyp->yylex_batch__(out, max]]><$NextParams \"ActualParams\"/><![[);\n\
+}\n\
+]]></If>\n\
+\n\
+<If EnableParser><![[\n\
+// assign new scanner and return the old one \n\
+yylex_t yysetlex(yyparser_t *yyp, yylex_t plex) {\n\
+	\n\
+    yylex_t pold = yyp->yylexer;\n\
+	yyp->yylexer = plex;\n\
+\n\
+	return pold;\n\
+}\n\
+\n\
+// semantic value of current token, assigned by scanner\n\
+xstype_t* yygetlval(yyparser_t *yyp) {\n\
+	return &yyp->yylval;\n\
+}\n\
+\n\
+// location of current token, assigned by scanner\n\
+xltype_t* yygetlloc(yyparser_t *yyp) {\n\
+	return &yyp->yylloc;\n\
+}\n\
+\n\
+// generated parser, it should not be replaced\n\
+int yyparse(]]><$ParserParams \"FormalParams\"/><![[) {\n\
+	return yyp->yyparse__(]]><If Has\?\"ActualParams\"><Action \"ActualParams\"/></If><![[);\n\
+}]]><If PushMode><![[\n\
+\n\
+// pushing one token to parser\n\
+int yypush(yyparser_t *yyp, int tok, const xstype_t *pval, const xltype_t *ploc]]><$NextParams \"FormalParams\"/><![[) {\n\
+\n\
+	if(pval) {\n\
+		*yygetlval(yyp) = *pval;\n\
+	}\n\
+	if(ploc) {\n\
+		*yygetlloc(yyp) = *ploc;\n\
+	}\n\
+	return yyp->yypush__(tok]]><$NextParams \"ActualParams\"/><![[);\n\
+}]]></If></If></If>\n\
+<Else><![[\n\
 \n\
 // get global parser object,\n\
 // it\'s invisiable to user\n\
@@ -2362,12 +3365,25 @@ int yylexstr(char *strbuffer, int size) {\n\
 int yylexcstr(const char *strbuffer, int size) {\n\
 	return getTheParser().yylexinit__(strbuffer, size)\? 0: -1;\n\
 }\n\
-\n\
+// initializing memory-mapped file buffer before parsing or patter-matching\n\
+int yylexmmap(const char *pchFile) {\n\
+	return getTheParser().yylexinit__(pchFile)\? 0: -1;\n\
+}\n\
+]]><If PushMode><![[// appending input chunk before pattern-matching\n\
+int yylexchunk(const char *pchunk, int size, bool blast) {\n\
+	return getTheParser().yylexchunk__(pchunk, size, blast)\? 0: -1;\n\
+}\n\
+]]></If><![[\n\
 // generated scanner, can be replaced\n\
 int yylex(]]><If Has\?\"FormalParams\"><Action \"FormalParams\"/></If><![[) {\n\
 \n\
 	return getTheParser().yylex__(]]><If Has\?\"ActualParams\"><Action \"ActualParams\"/></If><![[);\n\
 } \n\
+\n\
+// scanning tokens in one call\n\
+int yylex_batch(yytoken_t *out, int max]]><$NextParams \"FormalParams\"/><![[) {\n\
+	return getTheParser().yylex_batch__(out, max]]><$NextParams \"ActualParams\"/><![[);\n\
+}\n\
 ]]></If>\n\
 \n\
 <If EnableParser><![[\n\
@@ -2384,7 +3400,19 @@ yylex_t yysetlex(yylex_t plex) {\n\
 // generated parser, it should not be replaced\n\
 int yyparse(]]><If Has\?\"FormalParams\"><Action \"FormalParams\"/></If><![[) {\n\
 	return getTheParser().yyparse__(]]><If Has\?\"ActualParams\"><Action \"ActualParams\"/></If><![[);\n\
-}]]></If>\n\
+}]]><If PushMode><![[\n\
+\n\
+// pushing one token to parser\n\
+int yypush(int tok, const xstype_t *pval, const xltype_t *ploc]]><$NextParams \"FormalParams\"/><![[) {\n\
+\n\
+	if(pval) {\n\
+		yylval = *pval;\n\
+	}\n\
+	if(ploc) {\n\
+		yylloc = *ploc;\n\
+	}\n\
+	return getTheParser().yypush__(tok]]><$NextParams \"ActualParams\"/><![[);\n\
+}]]></If></If></Else>\n\
 <![[\n\
 } // namspace\n\
 ]]>\n\
@@ -102,6 +102,43 @@ A parser program in Object Pascal, generated by ]]>\n\
 	]]><$IntArray/></Case>\n\
 <Default><Integer #0/><![[,	]]><$IntArray/></Default>\n\
 	</Macro>\n\
+\n\
+	<Macro \"$IntType\">\n\
+<Case Equal\?\"uint8\"><![[byte]]></Case>\n\
+<Case Equal\?\"int8\"><![[shortint]]></Case>\n\
+<Case Equal\?\"uint16\"><![[word]]></Case>\n\
+<Case Equal\?\"int16\"><![[smallint]]></Case>\n\
+<Default><![[integer]]></Default>\n\
+	</Macro>\n\
+\n\
+	<Macro \"$LexDirectStates\">\n\
+<Case End><GoFirst/></Case>\n\
+<Default><![[\n\
+		]]><Integer #0/><![[:]]><Skip #0/><Skip #0/><$LexDirectCase/></Default>\n\
+	</Macro>\n\
+\n\
+	<Macro \"$LexDirectCase\">\n\
+<Case GroupFlag><![[ ;]]><Skip #0/><$LexDirectStates/></Case>\n\
+<Default><![[\n\
+			case yydcmap[c] of\n\
+				]]><$LexDirectLabels/></Default>\n\
+	</Macro>\n\
+\n\
+	<Macro \"$LexDirectLabels\">\n\
+	<Integer #0/><$LexDirectMore/>\n\
+	</Macro>\n\
+\n\
+	<Macro \"$LexDirectMore\">\n\
+<Case Equal\?-2><Skip #0/><![[: yynext_lexstate__ := ]]><Integer #0/><![[;]]><Skip #0/><$LexDirectGroups/></Case>\n\
+<Default><![[, ]]><Integer #0/><$LexDirectMore/></Default>\n\
+	</Macro>\n\
+\n\
+	<Macro \"$LexDirectGroups\">\n\
+<Case GroupFlag><Skip #0/><![[\n\
+			end;]]><$LexDirectStates/></Case>\n\
+<Default><![[\n\
+				]]><$LexDirectLabels/></Default>\n\
+	</Macro>\n\
 \n\
 	<Macro \"$QStrArray\">\n\
 <Case Last><![[\']]><String #0/><![[\']]><GoFirst/></Case>\n\
@@ -167,7 +204,12 @@ const\n\
 \n\
 // index of the rule that matches EOAF (end of all files, or end of input)\n\
 	LEX_EOAF_RULE = ]]><Integer \"LexEOFARuleIndex\"/><![[;\n\
-]]>\n\
+]]><If Has\?\"LexDFAFull\"><![[\n\
+// size of rows of full transition table, the last column holds accepted\n\
+// rules, which are offset by -LEX_ERROR_RULE\n\
+	LEX_FULL_STRIDE = ]]><Integer \"LexFullStride\"/><![[;\n\
+	LEX_FULL_ACCEPT = LEX_FULL_STRIDE - 1;\n\
+]]></If>\n\
 </If><![[\n\
 // index of symbol `$end\' in symbol table\n\
 	PARSE_ENDSYMB_INDEX = ]]><Integer \"ParseEndSymbIdx\"/><![[;\n\
@@ -183,9 +225,11 @@ const\n\
 // ID of symbol \'$undef\'\n\
 	PARSE_UNDEFSYMB_ID = ]]><Integer \"ParseUndefSymbID\"/><![[;\n\
 ]]>\n\
-<If EnableParser><![[\n\
+<If EnableParser><If ParseRowMerge><![[\n\
+// base of action table for states having default action only\n\
+	PARSE_DEFONLY_BASE = ]]><Integer \"PActionDefBase\"/><![[;]]></If><Else><![[\n\
 // row size(in byte) of non-error bitmap of parse table\n\
-	PARSE_BMAP_ROWSIZE = ]]><Integer \"ParseBMapRowSize\"/><![[;\n\
+	PARSE_BMAP_ROWSIZE = ]]><Integer \"ParseBMapRowSize\"/><![[;]]></Else><![[\n\
 // base address of indexes of types (aka non-terminals or variables)\n\
 	PARSE_TYPE_BASE = ]]><Integer \"ParseTypeBase\"/><![[;\n\
 // number of symbols in parser\n\
@@ -312,14 +356,18 @@ type\n\
 	bufbase_t = class\n\
 	protected\n\
 		pbase, gptr, gend: pchar;\n\
+		// limit of chars that can be read in place\n\
+		glim: pchar;\n\
 		eos, imod: boolean;\n\
 		line, col, tab: integer;\n\
 		pvoid: pointer;\n\
 \n\
+		// read next char when it can not be read in place, and update glim\n\
+		function xget: integer; virtual; abstract;\n\
 	public\n\
 		constructor create;\n\
 		procedure reset; virtual;\n\
-		function get: integer; virtual; abstract;\n\
+		function get: integer;\n\
 		function peek: integer; virtual; abstract;\n\
 		function unget: integer; overload; virtual; abstract;\n\
 		function unget(num: integer): integer; overload; virtual; abstract;\n\
@@ -399,7 +447,7 @@ const\n\
 ///////////////////////////////////////////////////////////////////////////\n\
 	// lexical tables\n\
 	// start states of DFAs\n\
-	yydsc: array[0..]]><Size \"LexStartStates\"/><![[ - 1] of integer = (\n\
+	yydsc: array[0..]]><Size \"LexStartStates\"/><![[ - 1] of ]]><$IntType \"LexStartStatesType\"/><![[ = (\n\
 	]]><$IntArray \"LexStartStates\"/>\n\
 	<![[	\n\
 	);\n\
@@ -407,45 +455,52 @@ const\n\
 	// @yydcmap is a char map: char -> transition-label,\n\
 	// that is, chars are grouped, transition label is\n\
 	// representation of equivalent class of chars\n\
-	yydcmap: array[0..]]><Size \"LexCharMap\"/><![[ - 1] of integer = (\n\
+	yydcmap: array[0..]]><Size \"LexCharMap\"/><![[ - 1] of ]]><$IntType \"LexCharMapType\"/><![[ = (\n\
 	]]><$IntArray \"LexCharMap\"/>\n\
 	<![[\n\
 	);\n\
 \n\
-	// @yydmeta is transition-label map: transition-label -> grouped-transition-label,\n\
+]]><If Has\?\"LexDFAFull\"><![[\n\
+	// full transition table: [state][transition-label], and accepted rule\n\
+	// of each state in the last column, offset by -LEX_ERROR_RULE\n\
+	yydfull: array[0..]]><Size \"LexDFAFull\"/><![[ - 1] of ]]><$IntType \"LexDFAFullType\"/><![[ = (\n\
+	]]><$IntArray \"LexDFAFull\"/>\n\
+	<![[\n\
+	);\n\
+]]></If><Else><![[	// @yydmeta is transition-label map: transition-label -> grouped-transition-label,\n\
 	// that is, transition-label in @yydcmap are further grouped in order to save space\n\
-	yydmeta: array[0..]]><Size \"LexMetaChars\"/><![[ - 1] of integer = (\n\
+	yydmeta: array[0..]]><Size \"LexMetaChars\"/><![[ - 1] of ]]><$IntType \"LexMetaCharsType\"/><![[ = (\n\
 	]]><$IntArray \"LexMetaChars\"/>\n\
 	<![[	\n\
 	);\n\
 \n\
 	// use next-check-base-default scheme to store DFAs\n\
 	// \n\
-	yydbase: array[0..]]><Size \"LexDFABases\"/><![[ - 1] of integer = (\n\
+	yydbase: array[0..]]><Size \"LexDFABases\"/><![[ - 1] of ]]><$IntType \"LexDFABasesType\"/><![[ = (\n\
 	]]><$IntArray \"LexDFABases\"/>\n\
 	<![[	\n\
 	);\n\
-	yyddef: array[0..]]><Size \"LexDFADefaults\"/><![[ - 1] of integer = (\n\
+	yyddef: array[0..]]><Size \"LexDFADefaults\"/><![[ - 1] of ]]><$IntType \"LexDFADefaultsType\"/><![[ = (\n\
 	]]><$IntArray \"LexDFADefaults\"/>\n\
 	<![[	\n\
 	);\n\
 	// next table is an indeed transition table\n\
-	yydnxt: array[0..]]><Size \"LexDFANexts\"/><![[ - 1] of integer = (\n\
+	yydnxt: array[0..]]><Size \"LexDFANexts\"/><![[ - 1] of ]]><$IntType \"LexDFANextsType\"/><![[ = (\n\
 	]]><$IntArray \"LexDFANexts\"/>\n\
 	<![[	\n\
 	);\n\
-	yydchk: array[0..]]><Size \"LexDFAChecks\"/><![[ - 1] of integer = (\n\
+	yydchk: array[0..]]><Size \"LexDFAChecks\"/><![[ - 1] of ]]><$IntType \"LexDFAChecksType\"/><![[ = (\n\
 	]]><$IntArray \"LexDFAChecks\"/>\n\
 	<![[	\n\
 	);\n\
-	yydaccpt: array[0..]]><Size \"LexDFAAccepts\"/><![[ - 1] of integer = (\n\
+	yydaccpt: array[0..]]><Size \"LexDFAAccepts\"/><![[ - 1] of ]]><$IntType \"LexDFAAcceptsType\"/><![[ = (\n\
 	]]><$IntArray \"LexDFAAccepts\"/>\n\
 	<![[	\n\
 	);\n\
-	YYMSG_UNMATCHED: pchar = \'Error: unmatched character ` \'\'.\';\n\
+]]></Else><![[	YYMSG_UNMATCHED: pchar = \'Error: unmatched character ` \'\'.\';\n\
 ]]>\n\
 	<If Has\?\"LexDFALookaheads\"><![[\n\
-	yylad: array[0..]]><Size \"LexDFALookaheads\"/><![[ - 1] of integer = (\n\
+	yylad: array[0..]]><Size \"LexDFALookaheads\"/><![[ - 1] of ]]><$IntType \"LexDFALookaheadsType\"/><![[ = (\n\
 	]]><$IntArray \"LexDFALookaheads\"/><![[\n\
 	);]]>\n\
 	</If>\n\
@@ -455,7 +510,7 @@ const\n\
 	]]><$QStrArray \"LexStartLabels\"/><![[\n\
 	);\n\
 \n\
-	yydline: array[0..]]><Size \"LexRule2Lines\"/><![[ - 1] of integer = (\n\
+	yydline: array[0..]]><Size \"LexRule2Lines\"/><![[ - 1] of ]]><$IntType \"LexRule2LinesType\"/><![[ = (\n\
 	]]><$IntArray \"LexRule2Lines\"/><![[\n\
 	);]]>\n\
 	</If>\n\
@@ -463,31 +518,31 @@ const\n\
 <If EnableParser><![[\n\
 	// token map: token ID --> token index in token ID table\n\
 	// in fact, it acts like inverse table of token ID table\n\
-	yyptmap: array[0..]]><Size \"ParseTokenMap\"/><![[ - 1] of integer = (\n\
+	yyptmap: array[0..]]><Size \"ParseTokenMap\"/><![[ - 1] of ]]><$IntType \"ParseTokenMapType\"/><![[ = (\n\
 	]]><$IntArray \"ParseTokenMap\"/>\n\
 <![[\n\
 	);\n\
 {\n\
 	// token ID table, containing token IDs\n\
-	yyptid: array[0..]]><Size \"ParseTokenID\"/><![[ - 1] of integer = (\n\
+	yyptid: array[0..]]><Size \"ParseTokenID\"/><![[ - 1] of ]]><$IntType \"ParseTokenIDType\"/><![[ = (\n\
 	]]><$IntArray \"ParseTokenID\"/>\n\
 <![[\n\
 	);\n\
 }\n\
 	// prnum table, its element is number of symbols in right part of corresponding grammar rule\n\
-	yyprnum: array[0..]]><Size \"ParseRPNum\"/><![[ - 1] of integer = (\n\
+	yyprnum: array[0..]]><Size \"ParseRPNum\"/><![[ - 1] of ]]><$IntType \"ParseRPNumType\"/><![[ = (\n\
 	]]><$IntArray \"ParseRPNum\"/>\n\
 <![[\n\
 	);\n\
 \n\
 	// plid table, its element is the index of left part of corresponding grammar rule in token ID table\n\
-	yyplid: array[0..]]><Size \"ParseLPID\"/><![[ - 1] of integer = (\n\
+	yyplid: array[0..]]><Size \"ParseLPID\"/><![[ - 1] of ]]><$IntType \"ParseLPIDType\"/><![[ = (\n\
 	]]><$IntArray \"ParseLPID\"/>\n\
 <![[\n\
 	);\n\
 \n\
 	// parse action table\n\
-	yypact: array[0..]]><Size \"ParseActEntries\"/><![[ - 1] of integer = (\n\
+	yypact: array[0..]]><Size \"ParseActEntries\"/><![[ - 1] of ]]><$IntType \"ParseActEntriesType\"/><![[ = (\n\
 	]]><$IntArray \"ParseActEntries\"/>\n\
 <![[\n\
 	);\n\
@@ -495,72 +550,93 @@ const\n\
 	// base array for parse action table\n\
 	// which is used to determine the base location of the entries\n\
 	// for each state stored in the yypack table\n\
-	yypabase: array[0..]]><Size \"PActionBases\"/><![[ - 1] of integer = (\n\
+	yypabase: array[0..]]><Size \"PActionBases\"/><![[ - 1] of ]]><$IntType \"PActionBasesType\"/><![[ = (\n\
 	]]><$IntArray \"PActionBases\"/>\n\
 <![[\n\
 	);\n\
 \n\
-	yypgoto: array[0..]]><Size \"ParseGotos\"/><![[ - 1] of integer = (\n\
+	yypgoto: array[0..]]><Size \"ParseGotos\"/><![[ - 1] of ]]><$IntType \"ParseGotosType\"/><![[ = (\n\
 	]]><$IntArray \"ParseGotos\"/>\n\
 <![[\n\
 	);\n\
 \n\
-	yypgbase: array[0..]]><Size \"PGotoBases\"/><![[ - 1] of integer = (\n\
+	yypgbase: array[0..]]><Size \"PGotoBases\"/><![[ - 1] of ]]><$IntType \"PGotoBasesType\"/><![[ = (\n\
 	]]><$IntArray \"PGotoBases\"/>\n\
 <![[\n\
 	);\n\
+]]><If ParseRowMerge><![[\n\
+	// check tables, and default action of each state and goto of each non-terminal\n\
+	yypachk: array[0..]]><Size \"PActionChecks\"/><![[ - 1] of ]]><$IntType \"PActionChecksType\"/><![[ = (\n\
+	]]><$IntArray \"PActionChecks\"/>\n\
+<![[\n\
+	);\n\
+\n\
+	yypgchk: array[0..]]><Size \"PGotoChecks\"/><![[ - 1] of ]]><$IntType \"PGotoChecksType\"/><![[ = (\n\
+	]]><$IntArray \"PGotoChecks\"/>\n\
+<![[\n\
+	);\n\
+\n\
+	yypdefact: array[0..]]><Size \"ParseDefRules\"/><![[ - 1] of ]]><$IntType \"ParseDefRulesType\"/><![[ = (\n\
+	]]><$IntArray \"ParseDefRules\"/>\n\
+<![[\n\
+	);\n\
 \n\
+	yypdefgoto: array[0..]]><Size \"ParseDefGotos\"/><![[ - 1] of ]]><$IntType \"ParseDefGotosType\"/><![[ = (\n\
+	]]><$IntArray \"ParseDefGotos\"/>\n\
+<![[\n\
+	);\n\
+]]></If><Else><![[\n\
 	yyvbmap: array[0..]]><Size \"ParseValidBMap\"/><![[ - 1] of byte = (\n\
 	]]><$IntArray \"ParseValidBMap\"/>\n\
 <![[\n\
 	);\n\
 \n\
-	yyparv: array[0..]]><Size \"ParseActRowVal\"/><![[ - 1] of integer = (\n\
+	yyparv: array[0..]]><Size \"ParseActRowVal\"/><![[ - 1] of ]]><$IntType \"ParseActRowValType\"/><![[ = (\n\
 	]]><$IntArray \"ParseActRowVal\"/>\n\
 <![[\n\
 	);\n\
 \n\
 \n\
-	yyparn: array[0..]]><Size \"ParseActRowNice\"/><![[ - 1] of integer = (\n\
+	yyparn: array[0..]]><Size \"ParseActRowNice\"/><![[ - 1] of ]]><$IntType \"ParseActRowNiceType\"/><![[ = (\n\
 	]]><$IntArray \"ParseActRowNice\"/>\n\
 <![[\n\
 	);\n\
 \n\
-	yypcv: array[0..]]><Size \"ParseColVal\"/><![[ - 1] of integer = (\n\
+	yypcv: array[0..]]><Size \"ParseColVal\"/><![[ - 1] of ]]><$IntType \"ParseColValType\"/><![[ = (\n\
 	]]><$IntArray \"ParseColVal\"/>\n\
 <![[\n\
 	);\n\
 \n\
-	yypcn: array[0..]]><Size \"ParseColNice\"/><![[ - 1] of integer = (\n\
+	yypcn: array[0..]]><Size \"ParseColNice\"/><![[ - 1] of ]]><$IntType \"ParseColNiceType\"/><![[ = (\n\
 	]]><$IntArray \"ParseColNice\"/>\n\
 <![[\n\
 	);\n\
 \n\
 \n\
-	yypgrv: array[0..]]><Size \"ParseGotoRowVal\"/><![[ - 1] of integer = (\n\
+	yypgrv: array[0..]]><Size \"ParseGotoRowVal\"/><![[ - 1] of ]]><$IntType \"ParseGotoRowValType\"/><![[ = (\n\
 	]]><$IntArray \"ParseGotoRowVal\"/>\n\
 <![[\n\
 	);\n\
 \n\
-	yypgrn: array[0..]]><Size \"ParseGotoRowNice\"/><![[ - 1] of integer = (\n\
+	yypgrn: array[0..]]><Size \"ParseGotoRowNice\"/><![[ - 1] of ]]><$IntType \"ParseGotoRowNiceType\"/><![[ = (\n\
 	]]><$IntArray \"ParseGotoRowNice\"/>\n\
 <![[\n\
 	);\n\
-]]>\n\
+]]></Else>\n\
 	<If ParseDebugMode><![[\n\
 	yypsnam: array[0..]]><Size \"ParseSymName\"/><![[ - 1] of pchar = (\n\
 	]]><$QStrArray \"ParseSymName\"/><![[\n\
 	);\n\
 \n\
-	yyprpbase: array[0..]]><Size \"ParseRPBases\"/><![[ - 1] of integer = (\n\
+	yyprpbase: array[0..]]><Size \"ParseRPBases\"/><![[ - 1] of ]]><$IntType \"ParseRPBasesType\"/><![[ = (\n\
 	]]><$IntArray \"ParseRPBases\"/><![[\n\
 	);\n\
 \n\
-	yyprpidx: array[0..]]><Size \"ParseRPIndexes\"/><![[ - 1] of integer = (\n\
+	yyprpidx: array[0..]]><Size \"ParseRPIndexes\"/><![[ - 1] of ]]><$IntType \"ParseRPIndexesType\"/><![[ = (\n\
 	]]><$IntArray \"ParseRPIndexes\"/><![[\n\
 	);\n\
 \n\
-	yypline: array[0..]]><Size \"ParseRule2Lines\"/><![[ - 1] of integer = (\n\
+	yypline: array[0..]]><Size \"ParseRule2Lines\"/><![[ - 1] of ]]><$IntType \"ParseRule2LinesType\"/><![[ = (\n\
 	]]><$IntArray \"ParseRule2Lines\"/><![[\n\
 	);]]>\n\
 	</If>\n\
@@ -583,7 +659,7 @@ type\n\
 		destructor destroy; override;\n\
 	public\n\
 		procedure reset; override;\n\
-		function get: integer; override;\n\
+		function xget: integer; override;\n\
 		function peek: integer; override;\n\
 		function unget: integer; override;\n\
 		function unget(num: integer): integer; override;\n\
@@ -599,7 +675,7 @@ type\n\
 		destructor destroy; override;\n\
 	public\n\
 		procedure reset; override;\n\
-		function get: integer; override;\n\
+		function xget: integer; override;\n\
 		function peek: integer; override;\n\
 		function unget: integer; override;\n\
 		function unget(num: integer): integer; override;\n\
@@ -615,6 +691,9 @@ type\n\
 	bufmgr_t = class\n\
 	private\n\
 		phead, pavail: plink_t;\n\
+		// buffer on top of working stack, cached for get and isimod,\n\
+		// which are called for each char scanned\n\
+		xtop: bufbase_t;\n\
 		xstdin: bufbase_t;\n\
 		oldfmode: byte;\n\
 	public\n\
@@ -904,6 +983,17 @@ type\n\
     </If><![[    \n\
 	end;\n\
   \n\
+	// chars before glim are read in place, only then is xget called\n\
+	function bufbase_t.get: integer;\n\
+	begin\n\
+		if gptr + 1 < glim then\n\
+		begin\n\
+			gptr := gptr + 1;\n\
+			get := integer(gptr^);\n\
+		end\n\
+		else get := xget;\n\
+	end;\n\
+\n\
 	function bufbase_t.iseof: boolean;\n\
 	begin\n\
 		iseof := (gptr = gend);\n\
@@ -997,6 +1087,7 @@ type\n\
 	procedure filebuf_t.init;\n\
 	begin\n\
 		gend := buf;\n\
+		glim := gend;\n\
 		gptr := gend + BUF_FULL_SIZE - 1;\n\
 		pbase := gptr;\n\
 		gptr^ := #10;\n\
@@ -1076,25 +1167,27 @@ type\n\
 		inherited reset;\n\
 	end;\n\
 \n\
-	function filebuf_t.get: integer;\n\
+	function filebuf_t.xget: integer;\n\
 	begin\n\
 		if gptr = gend then\n\
 		begin\n\
 			eos := true;\n\
-			get := END_OF_ALLFILE;\n\
+			xget := END_OF_ALLFILE;\n\
 		end\n\
 		else\n\
 		begin\n\
 			gptr := buf + ((gptr - buf) + 1) mod BUF_FULL_SIZE;\n\
 \n\
 			if (gptr = gend) and (not bpeeked) then\n\
-			begin\n\
 				fill(gptr);\n\
-				bpeeked := false;\n\
-			end;\n\
 \n\
-			if iseof then get := END_OF_FILE\n\
-			else get := integer(gptr^);\n\
+			bpeeked := false;\n\
+			// chars up to gend or end of ring, whichever comes first\n\
+			if gend >= gptr then glim := gend\n\
+			else glim := buf + BUF_FULL_SIZE;\n\
+\n\
+			if iseof then xget := END_OF_FILE\n\
+			else xget := integer(gptr^);\n\
 		end;\n\
 	end;\n\
 \n\
@@ -1106,7 +1199,9 @@ type\n\
 		else begin\n\
 			p := buf + ((gptr - buf) + 1) mod BUF_FULL_SIZE;\n\
 			if p = gend then fill(p);\n\
-			bpeeked := true;\n\
+			// set only if nothing is filled, so that get does not fill again,\n\
+			// chars read in place leave it as it is\n\
+			bpeeked := (p = gend);\n\
 \n\
 			if p = gend then peek := END_OF_FILE\n\
 			else peek := integer(p^);\n\
@@ -1184,20 +1279,21 @@ type\n\
 	procedure strbuf_t.reset;\n\
 	begin\n\
 		gptr := pbase - 1;\n\
+		glim := gend;\n\
 		eos := false;\n\
 		inherited reset;\n\
 	end;\n\
 \n\
-	function strbuf_t.get: integer;\n\
+	function strbuf_t.xget: integer;\n\
 	begin\n\
 		if gptr = gend then begin\n\
 			eos := true;\n\
-			get := END_OF_ALLFILE;\n\
+			xget := END_OF_ALLFILE;\n\
 		end\n\
 		else begin\n\
 			gptr := gptr + 1;\n\
-			if gptr = gend then get := END_OF_FILE\n\
-			else get := integer(gptr^);\n\
+			if gptr = gend then xget := END_OF_FILE\n\
+			else xget := integer(gptr^);\n\
 		end;\n\
 	end;\n\
 \n\
@@ -1275,7 +1371,7 @@ type\n\
 \n\
 	function bufmgr_t.get: integer;\n\
 	begin\n\
-		if phead <> nil then get := phead^.pxbuf.get\n\
+		if xtop <> nil then get := xtop.get\n\
 		else get:= END_OF_ALLFILE;\n\
 	end;\n\
 \n\
@@ -1317,7 +1413,7 @@ type\n\
 \n\
 	function bufmgr_t.isimod: boolean;\n\
 	begin\n\
-		if phead <> nil then isimod := phead^.pxbuf.isimod\n\
+		if xtop <> nil then isimod := xtop.isimod\n\
 		else isimod := false;\n\
 	end;\n\
 \n\
@@ -1444,6 +1540,7 @@ type\n\
 \n\
 		p^.plink := phead;\n\
 		phead := p;\n\
+		xtop := pbuf;\n\
 	end;\n\
 \n\
 	function bufmgr_t.pop: YYPBUFFER;\n\
@@ -1458,6 +1555,8 @@ type\n\
 		p := phead;\n\
 		pop := p^.pxbuf;\n\
 		phead := phead^.plink;\n\
+		if phead <> nil then xtop := phead^.pxbuf\n\
+		else xtop := nil;\n\
 		dispose(p);\n\
 	end;\n\
 \n\
@@ -1493,6 +1592,7 @@ type\n\
 		end;\n\
 \n\
 		phead := nil;\n\
+		xtop := nil;\n\
 	end;\n\
 \n\
 	function bufmgr_t.rmwork(pxb: YYPBUFFER): plink_t;\n\
@@ -1801,11 +1901,35 @@ const \n\
 		yylex_is_running__ := (yyecode__ = YYE_ALIVE);\n\
 	end;\n\
 	\n\
-	function ]]><$YY \"parser_t\"/><![[.yyget_lexrule__(s: integer): integer;\n\
+	function ]]><$YY \"parser_t\"/><![[.yyget_lexrule__(s: integer): integer;]]><If Has\?\"LexDFAFull\"><If LexFullPremul><![[\n\
+	{ states are offsets of their rows in full transition table }\n\
 	begin\n\
-		yyget_lexrule__ := yydaccpt[s];\n\
+		yyget_lexrule__ := yydfull[s + LEX_FULL_ACCEPT] + LEX_ERROR_RULE;\n\
 	end;\n\
 	function ]]><$YY \"parser_t\"/><![[.yynext_lexstate__(s, c: integer): integer;\n\
+	begin\n\
+		yynext_lexstate__ := yydfull[s + yydcmap[c]];\n\
+	end;\n\
+]]></If><Else><![[\n\
+	begin\n\
+		yyget_lexrule__ := yydfull[s * LEX_FULL_STRIDE + LEX_FULL_ACCEPT] + LEX_ERROR_RULE;\n\
+	end;\n\
+	function ]]><$YY \"parser_t\"/><![[.yynext_lexstate__(s, c: integer): integer;\n\
+	begin\n\
+		yynext_lexstate__ := yydfull[s * LEX_FULL_STRIDE + yydcmap[c]];\n\
+	end;\n\
+]]></Else></If><Else><![[\n\
+	begin\n\
+		yyget_lexrule__ := yydaccpt[s];\n\
+	end;\n\
+	function ]]><$YY \"parser_t\"/><![[.yynext_lexstate__(s, c: integer): integer;]]><If LexDirectCode><![[\n\
+	begin\n\
+		{ each state is a branch, its transitions are branches of labels }\n\
+		yynext_lexstate__ := LEX_ERROR_STATE;\n\
+		case s of]]><$LexDirectStates \"LexDirectStates\"/><![[\n\
+		end;\n\
+	end;\n\
+]]></If><Else><![[\n\
 	var\n\
 		d: integer;\n\
 	begin\n\
@@ -1822,7 +1946,7 @@ const \n\
 		else\n\
 			yynext_lexstate__ := yydnxt[ yydbase[s] + d];\n\
 	end;\n\
-	\n\
+]]></Else></Else><![[	\n\
 ]]>\n\
 </If>\n\
 <If EnableParser><![[\n\
@@ -1851,8 +1975,9 @@ const \n\
 	var\n\
 		r: integer;\n\
 	begin\n\
-		r := yyget_prule__(yyparv[s]);\n\
-		if (yyparn[s] = 0) and is_valid_prule__(r) then\n\
+		]]><If ParseRowMerge><![[r := yyget_prule__(yypdefact[s]);\n\
+		if (yypabase[s] = PARSE_DEFONLY_BASE) and is_valid_prule__(r) then]]></If><Else><![[r := yyget_prule__(yyparv[s]);\n\
+		if (yyparn[s] = 0) and is_valid_prule__(r) then]]></Else><![[\n\
 			yyget_defrule := r\n\
 		else\n\
 			yyget_defrule := PERROR_RULE;\n\
@@ -1883,7 +2008,28 @@ const \n\
 		end;]]>\n\
 	</If><![[	\n\
 	end;\n\
+	]]><If ParseRowMerge><![[\n\
+	function ]]><$YY \"parser_t\"/><![[.yynext_pstate__(s, t: integer): integer;\n\
+	var\n\
+		i: integer;\n\
+	begin\n\
+		i := yypabase[s] + t;\n\
+		if yypachk[i] = t then\n\
+			yynext_pstate__ := yypact[i]\n\
+		else\n\
+			yynext_pstate__ := yypdefact[s];\n\
+	end;\n\
 	\n\
+	function ]]><$YY \"parser_t\"/><![[.yynext_goto__(s, t: integer): integer;\n\
+	var\n\
+		i: integer;\n\
+	begin\n\
+		i := yypgbase[t] + s;\n\
+		if yypgchk[i] = s then\n\
+			yynext_goto__ := yypgoto[i]\n\
+		else\n\
+			yynext_goto__ := yypdefgoto[t];\n\
+	end;]]></If><Else><![[\n\
 	function ]]><$YY \"parser_t\"/><![[.yynext_pstate__(s, t: integer): integer;\n\
 	begin\n\
 		if (yyvbmap[s * PARSE_BMAP_ROWSIZE + t div 8] and (1 shl (t mod 8))) <> 0 then\n\
@@ -1907,7 +2053,7 @@ const \n\
 			yynext_goto__ := yypcv[PARSE_TYPE_BASE + t]\n\
 		else\n\
 			yynext_goto__ := yypgoto[yypgbase[s] + t];\n\
-	end;\n\
+	end;]]></Else><![[\n\
 	\n\
 ]]>\n\
 </If><![[\n\
@@ -25,8 +25,8 @@
 namespace spec_ns {
 
 #define SPEC_NUM			2
-#define	CPP_SPEC_SIZE		64000
-#define PAS_SPEC_SIZE		71680
+#define	CPP_SPEC_SIZE		98304
+#define PAS_SPEC_SIZE		81920
 
 // array of language SPEC names
 extern const char* sn_ppchSPECName[SPEC_NUM + 1];